@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, section, uleb128, vec  # noqa: E402
+
+
+PHASES = ["file_load", "parse", "dependency_check", "validation", "initialize_runtime", "translate", "wasi_setup"]
+
+PHASE_RE = re.compile(r"timing phase=(\w+) total_ns=(\d+) count=(\d+) bytes=(\d+)")
+SUMMARY_RE = re.compile(r"timing summary modules=(\d+) phases_ns=(\d+) startup_ns=(\d+)")
+ANSI_RE = re.compile(r"\x1b\[[0-9;]*m")
+
+
+def make_module(*, func_count: int, body_size: int, export_start: bool) -> bytes:
+    """
+    Build a module with `func_count` functions of type [] -> [].
+    Every body is `body_size` bytes of `i32.const 0; drop` pairs followed by `end`,
+    which keeps the parse, validation and translation work proportional to the module size.
+    """
+    func_type = b"\x60\x00\x00"
+    pairs = max(body_size // 3, 0)
+    expr = b"\x41\x00\x1a" * pairs + b"\x0b"
+    body = b"\x00" + expr  # no local declarations
+    code_entry = uleb128(len(body)) + body
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([func_type]))
+    module += section(3, vec([uleb128(0)] * func_count))
+    if export_start:
+        module += section(7, vec([name("_start") + b"\x00" + uleb128(0)]))
+    module += section(10, uleb128(func_count) + code_entry * func_count)
+    return bytes(module)
+
+
+def parse_report(text: str) -> dict[str, int]:
+    result: dict[str, int] = {}
+    text = ANSI_RE.sub("", text)
+    for m in PHASE_RE.finditer(text):
+        result[f"{m.group(1)}_ns"] = int(m.group(2))
+        result[f"{m.group(1)}_count"] = int(m.group(3))
+        result[f"{m.group(1)}_bytes"] = int(m.group(4))
+    m = SUMMARY_RE.search(text)
+    if m is not None:
+        result["modules"] = int(m.group(1))
+        result["phases_ns"] = int(m.group(2))
+        result["startup_ns"] = int(m.group(3))
+    return result
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("STARTUP_BENCH_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    repeat = int(os.environ.get("STARTUP_BENCH_REPEAT", "5"))
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    # (scenario, function count, body bytes, preloaded module count)
+    scenarios = [
+        ("tiny", 1, 3, 0),
+        ("small", 256, 64, 0),
+        ("medium", 4096, 256, 0),
+        ("large", 16384, 1024, 0),
+        ("preload4", 4096, 256, 4),
+        ("preload16", 1024, 256, 16),
+    ]
+    only = os.environ.get("STARTUP_BENCH_SCENARIOS")
+    if only:
+        wanted = set(only.split(","))
+        scenarios = [s for s in scenarios if s[0] in wanted]
+
+    result_path = output_dir / "startup.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for scenario, func_count, body_size, preload_count in scenarios:
+            main_path = data_dir / f"{scenario}.main.wasm"
+            main_path.write_bytes(make_module(func_count=func_count, body_size=body_size, export_start=True))
+
+            argv = [str(uwvm), "--timing-report", *extra_args]
+            total_bytes = main_path.stat().st_size
+            for i in range(preload_count):
+                lib_path = data_dir / f"{scenario}.lib{i}.wasm"
+                lib_path.write_bytes(make_module(func_count=func_count, body_size=body_size, export_start=False))
+                total_bytes += lib_path.stat().st_size
+                argv += ["--wasm-preload-library", str(lib_path), f"lib{i}"]
+            argv += ["--run", str(main_path)]
+
+            print(">> " + " ".join(shlex.quote(x) for x in argv))
+
+            samples: list[dict[str, int]] = []
+            for _ in range(repeat):
+                proc = subprocess.run(argv, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, check=False)
+                report = parse_report(proc.stdout.decode("utf-8", errors="replace"))
+                if proc.returncode != 0 or "startup_ns" not in report:
+                    print(proc.stdout.decode("utf-8", errors="replace"))
+                    raise SystemExit(f"uwvm failed for scenario {scenario} (exit {proc.returncode})")
+                samples.append(report)
+
+            line = [f"uwvm2_startup scenario={scenario}", f"modules={preload_count + 1}", f"bytes={total_bytes}"]
+            for key in ["startup_ns", "phases_ns"] + [f"{p}_ns" for p in PHASES]:
+                line.append(f"{key}={int(statistics.median(s.get(key, 0) for s in samples))}")
+            text = " ".join(line)
+            print(text)
+            result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import shutil
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+def make_module(*, trees: int, fanout: int, rounds: int) -> bytes:
+    """
+    Build a module whose static call graph is `trees` independent two-level trees.
+    Function 0 is `_start` and calls every root; each root calls its `fanout` leaves.
+    Every root and leaf is an `(i32) -> i32` add/mul chain of `rounds` steps with distinct constants.
+    """
+    start_type = b"\x60\x00\x00"
+    work_type = b"\x60\x01\x7f\x01\x7f"
+
+    def work_expr(seed: int, callees: list[int]) -> bytes:
+        expr = bytearray(b"\x20\x00")
+        for r in range(rounds):
+            expr += b"\x41" + sleb128(seed * 131 + r * 7 + 3) + b"\x6a"
+            expr += b"\x41" + sleb128((seed * 17 + r) | 1) + b"\x6c"
+        for callee in callees:
+            expr += b"\x10" + uleb128(callee)
+        return bytes(expr) + b"\x0b"
+
+    bodies: list[bytes] = []
+    start = bytearray()
+    next_index = 1
+    tree_layout: list[tuple[int, list[int]]] = []
+    for _ in range(trees):
+        root = next_index
+        leaves = list(range(root + 1, root + 1 + fanout))
+        next_index = root + 1 + fanout
+        tree_layout.append((root, leaves))
+        start += b"\x41\x00\x10" + uleb128(root) + b"\x1a"
+    bodies.append(b"\x00" + bytes(start) + b"\x0b")
+    for root, leaves in tree_layout:
+        bodies.append(b"\x00" + work_expr(root, leaves))
+        for leaf in leaves:
+            bodies.append(b"\x00" + work_expr(leaf, []))
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([start_type, work_type]))
+    module += section(3, vec([uleb128(0)] + [uleb128(1)] * (len(bodies) - 1)))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(0)]))
+    module += section(10, vec([uleb128(len(body)) + body for body in bodies]))
+    return bytes(module)
+
+
+def count_files(path: Path) -> int:
+    return sum(1 for p in path.rglob("*") if p.is_file()) if path.exists() else 0
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("LAZY_JIT_BENCH_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    repeat = int(os.environ.get("LAZY_JIT_BENCH_REPEAT", "5"))
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    # (scenario, trees, leaves per root, add/mul rounds per function)
+    scenarios = [
+        ("small", 16, 3, 32),
+        ("medium", 128, 7, 64),
+        ("large", 512, 7, 64),
+    ]
+    only = os.environ.get("LAZY_JIT_BENCH_SCENARIOS")
+    if only:
+        wanted = set(only.split(","))
+        scenarios = [s for s in scenarios if s[0] in wanted]
+
+    result_path = output_dir / "lazy_jit_cache.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for scenario, trees, fanout, rounds in scenarios:
+            wasm_path = data_dir / f"{scenario}.wasm"
+            wasm_path.write_bytes(make_module(trees=trees, fanout=fanout, rounds=rounds))
+            functions = 1 + trees * (1 + fanout)
+
+            base = [str(uwvm), "--runtime-jit", *extra_args]
+            run_args = ["--run", str(wasm_path)]
+            nocache_argv = base + ["--runtime-llvm-jit-cache-path", "disable"] + run_args
+            print(">> " + " ".join(shlex.quote(x) for x in nocache_argv))
+
+            nocache: list[int] = []
+            cold: list[int] = []
+            warm: list[int] = []
+            objects = 0
+            for i in range(repeat):
+                cache_dir = data_dir / f"{scenario}.cache{i}"
+                shutil.rmtree(cache_dir, ignore_errors=True)
+                cache_argv = base + ["--runtime-llvm-jit-cache-path", "path", str(cache_dir)] + run_args
+
+                nocache.append(run_once(nocache_argv))
+                cold.append(run_once(cache_argv))
+                objects = count_files(cache_dir)
+                warm.append(run_once(cache_argv))
+                shutil.rmtree(cache_dir, ignore_errors=True)
+
+            text = (
+                f"uwvm2_lazy_jit_cache scenario={scenario} functions={functions} cache_files={objects} "
+                f"nocache_ns={int(statistics.median(nocache))} cold_ns={int(statistics.median(cold))} "
+                f"warm_ns={int(statistics.median(warm))}"
+            )
+            print(text)
+            result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
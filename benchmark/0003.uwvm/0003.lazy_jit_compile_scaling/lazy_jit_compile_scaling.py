@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+def make_module(*, functions: int, rounds: int) -> bytes:
+    """
+    Build a module where function 0 is `_start` and calls each of `functions` workers once.
+    Every worker is an `(i32) -> i32` add/mul/xor chain of `rounds` steps with distinct constants.
+    """
+    start_type = b"\x60\x00\x00"
+    work_type = b"\x60\x01\x7f\x01\x7f"
+
+    start = bytearray()
+    for i in range(functions):
+        start += b"\x41" + sleb128(i) + b"\x10" + uleb128(i + 1) + b"\x1a"
+    bodies = [b"\x00" + bytes(start) + b"\x0b"]
+
+    for i in range(functions):
+        expr = bytearray(b"\x00\x20\x00")
+        for r in range(rounds):
+            seed = i * rounds + r
+            expr += b"\x41" + sleb128(seed * 7 + 3) + b"\x6a"
+            expr += b"\x41" + sleb128((seed * 13) | 1) + b"\x6c"
+            expr += b"\x20\x00\x73"
+        bodies.append(bytes(expr) + b"\x0b")
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([start_type, work_type]))
+    module += section(3, vec([uleb128(0)] + [uleb128(1)] * functions))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(0)]))
+    module += section(10, vec([uleb128(len(body)) + body for body in bodies]))
+    return bytes(module)
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("LAZY_JIT_SCALING_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    repeat = int(os.environ.get("LAZY_JIT_SCALING_REPEAT", "5"))
+    functions = int(os.environ.get("LAZY_JIT_SCALING_FUNCTIONS", "512"))
+    rounds = int(os.environ.get("LAZY_JIT_SCALING_ROUNDS", "96"))
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    cpus = os.cpu_count() or 1
+    threads_env = os.environ.get("LAZY_JIT_SCALING_THREADS")
+    if threads_env:
+        thread_counts = [int(x) for x in threads_env.split(",")]
+    else:
+        thread_counts = [t for t in (0, 1, 2, 4, 8) if t == 0 or t < cpus]
+
+    wasm_path = data_dir / f"scaling_{functions}x{rounds}.wasm"
+    wasm_path.write_bytes(make_module(functions=functions, rounds=rounds))
+
+    result_path = output_dir / "lazy_jit_compile_scaling.txt"
+    baseline_ns: int | None = None
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for threads in thread_counts:
+            argv = [
+                str(uwvm),
+                "--runtime-jit",
+                "--runtime-llvm-jit-cache-path",
+                "disable",
+                "--runtime-compile-threads",
+                str(threads),
+                *extra_args,
+                "--run",
+                str(wasm_path),
+            ]
+            print(">> " + " ".join(shlex.quote(x) for x in argv))
+
+            wall_ns = int(statistics.median(run_once(argv) for _ in range(repeat)))
+            if baseline_ns is None:
+                baseline_ns = wall_ns
+            text = (
+                f"uwvm2_lazy_jit_compile_scaling functions={functions} compile_threads={threads} wall_ns={wall_ns} "
+                f"functions_per_s={functions * 1e9 / wall_ns:.1f} speedup={baseline_ns / wall_ns:.3f}"
+            )
+            print(text)
+            result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
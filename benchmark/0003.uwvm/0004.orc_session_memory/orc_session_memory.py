@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, section, sleb128, uleb128, vec  # noqa: E402
+
+
+def make_module(*, functions: int) -> bytes:
+    """
+    Build a module where function 0 is `_start` and calls each of `functions` tiny `(i32) -> i32` leaves once.
+    Leaves call nothing, so every leaf outside `_start`'s cluster is linked as an object of its own.
+    """
+    start_type = b"\x60\x00\x00"
+    leaf_type = b"\x60\x01\x7f\x01\x7f"
+
+    start = bytearray()
+    for i in range(functions):
+        start += b"\x41" + sleb128(i) + b"\x10" + uleb128(i + 1) + b"\x1a"
+    bodies = [b"\x00" + bytes(start) + b"\x0b"]
+
+    for i in range(functions):
+        bodies.append(b"\x00\x20\x00\x41" + sleb128(i * 7 + 3) + b"\x6a\x0b")
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([start_type, leaf_type]))
+    module += section(3, vec([uleb128(0)] + [uleb128(1)] * functions))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(0)]))
+    module += section(10, vec([uleb128(len(body)) + body for body in bodies]))
+    return bytes(module)
+
+
+def run_once(argv: list[str]) -> tuple[int, int]:
+    """Returns wall time in ns and the child's peak RSS in KiB."""
+    start = time.perf_counter_ns()
+    proc = subprocess.Popen(argv, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = proc.stdout.read() if proc.stdout else b""
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter_ns() - start
+    proc.returncode = exit_code = os.waitstatus_to_exitcode(status)
+    if exit_code != 0:
+        print(output.decode("utf-8", errors="replace"))
+        raise SystemExit(f"uwvm failed (exit {exit_code}): {' '.join(argv)}")
+    return elapsed, usage.ru_maxrss
+
+
+def read_counters(log_text: str, line_tag: str) -> dict[str, int]:
+    lines = [line for line in log_text.splitlines() if line_tag in line]
+    if not lines:
+        return {}
+    return {key: int(value) for key, value in re.findall(r"(\w+)=(\d+)", lines[-1])}
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("ORC_SESSION_MEMORY_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    repeat = int(os.environ.get("ORC_SESSION_MEMORY_REPEAT", "5"))
+    function_counts = [int(x) for x in os.environ.get("ORC_SESSION_MEMORY_FUNCTIONS", "256,1024,4096").split(",")]
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    result_path = output_dir / "orc_session_memory.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for functions in function_counts:
+            wasm_path = data_dir / f"leaves_{functions}.wasm"
+            wasm_path.write_bytes(make_module(functions=functions))
+            log_path = data_dir / f"leaves_{functions}.log"
+
+            # Demand compilation only: one object per leaf, linked on the thread running `_start`.
+            argv = [
+                str(uwvm),
+                "--runtime-jit",
+                "--runtime-llvm-jit-cache-path",
+                "disable",
+                "--runtime-compile-threads",
+                "0",
+                "-Rclog",
+                "file",
+                str(log_path),
+                *extra_args,
+                "--run",
+                str(wasm_path),
+            ]
+            print(">> " + " ".join(shlex.quote(x) for x in argv))
+
+            samples = [run_once(argv) for _ in range(repeat)]
+            wall_ns = int(statistics.median(sample[0] for sample in samples))
+            maxrss_kib = int(statistics.median(sample[1] for sample in samples))
+
+            log_text = log_path.read_text(encoding="utf-8", errors="replace")
+            session = read_counters(log_text, "orc-session ")
+            arena = read_counters(log_text, "code-arena ")
+            objects = session.get("objects_linked", 0)
+            exec_bytes = session.get("exec_bytes", 0)
+            text = (
+                f"uwvm2_orc_session_memory functions={functions} objects={objects} exec_bytes={exec_bytes} "
+                f"exec_bytes_per_object={exec_bytes // objects if objects else 0} "
+                f"private_data_bytes={session.get('private_data_bytes', 0)} shared_data_bytes={session.get('shared_data_bytes', 0)} "
+                f"shared_data_chunk_bytes={session.get('shared_data_chunk_bytes', 0)} arena_code_bytes={arena.get('code_bytes', 0)} "
+                f"arena_data_bytes={arena.get('data_bytes', 0)} maxrss_kib={maxrss_kib} wall_ns={wall_ns}"
+            )
+            print(text)
+            result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import re
+import shlex
+import shutil
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+def make_module(*, functions: int, rounds: int, iterations: int) -> bytes:
+    """
+    Build a module where function 0 is `_start` and runs `iterations` passes over `functions` distinct `(i32) -> i32`
+    add/mul/xor chains, so the hot path keeps jumping between many separately linked code blocks.
+    """
+    start_type = b"\x60\x00\x00"
+    leaf_type = b"\x60\x01\x7f\x01\x7f"
+
+    # locals: 0 = pass counter, 1 = accumulator
+    start = bytearray(b"\x01\x02\x7f\x03\x40")
+    for i in range(functions):
+        start += b"\x20\x01\x10" + uleb128(i + 1) + b"\x21\x01"
+    start += b"\x20\x00\x41\x01\x6a\x22\x00\x41" + sleb128(iterations) + b"\x49\x0d\x00\x0b"
+    bodies = [bytes(start) + b"\x0b"]
+
+    for i in range(functions):
+        body = bytearray(b"\x00\x20\x00")
+        for r in range(rounds):
+            body += b"\x41" + sleb128(i * 131 + r * 7 + 3) + b"\x6a\x41" + sleb128(((i * 17 + r) * 2) | 1) + b"\x6c\x20\x00\x73"
+        bodies.append(bytes(body) + b"\x0b")
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([start_type, leaf_type]))
+    module += section(3, vec([uleb128(0)] + [uleb128(1)] * functions))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(0)]))
+    module += section(10, vec([uleb128(len(body)) + body for body in bodies]))
+    return bytes(module)
+
+
+def read_perf_counters(path: Path) -> dict[str, int]:
+    """Parses `perf stat -x,` output; unsupported events read as -1."""
+    counters: dict[str, int] = {}
+    for line in path.read_text(encoding="utf-8", errors="replace").splitlines():
+        fields = line.split(",")
+        if len(fields) < 3 or not fields[2]:
+            continue
+        event = fields[2].split(":")[0]
+        counters[event] = int(fields[0]) if fields[0].isdigit() else -1
+    return counters
+
+
+def read_syscall_counts(path: Path) -> dict[str, int]:
+    """Parses the `strace -c` summary table."""
+    counts: dict[str, int] = {}
+    for line in path.read_text(encoding="utf-8", errors="replace").splitlines():
+        fields = line.split()
+        if len(fields) >= 5 and fields[-1] in ("mmap", "munmap", "mprotect", "madvise"):
+            counts[fields[-1]] = int(fields[3])
+    return counts
+
+
+def read_counters(log_text: str, line_tag: str) -> dict[str, str]:
+    lines = [line for line in log_text.splitlines() if line_tag in line]
+    if not lines:
+        return {}
+    return dict(re.findall(r"(\w+)=(\w+)", lines[-1]))
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("CODE_ARENA_ITLB_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    binaries = [("arena", find_uwvm(root_dir))]
+    baseline = os.environ.get("UWVM_BASELINE_BIN")
+    if baseline:
+        binaries.append(("baseline", Path(baseline).expanduser().resolve()))
+
+    functions = int(os.environ.get("CODE_ARENA_ITLB_FUNCTIONS", "4096"))
+    rounds = int(os.environ.get("CODE_ARENA_ITLB_ROUNDS", "16"))
+    iterations = int(os.environ.get("CODE_ARENA_ITLB_ITERATIONS", "2000"))
+    repeat = int(os.environ.get("CODE_ARENA_ITLB_REPEAT", "5"))
+    modes = [x for x in os.environ.get("CODE_ARENA_ITLB_MODES", "jit,tiered").split(",") if x]
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    mode_args = {"jit": ["--runtime-jit"], "tiered": ["-Rtiered"], "full": ["-Rcm", "full", "-Rcc", "jit"]}
+    perf = shutil.which("perf")
+    strace = shutil.which("strace")
+    if not perf:
+        print("perf not found: iTLB columns read -1")
+    if not strace:
+        print("strace not found: syscall columns read -1")
+
+    wasm_path = data_dir / f"chains_{functions}.wasm"
+    wasm_path.write_bytes(make_module(functions=functions, rounds=rounds, iterations=iterations))
+
+    result_path = output_dir / "code_arena_itlb.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for label, uwvm in binaries:
+            for mode in modes:
+                stem = f"{label}_{mode}"
+                log_path = data_dir / f"{stem}.log"
+                argv = [
+                    str(uwvm),
+                    *mode_args[mode],
+                    "--runtime-llvm-jit-cache-path",
+                    "disable",
+                    "-Rclog",
+                    "file",
+                    str(log_path),
+                    *extra_args,
+                    "--run",
+                    str(wasm_path),
+                ]
+                print(">> " + " ".join(shlex.quote(x) for x in argv))
+
+                wall_ns = int(statistics.median(run_once(argv) for _ in range(repeat)))
+
+                itlb: dict[str, int] = {}
+                if perf:
+                    perf_path = data_dir / f"{stem}.perf"
+                    events = "iTLB-load-misses,iTLB-loads,instructions"
+                    run_once([perf, "stat", "-x,", "-e", events, "-o", str(perf_path), "--", *argv])
+                    itlb = read_perf_counters(perf_path)
+
+                syscalls: dict[str, int] = {}
+                if strace:
+                    strace_path = data_dir / f"{stem}.strace"
+                    run_once([strace, "-f", "-c", "-e", "trace=mmap,munmap,mprotect,madvise", "-o", str(strace_path), *argv])
+                    syscalls = read_syscall_counts(strace_path)
+
+                arena = read_counters(log_path.read_text(encoding="utf-8", errors="replace"), "code-arena ")
+                text = (
+                    f"uwvm2_code_arena_itlb binary={label} mode={mode} functions={functions} "
+                    f"itlb_misses={itlb.get('iTLB-load-misses', -1)} itlb_loads={itlb.get('iTLB-loads', -1)} "
+                    f"instructions={itlb.get('instructions', -1)} mmap={syscalls.get('mmap', -1 if not strace else 0)} "
+                    f"munmap={syscalls.get('munmap', -1 if not strace else 0)} mprotect={syscalls.get('mprotect', -1 if not strace else 0)} "
+                    f"huge_pages={arena.get('huge_pages', 'none')} wall_ns={wall_ns}"
+                )
+                print(text)
+                result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+def make_module(*, calls: int) -> bytes:
+    """
+    Build a module whose `_start` calls the imported WASI `args_sizes_get` `calls` times in a loop. Every call leaves JIT code
+    through a host thunk that resolves the caller module from its storage address.
+    """
+    wasi_type = b"\x60\x02\x7f\x7f\x01\x7f"
+    start_type = b"\x60\x00\x00"
+
+    body = bytearray(b"\x01\x01\x7f\x03\x40")
+    body += b"\x41\x00\x41\x08\x10\x00\x1a"
+    body += b"\x20\x00\x41\x01\x6a\x22\x00\x41" + sleb128(calls) + b"\x49\x0d\x00\x0b\x0b"
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([wasi_type, start_type]))
+    module += section(2, vec([name("wasi_snapshot_preview1") + name("args_sizes_get") + b"\x00\x00"]))
+    module += section(3, vec([uleb128(1)]))
+    module += section(5, vec([b"\x00\x01"]))
+    module += section(7, vec([name("_start") + b"\x00\x01", name("memory") + b"\x02\x00"]))
+    module += section(10, vec([uleb128(len(body)) + bytes(body)]))
+    return bytes(module)
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("HOST_BRIDGE_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    calls = int(os.environ.get("HOST_BRIDGE_CALLS", "4000000"))
+    repeat = int(os.environ.get("HOST_BRIDGE_REPEAT", "5"))
+    preload_counts = [int(x) for x in os.environ.get("HOST_BRIDGE_PRELOADS", "0,16,96").split(",")]
+    modes = [x for x in os.environ.get("HOST_BRIDGE_MODES", "jit,full").split(",") if x]
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+    mode_args = {"jit": ["-Rjit"], "full": ["-Rcm", "full", "-Rcc", "jit"], "tiered": ["-Rtiered"]}
+
+    # The short run pays the same startup and compilation, so the difference is the cost of the extra calls alone.
+    (data_dir / "long_run.wasm").write_bytes(make_module(calls=calls))
+    (data_dir / "short_run.wasm").write_bytes(make_module(calls=1))
+    empty_module = b"\x00asm\x01\x00\x00\x00"
+    for i in range(max(preload_counts, default=0)):
+        (data_dir / f"pad{i}.wasm").write_bytes(empty_module)
+
+    result_path = output_dir / "host_bridge_call_cost.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for mode in modes:
+            lone_ns = None
+            for preloads in preload_counts:
+                timings = {}
+                for run in ("long_run", "short_run"):
+                    # Preloaded modules are passed by relative name so the command line stays short.
+                    argv = [str(uwvm), *mode_args[mode], "--runtime-llvm-jit-cache-path", "disable", *extra_args]
+                    for i in range(preloads):
+                        argv += ["--wasm-preload-library", f"pad{i}.wasm", f"pad{i}"]
+                    argv += ["--run", f"{run}.wasm"]
+                    if run == "long_run":
+                        print(f">> (preloads={preloads}) " + " ".join(shlex.quote(x) for x in argv[:4]) + " ... --run long_run.wasm")
+                    timings[run] = int(statistics.median(run_once(argv, data_dir) for _ in range(repeat)))
+
+                ns_per_call = max(timings["long_run"] - timings["short_run"], 0) / max(calls - 1, 1)
+                if lone_ns is None:
+                    lone_ns = ns_per_call
+                text = (
+                    f"uwvm2_host_bridge_call_cost mode={mode} preloads={preloads} calls={calls} long_ns={timings['long_run']} "
+                    f"short_ns={timings['short_run']} ns_per_call={ns_per_call:.2f} "
+                    f"ratio_vs_lone={ns_per_call / lone_ns if lone_ns else 0.0:.2f}"
+                )
+                print(text)
+                result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
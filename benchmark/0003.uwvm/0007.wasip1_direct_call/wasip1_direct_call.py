@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+# Each benchmarked import: its WASI type and the argument pushes in front of the call. Results land in scratch memory at 0.
+IMPORTS = {
+    "args_sizes_get": (b"\x60\x02\x7f\x7f\x01\x7f", b"\x41\x00\x41\x08"),
+    "clock_time_get": (b"\x60\x03\x7f\x7e\x7f\x01\x7f", b"\x41\x01\x42\x01\x41\x10"),
+}
+
+
+def make_module(*, function: str, calls: int) -> bytes:
+    """
+    Build a module whose `_start` calls the imported WASI `function` `calls` times in a loop and drops the errno. With direct
+    calls enabled every call site is bound to a typed thunk; with them disabled it goes through the raw host bridge.
+    """
+    wasi_type, push_args = IMPORTS[function]
+    start_type = b"\x60\x00\x00"
+
+    body = bytearray(b"\x01\x01\x7f\x03\x40")
+    body += push_args + b"\x10\x00\x1a"
+    body += b"\x20\x00\x41\x01\x6a\x22\x00\x41" + sleb128(calls) + b"\x49\x0d\x00\x0b\x0b"
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([wasi_type, start_type]))
+    module += section(2, vec([name("wasi_snapshot_preview1") + name(function) + b"\x00\x00"]))
+    module += section(3, vec([uleb128(1)]))
+    module += section(5, vec([b"\x00\x01"]))
+    module += section(7, vec([name("_start") + b"\x00\x01", name("memory") + b"\x02\x00"]))
+    module += section(10, vec([uleb128(len(body)) + bytes(body)]))
+    return bytes(module)
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("WASIP1_DIRECT_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    calls = int(os.environ.get("WASIP1_DIRECT_CALLS", "4000000"))
+    repeat = int(os.environ.get("WASIP1_DIRECT_REPEAT", "5"))
+    functions = [x for x in os.environ.get("WASIP1_DIRECT_FUNCTIONS", "args_sizes_get,clock_time_get").split(",") if x]
+    modes = [x for x in os.environ.get("WASIP1_DIRECT_MODES", "jit,full").split(",") if x]
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+    mode_args = {"jit": ["-Rjit"], "full": ["-Rcm", "full", "-Rcc", "jit"], "tiered": ["-Rtiered"]}
+    path_args = {"direct": [], "raw": ["--runtime-llvm-jit-disable-wasip1-direct-call"]}
+
+    # The short run pays the same startup and compilation, so the difference is the cost of the extra calls alone.
+    for function in functions:
+        (data_dir / f"{function}.long.wasm").write_bytes(make_module(function=function, calls=calls))
+        (data_dir / f"{function}.short.wasm").write_bytes(make_module(function=function, calls=1))
+
+    result_path = output_dir / "wasip1_direct_call.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for mode in modes:
+            for function in functions:
+                ns_per_call = {}
+                for path in ("raw", "direct"):
+                    timings = {}
+                    for run in ("long", "short"):
+                        argv = [str(uwvm), *mode_args[mode], *path_args[path], "--runtime-llvm-jit-cache-path", "disable", *extra_args]
+                        argv += ["--run", f"{function}.{run}.wasm"]
+                        if run == "long":
+                            print(">> " + " ".join(shlex.quote(x) for x in argv))
+                        timings[run] = int(statistics.median(run_once(argv, data_dir) for _ in range(repeat)))
+
+                    ns_per_call[path] = max(timings["long"] - timings["short"], 0) / max(calls - 1, 1)
+                    text = (
+                        f"uwvm2_wasip1_direct_call mode={mode} function={function} path={path} calls={calls} long_ns={timings['long']} "
+                        f"short_ns={timings['short']} ns_per_call={ns_per_call[path]:.2f}"
+                    )
+                    print(text)
+                    result_file.write(text + "\n")
+
+                speedup = ns_per_call["raw"] / ns_per_call["direct"] if ns_per_call["direct"] else 0.0
+                text = f"uwvm2_wasip1_direct_call_summary mode={mode} function={function} speedup={speedup:.2f}"
+                print(text)
+                result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, section, sleb128, uleb128, vec  # noqa: E402
+
+
+WORKERS = 48
+ROUNDS = 24
+MASK = 0xFFFFFFFF
+
+
+def worker_add(worker: int, rnd: int) -> int:
+    return (worker * 131 + rnd * 7 + 3) & MASK
+
+
+def worker_mul(worker: int, rnd: int) -> int:
+    return ((worker * 17 + rnd) * 2 | 1) & MASK
+
+
+def signed32(value: int) -> int:
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def expected_accumulator(iterations: int) -> int:
+    acc = 0
+    for i in range(iterations):
+        for worker in range(WORKERS):
+            x = acc ^ i if worker == 0 else acc
+            v = x
+            for rnd in range(ROUNDS):
+                v = (((v + worker_add(worker, rnd)) & MASK) * worker_mul(worker, rnd) & MASK) ^ x
+            acc = v
+    return acc
+
+
+def make_module(*, iterations: int) -> bytes:
+    """
+    Build the module of `test/0013.uwvm_int/lazy/uwvm_int_lazy_hot_tier.cc`: `WORKERS` distinct loop-free `(i32) -> i32` workers
+    chained `iterations` times from `_start`, which traps unless the accumulator matches the host model. Loop-free workers start on
+    the baseline tier and are promoted once they cross the hot-tier threshold.
+    """
+    worker_type = b"\x60\x01\x7f\x01\x7f"
+    start_type = b"\x60\x00\x00"
+
+    bodies = []
+    for worker in range(WORKERS):
+        body = bytearray(b"\x00\x20\x00")
+        for rnd in range(ROUNDS):
+            body += b"\x41" + sleb128(signed32(worker_add(worker, rnd))) + b"\x6a"
+            body += b"\x41" + sleb128(signed32(worker_mul(worker, rnd))) + b"\x6c\x20\x00\x73"
+        body += b"\x0b"
+        bodies.append(uleb128(len(body)) + bytes(body))
+
+    # locals: 0 = i, 1 = acc
+    body = bytearray(b"\x01\x02\x7f\x03\x40")
+    for worker in range(WORKERS):
+        body += b"\x20\x01"
+        if worker == 0:
+            body += b"\x20\x00\x73"
+        body += b"\x10" + uleb128(worker) + b"\x21\x01"
+    body += b"\x20\x00\x41\x01\x6a\x22\x00\x41" + sleb128(signed32(iterations)) + b"\x49\x0d\x00\x0b"
+    body += b"\x20\x01\x41" + sleb128(signed32(expected_accumulator(iterations))) + b"\x47\x04\x40\x00\x0b\x0b"
+    bodies.append(uleb128(len(body)) + bytes(body))
+
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([worker_type, start_type]))
+    module += section(3, vec([b"\x00"] * WORKERS + [b"\x01"]))
+    module += section(5, vec([b"\x00\x01"]))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(WORKERS), name("memory") + b"\x02\x00"]))
+    module += section(10, vec(bodies))
+    return bytes(module)
+
+
+def read_counter(log: str, key: str) -> int:
+    pos = log.rfind(key + "=")
+    if pos < 0:
+        return 0
+    digits = ""
+    for ch in log[pos + len(key) + 1 :]:
+        if not ch.isdigit():
+            break
+        digits += ch
+    return int(digits or "0")
+
+
+def run_once(argv: list[str], cwd: Path) -> tuple[int, str]:
+    with tempfile.TemporaryDirectory() as tmp:
+        log_path = Path(tmp) / "runtime.log"
+        full_argv = [*argv[:-2], "-Rclog", "file", str(log_path), *argv[-2:]]
+        start = time.perf_counter_ns()
+        proc = subprocess.run(full_argv, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, check=False)
+        elapsed = time.perf_counter_ns() - start
+        if proc.returncode != 0:
+            print(proc.stdout.decode("utf-8", errors="replace"))
+            raise SystemExit(f"uwvm failed (exit {proc.returncode}): {' '.join(full_argv)}")
+        log = log_path.read_text(encoding="utf-8", errors="replace") if log_path.exists() else ""
+    return elapsed, log
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("HOT_TIER_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    repeat = int(os.environ.get("HOT_TIER_REPEAT", "5"))
+    thresholds = [int(x) for x in os.environ.get("HOT_TIER_THRESHOLDS", "0,1,256").split(",")]
+    runs = {"startup": 1, "steady": int(os.environ.get("HOT_TIER_ITERATIONS", "20000"))}
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    for run, iterations in runs.items():
+        (data_dir / f"{run}.wasm").write_bytes(make_module(iterations=iterations))
+
+    result_path = output_dir / "uwvm_int_hot_tier.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        single_tier_ns = {}
+        for threshold in thresholds:
+            for run, iterations in runs.items():
+                argv = [str(uwvm), "-Rcm", "lazy", "-Rcc", "int", "-Rint-hot-tier", str(threshold), *extra_args, "--run", f"{run}.wasm"]
+                print(">> " + " ".join(shlex.quote(x) for x in argv))
+                samples = [run_once(argv, data_dir) for _ in range(repeat)]
+                wall_ns = int(statistics.median(elapsed for elapsed, _ in samples))
+                promotions = read_counter(samples[-1][1], "hot_tier_promotions")
+                if threshold == 0:
+                    single_tier_ns[run] = wall_ns
+                baseline = single_tier_ns.get(run)
+                text = (
+                    f"uwvm2_uwvm_int_hot_tier threshold={threshold} run={run} iterations={iterations} wall_ns={wall_ns} "
+                    f"hot_tier_promotions={promotions} ratio_vs_single_tier={wall_ns / baseline if baseline else 0.0:.2f}"
+                )
+                print(text)
+                result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
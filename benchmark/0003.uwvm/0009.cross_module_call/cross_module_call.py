@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import statistics
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+from uwvm_bench_common import find_uwvm, name, run_once, section, sleb128, uleb128, vec  # noqa: E402
+
+
+LEAF_TYPE = b"\x60\x01\x7f\x01\x7f"
+START_TYPE = b"\x60\x00\x00"
+# `x * 3 + 1`: small enough that the call itself dominates.
+LEAF_BODY = b"\x00\x20\x00\x41\x03\x6c\x41\x01\x6a\x0b"
+
+
+def make_lib() -> bytes:
+    """Build the preloaded module `lib`, which exports the `(i32) -> i32` leaf the caller imports."""
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([LEAF_TYPE]))
+    module += section(3, vec([uleb128(0)]))
+    module += section(7, vec([name("leaf") + b"\x00\x00"]))
+    module += section(10, vec([uleb128(len(LEAF_BODY)) + LEAF_BODY]))
+    return bytes(module)
+
+
+def make_main(*, calls: int, same_module: bool) -> bytes:
+    """
+    Build a module whose `_start` threads an accumulator through the leaf `calls` times and stores it to memory. The leaf is the
+    import `lib.leaf` unless `same_module` is set, in which case it is defined in this module as the same-module reference.
+    """
+    leaf_index = 1 if same_module else 0
+    body = bytearray(b"\x01\x02\x7f\x03\x40")
+    body += b"\x20\x01\x20\x00\x73\x10" + uleb128(leaf_index) + b"\x21\x01"
+    body += b"\x20\x00\x41\x01\x6a\x22\x00\x41" + sleb128(calls) + b"\x49\x0d\x00\x0b"
+    body += b"\x41\x00\x20\x01\x36\x02\x00\x0b"
+
+    start_index = 0 if same_module else 1
+    module = bytearray(b"\x00asm\x01\x00\x00\x00")
+    module += section(1, vec([LEAF_TYPE, START_TYPE]))
+    if not same_module:
+        module += section(2, vec([name("lib") + name("leaf") + b"\x00\x00"]))
+    module += section(3, vec([uleb128(1), uleb128(0)] if same_module else [uleb128(1)]))
+    module += section(5, vec([b"\x00\x01"]))
+    module += section(7, vec([name("_start") + b"\x00" + uleb128(start_index), name("memory") + b"\x02\x00"]))
+    codes = [uleb128(len(body)) + bytes(body)]
+    if same_module:
+        codes.append(uleb128(len(LEAF_BODY)) + LEAF_BODY)
+    module += section(10, vec(codes))
+    return bytes(module)
+
+
+def main() -> int:
+    script_dir = Path(__file__).resolve().parent
+    root_dir = script_dir.parents[2]
+    output_dir = Path(os.environ.get("CROSS_MODULE_OUTPUT_DIR", script_dir / "outputs")).resolve()
+    data_dir = output_dir / "data"
+    data_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = find_uwvm(root_dir)
+    calls = int(os.environ.get("CROSS_MODULE_CALLS", "20000000"))
+    repeat = int(os.environ.get("CROSS_MODULE_REPEAT", "5"))
+    modes = [x for x in os.environ.get("CROSS_MODULE_MODES", "int,full").split(",") if x]
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+    mode_args = {"int": ["-Rcm", "full", "-Rcc", "int"], "full": ["-Rcm", "full", "-Rcc", "jit"]}
+    # `bridge` is the marshaling path every cross-module call took before direct linking; `same` calls a local copy of the leaf.
+    path_args = {
+        "bridge": ["--runtime-disable-cross-module-direct-call", "--wasm-preload-library", "lib.wasm", "lib"],
+        "direct": ["--wasm-preload-library", "lib.wasm", "lib"],
+        "same": [],
+    }
+
+    # The short run pays the same startup and compilation, so the difference is the cost of the extra calls alone.
+    (data_dir / "lib.wasm").write_bytes(make_lib())
+    for run, run_calls in (("long", calls), ("short", 1)):
+        (data_dir / f"cross.{run}.wasm").write_bytes(make_main(calls=run_calls, same_module=False))
+        (data_dir / f"same.{run}.wasm").write_bytes(make_main(calls=run_calls, same_module=True))
+
+    result_path = output_dir / "cross_module_call.txt"
+    with open(result_path, "w", encoding="utf-8") as result_file:
+        for mode in modes:
+            ns_per_call = {}
+            for path in ("bridge", "direct", "same"):
+                layout = "same" if path == "same" else "cross"
+                timings = {}
+                for run in ("long", "short"):
+                    argv = [str(uwvm), *mode_args[mode], *path_args[path], "--runtime-llvm-jit-cache-path", "disable", *extra_args]
+                    argv += ["--run", f"{layout}.{run}.wasm"]
+                    if run == "long":
+                        print(">> " + " ".join(shlex.quote(x) for x in argv))
+                    timings[run] = int(statistics.median(run_once(argv, data_dir) for _ in range(repeat)))
+
+                ns_per_call[path] = max(timings["long"] - timings["short"], 0) / max(calls - 1, 1)
+                text = (
+                    f"uwvm2_cross_module_call mode={mode} path={path} calls={calls} long_ns={timings['long']} "
+                    f"short_ns={timings['short']} ns_per_call={ns_per_call[path]:.2f}"
+                )
+                print(text)
+                result_file.write(text + "\n")
+
+            speedup = ns_per_call["bridge"] / ns_per_call["direct"] if ns_per_call["direct"] else 0.0
+            ratio_vs_same = ns_per_call["direct"] / ns_per_call["same"] if ns_per_call["same"] else 0.0
+            text = f"uwvm2_cross_module_call_summary mode={mode} speedup={speedup:.2f} direct_vs_same={ratio_vs_same:.2f}"
+            print(text)
+            result_file.write(text + "\n")
+
+    print(f"==> Results written to {result_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
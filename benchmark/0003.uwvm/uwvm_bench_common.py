@@ -0,0 +1,76 @@
+"""Helpers shared by the benchmark drivers under benchmark/0003.uwvm.
+
+Each driver puts this directory on ``sys.path`` and imports what it needs:
+
+    sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+    from uwvm_bench_common import find_uwvm, run_once, section, uleb128, vec
+
+The wasm encoders emit the raw binary format, so drivers can generate their modules without wabt.
+"""
+from __future__ import annotations
+
+import os
+import shutil
+import subprocess
+import time
+from pathlib import Path
+
+
+def uleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def sleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        done = (value == 0 and not byte & 0x40) or (value == -1 and byte & 0x40)
+        out.append(byte if done else byte | 0x80)
+        if done:
+            return bytes(out)
+
+
+def name(text: str) -> bytes:
+    raw = text.encode("utf-8")
+    return uleb128(len(raw)) + raw
+
+
+def section(section_id: int, payload: bytes) -> bytes:
+    return bytes([section_id]) + uleb128(len(payload)) + payload
+
+
+def vec(items: list[bytes]) -> bytes:
+    return uleb128(len(items)) + b"".join(items)
+
+
+def find_uwvm(root: Path) -> Path:
+    env_bin = os.environ.get("UWVM_BIN")
+    if env_bin:
+        return Path(env_bin).expanduser().resolve()
+    found = shutil.which("uwvm")
+    if found:
+        return Path(found).resolve()
+    for candidate in sorted(root.glob("build/**/uwvm")):
+        if candidate.is_file() and os.access(candidate, os.X_OK):
+            return candidate.resolve()
+    raise SystemExit("uwvm binary not found: set UWVM_BIN or build the project with xmake first")
+
+
+def run_once(argv: list[str], cwd: Path | None = None) -> int:
+    """Runs ``argv`` to completion and returns its wall time in ns; a non-zero exit prints the output and aborts."""
+    start = time.perf_counter_ns()
+    proc = subprocess.run(argv, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, check=False)
+    elapsed = time.perf_counter_ns() - start
+    if proc.returncode != 0:
+        print(proc.stdout.decode("utf-8", errors="replace"))
+        raise SystemExit(f"{Path(argv[0]).name} failed (exit {proc.returncode}): {' '.join(argv)}")
+    return elapsed
@@ -423,6 +423,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     sleep_duration.seconds = static_cast<decltype(sleep_duration.seconds)>(seconds_part);
                     sleep_duration.subseconds = static_cast<decltype(sleep_duration.subseconds)>(subseconds_part);
 
+                    // SIGPROF stays pending until the sleep ends; `sleep_for` does not resume after a signal.
+                    [[maybe_unused]] ::uwvm2::imported::wasi::wasip1::func::posix::sigprof_wait_mask_guard const sigprof_mask{true};
                     ::fast_io::this_thread::sleep_for(sleep_duration);
                 }
             }
@@ -495,6 +497,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     sleep_duration.seconds = static_cast<decltype(sleep_duration.seconds)>(seconds_part);
                     sleep_duration.subseconds = static_cast<decltype(sleep_duration.subseconds)>(subseconds_part);
 
+                    // SIGPROF stays pending until the sleep ends; `sleep_for` does not resume after a signal.
+                    [[maybe_unused]] ::uwvm2::imported::wasi::wasip1::func::posix::sigprof_wait_mask_guard const sigprof_mask{true};
                     ::fast_io::this_thread::sleep_for(sleep_duration);
                 }
             }
@@ -2229,12 +2233,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
             int const max_events{static_cast<int>(events.size())};
 
-            int const ready{::uwvm2::imported::wasi::wasip1::func::posix::kevent(kq,
-                                                                                 change_list.empty() ? nullptr : change_list.data(),
-                                                                                 static_cast<int>(change_list.size()),
-                                                                                 events.data(),
-                                                                                 max_events,
-                                                                                 timeout_ptr)};
+            int ready;  // no initialize
+            {
+                // A profiling tick would otherwise end a blocking wait with EINTR.
+                bool const may_block{timeout_ptr == nullptr || ts_timeout.tv_sec != 0 || ts_timeout.tv_nsec != 0};
+                [[maybe_unused]] ::uwvm2::imported::wasi::wasip1::func::posix::sigprof_wait_mask_guard const sigprof_mask{may_block};
+                ready = ::uwvm2::imported::wasi::wasip1::func::posix::kevent(kq,
+                                                                             change_list.empty() ? nullptr : change_list.data(),
+                                                                             static_cast<int>(change_list.size()),
+                                                                             events.data(),
+                                                                             max_events,
+                                                                             timeout_ptr);
+            }
 
             if(ready == -1) [[unlikely]]
             {
@@ -3352,7 +3362,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 return ::uwvm2::imported::wasi::wasip1::abi::errno_t::eoverflow;
             }
 
-            int const ready{::uwvm2::imported::wasi::wasip1::func::posix::poll(poll_fds.data(), static_cast<::nfds_t>(poll_fds.size()), timeout_ms)};
+            int ready;  // no initialize
+            {
+                // A profiling tick would otherwise end a blocking wait with EINTR.
+                [[maybe_unused]] ::uwvm2::imported::wasi::wasip1::func::posix::sigprof_wait_mask_guard const sigprof_mask{timeout_ms != 0};
+                ready = ::uwvm2::imported::wasi::wasip1::func::posix::poll(poll_fds.data(), static_cast<::nfds_t>(poll_fds.size()), timeout_ms);
+            }
 
             if(ready == -1) [[unlikely]]
             {
@@ -3898,8 +3913,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
             int nfds{max_fd + 1};
 
-            int const ready{
-                ::uwvm2::imported::wasi::wasip1::func::posix::select(nfds, ::std::addressof(readfds), ::std::addressof(writefds), nullptr, timeout_ptr)};
+            int ready;  // no initialize
+            {
+                // A profiling tick would otherwise end a blocking wait with EINTR.
+                bool const may_block{timeout_ptr == nullptr || tv_timeout.tv_sec != 0 || tv_timeout.tv_usec != 0};
+                [[maybe_unused]] ::uwvm2::imported::wasi::wasip1::func::posix::sigprof_wait_mask_guard const sigprof_mask{may_block};
+                ready = ::uwvm2::imported::wasi::wasip1::func::posix::select(nfds, ::std::addressof(readfds), ::std::addressof(writefds), nullptr, timeout_ptr);
+            }
 
             if(ready == -1) [[unlikely]]
             {
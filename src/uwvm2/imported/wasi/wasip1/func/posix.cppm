@@ -53,6 +53,7 @@ module;
 #  include <sys/select.h>
 # endif
 # if !(defined(__MSDOS__) || defined(__DJGPP__))
+#  include <signal.h>
 #  include <sys/socket.h>
 # else
 #  include <utime.h>
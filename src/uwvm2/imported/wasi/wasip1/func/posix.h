@@ -54,6 +54,7 @@
 #   include <sys/select.h>
 #  endif
 #  if !(defined(__MSDOS__) || defined(__DJGPP__))
+#   include <signal.h>
 #   include <sys/socket.h>
 #  else
 #   include <utime.h>
@@ -317,6 +318,50 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             __asm__("_raise")
 # endif
                 ;
+
+# if !(defined(__MSDOS__) || defined(__DJGPP__)) && defined(SIGPROF)
+        /// @brief Blocks SIGPROF on the calling thread while a WASI call waits.
+        /// @details `poll`, `select`, `kevent` and `nanosleep` are not restarted by `SA_RESTART`, so the profiler's ITIMER_PROF tick
+        ///          (`--runtime-profile-sample`) would otherwise end the wait early with EINTR. A tick that arrives meanwhile stays
+        ///          pending and is taken right after the wait. Waits that cannot block (zero timeout) skip the two mask syscalls.
+        struct sigprof_wait_mask_guard
+        {
+            ::sigset_t old_mask{};
+            bool masked{};
+
+            inline explicit sigprof_wait_mask_guard(bool may_block) noexcept
+            {
+                if(!may_block) { return; }
+                ::sigset_t block_mask;  // no initialize
+                ::sigemptyset(::std::addressof(block_mask));
+                ::sigaddset(::std::addressof(block_mask), SIGPROF);
+                this->masked = ::pthread_sigmask(SIG_BLOCK, ::std::addressof(block_mask), ::std::addressof(this->old_mask)) == 0;
+            }
+
+            inline sigprof_wait_mask_guard(sigprof_wait_mask_guard const&) = delete;
+            inline sigprof_wait_mask_guard& operator= (sigprof_wait_mask_guard const&) = delete;
+
+            inline ~sigprof_wait_mask_guard()
+            {
+                // pthread_sigmask reports failure through its result and leaves errno alone, so the wait's errno survives.
+                if(this->masked) { ::pthread_sigmask(SIG_SETMASK, ::std::addressof(this->old_mask), nullptr); }
+            }
+        };
+# else
+        struct sigprof_wait_mask_guard
+        {
+            inline explicit constexpr sigprof_wait_mask_guard(bool) noexcept {}
+        };
+# endif
+    }  // namespace posix
+#else
+    namespace posix
+    {
+        // No POSIX signals here, so no profiling tick can interrupt a WASI wait.
+        struct sigprof_wait_mask_guard
+        {
+            inline explicit constexpr sigprof_wait_mask_guard(bool) noexcept {}
+        };
     }  // namespace posix
 #endif
 
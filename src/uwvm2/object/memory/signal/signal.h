@@ -123,6 +123,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
     ///             expected to be terminal; the dispatcher terminates immediately after invoking it.
     using mmap_memory_out_of_bounds_func_t = void (*)(::uwvm2::object::memory::error::mmap_memory_error_t const&) noexcept;
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && defined(UWVM_USE_THREAD_LOCAL)
+    /// @brief      Callback type invoked when a thread runs into the guard region of its registered guest stack.
+    /// @details    Runs on the thread's alternate signal stack because the faulting stack is exhausted. It is expected to be
+    ///             terminal, exactly like mmap_memory_out_of_bounds_func_t.
+    using guest_stack_overflow_func_t = void (*)(::std::uintptr_t instruction_address, ::std::uintptr_t frame_address, ::std::uintptr_t stack_pointer) noexcept;
+# endif
+
     namespace detail
     {
         /// @brief  Global registry of protected mmap-backed memory intervals.
@@ -133,6 +140,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
         /// @brief  Optional process-wide hook for translating mmap memory faults to a runtime-specific action.
         inline mmap_memory_out_of_bounds_func_t mmap_memory_out_of_bounds_func{};  // [global]
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && defined(UWVM_USE_THREAD_LOCAL)
+        /// @brief      Guard region below the guest stack of the current thread.
+        /// @details    Thread-local because every thread owns its own guest stack. The fault handler runs on the faulting thread, so
+        ///             it reads this without synchronization.
+        struct guest_stack_guard_t
+        {
+            ::std::byte const* begin{};
+            ::std::byte const* end{};
+        };
+
+        inline thread_local guest_stack_guard_t guest_stack_guard{};  // [global] [thread_local]
+
+        /// @brief  Optional process-wide hook for translating guest stack overflows to a runtime-specific action.
+        inline guest_stack_overflow_func_t guest_stack_overflow_func{};  // [global]
+# endif
+
         /// @brief      Previous platform handlers saved when UWVM installs its own fault handler.
         /// @details    The signal layer only consumes faults that belong to registered protected segments.
         ///             Unrelated process faults are forwarded to the saved handlers when possible.
@@ -577,6 +600,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
 
             if(handle_fault_address(fault_addr, instruction_address, frame_address, stack_pointer)) { return; }
 
+#  if defined(UWVM_USE_THREAD_LOCAL)
+            // A fault in the guard region below the current thread's guest stack is a wasm call-stack exhaustion. This handler is
+            // already running on the alternate signal stack (SA_ONSTACK), so the report can still be printed.
+            if(auto const& guard{guest_stack_guard}; fault_addr != nullptr && guard.begin <= fault_addr && fault_addr < guard.end)
+            {
+                if(auto const handler{guest_stack_overflow_func}; handler != nullptr) [[likely]] { handler(instruction_address, frame_address, stack_pointer); }
+                ::fast_io::fast_terminate();
+            }
+#  endif
+
             if(signal == SIGSEGV && signal_handlers.has_previous_sigsegv)
             {
                 dispatch_previous_handler(signal, siginfo, context, signal_handlers.previous_sigsegv);
@@ -608,7 +641,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
             struct ::sigaction act{};
             act.sa_sigaction = posix_signal_handler;
             sigemptyset(::std::addressof(act.sa_mask));
-            act.sa_flags = SA_SIGINFO;
+            // SA_ONSTACK only matters on threads that installed an alternate signal stack (guest stacks do); a stack overflow can only
+            // be reported from there.
+            act.sa_flags = SA_SIGINFO | SA_ONSTACK;
 
             if(posix::sigaction(SIGSEGV, ::std::addressof(act), ::std::addressof(signal_handlers.previous_sigsegv)) != 0) [[unlikely]]
             {
@@ -719,6 +754,26 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
     /// @note       Intended for whole-runtime teardown or reinitialization outside guest execution.
     inline constexpr void clear_protected_segments() noexcept { detail::segments.clear(); }
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && defined(UWVM_USE_THREAD_LOCAL)
+    /// @brief      Set the process-wide callback used for guest stack overflows.
+    /// @note       Like set_mmap_memory_out_of_bounds_handler, install it before guest execution begins.
+    inline constexpr void set_guest_stack_overflow_handler(guest_stack_overflow_func_t func) noexcept { detail::guest_stack_overflow_func = func; }
+
+    /// @brief      Register the inaccessible guard region below the calling thread's guest stack.
+    /// @param      begin First byte of the guard region.
+    /// @param      end   One-past-the-last byte of the guard region, i.e. the lowest usable stack byte.
+    /// @note       The calling thread must also have an alternate signal stack installed (`sigaltstack`); otherwise the kernel
+    ///             cannot deliver the fault and the process dies without a report.
+    inline constexpr void register_guest_stack_guard(::std::byte const* begin, ::std::byte const* end) noexcept
+    {
+        detail::install_signal_handler();
+        detail::guest_stack_guard = {begin, end};
+    }
+
+    /// @brief      Forget the calling thread's guest stack guard region.
+    inline constexpr void unregister_guest_stack_guard() noexcept { detail::guest_stack_guard = {}; }
+# endif
+
 }  // namespace uwvm2::object::memory::signal
 
 #endif
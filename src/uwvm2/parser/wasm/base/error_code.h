@@ -265,7 +265,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
         reference_types,
         sign_extension,
         nontrapping_float_to_int,
-        simd
+        simd,
+        tail_call
     };
 
     /// @brief WebAssembly 1.1 syntax/semantic site used by wasm1p1-specific diagnostics.
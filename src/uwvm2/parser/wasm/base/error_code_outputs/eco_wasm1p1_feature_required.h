@@ -76,6 +76,14 @@ constexpr auto get_wasm1p1_feature_name{[]<::std::integral char_type2>(::uwvm2::
                                                     else if constexpr(::std::same_as<char_type2, char16_t>) { return {u"simd"}; }
                                                     else if constexpr(::std::same_as<char_type2, char32_t>) { return {U"simd"}; }
                                                 }
+                                                case ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call:
+                                                {
+                                                    if constexpr(::std::same_as<char_type2, char>) { return {"tail-call"}; }
+                                                    else if constexpr(::std::same_as<char_type2, wchar_t>) { return {L"tail-call"}; }
+                                                    else if constexpr(::std::same_as<char_type2, char8_t>) { return {u8"tail-call"}; }
+                                                    else if constexpr(::std::same_as<char_type2, char16_t>) { return {u"tail-call"}; }
+                                                    else if constexpr(::std::same_as<char_type2, char32_t>) { return {U"tail-call"}; }
+                                                }
                                                 [[unlikely]] default:
                                                 {
             /// @warning Extension point: reaching "unknown" here usually means a new wasm1p1 feature flag lacks ECO output.
@@ -52,6 +52,7 @@ import fast_io;
 import uwvm2.utils.container;
 import uwvm2.utils.debug;
 import uwvm2.utils.intrinsics;
+import uwvm2.utils.thread;
 import uwvm2.parser.wasm.base;
 import uwvm2.parser.wasm.utils;
 import uwvm2.parser.wasm.concepts;
@@ -41,6 +41,7 @@
 # include <uwvm2/utils/container/impl.h>
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/utils/intrinsics/impl.h>
+# include <uwvm2/utils/thread/impl.h>
 # include <uwvm2/parser/wasm/base/impl.h>
 # include <uwvm2/parser/wasm/utils/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
@@ -110,6 +111,399 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         }
     }
 
+    namespace details::code_section_parse
+    {
+        /// @brief      Parse the local declarations of one code body whose boundaries (`code.body.code_begin`/`code_end`) are already checked.
+        /// @details    Fills `code.locals`, `code.all_local_count` and `code.body.expr_begin`, and checks the trailing `end`. Only `code`
+        ///             and `err` are written, so distinct code bodies can be parsed concurrently.
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void parse_code_body_locals(
+            ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> & code,
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 curr_code_parameter_size,
+            ::uwvm2::parser::wasm::base::error_impl & err,
+            [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
+        {
+            using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+            constexpr auto wasm_u32_max{::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max()};
+
+            // The boundary checks proved [code_begin, code_end) is inside the current section.
+            auto section_curr{reinterpret_cast<::std::byte const*>(code.body.code_begin)};
+            auto const code_end{reinterpret_cast<::std::byte const*>(code.body.code_end)};
+
+            // [ ... body_size ...] local_count(code_body_begin) ... ...] (code_body_end)
+            // [        safe      ]        .....                        ] unsafe (could be the section_end)
+            //                      ^^ section_curr                       ^^ code_end
+
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local_count;
+
+            auto const [local_count_next, local_count_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
+                                                                                    reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                    ::fast_io::mnp::leb128_get(local_count))};
+
+            if(local_count_err != ::fast_io::parse_code::ok) [[unlikely]]
+            {
+                err.err_curr = section_curr;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_local_count;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(local_count_err);
+            }
+
+            // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
+            // [                     safe                          ]   ......                                           ] unsafe
+            //                     ^^ section_curr
+
+            // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
+            if constexpr(size_t_max < wasm_u32_max)
+            {
+                // The size_t of current platforms is smaller than u32, in these platforms you need to do a size check before conversion
+                if(local_count > size_t_max) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_selectable.u64 = static_cast<::std::uint_least64_t>(local_count);
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+            }
+
+            if constexpr((::std::same_as<wasm1, Fs> || ...))
+            {
+                auto const& wasm1_feapara_r{::uwvm2::parser::wasm::concepts::get_curr_feature_parameter<wasm1>(fs_para)};
+                auto const& parser_limit{wasm1_feapara_r.parser_limit};
+                if(static_cast<::std::size_t>(local_count) > parser_limit.max_code_locals) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_selectable.exceed_the_max_parser_limit.name = u8"code_locals";
+                    err.err_selectable.exceed_the_max_parser_limit.value = static_cast<::std::size_t>(local_count);
+                    err.err_selectable.exceed_the_max_parser_limit.maxval = parser_limit.max_code_locals;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::exceed_the_max_parser_limit;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+            }
+
+            code.locals.reserve(static_cast<::std::size_t>(local_count));
+
+            // parse_by_scan succeeded, so [section_curr, local_count_next) is now proven safe and local_count_next is inside [section_curr, code_end].
+            // Proof view before moving section_curr: section_curr still points at the local count, and local_count_next marks the local declarations.
+            // Pointer move: advance section_curr to the first local declaration, or to the expression when the local vector is empty.
+            section_curr = reinterpret_cast<::std::byte const*>(local_count_next);
+
+            // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
+            // [                     safe                          ]   ......                                           ] unsafe
+            //                                                       ^^ section_curr
+
+            // The final list of local variables obtained by concatenating all groups must not exceed u32max.
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 all_clocal_counter{};
+
+            // The WASM specification requires that locally defined `local+parameter` values must not exceed `u32max`.
+            auto const max_local_defined_count{wasm_u32_max - curr_code_parameter_size};
+
+            // Undeterministic boundaries need to use quantity loops (No local_end)
+            for(::std::size_t local_counter{}; local_counter != local_count; ++local_counter)
+            {
+                ::uwvm2::parser::wasm::standard::wasm1::features::final_local_entry_t<Fs...> fle{};
+
+                // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
+                // [                     safe                          ]    ......                                          ] unsafe
+                //                                                       ^^ section_curr
+
+                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 clocal_n;
+
+                auto const [clocal_n_next, clocal_n_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
+                                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                  ::fast_io::mnp::leb128_get(clocal_n))};
+
+                if(clocal_n_err != ::fast_io::parse_code::ok) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_clocal_n;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(clocal_n_err);
+                }
+
+                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
+                // [                             safe                               ]    ......                             ] unsafe
+                //                                                      ^^ section_curr
+
+                // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
+                if constexpr(size_t_max < wasm_u32_max)
+                {
+                    // The size_t of current platforms is smaller than u32, in these platforms you need to do a size check before conversion
+                    if(clocal_n > size_t_max) [[unlikely]]
+                    {
+                        err.err_curr = section_curr;
+                        err.err_selectable.u64 = static_cast<::std::uint_least64_t>(clocal_n);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+                }
+
+                // The final list of local variables obtained by concatenating all groups must not exceed u32max.
+                if(clocal_n > max_local_defined_count - all_clocal_counter) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_selectable.u32 = curr_code_parameter_size;
+                    err.err_code =
+                        ::uwvm2::parser::wasm::base::wasm_parse_error_code::final_list_of_locals_exceeds_the_maximum_value_of_u32max_minus_parameter_size;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                all_clocal_counter += clocal_n;
+
+                fle.count = clocal_n;
+
+                // parse_by_scan succeeded, so [section_curr, clocal_n_next) is now proven safe and clocal_n_next is inside [section_curr, code_end].
+                // Proof view before moving section_curr: section_curr still points at the local run count, and clocal_n_next marks the local type.
+                // Pointer move: advance section_curr to the one-byte local type.
+                section_curr = reinterpret_cast<::std::byte const*>(clocal_n_next);
+
+                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
+                // [                             safe                               ]    ......                             ] unsafe
+                //                                                                    ^^ section_curr
+
+                if(section_curr == code_end) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_missing_local_type;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ... clocal_type] next_clocal_n ... code ...]
+                // [                                   safe                                     ]  ......                   ] unsafe
+                //                                                                   ^^ section_curr
+
+                ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...> fvt;
+
+                ::std::memcpy(::std::addressof(fvt), section_curr, sizeof(::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>));
+
+                // Size equal to one does not need to do little-endian conversion
+                static_assert(sizeof(fvt) == 1uz);
+
+                // check fvt
+                // section_curr != code_end above proves the one-byte local type read is inside the current code body.
+                // check_codesec_value_type only validates the byte value against the active feature parameters.
+                if(!check_codesec_value_type(sec_adl, fvt, fs_para)) [[unlikely]]
+                {
+                    err.err_curr = section_curr;
+                    err.err_selectable.u8 = static_cast<::std::uint_least8_t>(
+                        static_cast<::std::underlying_type_t<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>>>(fvt));
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                fle.type = fvt;
+
+                // section_curr points at the one-byte local type already proven safe by section_curr != code_end and validated above.
+                // Pointer move: advance to the next local declaration or the expression body.
+                ++section_curr;
+
+                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ... clocal_type] next_clocal_n ... code ...]
+                // [                                   safe                                     ] ......                    ] unsafe
+                //                                                                                ^^ section_curr
+
+                code.locals.push_back_unchecked(::std::move(fle));
+            }
+
+            code.all_local_count = all_clocal_counter;
+
+            // Pointer storage: expr_begin records the first byte after the checked local declaration sequence.
+            code.body.expr_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_curr);
+
+            // [ ...] [(expr_begin) ...] (code_end)
+            // [safe] [     safe       ] unsafe (could be the section_end)
+            //         ^^ section_curr
+
+            // minimum check end (0x0B)
+            // At least one byte, with the last byte being 0x0B.
+            if(section_curr == code_end) [[unlikely]]
+            {
+                // Equivalent to "static_cast<::std::size_t>(section_curr - code_end) < 1uz"
+                err.err_curr = section_curr;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::missing_code_body_end;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+
+            // [ ...] [(expr_begin) ...] [0x0B] (code_end)
+            // [safe] [   scope safe   ] [safe] unsafe (could be the section_end)
+            //         ^^ section_curr
+
+            auto const code_end_ptr{reinterpret_cast<::std::byte const*>(code_end) - 1u};
+
+            // [ ...] [(expr_begin) ...] [0x0B] (code_end)
+            // [safe] [   scope safe   ] [safe] unsafe (could be the section_end)
+            //                            ^^ code_end_ptr
+
+            if(*code_end_ptr != static_cast<::std::byte>(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic::end)) [[unlikely]]
+            {
+                err.err_curr = code_end_ptr;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::missing_code_body_end;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+        }
+
+        /// @brief      Cheap boundary scan of the code section: only the `body_size` prefixes are decoded.
+        /// @details    Pushes one code entry per body with `code.body.code_begin`/`code_end` set. Returns false on any malformed
+        ///             boundary or count; the caller then re-parses serially, which reports exactly the error a serial parse reports.
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr bool scan_code_body_boundaries(code_section_storage_t<Fs...> & codesec,
+                                                        ::std::byte const* section_curr,
+                                                        ::std::byte const* const section_end,
+                                                        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_count) noexcept
+        {
+            using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+            constexpr auto wasm_u32_max{::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max()};
+
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_counter{};
+
+            while(section_curr != section_end) [[likely]]
+            {
+                if(code_counter == code_count) [[unlikely]] { return false; }
+                ++code_counter;
+
+                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 body_size;
+
+                auto const [body_size_next, body_size_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
+                                                                                    reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
+                                                                                    ::fast_io::mnp::leb128_get(body_size))};
+
+                if(body_size_err != ::fast_io::parse_code::ok) [[unlikely]] { return false; }
+
+                if constexpr(size_t_max < wasm_u32_max)
+                {
+                    if(body_size > size_t_max) [[unlikely]] { return false; }
+                }
+
+                section_curr = reinterpret_cast<::std::byte const*>(body_size_next);
+
+                if(static_cast<::std::size_t>(section_end - section_curr) < static_cast<::std::size_t>(body_size)) [[unlikely]] { return false; }
+
+                ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> code{};
+
+                // The length check above proves [section_curr, section_curr + body_size) is inside the current section.
+                code.body.code_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_curr);
+                section_curr += body_size;
+                code.body.code_end = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_curr);
+
+                codesec.codes.push_back_unchecked(::std::move(code));
+            }
+
+            return code_counter == code_count;
+        }
+
+#ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+        /// @brief      A contiguous run of code bodies decoded by one task, together with the first error it met.
+        struct code_body_chunk_t
+        {
+            ::std::size_t begin{};
+            ::std::size_t end{};
+            ::uwvm2::parser::wasm::base::error_impl err{};
+            ::fast_io::error fault{};
+            bool failed{};
+        };
+
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline ::uwvm2::utils::thread::scheduled_task make_parse_code_chunk_task(
+            ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+            code_section_storage_t<Fs...> & codesec,
+            function_section_storage_t const& funcsec,
+            type_section_storage_t<Fs...> const& typesec,
+            code_body_chunk_t & chunk,
+            ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para)
+        {
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                for(auto code_index{chunk.begin}; code_index != chunk.end; ++code_index)
+                {
+                    auto const& curr_code_match_type{typesec.types.index_unchecked(funcsec.funcs.index_unchecked(code_index))};
+                    auto const curr_code_parameter_size{static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(
+                        static_cast<::std::size_t>(curr_code_match_type.parameter.end - curr_code_match_type.parameter.begin))};
+
+                    parse_code_body_locals(sec_adl, codesec.codes.index_unchecked(code_index), curr_code_parameter_size, chunk.err, fs_para);
+                }
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error e)
+            {
+                // Bodies are decoded in order inside a chunk, so this is the first error of the chunk.
+                chunk.fault = e;
+                chunk.failed = true;
+            }
+# endif
+
+            co_return;
+        }
+
+        /// @brief      Decode the local declarations of all scanned code bodies on a `native_thread_pool`.
+        /// @details    Errors are replayed from the lowest failing chunk, which is the error a serial parse would report first.
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline void parse_code_bodies_parallel(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+                                               code_section_storage_t<Fs...> & codesec,
+                                               function_section_storage_t const& funcsec,
+                                               type_section_storage_t<Fs...> const& typesec,
+                                               ::std::size_t chunk_byte_size,
+                                               ::std::size_t extra_worker_count,
+                                               ::uwvm2::parser::wasm::base::error_impl & err,
+                                               ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
+        {
+            // Split into runs of roughly `chunk_byte_size` body bytes, so one huge function does not serialize the rest.
+            ::uwvm2::utils::container::vector<code_body_chunk_t> chunks{};
+            {
+                auto const code_size{codesec.codes.size()};
+                ::std::size_t chunk_begin{};
+                ::std::size_t chunk_bytes{};
+                for(::std::size_t code_index{}; code_index != code_size; ++code_index)
+                {
+                    auto const& curr_code{codesec.codes.index_unchecked(code_index)};
+                    chunk_bytes += static_cast<::std::size_t>(curr_code.body.code_end - curr_code.body.code_begin);
+                    if(chunk_bytes >= chunk_byte_size || code_index + 1uz == code_size)
+                    {
+                        chunks.push_back({.begin = chunk_begin, .end = code_index + 1uz});
+                        chunk_begin = code_index + 1uz;
+                        chunk_bytes = 0uz;
+                    }
+                }
+            }
+
+            ::uwvm2::utils::thread::scheduled_task_batch task_batch{chunks.size()};
+            for(auto& chunk: chunks)
+            {
+                auto task{make_parse_code_chunk_task(sec_adl, codesec, funcsec, typesec, chunk, fs_para)};
+                ::std::construct_at(task_batch.handles.buffer + task_batch.handle_count, task.release());
+                ++task_batch.handle_count;
+            }
+
+            {
+                ::uwvm2::utils::thread::native_thread_pool thread_pool{};
+                thread_pool.run(task_batch, extra_worker_count);
+            }
+
+            for(auto const& chunk: chunks)
+            {
+                if(chunk.failed) [[unlikely]]
+                {
+                    err = chunk.err;
+# ifdef UWVM_CPP_EXCEPTIONS
+                    throw chunk.fault;
+# endif
+                }
+            }
+        }
+#endif
+    }  // namespace details::code_section_parse
+
+    /// @brief      Code sections of at least this many bytes are parsed in two phases: a serial boundary scan over the `body_size`
+    ///             prefixes, then concurrent decoding of the local declarations. Smaller sections are not worth starting threads for.
+    inline constexpr ::std::size_t code_section_parallel_parse_threshold{8uz * 1024uz * 1024uz};
+
+    /// @brief      Approximate number of code-body bytes decoded by one task in the parallel phase.
+    inline constexpr ::std::size_t code_section_parallel_parse_chunk_size{512uz * 1024uz};
+
     /// @brief Define the handler function for code_section
     template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
     inline constexpr void handle_binfmt_ver1_extensible_section_define(
@@ -216,6 +610,36 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         // [                 safe              ] unsafe (could be the section_end)
         //                                       ^^ section_curr
 
+#ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+        if(static_cast<::std::size_t>(section_end - section_curr) >= code_section_parallel_parse_threshold)
+        {
+            // Every body carries its byte size, so the boundaries are found without decoding the bodies; the local declarations are
+            // then decoded concurrently into the preallocated `codesec.codes` slots. The workers come from the shared budget, so a module
+            // parsed on the loader's pool only uses the threads the pool left idle, and parses serially when there are none.
+            auto const chunk_count{static_cast<::std::size_t>(section_end - section_curr) / code_section_parallel_parse_chunk_size + 1uz};
+            ::uwvm2::utils::thread::extra_worker_lease const lease{
+                ::uwvm2::utils::thread::clamp_extra_worker_count(chunk_count, ::uwvm2::utils::thread::hardware_concurrency() - 1uz)};
+            if(lease.count != 0uz)
+            {
+                if(details::code_section_parse::scan_code_body_boundaries(codesec, section_curr, section_end, code_count))
+                {
+                    details::code_section_parse::parse_code_bodies_parallel(sec_adl,
+                                                                            codesec,
+                                                                            funcsec,
+                                                                            typesec,
+                                                                            code_section_parallel_parse_chunk_size,
+                                                                            lease.count,
+                                                                            err,
+                                                                            fs_para);
+                    return;
+                }
+
+                // Malformed boundaries: discard the scan and let the serial parse below report the error at its exact position.
+                codesec.codes.clear();
+            }
+        }
+#endif
+
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_counter{};  // use for check
 
         while(section_curr != section_end) [[likely]]
@@ -321,212 +745,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             //                                                            ^^ code_end
             //                                                            ^^ code.body.code_end
 
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local_count;
-
-            auto const [local_count_next, local_count_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                                    reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
-                                                                                    ::fast_io::mnp::leb128_get(local_count))};
-
-            if(local_count_err != ::fast_io::parse_code::ok) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_local_count;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(local_count_err);
-            }
-
-            // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
-            // [                     safe                          ]   ......                                           ] unsafe
-            //                     ^^ section_curr
-
-            // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
-            if constexpr(size_t_max < wasm_u32_max)
-            {
-                // The size_t of current platforms is smaller than u32, in these platforms you need to do a size check before conversion
-                if(local_count > size_t_max) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_selectable.u64 = static_cast<::std::uint_least64_t>(local_count);
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                }
-            }
-
-            if constexpr((::std::same_as<wasm1, Fs> || ...))
-            {
-                auto const& wasm1_feapara_r{::uwvm2::parser::wasm::concepts::get_curr_feature_parameter<wasm1>(fs_para)};
-                auto const& parser_limit{wasm1_feapara_r.parser_limit};
-                if(static_cast<::std::size_t>(local_count) > parser_limit.max_code_locals) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_selectable.exceed_the_max_parser_limit.name = u8"code_locals";
-                    err.err_selectable.exceed_the_max_parser_limit.value = static_cast<::std::size_t>(local_count);
-                    err.err_selectable.exceed_the_max_parser_limit.maxval = parser_limit.max_code_locals;
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::exceed_the_max_parser_limit;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                }
-            }
-
-            code.locals.reserve(static_cast<::std::size_t>(local_count));
-
-            // parse_by_scan succeeded, so [section_curr, local_count_next) is now proven safe and local_count_next is inside [section_curr, code_end].
-            // Proof view before moving section_curr: section_curr still points at the local count, and local_count_next marks the local declarations.
-            // Pointer move: advance section_curr to the first local declaration, or to the expression when the local vector is empty.
-            section_curr = reinterpret_cast<::std::byte const*>(local_count_next);
-
-            // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
-            // [                     safe                          ]   ......                                           ] unsafe
-            //                                                       ^^ section_curr
-
-            // The final list of local variables obtained by concatenating all groups must not exceed u32max.
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 all_clocal_counter{};
-
             auto const curr_code_match_type_index{code_counter - 1u};
             auto const& curr_code_match_type{typesec.types.index_unchecked(funcsec.funcs.index_unchecked(curr_code_match_type_index))};
             auto const curr_code_parameter_size{static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(
                 static_cast<::std::size_t>(curr_code_match_type.parameter.end - curr_code_match_type.parameter.begin))};
-            // The WASM specification requires that locally defined `local+parameter` values must not exceed `u32max`.
-            auto const max_local_defined_count{wasm_u32_max - curr_code_parameter_size};
-
-            // Undeterministic boundaries need to use quantity loops (No local_end)
-            for(::std::size_t local_counter{}; local_counter != local_count; ++local_counter)
-            {
-                ::uwvm2::parser::wasm::standard::wasm1::features::final_local_entry_t<Fs...> fle{};
-
-                // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
-                // [                     safe                          ]    ......                                          ] unsafe
-                //                                                       ^^ section_curr
-
-                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 clocal_n;
 
-                auto const [clocal_n_next, clocal_n_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
-                                                                                  ::fast_io::mnp::leb128_get(clocal_n))};
-
-                if(clocal_n_err != ::fast_io::parse_code::ok) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_clocal_n;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(clocal_n_err);
-                }
-
-                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
-                // [                             safe                               ]    ......                             ] unsafe
-                //                                                      ^^ section_curr
-
-                // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
-                if constexpr(size_t_max < wasm_u32_max)
-                {
-                    // The size_t of current platforms is smaller than u32, in these platforms you need to do a size check before conversion
-                    if(clocal_n > size_t_max) [[unlikely]]
-                    {
-                        err.err_curr = section_curr;
-                        err.err_selectable.u64 = static_cast<::std::uint_least64_t>(clocal_n);
-                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
-                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                    }
-                }
-
-                // The final list of local variables obtained by concatenating all groups must not exceed u32max.
-                if(clocal_n > max_local_defined_count - all_clocal_counter) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_selectable.u32 = curr_code_parameter_size;
-                    err.err_code =
-                        ::uwvm2::parser::wasm::base::wasm_parse_error_code::final_list_of_locals_exceeds_the_maximum_value_of_u32max_minus_parameter_size;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                }
-
-                all_clocal_counter += clocal_n;
-
-                fle.count = clocal_n;
-
-                // parse_by_scan succeeded, so [section_curr, clocal_n_next) is now proven safe and clocal_n_next is inside [section_curr, code_end].
-                // Proof view before moving section_curr: section_curr still points at the local run count, and clocal_n_next marks the local type.
-                // Pointer move: advance section_curr to the one-byte local type.
-                section_curr = reinterpret_cast<::std::byte const*>(clocal_n_next);
-
-                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
-                // [                             safe                               ]    ......                             ] unsafe
-                //                                                                    ^^ section_curr
-
-                if(section_curr == code_end) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_missing_local_type;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                }
-
-                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ... clocal_type] next_clocal_n ... code ...]
-                // [                                   safe                                     ]  ......                   ] unsafe
-                //                                                                   ^^ section_curr
-
-                ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...> fvt;
-
-                ::std::memcpy(::std::addressof(fvt), section_curr, sizeof(::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>));
-
-                // Size equal to one does not need to do little-endian conversion
-                static_assert(sizeof(fvt) == 1uz);
-
-                // check fvt
-                // section_curr != code_end above proves the one-byte local type read is inside the current code body.
-                // check_codesec_value_type only validates the byte value against the active feature parameters.
-                if(!check_codesec_value_type(sec_adl, fvt, fs_para)) [[unlikely]]
-                {
-                    err.err_curr = section_curr;
-                    err.err_selectable.u8 = static_cast<::std::uint_least8_t>(
-                        static_cast<::std::underlying_type_t<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>>>(fvt));
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-                }
-
-                fle.type = fvt;
-
-                // section_curr points at the one-byte local type already proven safe by section_curr != code_end and validated above.
-                // Pointer move: advance to the next local declaration or the expression body.
-                ++section_curr;
-
-                // [ ... body_size ... local_count(code_body_begin) ... clocal_n ... clocal_type] next_clocal_n ... code ...]
-                // [                                   safe                                     ] ......                    ] unsafe
-                //                                                                                ^^ section_curr
-
-                code.locals.push_back_unchecked(::std::move(fle));
-            }
-
-            code.all_local_count = all_clocal_counter;
-
-            // Pointer storage: expr_begin records the first byte after the checked local declaration sequence.
-            code.body.expr_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_curr);
-
-            // [ ...] [(expr_begin) ...] (code_end)
-            // [safe] [     safe       ] unsafe (could be the section_end)
-            //         ^^ section_curr
-
-            // minimum check end (0x0B)
-            // At least one byte, with the last byte being 0x0B.
-            if(section_curr == code_end) [[unlikely]]
-            {
-                // Equivalent to "static_cast<::std::size_t>(section_curr - code_end) < 1uz"
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::missing_code_body_end;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
-
-            // [ ...] [(expr_begin) ...] [0x0B] (code_end)
-            // [safe] [   scope safe   ] [safe] unsafe (could be the section_end)
-            //         ^^ section_curr
-
-            auto const code_end_ptr{reinterpret_cast<::std::byte const*>(code_end) - 1u};
-
-            // [ ...] [(expr_begin) ...] [0x0B] (code_end)
-            // [safe] [   scope safe   ] [safe] unsafe (could be the section_end)
-            //                            ^^ code_end_ptr
-
-            if(*code_end_ptr != static_cast<::std::byte>(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic::end)) [[unlikely]]
-            {
-                err.err_curr = code_end_ptr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::missing_code_body_end;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
+            details::code_section_parse::parse_code_body_locals(sec_adl, code, curr_code_parameter_size, err, fs_para);
 
             // Parsing of the expression will be completed later.
 
@@ -59,6 +59,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1p1::features
         bool enable_sign_extension{};
         bool enable_nontrapping_float_to_int{};
         bool enable_simd{};
+        /// @brief Tail-call proposal (`return_call`/`return_call_indirect`). Not part of wasm1.1, so `--wasm-feature-1p1` leaves it off.
+        bool enable_tail_call{};
 
         bool explicit_feature_1p1{};
         bool explicit_enable_multi_value{};
@@ -67,6 +69,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1p1::features
         bool explicit_enable_sign_extension{};
         bool explicit_enable_nontrapping_float_to_int{};
         bool explicit_enable_simd{};
+        bool explicit_enable_tail_call{};
 
         wasm1p1_parser_limit_t parser_limit{};
 
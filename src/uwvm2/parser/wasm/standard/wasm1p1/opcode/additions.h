@@ -34,6 +34,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1p1::opcode
 {
     enum class op_basic : ::uwvm2::parser::wasm::standard::wasm1::type::op_basic_type
     {
+        // Control instructions (tail-call proposal)
+        return_call = 0x12,
+        return_call_indirect = 0x13,
+
         // Parametric instructions
         select_t = 0x1c,
 
@@ -136,6 +136,23 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::lib
                                                  ::std::size_t result_bytes,
                                                  void const* param_buffer,
                                                  ::std::size_t param_bytes) noexcept;
+
+    /// @brief Typed native entry for one WASI Preview1 local-imported function.
+    /// @note  `entry_address` is zero when the target has no direct entry. A non-zero entry uses the host C ABI with the signature
+    ///        `(uintptr_t caller_runtime_module, wasm params...) -> wasm result`.
+    struct llvm_jit_wasip1_direct_host_entry_t
+    {
+        ::std::uintptr_t entry_address{};
+        ::uwvm2::utils::container::u8string_view function_name{};
+        ::std::size_t parameter_count{};
+        ::std::size_t result_count{};
+    };
+
+    /// @brief Whether generated code may call WASI Preview1 imports through their typed entries; part of every codegen policy.
+    extern "C++" [[nodiscard]] bool llvm_jit_wasip1_direct_calls_enabled() noexcept;
+
+    extern "C++" [[nodiscard]] llvm_jit_wasip1_direct_host_entry_t llvm_jit_find_wasip1_direct_host_api(void const* local_imported_module_ptr,
+                                                                                                          ::std::size_t function_index) noexcept;
 }
 
 UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm
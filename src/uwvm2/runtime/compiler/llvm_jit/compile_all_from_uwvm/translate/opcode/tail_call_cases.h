@@ -0,0 +1,200 @@
+    // Tail-call validation cases (`return_call`, `return_call_indirect`) from the WebAssembly 1.1 tail-call proposal.
+    // The stack effect is `call` followed by `return`: the callee results must equal the function results, and the rest of
+    // the block becomes polymorphic.  Emission prefers LLVM `musttail` (see `try_emit_runtime_local_func_llvm_jit_return_call`).
+
+case static_cast<wasm1_code>(::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic::return_call): [[fallthrough]];
+case static_cast<wasm1_code>(::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic::return_call_indirect):
+{
+    // return_call(_indirect) immediates ...
+    // [      safe         ] unsafe (could be the section_end)
+    // ^^ code_curr
+
+    auto const op_begin{code_curr};
+    bool const is_indirect{curr_opbase == static_cast<wasm1_code>(::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic::return_call_indirect)};
+    ::uwvm2::utils::container::u8string_view const op_name{is_indirect ? u8"return_call_indirect" : u8"return_call"};
+
+    ++code_curr;
+
+    // The LLVM translator has no per-module feature parameter; tail calls follow the process-wide command-line switch.
+    if(!::uwvm2::parser::wasm::standard::wasm1p1::features::get_wasm1p1_parameter(::uwvm2::uwvm::wasm::storage::wasm_parameter.binfmt1_para)
+            .enable_tail_call) [[unlikely]]
+    {
+        err.err_curr = op_begin;
+        err.err_selectable.wasm1p1_feature_required.value = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(curr_opbase);
+        err.err_selectable.wasm1p1_feature_required.feature = ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call;
+        err.err_selectable.wasm1p1_feature_required.subject = ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction;
+        err.err_code = ::uwvm2::validation::error::code_validation_error_code::wasm1p1_feature_required;
+        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+    }
+
+    using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+    ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const* callee_type_ptr{};
+    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 callee_index{};
+    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 table_index{};
+
+    auto const read_u32{[&](::uwvm2::validation::error::code_validation_error_code encoding_err) constexpr UWVM_THROWS
+                            -> ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32
+                        {
+                            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 value;  // No initialization necessary
+                            auto const [next, parse_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(code_curr),
+                                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                  ::fast_io::mnp::leb128_get(value))};
+                            if(parse_err != ::fast_io::parse_code::ok) [[unlikely]]
+                            {
+                                err.err_curr = op_begin;
+                                err.err_code = encoding_err;
+                                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(parse_err);
+                            }
+                            code_curr = reinterpret_cast<::std::byte const*>(next);
+                            return value;
+                        }};
+
+    if(is_indirect)
+    {
+        callee_index = read_u32(::uwvm2::validation::error::code_validation_error_code::invalid_type_index);
+        table_index = read_u32(::uwvm2::validation::error::code_validation_error_code::invalid_table_index);
+
+        auto const all_type_count_uz{typesec.types.size()};
+        if(static_cast<::std::size_t>(callee_index) >= all_type_count_uz) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.illegal_type_index.type_index = callee_index;
+            err.err_selectable.illegal_type_index.all_type_count = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(all_type_count_uz);
+            err.err_code = ::uwvm2::validation::error::code_validation_error_code::illegal_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        if(table_index >= all_table_count) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.illegal_table_index.table_index = table_index;
+            err.err_selectable.illegal_table_index.all_table_count = all_table_count;
+            err.err_code = ::uwvm2::validation::error::code_validation_error_code::illegal_table_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        callee_type_ptr = typesec.types.cbegin() + static_cast<::std::size_t>(callee_index);
+    }
+    else
+    {
+        callee_index = read_u32(::uwvm2::validation::error::code_validation_error_code::invalid_function_index_encoding);
+
+        auto const all_function_size{import_func_count + local_func_count};
+        if(static_cast<::std::size_t>(callee_index) >= all_function_size) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.invalid_function_index.function_index = static_cast<::std::size_t>(callee_index);
+            err.err_selectable.invalid_function_index.all_function_size = all_function_size;
+            err.err_code = ::uwvm2::validation::error::code_validation_error_code::invalid_function_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        if(static_cast<::std::size_t>(callee_index) < import_func_count)
+        {
+            auto const& imported_funcs{importsec.importdesc.index_unchecked(0u)};
+            callee_type_ptr = imported_funcs.index_unchecked(static_cast<::std::size_t>(callee_index))->imports.storage.function;
+        }
+        else
+        {
+            auto const local_idx{static_cast<::std::size_t>(callee_index) - import_func_count};
+            callee_type_ptr = typesec.types.cbegin() + funcsec.funcs.index_unchecked(local_idx);
+        }
+    }
+
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+    if(callee_type_ptr == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#endif
+
+    auto const& callee_type{*callee_type_ptr};
+    auto const param_count{static_cast<::std::size_t>(callee_type.parameter.end - callee_type.parameter.begin)};
+    auto const callee_result_count{static_cast<::std::size_t>(callee_type.result.end - callee_type.result.begin)};
+
+    // The callee returns straight to this function's caller, so its results must be exactly the function results.
+    auto const& func_frame{control_flow_stack.index_unchecked(0u)};
+    auto const expected_result_count{static_cast<::std::size_t>(func_frame.result.end - func_frame.result.begin)};
+    for(::std::size_t i{}; i != expected_result_count && i != callee_result_count; ++i)
+    {
+        if(func_frame.result.begin[i] != callee_type.result.begin[i]) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+            err.err_selectable.br_value_type_mismatch.expected_type =
+                static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(func_frame.result.begin[i]);
+            err.err_selectable.br_value_type_mismatch.actual_type =
+                static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(callee_type.result.begin[i]);
+            err.err_code = ::uwvm2::validation::error::code_validation_error_code::br_value_type_mismatch;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+
+    if(expected_result_count != callee_result_count) [[unlikely]]
+    {
+        err.err_curr = op_begin;
+        err.err_selectable.end_result_mismatch.block_kind = op_name;
+        err.err_selectable.end_result_mismatch.expected_count = expected_result_count;
+        err.err_selectable.end_result_mismatch.actual_count = callee_result_count;
+        err.err_selectable.end_result_mismatch.expected_type =
+            expected_result_count == 1uz ? static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(*func_frame.result.begin)
+                                         : ::uwvm2::parser::wasm::standard::wasm1::type::value_type{};
+        err.err_selectable.end_result_mismatch.actual_type =
+            callee_result_count == 1uz ? static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(*callee_type.result.begin)
+                                       : ::uwvm2::parser::wasm::standard::wasm1::type::value_type{};
+        err.err_code = ::uwvm2::validation::error::code_validation_error_code::end_result_mismatch;
+        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+    }
+
+    auto const required_stack_size{param_count + (is_indirect ? 1uz : 0uz)};
+    if(!is_polymorphic && concrete_operand_count() < required_stack_size) [[unlikely]]
+    {
+        report_operand_stack_underflow(op_begin, op_name, required_stack_size);
+    }
+
+    if(is_indirect)
+    {
+        if(auto const idx{try_pop_concrete_operand()}; idx.from_stack && idx.type != curr_operand_stack_value_type::i32) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_cond_type_not_i32.op_code_name = op_name;
+            err.err_selectable.br_cond_type_not_i32.cond_type = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(idx.type);
+            err.err_code = ::uwvm2::validation::error::code_validation_error_code::br_cond_type_not_i32;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+
+    if(param_count != 0uz)
+    {
+        auto const available_param_count{concrete_operand_count()};
+        auto const concrete_to_check{available_param_count < param_count ? available_param_count : param_count};
+        for(::std::size_t i{}; i != concrete_to_check; ++i)
+        {
+            auto const expected_type{callee_type.parameter.begin[param_count - 1uz - i]};
+            auto const actual_type{operand_stack[operand_stack.size() - 1uz - i].type};
+            if(actual_type != expected_type) [[unlikely]]
+            {
+                err.err_curr = op_begin;
+                err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+                err.err_selectable.br_value_type_mismatch.expected_type = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(expected_type);
+                err.err_selectable.br_value_type_mismatch.actual_type = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::value_type>(actual_type);
+                err.err_code = ::uwvm2::validation::error::code_validation_error_code::br_value_type_mismatch;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+        }
+
+        operand_stack_pop_n(param_count);
+    }
+
+    // Like `return`: nothing after the tail call is reachable.
+    operand_stack_truncate_to(control_flow_stack.back_unchecked().operand_stack_base);
+    is_polymorphic = true;
+
+    if(emit_llvm_jit_active)
+    {
+        llvm_jit_instruction_emitted_inline = true;
+        bool const emitted{is_indirect ? try_emit_runtime_local_func_llvm_jit_return_call_indirect(llvm_jit_emit_state, callee_index, table_index)
+                                       : try_emit_runtime_local_func_llvm_jit_return_call(llvm_jit_emit_state, callee_index)};
+        if(!emitted) [[unlikely]] { disable_inline_llvm_jit_emission(); }
+    }
+
+    break;
+}
@@ -0,0 +1,413 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V / | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <mutex>
+# include <string>
+# include <utility>
+// platform
+# if defined(UWVM_RUNTIME_LLVM_JIT)
+#  include <llvm/ADT/DenseMap.h>
+#  include <llvm/Config/llvm-config.h>
+#  include <llvm/ExecutionEngine/JITEventListener.h>
+#  include <llvm/ExecutionEngine/ObjectCache.h>
+#  include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#  include <llvm/ExecutionEngine/Orc/Core.h>
+#  include <llvm/ExecutionEngine/Orc/ExecutorProcessControl.h>
+#  include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#  include <llvm/ExecutionEngine/Orc/Mangling.h>
+#  include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
+#  include <llvm/IR/DataLayout.h>
+#  include <llvm/IR/Module.h>
+#  include <llvm/Object/ObjectFile.h>
+#  include <llvm/Support/DynamicLibrary.h>
+#  include <llvm/Target/TargetMachine.h>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include "section_memory_manager.h"
+#endif
+
+namespace uwvm2::runtime::compiler::llvm_jit::details
+{
+#if defined(UWVM_RUNTIME_LLVM_JIT)
+    // Executable section of a linked object, in process addresses.
+    struct runtime_llvm_jit_orc_code_range
+    {
+        ::std::uintptr_t begin{};
+        ::std::size_t size{};
+    };
+
+    // Load-time footprint of one linked object: its executable ranges and the bytes of every section RuntimeDyld allocated.
+    // Recorded when the object is linked so the tiered runtime can tell whether a thread is still executing in it before
+    // freeing it.
+    struct runtime_llvm_jit_orc_loaded_object
+    {
+        ::uwvm2::utils::container::vector<runtime_llvm_jit_orc_code_range> code_ranges{};
+        ::std::size_t bytes{};
+    };
+
+    // Process-wide ORC execution session used by lazy (tier-1) materialization.
+    //
+    // Each Wasm module gets one JITDylib; each materialized object is added under its own ResourceTracker, so a unit's code
+    // can be freed without tearing down the module.  Every object is linked through the session's one
+    // `runtime_llvm_jit_shared_section_memory_manager`, so small units pack their writable data together instead of each
+    // mapping its own pages, while EH-frame registration and reclamation stay per object.
+    // Code generation happens on the caller's thread with its own TargetMachine before the object reaches the session, so
+    // compile work never serializes on session locks.
+    //
+    // The session is created once and intentionally never destroyed: generated code may still be running during static
+    // destruction, and LLVM globals may already be gone by then.
+    struct runtime_llvm_jit_orc_session
+    {
+        ::std::unique_ptr<::llvm::orc::ExecutionSession> execution_session{};
+        ::llvm::DataLayout data_layout;
+        ::std::unique_ptr<::llvm::orc::MangleAndInterner> mangle{};
+
+        runtime_llvm_jit_shared_section_memory_manager section_memory{};
+
+        // Plain objects, and objects whose sections and DWARF are reported to JIT event listeners (unwind call-stack mode).
+        ::std::unique_ptr<::llvm::orc::RTDyldObjectLinkingLayer> object_layer{};
+        ::std::unique_ptr<::llvm::orc::RTDyldObjectLinkingLayer> debug_object_layer{};
+
+        // Caller listeners already registered with the debug layer; the layer keeps no set of its own and would report
+        // every object twice to a listener registered twice.
+        ::std::mutex event_listeners_lock{};
+        ::uwvm2::utils::container::vector<::llvm::JITEventListener*> event_listeners{};
+        ::std::atomic_size_t event_listener_count{};
+
+        ::std::atomic_size_t next_dylib_id{};
+
+        // Footprints of linked objects, keyed by resource tracker, until the materializer takes them.  Linking runs on whichever
+        // thread performs the first lookup, so the table is shared.
+        ::std::mutex loaded_objects_lock{};
+        ::llvm::DenseMap<::llvm::orc::ResourceKey, runtime_llvm_jit_orc_loaded_object> loaded_objects{};
+
+        inline explicit runtime_llvm_jit_orc_session(::llvm::DataLayout layout) noexcept : data_layout{::std::move(layout)} {}
+    };
+
+    // RTDyld load callback: records where the object's sections landed under the tracker that owns them.
+    inline void record_runtime_llvm_jit_orc_loaded_object(runtime_llvm_jit_orc_session& session,
+                                                          ::llvm::orc::MaterializationResponsibility& responsibility,
+                                                          ::llvm::object::ObjectFile const& object,
+                                                          ::llvm::RuntimeDyld::LoadedObjectInfo const& loaded_info) noexcept
+    {
+        runtime_llvm_jit_orc_loaded_object loaded{};
+        for(auto const& section: object.sections())
+        {
+            auto const load_address{loaded_info.getSectionLoadAddress(section)};
+            if(load_address == 0u) { continue; }
+            auto const size{static_cast<::std::size_t>(section.getSize())};
+            loaded.bytes += size;
+            if(section.isText() && size != 0uz) { loaded.code_ranges.push_back({static_cast<::std::uintptr_t>(load_address), size}); }
+        }
+
+        ::llvm::consumeError(responsibility.withResourceKeyDo(
+            [&](::llvm::orc::ResourceKey key)
+            {
+                ::std::lock_guard guard{session.loaded_objects_lock};
+                session.loaded_objects[key] = ::std::move(loaded);
+            }));
+    }
+
+    // Removes and returns the footprint recorded for `tracker`'s object; empty if it was never linked.
+    [[nodiscard]] inline runtime_llvm_jit_orc_loaded_object take_runtime_llvm_jit_orc_loaded_object(runtime_llvm_jit_orc_session& session,
+                                                                                                   ::llvm::orc::ResourceTracker& tracker) noexcept
+    {
+        ::std::lock_guard guard{session.loaded_objects_lock};
+        auto const it{session.loaded_objects.find(tracker.getKeyUnsafe())};
+        if(it == session.loaded_objects.end()) { return {}; }
+        auto loaded{::std::move(it->second)};
+        session.loaded_objects.erase(it);
+        return loaded;
+    }
+
+    [[nodiscard]] inline runtime_llvm_jit_orc_session* create_runtime_llvm_jit_orc_session() noexcept
+    {
+        auto executor_process_control{::llvm::orc::SelfExecutorProcessControl::Create()};
+        if(!executor_process_control) [[unlikely]]
+        {
+            ::llvm::consumeError(executor_process_control.takeError());
+            return nullptr;
+        }
+
+        auto target_machine_builder{::llvm::orc::JITTargetMachineBuilder::detectHost()};
+        if(!target_machine_builder) [[unlikely]]
+        {
+            ::llvm::consumeError(target_machine_builder.takeError());
+            return nullptr;
+        }
+        auto data_layout{target_machine_builder->getDefaultDataLayoutForTarget()};
+        if(!data_layout) [[unlikely]]
+        {
+            ::llvm::consumeError(data_layout.takeError());
+            return nullptr;
+        }
+
+        auto session{new runtime_llvm_jit_orc_session{::std::move(*data_layout)}};
+        session->execution_session = ::std::make_unique<::llvm::orc::ExecutionSession>(::std::move(*executor_process_control));
+        session->mangle = ::std::make_unique<::llvm::orc::MangleAndInterner>(*session->execution_session, session->data_layout);
+
+        // RTDyldObjectLinkingLayer's memory-manager factory gained a `MemoryBuffer const&` parameter in newer LLVM releases;
+        // the generic lambda binds to either signature.
+        auto const make_memory_manager{[session](auto&&...) noexcept { return make_runtime_llvm_jit_object_memory_manager(session->section_memory); }};
+        session->object_layer = ::std::make_unique<::llvm::orc::RTDyldObjectLinkingLayer>(*session->execution_session, make_memory_manager);
+        session->debug_object_layer = ::std::make_unique<::llvm::orc::RTDyldObjectLinkingLayer>(*session->execution_session, make_memory_manager);
+        session->debug_object_layer->setProcessAllSections(true);
+
+        // Built-in listeners: debuggers see the objects that keep their DWARF, and the profiler listeners (null unless LLVM
+        // was configured with them) see every object, as they would under MCJIT.
+        auto const register_listener{[session](::llvm::orc::RTDyldObjectLinkingLayer& layer, ::llvm::JITEventListener* listener) noexcept
+                                     {
+                                         if(listener == nullptr) { return; }
+                                         layer.registerJITEventListener(*listener);
+                                         session->event_listener_count.fetch_add(1uz, ::std::memory_order_relaxed);
+                                     }};
+        register_listener(*session->debug_object_layer, ::llvm::JITEventListener::createGDBRegistrationListener());
+        for(auto const listener: {::llvm::JITEventListener::createPerfJITEventListener(),
+                                  ::llvm::JITEventListener::createIntelJITEventListener(),
+                                  ::llvm::JITEventListener::createOProfileJITEventListener()})
+        {
+            register_listener(*session->object_layer, listener);
+            register_listener(*session->debug_object_layer, listener);
+        }
+
+        auto const record_loaded{[session](::llvm::orc::MaterializationResponsibility& responsibility,
+                                           ::llvm::object::ObjectFile const& object,
+                                           ::llvm::RuntimeDyld::LoadedObjectInfo const& loaded_info) noexcept
+                                 { record_runtime_llvm_jit_orc_loaded_object(*session, responsibility, object, loaded_info); }};
+        session->object_layer->setNotifyLoaded(record_loaded);
+        session->debug_object_layer->setNotifyLoaded(record_loaded);
+        return session;
+    }
+
+    // Set once the process session exists, so reporting can read it without creating one.
+    inline ::std::atomic<runtime_llvm_jit_orc_session*> published_runtime_llvm_jit_orc_session{};
+
+    // Returns the process session, creating it on first use.  Requires the native target to be initialized.
+    [[nodiscard]] inline runtime_llvm_jit_orc_session* get_runtime_llvm_jit_orc_session() noexcept
+    {
+        static runtime_llvm_jit_orc_session* const session{[]() noexcept
+                                                           {
+                                                               auto const created{create_runtime_llvm_jit_orc_session()};
+                                                               published_runtime_llvm_jit_orc_session.store(created, ::std::memory_order_release);
+                                                               return created;
+                                                           }()};
+        return session;
+    }
+
+    // Registers `listener` with the debug layer unless it already is.  Safe to call from concurrent materializations.
+    inline void register_runtime_llvm_jit_orc_event_listener(runtime_llvm_jit_orc_session& session, ::llvm::JITEventListener& listener) noexcept
+    {
+        ::std::scoped_lock guard{session.event_listeners_lock};
+        for(auto const registered: session.event_listeners)
+        {
+            if(registered == ::std::addressof(listener)) { return; }
+        }
+        session.event_listeners.push_back(::std::addressof(listener));
+        session.debug_object_layer->registerJITEventListener(listener);
+        session.event_listener_count.fetch_add(1uz, ::std::memory_order_relaxed);
+    }
+
+    struct runtime_llvm_jit_orc_session_stats
+    {
+        bool created{};
+        runtime_llvm_jit_shared_section_memory_stats memory{};
+        ::std::size_t event_listeners{};
+    };
+
+    // Footprint of the process session; `created` stays false until the first lazy materialization creates it.
+    [[nodiscard]] inline runtime_llvm_jit_orc_session_stats get_runtime_llvm_jit_orc_session_stats() noexcept
+    {
+        auto const session{published_runtime_llvm_jit_orc_session.load(::std::memory_order_acquire)};
+        if(session == nullptr) { return {}; }
+        return runtime_llvm_jit_orc_session_stats{.created = true,
+                                                  .memory = session->section_memory.stats(),
+                                                  .event_listeners = session->event_listener_count.load(::std::memory_order_relaxed)};
+    }
+
+    // Resolves undefined symbols the way MCJIT's default memory manager did: explicit symbols registered with
+    // `llvm::sys::DynamicLibrary::AddSymbol` (host bridges, imported host functions) first, then loaded libraries.
+    // `DynamicLibrarySearchGenerator` only searches library handles, so it would miss the explicit symbols.
+    class runtime_llvm_jit_orc_process_symbol_generator final : public ::llvm::orc::DefinitionGenerator
+    {
+    public:
+        inline explicit runtime_llvm_jit_orc_process_symbol_generator(char global_prefix) noexcept : global_prefix{global_prefix} {}
+
+        inline ::llvm::Error tryToGenerate(::llvm::orc::LookupState&,
+                                           ::llvm::orc::LookupKind,
+                                           ::llvm::orc::JITDylib& dylib,
+                                           ::llvm::orc::JITDylibLookupFlags,
+                                           ::llvm::orc::SymbolLookupSet const& symbols) override
+        {
+            ::llvm::orc::SymbolMap found{};
+            for(auto const& [name, flags]: symbols)
+            {
+                static_cast<void>(flags);
+                auto symbol_name{(*name).str()};
+                if(global_prefix != '\0')
+                {
+                    if(symbol_name.empty() || symbol_name.front() != global_prefix) { continue; }
+                    symbol_name.erase(0uz, 1uz);
+                }
+                auto const address{::llvm::sys::DynamicLibrary::SearchForAddressOfSymbol(symbol_name)};
+                if(address == nullptr) { continue; }
+                found[name] = ::llvm::orc::ExecutorSymbolDef{::llvm::orc::ExecutorAddr::fromPtr(address), ::llvm::JITSymbolFlags::Exported};
+            }
+            if(found.empty()) { return ::llvm::Error::success(); }
+            return dylib.define(::llvm::orc::absoluteSymbols(::std::move(found)));
+        }
+
+    private:
+        char global_prefix{};
+    };
+
+    // Creates a fresh JITDylib for one Wasm module, resolving external symbols from the process.
+    [[nodiscard]] inline ::llvm::orc::JITDylib* create_runtime_llvm_jit_orc_dylib(runtime_llvm_jit_orc_session& session,
+                                                                                 ::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        auto const dylib_id{session.next_dylib_id.fetch_add(1uz, ::std::memory_order_relaxed)};
+        // Names only need to be unique within the session; the counter covers modules that share a name.
+        ::std::string dylib_name{"uwvm."};
+        dylib_name.append(reinterpret_cast<char const*>(module_name.data()), module_name.size());
+        dylib_name.push_back('.');
+        dylib_name.append(::std::to_string(dylib_id));
+
+        auto dylib{session.execution_session->createJITDylib(::std::move(dylib_name))};
+        if(!dylib) [[unlikely]]
+        {
+            ::llvm::consumeError(dylib.takeError());
+            return nullptr;
+        }
+
+        dylib->addGenerator(::std::make_unique<runtime_llvm_jit_orc_process_symbol_generator>(session.data_layout.getGlobalPrefix()));
+        return ::std::addressof(*dylib);
+    }
+
+    // Owning handle for a module's JITDylib.  Removing the dylib frees every object still tracked in it.
+    struct runtime_llvm_jit_orc_dylib
+    {
+        // Published with `std::atomic_ref` so concurrent first materializations agree on one dylib while the handle stays
+        // movable inside lazy module storage.
+        ::llvm::orc::JITDylib* dylib{};
+
+        inline constexpr runtime_llvm_jit_orc_dylib() noexcept = default;
+        inline constexpr runtime_llvm_jit_orc_dylib(runtime_llvm_jit_orc_dylib const&) noexcept = delete;
+        inline constexpr runtime_llvm_jit_orc_dylib& operator= (runtime_llvm_jit_orc_dylib const&) noexcept = delete;
+
+        inline constexpr runtime_llvm_jit_orc_dylib(runtime_llvm_jit_orc_dylib&& other) noexcept : dylib{::std::exchange(other.dylib, nullptr)} {}
+
+        inline constexpr runtime_llvm_jit_orc_dylib& operator= (runtime_llvm_jit_orc_dylib&& other) noexcept
+        {
+            if(this != ::std::addressof(other))
+            {
+                reset();
+                dylib = ::std::exchange(other.dylib, nullptr);
+            }
+            return *this;
+        }
+
+        inline constexpr ~runtime_llvm_jit_orc_dylib() { reset(); }
+
+        // Gives up ownership without removing the dylib; used during process exit.
+        inline constexpr ::llvm::orc::JITDylib* release() noexcept { return ::std::exchange(dylib, nullptr); }
+
+        inline constexpr void reset() noexcept
+        {
+            auto const curr{::std::exchange(dylib, nullptr)};
+            if(curr == nullptr) { return; }
+            ::llvm::consumeError(curr->getExecutionSession().removeJITDylib(*curr));
+        }
+
+        // Returns the module dylib, creating it on first use.  Safe to call from concurrent materializations.
+        [[nodiscard]] inline ::llvm::orc::JITDylib* get_or_create(runtime_llvm_jit_orc_session& session,
+                                                                  ::uwvm2::utils::container::u8string_view module_name) noexcept
+        {
+            ::std::atomic_ref<::llvm::orc::JITDylib*> published{dylib};
+            if(auto const curr{published.load(::std::memory_order_acquire)}; curr != nullptr) { return curr; }
+
+            auto const created{create_runtime_llvm_jit_orc_dylib(session, module_name)};
+            if(created == nullptr) [[unlikely]] { return nullptr; }
+
+            ::llvm::orc::JITDylib* expected{};
+            if(published.compare_exchange_strong(expected, created, ::std::memory_order_acq_rel, ::std::memory_order_acquire)) { return created; }
+
+            // Another thread published first; drop the empty dylib created here.
+            ::llvm::consumeError(session.execution_session->removeJITDylib(*created));
+            return expected;
+        }
+    };
+
+    // Compiles `module` with `target_machine` on the calling thread (consulting `object_cache` first, like MCJIT did) and adds
+    // the resulting object to `dylib` under a new resource tracker.  Linking happens on the first symbol lookup.
+    [[nodiscard]] inline ::llvm::orc::ResourceTrackerSP add_runtime_llvm_jit_orc_module(runtime_llvm_jit_orc_session& session,
+                                                                                        ::llvm::orc::JITDylib& dylib,
+                                                                                        ::llvm::Module& module,
+                                                                                        ::llvm::TargetMachine& target_machine,
+                                                                                        ::llvm::ObjectCache* object_cache,
+                                                                                        ::llvm::JITEventListener* event_listener) noexcept
+    {
+        ::llvm::orc::SimpleCompiler compiler{target_machine, object_cache};
+        auto object{compiler(module)};
+        if(!object) [[unlikely]]
+        {
+            ::llvm::consumeError(object.takeError());
+            return {};
+        }
+
+        auto& layer{event_listener == nullptr ? *session.object_layer : *session.debug_object_layer};
+        if(event_listener != nullptr) { register_runtime_llvm_jit_orc_event_listener(session, *event_listener); }
+
+        auto tracker{dylib.createResourceTracker()};
+        if(auto err{layer.add(tracker, ::std::move(*object))}) [[unlikely]]
+        {
+            ::llvm::consumeError(::std::move(err));
+            return {};
+        }
+        return tracker;
+    }
+
+    // Resolves one IR-level symbol name in `dylib`, linking its object if this is the first lookup.
+    [[nodiscard]] inline ::std::uintptr_t lookup_runtime_llvm_jit_orc_symbol(runtime_llvm_jit_orc_session& session,
+                                                                             ::llvm::orc::JITDylib& dylib,
+                                                                             ::uwvm2::utils::container::u8string const& symbol_name) noexcept
+    {
+        auto symbol{session.execution_session->lookup(
+            ::llvm::ArrayRef<::llvm::orc::JITDylib*>{::std::addressof(dylib)},
+            (*session.mangle)(::llvm::StringRef{reinterpret_cast<char const*>(symbol_name.data()), symbol_name.size()}))};
+        if(!symbol) [[unlikely]]
+        {
+            ::llvm::consumeError(symbol.takeError());
+            return 0u;
+        }
+        return static_cast<::std::uintptr_t>(symbol->getAddress().getValue());
+    }
+#endif
+}  // namespace uwvm2::runtime::compiler::llvm_jit::details
@@ -24,15 +24,26 @@
 #ifndef UWVM_MODULE
 // std
 # include <algorithm>
+# include <cerrno>
 # include <cstddef>
 # include <cstdint>
 # include <cstring>
 # include <limits>
 # include <memory>
+# include <mutex>
+# include <string>
+# include <system_error>
 // platform
 # if defined(UWVM_RUNTIME_LLVM_JIT)
 #  include <llvm/Config/llvm-config.h>
+#  include <llvm/ExecutionEngine/RuntimeDyld.h>
 #  include <llvm/ExecutionEngine/SectionMemoryManager.h>
+#  include <llvm/Support/Alignment.h>
+#  include <llvm/Support/Memory.h>
+#  include <llvm/Support/Process.h>
+# endif
+# if defined(UWVM_RUNTIME_LLVM_JIT) && !defined(_WIN32) && __has_include(<sys/mman.h>)
+#  include <sys/mman.h>
 # endif
 # if defined(UWVM_RUNTIME_LLVM_JIT) && !defined(_WIN32) && __has_include(<unwind.h>)
 #  include <unwind.h>
@@ -69,6 +80,14 @@ extern "C" void __deregister_frame(void const*);
 # define UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_DWARF_EH_FRAME 0
 #endif
 
+#pragma push_macro("UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA")
+#undef UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA
+#if defined(UWVM_RUNTIME_LLVM_JIT) && !defined(_WIN32) && __has_include(<sys/mman.h>) && UINTPTR_MAX > 0xffffffffu
+# define UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA 1
+#else
+# define UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA 0
+#endif
+
 namespace uwvm2::runtime::compiler::llvm_jit::details
 {
 #if defined(UWVM_RUNTIME_LLVM_JIT)
@@ -129,14 +148,254 @@ namespace uwvm2::runtime::compiler::llvm_jit::details
     }
 # endif
 
+    struct runtime_llvm_jit_code_arena_stats
+    {
+        ::std::size_t reserved_bytes{};
+        ::std::size_t code_bytes{};
+        ::std::size_t data_bytes{};
+        ::std::size_t fallback_allocations{};
+        bool huge_pages{};
+    };
+
+# if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA
+    // One reservation per process holds every JIT section.  Code and data live in two adjacent regions so the PC-relative
+    // relocations RuntimeDyld emits between them always stay within +-2 GiB, and the code region is 2 MiB aligned so the kernel
+    // can back it with transparent huge pages.
+    inline constexpr ::std::size_t runtime_llvm_jit_code_arena_huge_page_bytes{2uz * 1024uz * 1024uz};
+    inline constexpr ::std::size_t runtime_llvm_jit_code_arena_code_region_bytes{512uz * 1024uz * 1024uz};
+    inline constexpr ::std::size_t runtime_llvm_jit_code_arena_data_region_bytes{256uz * 1024uz * 1024uz};
+
+    struct runtime_llvm_jit_code_arena_extent
+    {
+        ::std::uintptr_t begin{};
+        ::std::size_t size{};
+    };
+
+    struct runtime_llvm_jit_code_arena_region
+    {
+        ::std::uintptr_t begin{};
+        ::std::uintptr_t end{};
+        ::std::uintptr_t frontier{};
+        ::std::size_t live_bytes{};
+        // Sorted by address and coalesced; an extent touching the frontier is folded back into it.
+        ::uwvm2::utils::container::vector<runtime_llvm_jit_code_arena_extent> free_extents{};
+
+        [[nodiscard]] inline constexpr bool contains(::std::uintptr_t address) const noexcept { return address >= begin && address < end; }
+
+        [[nodiscard]] inline constexpr ::std::uintptr_t allocate(::std::size_t size) noexcept
+        {
+            // First fit over the released extents keeps retired units' pages hot before bumping the frontier.
+            for(auto it{free_extents.begin()}; it != free_extents.end(); ++it)
+            {
+                if(it->size < size) { continue; }
+                auto const address{it->begin};
+                it->begin += size;
+                it->size -= size;
+                if(it->size == 0uz) { free_extents.erase(it); }
+                live_bytes += size;
+                return address;
+            }
+
+            if(static_cast<::std::size_t>(end - frontier) < size) { return 0u; }
+            auto const address{frontier};
+            frontier += size;
+            live_bytes += size;
+            return address;
+        }
+
+        inline constexpr void release(::std::uintptr_t address, ::std::size_t size) noexcept
+        {
+            live_bytes -= size;
+
+            auto it{::std::lower_bound(free_extents.begin(),
+                                       free_extents.end(),
+                                       address,
+                                       [](runtime_llvm_jit_code_arena_extent const& extent, ::std::uintptr_t value) constexpr noexcept
+                                       { return extent.begin < value; })};
+            it = free_extents.insert(it, runtime_llvm_jit_code_arena_extent{address, size});
+
+            if(auto const next{it + 1}; next != free_extents.end() && it->begin + it->size == next->begin)
+            {
+                it->size += next->size;
+                free_extents.erase(next);
+            }
+            if(it != free_extents.begin())
+            {
+                if(auto const prev{it - 1}; prev->begin + prev->size == it->begin)
+                {
+                    prev->size += it->size;
+                    free_extents.erase(it);
+                }
+            }
+
+            if(!free_extents.empty())
+            {
+                auto const& last{free_extents.back()};
+                if(last.begin + last.size == frontier)
+                {
+                    frontier = last.begin;
+                    free_extents.pop_back();
+                }
+            }
+        }
+    };
+
+    class runtime_llvm_jit_code_arena_mapper final : public ::llvm::SectionMemoryManager::MemoryMapper
+    {
+    public:
+        inline ::llvm::sys::MemoryBlock allocateMappedMemory(::llvm::SectionMemoryManager::AllocationPurpose purpose,
+                                                             ::std::size_t num_bytes,
+                                                             ::llvm::sys::MemoryBlock const* const near_block,
+                                                             unsigned flags,
+                                                             ::std::error_code& ec) noexcept override
+        {
+            ec = ::std::error_code{};
+            if(num_bytes != 0uz)
+            {
+                auto const page_bytes{static_cast<::std::size_t>(::llvm::sys::Process::getPageSizeEstimate())};
+                auto const size{(num_bytes + page_bytes - 1uz) / page_bytes * page_bytes};
+
+                ::std::uintptr_t address{};
+                {
+                    ::std::scoped_lock guard{lock_};
+                    if(!reserve_attempted_) { reserve_locked(); }
+                    address = (purpose == ::llvm::SectionMemoryManager::AllocationPurpose::Code ? code_ : data_).allocate(size);
+                    if(address == 0u) { ++fallback_allocations_; }
+                }
+
+                if(address != 0u)
+                {
+                    // Arena pages rest at PROT_NONE; SectionMemoryManager asks for RW here and flips code to RX on finalize,
+                    // so W^X holds per block exactly as with its own mappings.
+                    ::llvm::sys::MemoryBlock block{reinterpret_cast<void*>(address), size};
+                    ec = ::llvm::sys::Memory::protectMappedMemory(block, flags);
+                    if(!ec) { return block; }
+                    release_to_arena(address, size);
+                    return ::llvm::sys::MemoryBlock{};
+                }
+            }
+
+            return ::llvm::sys::Memory::allocateMappedMemory(num_bytes, near_block, flags, ec);
+        }
+
+        inline ::std::error_code protectMappedMemory(::llvm::sys::MemoryBlock const& block, unsigned flags) noexcept override
+        {
+            return ::llvm::sys::Memory::protectMappedMemory(block, flags);
+        }
+
+        inline ::std::error_code releaseMappedMemory(::llvm::sys::MemoryBlock& block) noexcept override
+        {
+            auto const address{reinterpret_cast<::std::uintptr_t>(block.base())};
+            auto const size{static_cast<::std::size_t>(block.allocatedSize())};
+            if(address == 0u || size == 0uz) { return ::std::error_code{}; }
+            if(!code_.contains(address) && !data_.contains(address)) { return ::llvm::sys::Memory::releaseMappedMemory(block); }
+
+            // Back to PROT_NONE until reused, so a stale call into a released unit faults instead of running its successor.
+            // sys::Memory::protectMappedMemory rejects empty flags, hence the direct call.
+            if(::mprotect(block.base(), size, PROT_NONE) != 0) [[unlikely]] { return ::std::error_code{errno, ::std::generic_category()}; }
+            // PROT_NONE alone keeps the pages committed; drop them so a retired unit stops counting against RSS.  Advisory: on
+            // failure the pages merely stay resident until the extent is reused.
+#  if defined(MADV_DONTNEED)
+            static_cast<void>(::madvise(block.base(), size, MADV_DONTNEED));
+#  endif
+            release_to_arena(address, size);
+            block = ::llvm::sys::MemoryBlock{};
+            return ::std::error_code{};
+        }
+
+        [[nodiscard]] inline runtime_llvm_jit_code_arena_stats stats() noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            return runtime_llvm_jit_code_arena_stats{.reserved_bytes = static_cast<::std::size_t>(data_.end - code_.begin),
+                                                     .code_bytes = code_.live_bytes,
+                                                     .data_bytes = data_.live_bytes,
+                                                     .fallback_allocations = fallback_allocations_,
+                                                     .huge_pages = huge_pages_};
+        }
+
+    private:
+        // Region bounds are written once under the lock before any block is handed out and never change afterwards, so
+        // `contains` on a block this mapper returned needs no lock.
+        ::std::mutex lock_{};
+        bool reserve_attempted_{};
+        bool huge_pages_{};
+        ::std::size_t fallback_allocations_{};
+        runtime_llvm_jit_code_arena_region code_{};
+        runtime_llvm_jit_code_arena_region data_{};
+
+        inline void release_to_arena(::std::uintptr_t address, ::std::size_t size) noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            (code_.contains(address) ? code_ : data_).release(address, size);
+        }
+
+        inline void reserve_locked() noexcept
+        {
+            reserve_attempted_ = true;
+
+            // Over-reserve by one huge page and trim both ends so the code region starts on a 2 MiB boundary.  The mapping is
+            // PROT_NONE and NORESERVE: untouched arena pages cost address space only.
+            constexpr auto arena_bytes{runtime_llvm_jit_code_arena_code_region_bytes + runtime_llvm_jit_code_arena_data_region_bytes};
+            constexpr auto mapping_bytes{arena_bytes + runtime_llvm_jit_code_arena_huge_page_bytes};
+            int map_flags{MAP_PRIVATE | MAP_ANONYMOUS};
+#  if defined(MAP_NORESERVE)
+            map_flags |= MAP_NORESERVE;
+#  endif
+            auto const mapping{::mmap(nullptr, mapping_bytes, PROT_NONE, map_flags, -1, 0)};
+            if(mapping == MAP_FAILED) [[unlikely]] { return; }
+
+            auto const mapping_begin{reinterpret_cast<::std::uintptr_t>(mapping)};
+            auto const mapping_end{mapping_begin + mapping_bytes};
+            auto const begin{(mapping_begin + runtime_llvm_jit_code_arena_huge_page_bytes - 1u) & ~(runtime_llvm_jit_code_arena_huge_page_bytes - 1u)};
+            auto const end{begin + arena_bytes};
+            if(begin != mapping_begin) { static_cast<void>(::munmap(mapping, begin - mapping_begin)); }
+            if(end != mapping_end) { static_cast<void>(::munmap(reinterpret_cast<void*>(end), mapping_end - end)); }
+
+#  if defined(MADV_HUGEPAGE)
+            // Advisory only: without THP (or with it set to "never") the region simply stays on base pages.
+            huge_pages_ = ::madvise(reinterpret_cast<void*>(begin), runtime_llvm_jit_code_arena_code_region_bytes, MADV_HUGEPAGE) == 0;
+#  endif
+
+            code_.begin = begin;
+            code_.end = begin + runtime_llvm_jit_code_arena_code_region_bytes;
+            code_.frontier = code_.begin;
+            data_.begin = code_.end;
+            data_.end = end;
+            data_.frontier = data_.begin;
+        }
+    };
+
+    [[nodiscard]] inline runtime_llvm_jit_code_arena_mapper& get_runtime_llvm_jit_code_arena() noexcept
+    {
+        // Never destroyed: memory managers owned by other statics may still release blocks during static destruction.
+        static auto* const arena{::new runtime_llvm_jit_code_arena_mapper{}};
+        return *arena;
+    }
+
+    [[nodiscard]] inline ::llvm::SectionMemoryManager::MemoryMapper* get_runtime_llvm_jit_code_arena_mapper() noexcept
+    {
+        return ::std::addressof(get_runtime_llvm_jit_code_arena());
+    }
+
+    [[nodiscard]] inline runtime_llvm_jit_code_arena_stats get_runtime_llvm_jit_code_arena_stats() noexcept
+    {
+        return get_runtime_llvm_jit_code_arena().stats();
+    }
+# else
+    // Windows and 32-bit targets keep SectionMemoryManager's own per-section mappings.
+    [[nodiscard]] inline constexpr ::llvm::SectionMemoryManager::MemoryMapper* get_runtime_llvm_jit_code_arena_mapper() noexcept { return nullptr; }
+
+    [[nodiscard]] inline constexpr runtime_llvm_jit_code_arena_stats get_runtime_llvm_jit_code_arena_stats() noexcept { return {}; }
+# endif
+
     class runtime_llvm_jit_section_memory_manager final : public ::llvm::SectionMemoryManager
     {
     public:
         inline constexpr runtime_llvm_jit_section_memory_manager() noexcept :
 # if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_RESERVE_ALLOC
-            ::llvm::SectionMemoryManager(nullptr, UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_WIN64_SEH != 0)
+            ::llvm::SectionMemoryManager(get_runtime_llvm_jit_code_arena_mapper(), UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_WIN64_SEH != 0)
 # else
-            ::llvm::SectionMemoryManager(nullptr)
+            ::llvm::SectionMemoryManager(get_runtime_llvm_jit_code_arena_mapper())
 # endif
         {
         }
@@ -270,9 +529,334 @@ namespace uwvm2::runtime::compiler::llvm_jit::details
         ::uwvm2::utils::container::vector<runtime_llvm_jit_eh_frame_record> eh_frame_records_{};
 # endif
     };
+
+    // Footprint of the objects linked through one ORC session's section memory manager.
+    struct runtime_llvm_jit_shared_section_memory_stats
+    {
+        ::std::size_t objects_linked{};
+        ::std::size_t live_objects{};
+        ::std::size_t exec_bytes{};
+        ::std::size_t private_data_bytes{};
+        ::std::size_t shared_data_bytes{};
+        ::std::size_t shared_data_chunk_bytes{};
+    };
+
+# if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA
+    // Writable data is packed in chunks carved from the arena's data region.  Chunks are kept for the life of the session, so
+    // slots freed by retired objects are reused by later ones.
+    inline constexpr ::std::size_t runtime_llvm_jit_shared_data_chunk_bytes{64uz * 1024uz};
+    inline constexpr ::std::size_t runtime_llvm_jit_shared_data_alignment{16uz};
+
+    // The one section memory manager of an ORC session.  RuntimeDyld still finalizes and frees objects one at a time, so every
+    // object links through a thin `runtime_llvm_jit_object_section_memory` view that draws from this manager:
+    //   - an object's code and read-only data share one page-rounded block that is flipped from RW to RX on finalize.  Those
+    //     pages cannot be shared with other objects without making them writable while another object already runs.
+    //   - writable data of every object is packed into shared RW chunks, which never change protection.
+    // Removing an object's resource tracker destroys its view, which returns the block to the arena and the slots to the chunks.
+    class runtime_llvm_jit_shared_section_memory_manager
+    {
+    public:
+        inline constexpr runtime_llvm_jit_shared_section_memory_manager() noexcept = default;
+        inline constexpr runtime_llvm_jit_shared_section_memory_manager(runtime_llvm_jit_shared_section_memory_manager const&) noexcept = delete;
+        inline constexpr runtime_llvm_jit_shared_section_memory_manager& operator= (runtime_llvm_jit_shared_section_memory_manager const&) noexcept = delete;
+
+        // Maps a page-rounded RW block of at least `bytes`.  Code blocks also hold their object's read-only data.
+        [[nodiscard]] inline ::llvm::sys::MemoryBlock allocate_block(bool executable, ::std::size_t bytes) noexcept
+        {
+            auto const purpose{executable ? ::llvm::SectionMemoryManager::AllocationPurpose::Code : ::llvm::SectionMemoryManager::AllocationPurpose::RWData};
+            ::std::error_code ec{};
+            auto block{get_runtime_llvm_jit_code_arena().allocateMappedMemory(purpose,
+                                                                              bytes,
+                                                                              nullptr,
+                                                                              ::llvm::sys::Memory::MF_READ | ::llvm::sys::Memory::MF_WRITE,
+                                                                              ec)};
+            if(ec || block.base() == nullptr) [[unlikely]] { return ::llvm::sys::MemoryBlock{}; }
+
+            ::std::scoped_lock guard{lock_};
+            (executable ? exec_bytes_ : private_data_bytes_) += block.allocatedSize();
+            return block;
+        }
+
+        inline void release_block(bool executable, ::llvm::sys::MemoryBlock& block) noexcept
+        {
+            auto const size{static_cast<::std::size_t>(block.allocatedSize())};
+            if(block.base() == nullptr || size == 0uz) { return; }
+            static_cast<void>(get_runtime_llvm_jit_code_arena().releaseMappedMemory(block));
+
+            ::std::scoped_lock guard{lock_};
+            (executable ? exec_bytes_ : private_data_bytes_) -= size;
+        }
+
+        // W^X: a finalized code block is read/execute only.
+        [[nodiscard]] inline ::std::error_code finalize_code_block(::llvm::sys::MemoryBlock const& block) noexcept
+        {
+            auto const ec{::llvm::sys::Memory::protectMappedMemory(block, ::llvm::sys::Memory::MF_READ | ::llvm::sys::Memory::MF_EXEC)};
+            if(!ec) { ::llvm::sys::Memory::InvalidateInstructionCache(block.base(), block.allocatedSize()); }
+            return ec;
+        }
+
+        // Returns a zeroed slot of `size` bytes (a multiple of the shared alignment) in a shared RW chunk, or 0 if no chunk can
+        // be mapped.
+        [[nodiscard]] inline ::std::uintptr_t allocate_shared_data(::std::size_t size) noexcept
+        {
+            ::std::uintptr_t address{};
+            {
+                ::std::scoped_lock guard{lock_};
+                for(auto& chunk: data_chunks_)
+                {
+                    if(address = chunk.allocate(size); address != 0u) { break; }
+                }
+
+                if(address == 0u)
+                {
+                    ::std::error_code ec{};
+                    auto const block{get_runtime_llvm_jit_code_arena().allocateMappedMemory(::llvm::SectionMemoryManager::AllocationPurpose::RWData,
+                                                                                            runtime_llvm_jit_shared_data_chunk_bytes,
+                                                                                            nullptr,
+                                                                                            ::llvm::sys::Memory::MF_READ | ::llvm::sys::Memory::MF_WRITE,
+                                                                                            ec)};
+                    if(ec || block.base() == nullptr) [[unlikely]] { return 0u; }
+
+                    auto const begin{reinterpret_cast<::std::uintptr_t>(block.base())};
+                    auto& chunk{data_chunks_.emplace_back()};
+                    chunk.begin = begin;
+                    chunk.end = begin + block.allocatedSize();
+                    chunk.frontier = begin;
+                    shared_data_chunk_bytes_ += block.allocatedSize();
+                    address = chunk.allocate(size);
+                    if(address == 0u) [[unlikely]] { return 0u; }
+                }
+                shared_data_bytes_ += size;
+            }
+
+            // Slots are reused, and RuntimeDyld only zero-fills the sections it knows to be zero-initialized.
+            ::std::memset(reinterpret_cast<void*>(address), 0, size);
+            return address;
+        }
+
+        inline void release_shared_data(::std::uintptr_t address, ::std::size_t size) noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            for(auto& chunk: data_chunks_)
+            {
+                if(!chunk.contains(address)) { continue; }
+                chunk.release(address, size);
+                shared_data_bytes_ -= size;
+                return;
+            }
+        }
+
+        inline void object_created() noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            ++objects_linked_;
+            ++live_objects_;
+        }
+
+        inline void object_destroyed() noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            --live_objects_;
+        }
+
+        [[nodiscard]] inline runtime_llvm_jit_shared_section_memory_stats stats() noexcept
+        {
+            ::std::scoped_lock guard{lock_};
+            return runtime_llvm_jit_shared_section_memory_stats{.objects_linked = objects_linked_,
+                                                                .live_objects = live_objects_,
+                                                                .exec_bytes = exec_bytes_,
+                                                                .private_data_bytes = private_data_bytes_,
+                                                                .shared_data_bytes = shared_data_bytes_,
+                                                                .shared_data_chunk_bytes = shared_data_chunk_bytes_};
+        }
+
+    private:
+        ::std::mutex lock_{};
+        ::uwvm2::utils::container::vector<runtime_llvm_jit_code_arena_region> data_chunks_{};
+        ::std::size_t objects_linked_{};
+        ::std::size_t live_objects_{};
+        ::std::size_t exec_bytes_{};
+        ::std::size_t private_data_bytes_{};
+        ::std::size_t shared_data_bytes_{};
+        ::std::size_t shared_data_chunk_bytes_{};
+    };
+
+    // Per-object view of the session's section memory manager, owned by RuntimeDyld for the object's lifetime.
+    class runtime_llvm_jit_object_section_memory final : public ::llvm::RuntimeDyld::MemoryManager
+    {
+    public:
+        inline explicit runtime_llvm_jit_object_section_memory(runtime_llvm_jit_shared_section_memory_manager& shared) noexcept :
+            shared_{::std::addressof(shared)}
+        {
+            shared.object_created();
+        }
+
+        inline runtime_llvm_jit_object_section_memory(runtime_llvm_jit_object_section_memory const&) noexcept = delete;
+        inline runtime_llvm_jit_object_section_memory& operator= (runtime_llvm_jit_object_section_memory const&) noexcept = delete;
+
+        inline ~runtime_llvm_jit_object_section_memory() override
+        {
+            // Unwind tables go first: the code they describe is about to be reused.
+            deregisterEHFrames();
+            for(auto& block: code_blocks_) { shared_->release_block(true, block.block); }
+            for(auto& block: data_blocks_) { shared_->release_block(false, block.block); }
+            for(auto const& slot: shared_data_slots_) { shared_->release_shared_data(slot.begin, slot.size); }
+            shared_->object_destroyed();
+        }
+
+        inline bool needsToReserveAllocationSpace() noexcept override { return true; }
+
+        // RuntimeDyld reports the object's totals up front, so code and read-only data usually fit one block.
+        inline void reserveAllocationSpace(::std::uintptr_t code_size,
+                                           ::llvm::Align code_align,
+                                           ::std::uintptr_t ro_data_size,
+                                           ::llvm::Align ro_data_align,
+                                           ::std::uintptr_t,
+                                           ::llvm::Align) noexcept override
+        {
+            code_reserve_ = static_cast<::std::size_t>(code_size + ro_data_size + code_align.value() + ro_data_align.value());
+        }
+
+        inline ::std::uint8_t* allocateCodeSection(::std::uintptr_t size, unsigned alignment, unsigned, ::llvm::StringRef) noexcept override
+        {
+            return bump(true, code_blocks_, code_reserve_, static_cast<::std::size_t>(size), alignment);
+        }
+
+        inline ::std::uint8_t*
+            allocateDataSection(::std::uintptr_t size, unsigned alignment, unsigned, ::llvm::StringRef, bool is_read_only) noexcept override
+        {
+            // Read-only data becomes read/execute with the code it sits next to; it is never written after relocation.
+            if(is_read_only) { return bump(true, code_blocks_, code_reserve_, static_cast<::std::size_t>(size), alignment); }
+
+            if(alignment <= runtime_llvm_jit_shared_data_alignment && size <= runtime_llvm_jit_shared_data_chunk_bytes / 4u)
+            {
+                constexpr auto slot_mask{runtime_llvm_jit_shared_data_alignment - 1uz};
+                auto const slot_size{((::std::max)(static_cast<::std::size_t>(size), 1uz) + slot_mask) & ~slot_mask};
+                if(auto const address{shared_->allocate_shared_data(slot_size)}; address != 0u)
+                {
+                    shared_data_slots_.push_back(runtime_llvm_jit_code_arena_extent{address, slot_size});
+                    return reinterpret_cast<::std::uint8_t*>(address);
+                }
+            }
+
+            // Over-aligned or large writable sections get a private block.
+            ::std::size_t no_reserve{};
+            return bump(false, data_blocks_, no_reserve, static_cast<::std::size_t>(size), alignment);
+        }
+
+        inline bool finalizeMemory(::std::string* error_message) noexcept override
+        {
+            for(auto const& block: code_blocks_)
+            {
+                if(auto const ec{shared_->finalize_code_block(block.block)}; ec) [[unlikely]]
+                {
+                    if(error_message != nullptr) { *error_message = ec.message(); }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline void registerEHFrames(::std::uint8_t* addr, ::std::uint64_t, ::std::size_t size) noexcept override
+        {
+#  if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_DWARF_EH_FRAME
+            visit_runtime_llvm_jit_eh_frame_fdes(addr, size, [](::std::uint8_t* fde) constexpr noexcept { __register_frame(fde); });
+#  else
+            ::llvm::RTDyldMemoryManager::registerEHFramesInProcess(addr, size);
+#  endif
+            eh_frame_records_.push_back(runtime_llvm_jit_eh_frame_record{addr, size});
+        }
+
+        inline void deregisterEHFrames() noexcept override
+        {
+            for(auto const& frame: eh_frame_records_)
+            {
+#  if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_DWARF_EH_FRAME
+                visit_runtime_llvm_jit_eh_frame_fdes(frame.addr, frame.size, [](::std::uint8_t* fde) constexpr noexcept { __deregister_frame(fde); });
+#  else
+                ::llvm::RTDyldMemoryManager::deregisterEHFramesInProcess(frame.addr, frame.size);
+#  endif
+            }
+            eh_frame_records_.clear();
+        }
+
+    private:
+        struct bump_block
+        {
+            ::llvm::sys::MemoryBlock block{};
+            ::std::size_t used{};
+        };
+
+#  if !UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_DWARF_EH_FRAME
+        struct runtime_llvm_jit_eh_frame_record
+        {
+            ::std::uint8_t* addr{};
+            ::std::size_t size{};
+        };
+#  endif
+
+        runtime_llvm_jit_shared_section_memory_manager* shared_{};
+        ::uwvm2::utils::container::vector<bump_block> code_blocks_{};
+        ::uwvm2::utils::container::vector<bump_block> data_blocks_{};
+        ::uwvm2::utils::container::vector<runtime_llvm_jit_code_arena_extent> shared_data_slots_{};
+        ::uwvm2::utils::container::vector<runtime_llvm_jit_eh_frame_record> eh_frame_records_{};
+        ::std::size_t code_reserve_{};
+
+        // Bump-allocates from the last block of `blocks`, mapping a new one (sized by `reserve` the first time) when it is full.
+        [[nodiscard]] inline ::std::uint8_t* bump(bool executable,
+                                                  ::uwvm2::utils::container::vector<bump_block>& blocks,
+                                                  ::std::size_t& reserve,
+                                                  ::std::size_t size,
+                                                  unsigned alignment) noexcept
+        {
+            auto const align{static_cast<::std::uintptr_t>(alignment == 0u ? 1u : alignment)};
+            auto const try_fit{[&](bump_block& curr) noexcept -> ::std::uint8_t*
+                               {
+                                   auto const base{reinterpret_cast<::std::uintptr_t>(curr.block.base())};
+                                   auto const begin{(base + curr.used + align - 1u) & ~(align - 1u)};
+                                   if(begin + size > base + curr.block.allocatedSize()) { return nullptr; }
+                                   curr.used = static_cast<::std::size_t>(begin + size - base);
+                                   return reinterpret_cast<::std::uint8_t*>(begin);
+                               }};
+
+            if(!blocks.empty())
+            {
+                if(auto const address{try_fit(blocks.back())}; address != nullptr) { return address; }
+            }
+
+            auto const request{(::std::max)(reserve, size + static_cast<::std::size_t>(align))};
+            reserve = 0uz;
+            auto block{shared_->allocate_block(executable, request)};
+            if(block.base() == nullptr) [[unlikely]] { return nullptr; }
+            blocks.push_back(bump_block{block, 0uz});
+            return try_fit(blocks.back());
+        }
+    };
+# else
+    // Without the arena (Windows, 32-bit targets) every object keeps its own SectionMemoryManager: Win64 SEH tables are
+    // registered against an image base derived from that one object's sections.
+    class runtime_llvm_jit_shared_section_memory_manager
+    {
+    public:
+        [[nodiscard]] inline constexpr runtime_llvm_jit_shared_section_memory_stats stats() const noexcept { return {}; }
+    };
+# endif
+
+    // Memory manager for one object linked through `shared`'s session.
+    [[nodiscard]] inline ::std::unique_ptr<::llvm::RuntimeDyld::MemoryManager>
+        make_runtime_llvm_jit_object_memory_manager([[maybe_unused]] runtime_llvm_jit_shared_section_memory_manager& shared) noexcept
+    {
+        // RuntimeDyld takes ownership through `std::unique_ptr`, so this one allocation cannot use the project owner type.
+# if UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA
+        return ::std::make_unique<runtime_llvm_jit_object_section_memory>(shared);
+# else
+        return ::std::make_unique<runtime_llvm_jit_section_memory_manager>();
+# endif
+    }
 #endif
 }  // namespace uwvm2::runtime::compiler::llvm_jit::details
 
+#pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_CODE_ARENA")
 #pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_DWARF_EH_FRAME")
 #pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_RESERVE_ALLOC")
 #pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_SECTION_MEMORY_MANAGER_HAS_WIN64_SEH")
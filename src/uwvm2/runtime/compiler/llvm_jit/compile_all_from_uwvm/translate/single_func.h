@@ -104,6 +104,10 @@ struct full_function_symbol_t
     // True when the pre-link callback ran successfully on task fragments before linking.
     bool llvm_jit_task_modules_pre_link_optimized{};
 
+    // True when the functions were emitted with tiered loop reentry wrappers. Such code differs from plain LLVM code for the same
+    // module, so the runtime keys its object cache on it.
+    bool tiered_loop_reentry_entries{};
+
     // Reserved aggregate metrics for downstream runtime/JIT bookkeeping.
     ::std::size_t local_count{};
     ::std::size_t local_bytes_max{};
@@ -144,6 +148,11 @@ struct compile_option
     // Emits compact DWARF/unwind metadata for optimized trap-stack reconstruction.
     bool emit_unwind_call_stack_frames{};
 
+    // Per-import typed-entry slots for imports linked to a defined function of another module.  A non-zero slot is called with
+    // the Wasm ABI; zero keeps the raw host bridge.
+    ::std::uintptr_t cross_module_import_entry_base_address{};
+    ::std::size_t cross_module_import_entry_count{};
+
     // Optional per-task module callback used by optimization/linking pipelines.
     llvm_jit_task_module_pre_link_callback_t llvm_jit_task_module_pre_link_callback{};
     void* llvm_jit_task_module_pre_link_callback_context{};
@@ -749,7 +758,9 @@ namespace details
                                     bool emit_tiered_loop_reentry_entries = false,
                                     bool emit_call_stack_frames = true,
                                     bool emit_unwind_call_stack_frames = false,
-                                    ::uwvm2::utils::container::vector<tiered_loop_reentry_storage_t>* tiered_loop_reentries_out = nullptr) UWVM_THROWS
+                                    ::uwvm2::utils::container::vector<tiered_loop_reentry_storage_t>* tiered_loop_reentries_out = nullptr,
+                                    ::std::uintptr_t cross_module_import_entry_base_address = 0u,
+                                    ::std::size_t cross_module_import_entry_count = 0uz) UWVM_THROWS
     {
         auto const function_index{local_func_storage.function_index};
         auto const code_begin{local_func_storage.code_begin};
@@ -1028,7 +1039,9 @@ namespace details
                                                                                      lazy_defined_targets_are_atomic,
                                                                                      emit_tiered_loop_reentry_entries,
                                                                                      emit_call_stack_frames,
-                                                                                     emit_unwind_call_stack_frames)};
+                                                                                     emit_unwind_call_stack_frames,
+                                                                                     cross_module_import_entry_base_address,
+                                                                                     cross_module_import_entry_count)};
 
         using wasm_value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
 
@@ -1369,7 +1382,9 @@ namespace details
                                     options.emit_tiered_loop_reentry_entries,
                                     options.emit_call_stack_frames,
                                     options.emit_unwind_call_stack_frames,
-                                    ::std::addressof(local_func_storage.tiered_loop_reentries));
+                                    ::std::addressof(local_func_storage.tiered_loop_reentries),
+                                    options.cross_module_import_entry_base_address,
+                                    options.cross_module_import_entry_count);
         return local_func_storage;
     }
 
@@ -1853,6 +1868,7 @@ inline constexpr full_function_symbol_t compile_all_from_uwvm(::uwvm2::uwvm::run
                                                               compile_task_split_config split_config = {}) UWVM_THROWS
 {
     full_function_symbol_t storage{};
+    storage.tiered_loop_reentry_entries = options.emit_tiered_loop_reentry_entries;
     auto const validation_module{details::build_runtime_validation_module(curr_module)};
 
     split_config = resolve_effective_compile_task_split_config(curr_module, split_config, extra_compile_threads);
@@ -1988,6 +2004,7 @@ inline constexpr full_function_symbol_t compile_all_from_uwvm_single_func(::uwvm
                                                                           ::uwvm2::validation::error::code_validation_error_impl& err) UWVM_THROWS
 {
     full_function_symbol_t storage{};
+    storage.tiered_loop_reentry_entries = options.emit_tiered_loop_reentry_entries;
     if(curr_module.local_defined_function_vec_storage.empty()) { return storage; }
     auto const validation_module{details::build_runtime_validation_module(curr_module)};
 
@@ -1209,6 +1209,13 @@ struct runtime_direct_callee_resolution_t
 
     // Best-known function type for the resolved target.  This may be present even when the target is not directly callable.
     ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const* function_type_ptr{};
+
+    // True when the chain ends at a defined function owned by another module; `function_type_ptr` is its type.
+    bool cross_module_defined{};
+
+    // Final local-imported (built-in host) module and function index when the chain ends there; null otherwise.
+    ::uwvm2::uwvm::wasm::type::local_imported_t const* local_imported_module_ptr{};
+    ::std::size_t local_imported_index{};
 };
 
 // Runtime initialization rejects import-alias cycles and unresolved chains.  A post-initialization function alias chain
@@ -1287,6 +1294,7 @@ struct runtime_direct_callee_resolution_t
                 {
                     // The target is a valid defined function, but not one stored in this module's local-function array.
                     // Keep the type so the caller can still use the raw ABI path safely.
+                    result.cross_module_defined = true;
                     return result;
                 }
 
@@ -1305,6 +1313,11 @@ struct runtime_direct_callee_resolution_t
                 return result;
             }
             case function_link_kind::local_imported:
+            {
+                result.local_imported_module_ptr = curr->target.local_imported.module_ptr;
+                result.local_imported_index = curr->target.local_imported.index;
+                return result;
+            }
             case function_link_kind::unresolved:
             {
                 return result;
@@ -1395,6 +1408,10 @@ struct runtime_direct_callee_resolution_t
     get_llvm_lazy_typed_entry_target_table_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module) noexcept
 { return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_lazy_typed_entry_targets"); }
 
+[[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string
+    get_llvm_cross_module_import_entry_table_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module) noexcept
+{ return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_cross_module_import_entries"); }
+
 [[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string
     get_llvm_call_indirect_table_view_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module) noexcept
 { return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_call_indirect_table_views"); }
@@ -3376,6 +3393,10 @@ struct runtime_local_func_llvm_jit_emit_state_t
     // Enables DWARF/unwind metadata so optimized native frames can be mapped back to Wasm frames.
     bool emit_unwind_call_stack_frames{};
 
+    // Base address/count of typed-entry slots, indexed by import, for imports linked to another module's defined function.
+    ::std::uintptr_t cross_module_import_entry_base_address{};
+    ::std::size_t cross_module_import_entry_count{};
+
     // Runtime local-function storage being compiled.
     local_func_storage_t const* local_func_storage_ptr{};
 
@@ -3492,7 +3513,9 @@ struct runtime_local_func_llvm_jit_emit_state_t
                                                                                        bool lazy_defined_targets_are_atomic = false,
                                                                                        bool emit_tiered_loop_reentry_entries = false,
                                                                                        bool emit_call_stack_frames = true,
-                                                                                       bool emit_unwind_call_stack_frames = false) noexcept
+                                                                                       bool emit_unwind_call_stack_frames = false,
+                                                                                       ::std::uintptr_t cross_module_import_entry_base_address = 0u,
+                                                                                       ::std::size_t cross_module_import_entry_count = 0uz) noexcept
 {
     state = {};
     state.verify_llvm_jit_ir = verify_llvm_jit_ir;
@@ -3505,6 +3528,8 @@ struct runtime_local_func_llvm_jit_emit_state_t
     state.emit_tiered_loop_reentry_entries = emit_tiered_loop_reentry_entries;
     state.emit_call_stack_frames = emit_call_stack_frames;
     state.emit_unwind_call_stack_frames = emit_unwind_call_stack_frames;
+    state.cross_module_import_entry_base_address = cross_module_import_entry_base_address;
+    state.cross_module_import_entry_count = cross_module_import_entry_count;
 
     auto function_type_ptr{local_func_storage.function_type_ptr};
     auto wasm_code_ptr{local_func_storage.wasm_code_ptr};
@@ -4992,6 +5017,219 @@ template <typename EmitBridgeCallFromBuffers>
         });
 }
 
+// Emit a typed native call to a WASI Preview1 local-imported function.  The runtime supplies a per-function C++ thunk whose
+// signature is the caller module address followed by the Wasm scalars, so arguments stay in registers instead of being
+// spilled into raw parameter/result buffers for the generic host bridge.  Returns an invalid result when the callee is not a
+// built-in WASI Preview1 function; the caller then falls back to the raw host bridge.
+[[nodiscard]] inline constexpr llvm_jit_runtime_raw_bridge_emit_result_t
+    try_emit_runtime_local_func_llvm_jit_wasip1_direct_call(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                            ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                                            runtime_direct_callee_resolution_t const& callee_resolution,
+                                                            ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const& wasm_function_type,
+                                                            llvm_jit_prepared_wasm_call_operands_t const& prepared_call) noexcept
+{
+    if(!state.valid || state.llvm_context_holder == nullptr || state.llvm_module == nullptr || state.ir_builder == nullptr) [[unlikely]] { return {}; }
+    if(callee_resolution.local_imported_module_ptr == nullptr) { return {}; }
+
+    auto const direct_entry{::uwvm2::runtime::lib::llvm_jit_find_wasip1_direct_host_api(callee_resolution.local_imported_module_ptr,
+                                                                                         callee_resolution.local_imported_index)};
+    if(direct_entry.entry_address == 0u || direct_entry.function_name.empty()) { return {}; }
+
+    // Import linking already checked the signature; the arity check keeps a stale or mismatched entry from reaching the native ABI.
+    auto const abi_layout{prepared_call.abi_layout};
+    if(direct_entry.parameter_count != abi_layout.parameter_count || direct_entry.result_count != abi_layout.result_count) [[unlikely]] { return {}; }
+
+    auto& llvm_context{*state.llvm_context_holder};
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_module{state.llvm_module};
+    auto llvm_intptr_type{::llvm::Type::getIntNTy(llvm_context, static_cast<unsigned>(sizeof(::std::uintptr_t) * 8u))};
+
+    auto wasm_entry_function_type{get_llvm_function_type_from_wasm_function_type(llvm_context, wasm_function_type)};
+    if(wasm_entry_function_type == nullptr) [[unlikely]] { return {}; }
+
+    ::uwvm2::utils::container::vector<::llvm::Type*> host_parameter_types{};
+    host_parameter_types.reserve(wasm_entry_function_type->getNumParams() + 1uz);
+    host_parameter_types.push_back(llvm_intptr_type);
+    for(auto parameter_type: wasm_entry_function_type->params()) { host_parameter_types.push_back(parameter_type); }
+    auto host_function_type{::llvm::FunctionType::get(wasm_entry_function_type->getReturnType(),
+                                                      ::llvm::ArrayRef<::llvm::Type*>{host_parameter_types.data(), host_parameter_types.size()},
+                                                      false)};
+
+    // The symbol name depends only on the WASI function name, so cached objects keep resolving to the current process's thunk.
+    auto const symbol_name{::uwvm2::utils::container::u8concat_uwvm(u8"uwvm_wasip1_", direct_entry.function_name)};
+    auto symbol_name_ref{get_llvm_string_ref(symbol_name)};
+    ::llvm::sys::DynamicLibrary::AddSymbol(symbol_name_ref, reinterpret_cast<void*>(direct_entry.entry_address));
+
+    auto thunk_function{llvm_module->getFunction(symbol_name_ref)};
+    if(thunk_function == nullptr)
+    {
+        thunk_function = ::llvm::Function::Create(host_function_type, ::llvm::Function::ExternalLinkage, symbol_name_ref, llvm_module);
+        apply_llvm_jit_host_calling_conv(*thunk_function);
+    }
+    if(thunk_function->getFunctionType() != host_function_type) [[unlikely]] { return {}; }
+
+    auto const module_symbol_name{get_llvm_runtime_module_object_symbol_name(runtime_module)};
+    auto module_address{get_llvm_external_host_object_address(ir_builder,
+                                                              reinterpret_cast<::std::uintptr_t>(::std::addressof(runtime_module)),
+                                                              ::uwvm2::utils::container::u8string_view{module_symbol_name.data(), module_symbol_name.size()})};
+    if(module_address == nullptr) [[unlikely]] { return {}; }
+
+    ::uwvm2::utils::container::vector<::llvm::Value*> host_arguments{};
+    host_arguments.reserve(prepared_call.arguments.size() + 1uz);
+    host_arguments.push_back(module_address);
+    for(auto argument: prepared_call.arguments) { host_arguments.push_back(argument); }
+
+    auto call_inst{apply_llvm_jit_host_calling_conv(
+        ir_builder.CreateCall(thunk_function, ::llvm::ArrayRef<::llvm::Value*>{host_arguments.data(), host_arguments.size()}))};
+    if(call_inst == nullptr) [[unlikely]] { return {}; }
+
+    // Wasm i32 scalars are `int_least32_t` in the thunk; targets whose C ABI widens 32-bit integers (e.g. riscv64) expect sign extension.
+    auto const llvm_i32_type{::llvm::Type::getInt32Ty(llvm_context)};
+    for(unsigned parameter_index{1u}; parameter_index != host_function_type->getNumParams(); ++parameter_index)
+    {
+        if(host_function_type->getParamType(parameter_index) == llvm_i32_type) { call_inst->addParamAttr(parameter_index, ::llvm::Attribute::SExt); }
+    }
+    if(host_function_type->getReturnType() == llvm_i32_type) { call_inst->addRetAttr(::llvm::Attribute::SExt); }
+
+    return {.valid = true, .bridge_call = call_inst, .result_value = prepared_call.has_result ? call_inst : nullptr};
+}
+
+// Result of attempting to emit a typed-entry fast path with a raw-call fallback.
+// Whether a tail call to a callee of `callee_function_type` can become an LLVM `musttail` call.  LLVM requires the caller
+// and callee prototypes to match exactly; the tiered core carries hidden reentry arguments and never qualifies.
+[[nodiscard]] inline constexpr bool can_emit_runtime_local_func_llvm_jit_musttail_call(runtime_local_func_llvm_jit_emit_state_t const& state,
+                                                                                       ::llvm::FunctionType const* callee_function_type) noexcept
+{
+    return callee_function_type != nullptr && state.llvm_function != nullptr && state.llvm_function == state.llvm_public_entry_function &&
+           !state.emit_tiered_loop_reentry_entries && state.llvm_function->getFunctionType() == callee_function_type;
+}
+
+// Emit `musttail call` followed by `ret` so the callee reuses the caller's native frame.  The caller's logical call-stack
+// frame is popped first: the callee pushes its own, and `musttail` must be immediately followed by the return.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_musttail_return(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                     ::llvm::FunctionType* callee_function_type,
+                                                                                     ::llvm::Value* callee,
+                                                                                     ::llvm::ArrayRef<::llvm::Value*> call_arguments) noexcept
+{
+    auto& ir_builder{*state.ir_builder};
+    if(state.emit_call_stack_frames && !emit_runtime_local_func_llvm_jit_call_stack_pop(ir_builder)) [[unlikely]] { return false; }
+
+    auto tail_call{apply_llvm_jit_wasm_calling_conv(ir_builder.CreateCall(callee_function_type, callee, call_arguments))};
+    if(tail_call == nullptr) [[unlikely]] { return false; }
+    tail_call->setTailCallKind(::llvm::CallInst::TCK_MustTail);
+
+    if(callee_function_type->getReturnType()->isVoidTy()) { ir_builder.CreateRetVoid(); }
+    else
+    {
+        ir_builder.CreateRet(tail_call);
+    }
+    return true;
+}
+
+struct llvm_jit_lazy_typed_target_emit_result_t
+{
+    // True when either the known typed entry or fast/slow split was emitted successfully.
+    bool valid{};
+
+    // Typed result value, or null for void callees.
+    ::llvm::Value* result_value{};
+
+    // True when the call was emitted in tail position as `musttail` + `ret` on every path; nothing is left to push.
+    bool returned{};
+};
+
+// Emit a call to an import linked to a defined function of another module.  Separately materialized modules cannot name each
+// other's typed entries, so the runtime publishes the callee's typed entry into a per-import slot once every module is
+// materialized.  A published slot is called with the Wasm ABI, keeping arguments in registers; an empty slot (callee not
+// materialized, or a mode that never publishes) falls back to the raw host bridge.  Returns an invalid result when the callee
+// is not such a target or the slot table is absent.
+[[nodiscard]] inline constexpr llvm_jit_lazy_typed_target_emit_result_t
+    try_emit_runtime_local_func_llvm_jit_cross_module_import_call(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                  ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                                                  validation_module_traits_t::wasm_u32 func_index,
+                                                                  runtime_direct_callee_resolution_t const& callee_resolution,
+                                                                  ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const& wasm_function_type,
+                                                                  llvm_jit_prepared_wasm_call_operands_t const& prepared_call) noexcept
+{
+    if(!state.valid || state.llvm_context_holder == nullptr || state.ir_builder == nullptr) [[unlikely]] { return {}; }
+    if(!callee_resolution.cross_module_defined || callee_resolution.function_type_ptr == nullptr ||
+       !runtime_wasm_function_types_equal(*callee_resolution.function_type_ptr, wasm_function_type))
+    {
+        return {};
+    }
+    auto const import_index{static_cast<::std::size_t>(func_index)};
+    if(state.cross_module_import_entry_base_address == 0u || import_index >= state.cross_module_import_entry_count) { return {}; }
+
+    auto& llvm_context{*state.llvm_context_holder};
+    auto& ir_builder{*state.ir_builder};
+    auto const curr_block{ir_builder.GetInsertBlock()};
+    if(curr_block == nullptr || curr_block->getParent() == nullptr) [[unlikely]] { return {}; }
+
+    auto llvm_function{curr_block->getParent()};
+    auto llvm_intptr_type{::llvm::Type::getIntNTy(llvm_context, static_cast<unsigned>(sizeof(::std::uintptr_t) * 8u))};
+    auto callee_function_type{get_llvm_function_type_from_wasm_function_type(llvm_context, wasm_function_type)};
+    if(callee_function_type == nullptr) [[unlikely]] { return {}; }
+
+    // The slot table lives in the runtime; a named host symbol keeps cached objects relocatable across processes.
+    auto const table_symbol_name{get_llvm_cross_module_import_entry_table_symbol_name(runtime_module)};
+    auto table_base_ptr{
+        get_llvm_external_host_object_pointer(ir_builder,
+                                              state.cross_module_import_entry_base_address,
+                                              llvm_intptr_type,
+                                              ::uwvm2::utils::container::u8string_view{table_symbol_name.data(), table_symbol_name.size()})};
+    if(table_base_ptr == nullptr) [[unlikely]] { return {}; }
+
+    auto slot_ptr{ir_builder.CreateInBoundsGEP(llvm_intptr_type,
+                                               table_base_ptr,
+                                               {::llvm::ConstantInt::get(llvm_intptr_type, import_index)},
+                                               get_llvm_string_ref(u8"call.xmod.slot.ptr"))};
+    // Slots are written after this module is compiled; a volatile load keeps the initial zero from being constant-folded.
+    auto typed_entry_address{ir_builder.CreateLoad(llvm_intptr_type, slot_ptr, get_llvm_string_ref(u8"call.xmod.entry.addr"))};
+    typed_entry_address->setVolatile(true);
+    typed_entry_address->setAlignment(::llvm::Align{alignof(::std::uintptr_t)});
+
+    auto fast_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call.xmod.fast"), llvm_function)};
+    auto slow_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call.xmod.slow"), llvm_function)};
+    auto merge_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call.xmod.merge"), llvm_function)};
+    if(fast_block == nullptr || slow_block == nullptr || merge_block == nullptr) [[unlikely]] { return {}; }
+
+    ir_builder.CreateCondBr(ir_builder.CreateICmpNE(typed_entry_address, ::llvm::ConstantInt::get(llvm_intptr_type, 0u)), fast_block, slow_block);
+
+    ir_builder.SetInsertPoint(fast_block);
+    auto typed_entry_function_ptr{
+        ir_builder.CreateIntToPtr(typed_entry_address, get_llvm_pointer_type(callee_function_type), get_llvm_string_ref(u8"call.xmod.entry.ptr"))};
+    auto fast_call{apply_llvm_jit_wasm_calling_conv(
+        ir_builder.CreateCall(callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}))};
+    if(fast_call == nullptr) [[unlikely]] { return {}; }
+    auto fast_end_block{ir_builder.GetInsertBlock()};
+    ir_builder.CreateBr(merge_block);
+
+    ir_builder.SetInsertPoint(slow_block);
+    auto const raw_bridge_result{emit_runtime_local_func_llvm_jit_raw_host_wasm_call(state,
+                                                                                     runtime_module,
+                                                                                     func_index,
+                                                                                     wasm_function_type,
+                                                                                     prepared_call,
+                                                                                     get_llvm_string_ref(u8"call.params"),
+                                                                                     get_llvm_string_ref(u8"call.result.buf"))};
+    if(!raw_bridge_result.valid) [[unlikely]] { return {}; }
+    auto slow_end_block{ir_builder.GetInsertBlock()};
+    ir_builder.CreateBr(merge_block);
+
+    ir_builder.SetInsertPoint(merge_block);
+    ::llvm::Value* result_value{};
+    if(prepared_call.has_result)
+    {
+        if(raw_bridge_result.result_value == nullptr) [[unlikely]] { return {}; }
+        auto result_phi{ir_builder.CreatePHI(fast_call->getType(), 2u, get_llvm_string_ref(u8"call.xmod.result"))};
+        result_phi->addIncoming(fast_call, fast_end_block);
+        result_phi->addIncoming(raw_bridge_result.result_value, slow_end_block);
+        result_value = result_phi;
+    }
+
+    return {.valid = true, .result_value = result_value};
+}
+
 // Emit a raw call through the lazy-defined target table for a local defined function whose typed entry is not available.
 [[nodiscard]] inline constexpr llvm_jit_runtime_raw_bridge_emit_result_t
     emit_runtime_local_func_llvm_jit_raw_target_wasm_call(runtime_local_func_llvm_jit_emit_state_t& state,
@@ -5070,25 +5308,17 @@ template <typename EmitBridgeCallFromBuffers>
         });
 }
 
-// Result of attempting to emit the lazy typed-entry fast path.
-struct llvm_jit_lazy_typed_target_emit_result_t
-{
-    // True when either the known typed entry or fast/slow split was emitted successfully.
-    bool valid{};
-
-    // Typed result value, or null for void callees.
-    ::llvm::Value* result_value{};
-};
-
 // Emit a local call through the typed-entry lazy target table when possible.  If the typed entry is missing at runtime,
-// the generated code falls back to the raw target entry and merges results with a PHI.
+// the generated code falls back to the raw target entry and merges results with a PHI.  With `tail_position`, a typed
+// entry whose prototype matches the caller is entered with `musttail`; only the raw fallback then reaches the merge block.
 [[nodiscard]] inline constexpr llvm_jit_lazy_typed_target_emit_result_t
     emit_runtime_local_func_llvm_jit_lazy_typed_target_wasm_call(runtime_local_func_llvm_jit_emit_state_t& state,
                                                                  ::std::size_t local_function_index,
                                                                  ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const& wasm_function_type,
                                                                  llvm_jit_prepared_wasm_call_operands_t const& prepared_call,
                                                                  ::llvm::StringRef param_buffer_name,
-                                                                 ::llvm::StringRef result_buffer_name) noexcept
+                                                                 ::llvm::StringRef result_buffer_name,
+                                                                 bool tail_position = false) noexcept
 {
     if(!state.valid || state.llvm_context_holder == nullptr || state.ir_builder == nullptr) [[unlikely]] { return {}; }
     if(state.lazy_defined_typed_entry_target_base_address == 0u || state.lazy_defined_raw_call_target_base_address == 0u ||
@@ -5118,6 +5348,7 @@ struct llvm_jit_lazy_typed_target_emit_result_t
                                               ::uwvm2::utils::container::u8string_view{target_table_symbol_name.data(), target_table_symbol_name.size()})};
     if(target_base_ptr == nullptr) [[unlikely]] { return {}; }
 
+    bool const typed_tail_call{tail_position && can_emit_runtime_local_func_llvm_jit_musttail_call(state, callee_function_type)};
     auto const known_typed_entry_targets{reinterpret_cast<::std::uintptr_t const*>(state.lazy_defined_typed_entry_target_base_address)};
     auto const known_typed_entry_address{known_typed_entry_targets[local_function_index]};
     if(!state.lazy_defined_targets_are_atomic && known_typed_entry_address != 0u)
@@ -5126,6 +5357,15 @@ struct llvm_jit_lazy_typed_target_emit_result_t
         // runtime fast/slow control-flow split.
         auto typed_entry_function_ptr{get_llvm_host_pointer_value(ir_builder, known_typed_entry_address, get_llvm_pointer_type(callee_function_type))};
         if(typed_entry_function_ptr == nullptr) [[unlikely]] { return {}; }
+        if(typed_tail_call)
+        {
+            if(!emit_runtime_local_func_llvm_jit_musttail_return(
+                   state, callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()})) [[unlikely]]
+            {
+                return {};
+            }
+            return {.valid = true, .result_value = nullptr, .returned = true};
+        }
         auto typed_call{apply_llvm_jit_wasm_calling_conv(
             ir_builder.CreateCall(callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}))};
         if(typed_call == nullptr) [[unlikely]] { return {}; }
@@ -5153,11 +5393,24 @@ struct llvm_jit_lazy_typed_target_emit_result_t
     ir_builder.SetInsertPoint(fast_block);
     auto typed_entry_function_ptr{
         ir_builder.CreateIntToPtr(typed_entry_address, get_llvm_pointer_type(callee_function_type), get_llvm_string_ref(u8"call.lazy.typed.entry.ptr"))};
-    auto fast_call{apply_llvm_jit_wasm_calling_conv(
-        ir_builder.CreateCall(callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}))};
-    if(fast_call == nullptr) [[unlikely]] { return {}; }
-    auto fast_end_block{ir_builder.GetInsertBlock()};
-    ir_builder.CreateBr(merge_block);
+    ::llvm::CallInst* fast_call{};
+    ::llvm::BasicBlock* fast_end_block{};
+    if(typed_tail_call)
+    {
+        if(!emit_runtime_local_func_llvm_jit_musttail_return(
+               state, callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()})) [[unlikely]]
+        {
+            return {};
+        }
+    }
+    else
+    {
+        fast_call = apply_llvm_jit_wasm_calling_conv(
+            ir_builder.CreateCall(callee_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}));
+        if(fast_call == nullptr) [[unlikely]] { return {}; }
+        fast_end_block = ir_builder.GetInsertBlock();
+        ir_builder.CreateBr(merge_block);
+    }
 
     ir_builder.SetInsertPoint(slow_block);
     auto const raw_target_result{emit_runtime_local_func_llvm_jit_raw_target_wasm_call(state,
@@ -5172,7 +5425,12 @@ struct llvm_jit_lazy_typed_target_emit_result_t
 
     ir_builder.SetInsertPoint(merge_block);
     ::llvm::Value* result_value{};
-    if(prepared_call.has_result)
+    if(prepared_call.has_result && typed_tail_call)
+    {
+        // The fast path already returned, so the raw target is the merge block's only predecessor.
+        result_value = raw_target_result.result_value;
+    }
+    else if(prepared_call.has_result)
     {
         if(fast_call == nullptr || raw_target_result.result_value == nullptr) [[unlikely]] { return {}; }
         // Both paths implement the same Wasm call.  Merge their typed results so the caller sees one SSA value regardless
@@ -5566,6 +5824,15 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
                 emit_lazy_defined_target_call(local_function_index, get_llvm_string_ref(u8"call.params"), get_llvm_string_ref(u8"call.result.buf"))};
             if(lazy_target_result.valid) { return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, lazy_target_result.result_value); }
         }
+        else
+        {
+            // WASI Preview1 imports never become Wasm-level call targets, so routing them through a typed thunk keeps tier
+            // replacement intact while skipping the raw-buffer bridge.
+            auto const callee_resolution{resolve_runtime_direct_callee(*runtime_module_ptr, func_index)};
+            auto const wasip1_result{
+                try_emit_runtime_local_func_llvm_jit_wasip1_direct_call(state, *runtime_module_ptr, callee_resolution, *callee_type_ptr, prepared_call)};
+            if(wasip1_result.valid) { return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, wasip1_result.result_value); }
+        }
 
         auto const raw_bridge_result{emit_runtime_local_func_llvm_jit_raw_host_wasm_call(state,
                                                                                          *runtime_module_ptr,
@@ -5612,6 +5879,19 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
             return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, call_value);
         }
 
+        // Defined functions of other modules are reached through the runtime-published typed-entry slot.
+        auto const cross_module_result{try_emit_runtime_local_func_llvm_jit_cross_module_import_call(
+            state, *runtime_module_ptr, func_index, callee_resolution, *callee_type_ptr, prepared_call)};
+        if(cross_module_result.valid)
+        {
+            return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, cross_module_result.result_value);
+        }
+
+        // Built-in WASI Preview1 targets have a typed native entry; every other host target keeps the raw bridge.
+        auto const wasip1_result{
+            try_emit_runtime_local_func_llvm_jit_wasip1_direct_call(state, *runtime_module_ptr, callee_resolution, *callee_type_ptr, prepared_call)};
+        if(wasip1_result.valid) { return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, wasip1_result.result_value); }
+
         auto const raw_bridge_result{emit_runtime_local_func_llvm_jit_raw_host_wasm_call(state,
                                                                                          *runtime_module_ptr,
                                                                                          func_index,
@@ -5648,10 +5928,12 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
 // Lower Wasm `call_indirect`.  The generated code checks table bounds, null element, and canonical type id before choosing
 // a typed entry fast path or raw-entry fallback for the selected table element.  WebAssembly 1.0/MVP normally selects the
 // default table; reference-types/multi-table support must keep the decoded table index, runtime table storage, and this
-// selected-table lowering in sync.
+// selected-table lowering in sync.  With `tail_position`, a typed entry whose prototype matches the caller is entered with
+// `musttail` and returns directly; the raw-entry path still joins the merge block for the caller to return from.
 [[nodiscard]] inline constexpr bool try_emit_runtime_local_func_llvm_jit_call_indirect(runtime_local_func_llvm_jit_emit_state_t& state,
                                                                                        validation_module_traits_t::wasm_u32 type_index,
-                                                                                       validation_module_traits_t::wasm_u32 table_index) noexcept
+                                                                                       validation_module_traits_t::wasm_u32 table_index,
+                                                                                       bool tail_position = false) noexcept
 {
     if(!state.valid || state.local_func_storage_ptr == nullptr || state.llvm_context_holder == nullptr || state.llvm_module == nullptr ||
        state.ir_builder == nullptr || state.control_stack.empty()) [[unlikely]]
@@ -5795,11 +6077,25 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
     auto typed_entry_function_ptr{ir_builder.CreateIntToPtr(typed_entry_address,
                                                             get_llvm_pointer_type(typed_entry_function_type),
                                                             get_llvm_string_ref(u8"call_indirect.typed.entry.ptr"))};
-    auto typed_call{apply_llvm_jit_wasm_calling_conv(
-        ir_builder.CreateCall(typed_entry_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}))};
-    if(typed_call == nullptr) [[unlikely]] { return false; }
-    auto typed_end_block{ir_builder.GetInsertBlock()};
-    ir_builder.CreateBr(merge_block);
+    bool const typed_tail_call{tail_position && can_emit_runtime_local_func_llvm_jit_musttail_call(state, typed_entry_function_type)};
+    ::llvm::CallInst* typed_call{};
+    ::llvm::BasicBlock* typed_end_block{};
+    if(typed_tail_call)
+    {
+        if(!emit_runtime_local_func_llvm_jit_musttail_return(
+               state, typed_entry_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()})) [[unlikely]]
+        {
+            return false;
+        }
+    }
+    else
+    {
+        typed_call = apply_llvm_jit_wasm_calling_conv(
+            ir_builder.CreateCall(typed_entry_function_type, typed_entry_function_ptr, {prepared_call.arguments.data(), prepared_call.arguments.size()}));
+        if(typed_call == nullptr) [[unlikely]] { return false; }
+        typed_end_block = ir_builder.GetInsertBlock();
+        ir_builder.CreateBr(merge_block);
+    }
 
     ir_builder.SetInsertPoint(raw_block);
     auto const raw_bridge_result{emit_runtime_local_func_llvm_jit_runtime_raw_host_bridge_call(
@@ -5826,7 +6122,12 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
 
     ir_builder.SetInsertPoint(merge_block);
     ::llvm::Value* result_value{};
-    if(prepared_call.has_result)
+    if(prepared_call.has_result && typed_tail_call)
+    {
+        // The typed path already returned, so the raw entry is the merge block's only predecessor.
+        result_value = raw_bridge_result.result_value;
+    }
+    else if(prepared_call.has_result)
     {
         if(typed_call == nullptr || raw_bridge_result.result_value == nullptr) [[unlikely]] { return false; }
         auto result_phi{ir_builder.CreatePHI(typed_call->getType(), 2u, get_llvm_string_ref(u8"call_indirect.result"))};
@@ -5838,6 +6139,94 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
     return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, result_value);
 }
 
+// Lower Wasm `return_call`.  A call to a local defined function whose prototype matches the caller becomes `musttail call` +
+// `ret`, so unbounded mutual recursion runs in constant native stack: full-module JIT calls the definition directly, lazy
+// JIT calls the published typed entry (a not-yet-compiled target takes one ordinary raw-entry hop).  Imports, routed
+// (tiered) calls, and prototype mismatches keep the ordinary call lowering followed by `return`: same results, but each hop
+// still takes a native frame.
+[[nodiscard]] inline constexpr bool try_emit_runtime_local_func_llvm_jit_return_call(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                     validation_module_traits_t::wasm_u32 func_index) noexcept
+{
+    if(!state.valid || state.local_func_storage_ptr == nullptr || state.llvm_context_holder == nullptr || state.llvm_module == nullptr ||
+       state.ir_builder == nullptr || state.control_stack.empty()) [[unlikely]]
+    {
+        return false;
+    }
+
+    if(!state.control_stack.back().is_reachable) { return true; }
+
+    auto runtime_module_ptr{state.local_func_storage_ptr->runtime_module_ptr};
+    if(runtime_module_ptr == nullptr) [[unlikely]] { return false; }
+
+    auto const has_lazy_defined_target_tables{state.lazy_defined_raw_call_target_base_address != 0u &&
+                                              state.lazy_defined_typed_entry_target_base_address != 0u && state.lazy_defined_raw_call_target_count != 0uz &&
+                                              state.lazy_defined_typed_entry_target_count != 0uz};
+    auto const import_func_count{runtime_module_ptr->imported_function_vec_storage.size()};
+    if(!state.route_wasm_calls_through_runtime_bridge && static_cast<::std::size_t>(func_index) >= import_func_count)
+    {
+        auto callee_type_ptr{resolve_runtime_callee_function_type(*runtime_module_ptr, func_index)};
+        if(callee_type_ptr == nullptr) [[unlikely]] { return false; }
+
+        if(has_lazy_defined_target_tables)
+        {
+            auto const callee_function_type{get_llvm_function_type_from_wasm_function_type(*state.llvm_context_holder, *callee_type_ptr)};
+            if(!can_emit_runtime_local_func_llvm_jit_musttail_call(state, callee_function_type))
+            {
+                return try_emit_runtime_local_func_llvm_jit_call(state, func_index) && try_emit_runtime_local_func_llvm_jit_return(state);
+            }
+
+            auto const prepared_call{prepare_runtime_local_func_llvm_jit_wasm_call_operands(state, *callee_type_ptr)};
+            if(!prepared_call.valid) [[unlikely]] { return false; }
+
+            auto const local_function_index{static_cast<::std::size_t>(func_index) - import_func_count};
+            auto const lazy_target_result{emit_runtime_local_func_llvm_jit_lazy_typed_target_wasm_call(state,
+                                                                                                       local_function_index,
+                                                                                                       *callee_type_ptr,
+                                                                                                       prepared_call,
+                                                                                                       get_llvm_string_ref(u8"call.params"),
+                                                                                                       get_llvm_string_ref(u8"call.result.buf"),
+                                                                                                       true)};
+            if(!lazy_target_result.valid) [[unlikely]] { return false; }
+            if(lazy_target_result.returned)
+            {
+                enter_runtime_local_func_llvm_jit_unreachable_control_context(state);
+                return true;
+            }
+
+            return push_runtime_local_func_llvm_jit_wasm_call_result(state, prepared_call, lazy_target_result.result_value) &&
+                   try_emit_runtime_local_func_llvm_jit_return(state);
+        }
+
+        auto callee_function{
+            get_or_create_llvm_wasm_function_declaration(*state.llvm_module, *state.llvm_context_holder, *runtime_module_ptr, func_index, *callee_type_ptr)};
+        if(callee_function != nullptr && can_emit_runtime_local_func_llvm_jit_musttail_call(state, callee_function->getFunctionType()))
+        {
+            auto const prepared_call{prepare_runtime_local_func_llvm_jit_wasm_call_operands(state, *callee_type_ptr)};
+            if(!prepared_call.valid) [[unlikely]] { return false; }
+
+            if(!emit_runtime_local_func_llvm_jit_musttail_return(
+                   state, callee_function->getFunctionType(), callee_function, {prepared_call.arguments.data(), prepared_call.arguments.size()})) [[unlikely]]
+            {
+                return false;
+            }
+
+            enter_runtime_local_func_llvm_jit_unreachable_control_context(state);
+            return true;
+        }
+    }
+
+    return try_emit_runtime_local_func_llvm_jit_call(state, func_index) && try_emit_runtime_local_func_llvm_jit_return(state);
+}
+
+// Lower Wasm `return_call_indirect`: the checked `call_indirect` sequence in tail position, then `return` for the paths
+// that could not be entered with `musttail`.
+[[nodiscard]] inline constexpr bool try_emit_runtime_local_func_llvm_jit_return_call_indirect(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                              validation_module_traits_t::wasm_u32 type_index,
+                                                                                              validation_module_traits_t::wasm_u32 table_index) noexcept
+{
+    return try_emit_runtime_local_func_llvm_jit_call_indirect(state, type_index, table_index, true) && try_emit_runtime_local_func_llvm_jit_return(state);
+}
+
 // Generic constant emitter used by numeric opcode case files.  The supplied callable builds the LLVM constant lazily in
 // the current context.
 template <typename CreateValue>
@@ -63,6 +63,7 @@ for(;;)
 #include "opcode/control_flow_cases.h"
 #include "opcode/branch_cases.h"
 #include "opcode/call_cases.h"
+#include "opcode/tail_call_cases.h"
 #include "opcode/variable_cases.h"
 #include "opcode/memory_cases.h"
 #include "opcode/const_compare_cases.h"
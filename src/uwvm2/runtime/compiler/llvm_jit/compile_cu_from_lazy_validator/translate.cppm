@@ -30,6 +30,7 @@ module;
 #include <exception>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
@@ -40,7 +41,7 @@ module;
 # include <llvm/Analysis/TargetTransformInfo.h>
 # include <llvm/Config/llvm-config.h>
 # include <llvm/ExecutionEngine/ExecutionEngine.h>
-# include <llvm/ExecutionEngine/MCJIT.h>
+# include <llvm/ExecutionEngine/Orc/Core.h>
 # include <llvm/ExecutionEngine/SectionMemoryManager.h>
 # include <llvm/InitializePasses.h>
 # include <llvm/IR/LegacyPassManager.h>
@@ -57,6 +58,7 @@ module;
 #  include <unwind.h>
 # endif
 # include "../compile_all_from_uwvm/translate/section_memory_manager.h"
+# include "../compile_all_from_uwvm/translate/orc_session.h"
 #endif
 
 export module uwvm2.runtime.compiler.llvm_jit.compile_cu_from_lazy_validator:translate;
@@ -40,7 +40,7 @@
 # if defined(UWVM_RUNTIME_LLVM_JIT)
 #  include <llvm/Analysis/TargetTransformInfo.h>
 #  include <llvm/ExecutionEngine/ExecutionEngine.h>
-#  include <llvm/ExecutionEngine/MCJIT.h>
+#  include <llvm/ExecutionEngine/Orc/Core.h>
 #  include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #  include <llvm/Config/llvm-config.h>
 #  include <llvm/InitializePasses.h>
@@ -55,6 +55,7 @@
 #  include <llvm/Transforms/Scalar/GVN.h>
 #  include <llvm/Transforms/Utils.h>
 #  include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/section_memory_manager.h>
+#  include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/orc_session.h>
 # endif
 // import
 # include <fast_io.h>
@@ -94,7 +95,7 @@ extern "C" void __deregister_frame(void const*);
 // Lazy LLVM JIT compilation support for runtime-local Wasm functions.
 //
 // This header builds a light-weight lazy compilation index from the already-finalized runtime module, validates function
-// bodies on demand when requested, emits LLVM IR through the full-module translator helpers, and materializes MCJIT
+// bodies on demand when requested, emits LLVM IR through the full-module translator helpers, and materializes ORC
 // entry addresses only when a function is first needed.  The current LLVM lazy backend uses whole functions as compile
 // units; grouping is applied at materialization time to compile small direct-call neighborhoods together.
 UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator
@@ -273,6 +274,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
 
         // Primary compile unit for this function, or SIZE_MAX until initialization fills the record.
         ::std::size_t primary_cu_index{SIZE_MAX};
+
+        // Static call-graph cluster containing this function, or SIZE_MAX until initialization fills the record.
+        ::std::size_t call_graph_cluster_index{SIZE_MAX};
     };
 
     // Runtime-owned result of lazily materializing one local function.
@@ -281,9 +285,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         // Validation/emission metadata returned by the full LLVM JIT local-function translator.
         local_func_storage_t local_func{};
 
-        // The LLVM context and MCJIT engine must outlive all native entry addresses returned from the engine.
-        ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext> llvm_context_holder{};
-        ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> llvm_jit_engine{};
+        // ORC resource tracker that owns the linked object behind the addresses below.  Only the record that installed an
+        // object holds its tracker; grouped records point into the owner's object.  The LLVM IR and context are dropped as
+        // soon as the object is built, so nothing but native code stays resident per materialized unit.
+        ::llvm::orc::ResourceTrackerSP llvm_jit_resource_tracker{};
+
+        // Footprint of the object owned by `llvm_jit_resource_tracker`, taken from the ORC session once the object is linked.
+        // The tiered runtime scans guest stacks for these ranges before it frees a superseded object.
+        ::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_orc_code_range> llvm_jit_code_ranges{};
+        ::std::size_t llvm_jit_object_bytes{};
+
+        // Local-function index of the record that owns the object this record's addresses point into (itself for a single
+        // function), or SIZE_MAX before the first successful materialization.
+        ::std::size_t llvm_jit_object_owner_index{SIZE_MAX};
 
         // Typed public entry point for normal Wasm-to-Wasm calls.
         ::std::uintptr_t entry_address{};
@@ -296,7 +310,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         ::uwvm2::utils::container::vector<::std::uintptr_t> tiered_loop_reentry_raw_entry_addresses{};
 
         // Publication flag for the non-atomic payload above.  Writers fill `entry_address`, `raw_entry_address`,
-        // reentry vectors, and the LLVM owner fields first, then publish `ready == true` with release semantics.  Readers
+        // reentry vectors, and the resource tracker first, then publish `ready == true` with release semantics.  Readers
         // must use an acquire load through `std::atomic_ref<bool>` before touching those payload fields.
         //
         // Keep the storage type as `bool` rather than `std::atomic_bool`: the project vector type moves these records, and
@@ -313,6 +327,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
     // Complete lazy LLVM JIT state for one runtime module.
     struct lazy_module_storage_t
     {
+        // ORC JITDylib holding every object materialized for this module, created on first materialization.  Removing it
+        // frees all of the module's lazy native code at once.
+        ::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_orc_dylib orc_dylib{};
+
         // Shared metadata container used by eager translator helpers; only `local_funcs` is filled eagerly here.
         full_function_symbol_t compiled{};
 
@@ -327,6 +345,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
 
         // Native materialization results indexed by local-defined-function index.
         ::uwvm2::utils::container::vector<lazy_materialized_function_storage_t> materialized_functions{};
+
+        // Static call-graph clusters in CSR form: cluster `c` owns the local function indices in
+        // `call_graph_cluster_members[call_graph_cluster_begins[c], call_graph_cluster_begins[c + 1])`.  Built once from the
+        // Wasm bytes, so the membership (and therefore the cache key of a clustered object) never depends on timing.
+        ::uwvm2::utils::container::vector<::std::size_t> call_graph_cluster_begins{};
+        ::uwvm2::utils::container::vector<::std::size_t> call_graph_cluster_members{};
     };
 
     // Options consumed by the lazy LLVM JIT validator and materializer.
@@ -343,10 +367,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         // Validation policy for lazy compilation.
         lazy_validation_mode validation_mode{lazy_validation_mode::validate_on_lazy_compile};
 
-        // LLVM code-generation level used for the MCJIT engine and local optimization pipeline.
+        // LLVM code-generation level used for the lazy target machine and local optimization pipeline.
         ::llvm::CodeGenOptLevel codegen_opt_level{::llvm::CodeGenOptLevel::Less};
 
-        // Optional listener for object/debug registration events emitted by MCJIT.
+        // Optional listener for object/debug registration events emitted by the ORC object linking layer.
         ::llvm::JITEventListener* jit_event_listener{};
     };
 
@@ -389,56 +413,41 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
 # endif
         }
 
-        // Serializes LLVM MCJIT materialization and publication.  LLVM global initialization, MCJIT object finalization,
-        // and this runtime's target-table publication are intentionally kept behind a narrow process-local lock because
-        // those phases touch process-wide LLVM state and runtime dispatch tables.
-        inline ::std::atomic_flag lazy_materialize_lock = ATOMIC_FLAG_INIT;
+        // Serializes only the publication of materialized functions.  Each materialization owns its LLVMContext,
+        // TargetMachine and object cache, and links into its own ORC resource tracker, so IR emission, codegen, and object
+        // finalization run concurrently on every worker.  What remains shared is this runtime's target-table publication and the JIT
+        // event listener's code-range/debug-object tables, which are appended under this lock.
+        inline ::std::atomic_flag lazy_publish_lock = ATOMIC_FLAG_INIT;
 
         // Spin-based guard used by scheduler worker callbacks, where blocking primitives may not be available in all
-        // supported builds.
-        struct lazy_materialize_lock_guard
+        // supported builds.  Critical sections are a few table updates, so spinning stays short.
+        struct lazy_publish_lock_guard
         {
-            inline constexpr lazy_materialize_lock_guard() noexcept
+            inline constexpr lazy_publish_lock_guard() noexcept
             {
                 // Acquire pairs with the guard destructor's release clear.  This is a real lock boundary, not just a
-                // contention flag: after the loop exits, this worker sees all materialization and target-table side
-                // effects sequenced before the previous holder released the flag.
-                while(lazy_materialize_lock.test_and_set(::std::memory_order_acquire)) { ::uwvm2::utils::thread::lazy_compile_thread_yield(); }
+                // contention flag: after the loop exits, this worker sees all target-table side effects sequenced before
+                // the previous holder released the flag.
+                while(lazy_publish_lock.test_and_set(::std::memory_order_acquire)) { ::uwvm2::utils::thread::lazy_compile_thread_yield(); }
             }
 
-            inline constexpr lazy_materialize_lock_guard(lazy_materialize_lock_guard const&) noexcept = delete;
-            inline constexpr lazy_materialize_lock_guard& operator= (lazy_materialize_lock_guard const&) noexcept = delete;
+            inline constexpr lazy_publish_lock_guard(lazy_publish_lock_guard const&) noexcept = delete;
+            inline constexpr lazy_publish_lock_guard& operator= (lazy_publish_lock_guard const&) noexcept = delete;
 
-            inline constexpr ~lazy_materialize_lock_guard()
+            inline constexpr ~lazy_publish_lock_guard()
             {
                 // Release publishes every protected side effect before another worker's acquire succeeds.  Wait-free
                 // readers still synchronize through their own `ready` or state acquire loads; this lock only orders
-                // workers with respect to each other.
-                lazy_materialize_lock.clear(::std::memory_order_release);
+                // publishers with respect to each other.
+                lazy_publish_lock.clear(::std::memory_order_release);
             }
         };
 
-        // Extracts the first argument type from selected LLVM member functions.  LLVM has changed ownership parameter
-        // spellings across versions, so these aliases preserve ABI compatibility without version-specific branches.
-        template <typename>
-        struct member_function_first_argument;
-
-        template <typename R, typename C, typename A0>
-        struct member_function_first_argument<R (C::*)(A0)>
-        {
-            using type = A0;
-        };
-
-        using llvm_module_owner_t = typename member_function_first_argument<decltype(&::llvm::ExecutionEngine::addModule)>::type;
-        using llvm_jit_memory_manager_owner_t = typename member_function_first_argument<decltype(&::llvm::EngineBuilder::setMCJITMemoryManager)>::type;
-        using llvm_jit_function_address_name_t =
-            ::std::remove_cvref_t<typename member_function_first_argument<decltype(&::llvm::ExecutionEngine::getFunctionAddress)>::type>;
-
         // Shorthand aliases for the eager LLVM JIT compiler and its internal helper namespace.
         namespace all_compile = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm;
         namespace all_details = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::details;
 
-        // Cached host target description used for every lazy MCJIT engine in this process.
+        // Cached host target description used for every lazy target machine in this process.
         struct llvm_jit_native_target_config
         {
             // Host CPU name as returned by LLVM, stored to keep StringRef inputs alive.
@@ -650,7 +659,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return ::uwvm2::utils::container::u8string{all_details::get_uwvm_u8string_view(host_cpu_name)};
         }
 
-        // Returns the process-wide native target configuration used for lazy MCJIT materialization.
+        // Returns the process-wide native target configuration used for lazy ORC materialization.
         [[nodiscard]] inline constexpr llvm_jit_native_target_config const& get_llvm_jit_native_target_config() noexcept
         {
             static llvm_jit_native_target_config config{.cpu_name = get_llvm_jit_host_cpu_name(),
@@ -858,7 +867,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return true;
         }
 
-        // Verifies and lightly optimizes a lazy LLVM module before MCJIT takes ownership of it.
+        // Verifies and lightly optimizes a lazy LLVM module before it is compiled to an object.
         [[nodiscard]] inline constexpr bool optimize_lazy_llvm_jit_module(::llvm::Module& module,
                                                                           ::llvm::TargetMachine& target_machine,
                                                                           ::llvm::CodeGenOptLevel codegen_opt_level,
@@ -886,24 +895,80 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return all_details::verify_llvm_jit_module(module, verify_llvm_jit_ir);
         }
 
-        // Resolves an emitted LLVM function symbol to a native address, with a fallback for older MCJIT paths that need
-        // an IR Function pointer before materializing the address.
-        [[nodiscard]] inline constexpr ::std::uintptr_t resolve_llvm_function_address(::llvm::ExecutionEngine& engine,
-                                                                                      ::uwvm2::utils::container::u8string const& function_name) noexcept
+        // Frees the native code owned by a lazy object's resource tracker.  Used before rebuilding a record and when a
+        // freshly added object cannot be published.
+        inline void remove_lazy_llvm_jit_resource_tracker(::llvm::orc::ResourceTrackerSP& resource_tracker) noexcept
+        {
+            if(resource_tracker == nullptr) { return; }
+            // Drop the footprint recorded at link time so the session table does not outlive the object.
+            if(auto const orc_session{::uwvm2::runtime::compiler::llvm_jit::details::get_runtime_llvm_jit_orc_session()}; orc_session != nullptr)
+            {
+                static_cast<void>(::uwvm2::runtime::compiler::llvm_jit::details::take_runtime_llvm_jit_orc_loaded_object(*orc_session, *resource_tracker));
+            }
+            ::llvm::consumeError(resource_tracker->remove());
+            resource_tracker.reset();
+        }
+
+        // Clears a record's object footprint together with its tracker.
+        inline void reset_lazy_llvm_jit_object(lazy_materialized_function_storage_t& materialized) noexcept
         {
-            llvm_jit_function_address_name_t function_address_name{function_name.data(), function_name.data() + function_name.size()};
-            auto const direct_function_address{engine.getFunctionAddress(function_address_name)};
-            if(direct_function_address != 0u) [[likely]] { return static_cast<::std::uintptr_t>(direct_function_address); }
+            remove_lazy_llvm_jit_resource_tracker(materialized.llvm_jit_resource_tracker);
+            materialized.llvm_jit_code_ranges.clear();
+            materialized.llvm_jit_object_bytes = 0uz;
+            materialized.llvm_jit_object_owner_index = SIZE_MAX;
+        }
 
-            auto found_function{engine.FindFunctionNamed(all_details::get_llvm_string_ref(function_name))};
-            if(found_function == nullptr || found_function->isDeclaration()) [[unlikely]] { return 0u; }
+        // Installs a linked object's tracker on its owner record and moves the footprint ORC recorded for it onto the record.
+        inline void install_lazy_llvm_jit_object(lazy_materialized_function_storage_t& owner, ::llvm::orc::ResourceTrackerSP resource_tracker) noexcept
+        {
+            if(auto const orc_session{::uwvm2::runtime::compiler::llvm_jit::details::get_runtime_llvm_jit_orc_session()}; orc_session != nullptr)
+            {
+                auto loaded{::uwvm2::runtime::compiler::llvm_jit::details::take_runtime_llvm_jit_orc_loaded_object(*orc_session, *resource_tracker)};
+                owner.llvm_jit_code_ranges = ::std::move(loaded.code_ranges);
+                owner.llvm_jit_object_bytes = loaded.bytes;
+            }
+            owner.llvm_jit_resource_tracker = ::std::move(resource_tracker);
+        }
+
+        // Compiles a lazy LLVM IR module on the calling thread and adds the object to the module's ORC JITDylib.  The object
+        // cache is consulted before code generation, exactly as the MCJIT path did.
+        [[nodiscard]] inline ::llvm::orc::ResourceTrackerSP
+            add_lazy_llvm_jit_object(runtime_module_storage_t const& curr_module,
+                                     lazy_module_storage_t& storage,
+                                     lazy_compile_options const& options,
+                                     ::llvm::Module& llvm_module,
+                                     ::llvm::TargetMachine& target_machine,
+                                     ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache& llvm_jit_object_cache) noexcept
+        {
+            namespace jit_details = ::uwvm2::runtime::compiler::llvm_jit::details;
+            auto const orc_session{jit_details::get_runtime_llvm_jit_orc_session()};
+            if(orc_session == nullptr) [[unlikely]] { return {}; }
+            auto const orc_dylib{storage.orc_dylib.get_or_create(*orc_session, curr_module.module_name)};
+            if(orc_dylib == nullptr) [[unlikely]] { return {}; }
+
+            // Lazy unwind call-stack mode routes the object through the debug layer, which keeps DWARF sections as well as
+            // executable ones so optimized inline Wasm frames can be reconstructed by the listener.
+            return jit_details::add_runtime_llvm_jit_orc_module(*orc_session,
+                                                                *orc_dylib,
+                                                                llvm_module,
+                                                                target_machine,
+                                                                ::std::addressof(llvm_jit_object_cache),
+                                                                options.jit_event_listener);
+        }
 
-            auto const function_address{engine.getPointerToFunction(found_function)};
-            return function_address == nullptr ? 0u : reinterpret_cast<::std::uintptr_t>(function_address);
+        // Resolves an emitted LLVM function symbol in the module's JITDylib.  The first lookup into a new object links it.
+        [[nodiscard]] inline ::std::uintptr_t resolve_llvm_function_address(lazy_module_storage_t& storage,
+                                                                            ::uwvm2::utils::container::u8string const& function_name) noexcept
+        {
+            namespace jit_details = ::uwvm2::runtime::compiler::llvm_jit::details;
+            auto const orc_session{jit_details::get_runtime_llvm_jit_orc_session()};
+            auto const orc_dylib{::std::atomic_ref<::llvm::orc::JITDylib*>{storage.orc_dylib.dylib}.load(::std::memory_order_acquire)};
+            if(orc_session == nullptr || orc_dylib == nullptr) [[unlikely]] { return 0u; }
+            return jit_details::lookup_runtime_llvm_jit_orc_symbol(*orc_session, *orc_dylib, function_name);
         }
 
-        // Takes a single-function LLVM IR module, creates an MCJIT engine, resolves all public/raw entry points, and
-        // stores the owning LLVM objects in the materialized function record.
+        // Takes a single-function LLVM IR module, compiles it into the module's ORC JITDylib, resolves all public/raw entry
+        // points, and stores the object's resource tracker in the materialized function record.
         [[nodiscard]] inline constexpr bool materialize_lazy_local_function(runtime_module_storage_t const& curr_module,
                                                                             lazy_module_storage_t& storage,
                                                                             lazy_compile_options const& options,
@@ -920,8 +985,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             materialized.raw_entry_address = 0u;
             materialized.tiered_loop_reentries.clear();
             materialized.tiered_loop_reentry_raw_entry_addresses.clear();
-            materialized.llvm_jit_engine.reset();
-            materialized.llvm_context_holder.reset();
+            reset_lazy_llvm_jit_object(materialized);
 
             // The emitter hands over a context/module pair.  Materialization consumes both and clears `llvm_ir_storage`
             // so failed callers cannot accidentally reuse moved LLVM objects.
@@ -937,8 +1001,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
 
             if(llvm_context_holder == nullptr || llvm_module == nullptr) [[unlikely]] { return false; }
 
-            // Match the eager JIT target setup but keep the target machine temporary; MCJIT takes ownership through
-            // ExecutionEngine creation below.
+            // Match the eager JIT target setup.  The target machine is per call, so concurrent materializations never share
+            // code-generation state; only the final object add and symbol lookup touch the process ORC session.
             auto const& target_config{get_llvm_jit_native_target_config()};
             ::llvm::SmallVector<::llvm::StringRef, 16> host_target_attributes{};
             append_llvm_jit_host_target_attribute_refs(target_config.feature_storage, host_target_attributes);
@@ -982,6 +1046,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
                                                                                   u8"validation-mode",
                                                                                   lazy_validation_mode_name(options.validation_mode));
+                auto const wasip1_direct_policy{::uwvm2::runtime::lib::llvm_jit_wasip1_direct_calls_enabled() ? u8"on" : u8"off"};
+                ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy, u8"wasip1-direct", wasip1_direct_policy);
+                // `-Rtiered` T1 units carry loop reentry wrappers that `-Rjit` units do not.
+                auto const tiered_loop_reentry_policy{options.compile_options.emit_tiered_loop_reentry_entries ? u8"on" : u8"off"};
+                ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                                  u8"tiered-loop-reentry",
+                                                                                  tiered_loop_reentry_policy);
                 append_llvm_jit_native_target_codegen_policy(llvm_jit_cache_codegen_policy, target_config);
             }
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
@@ -992,43 +1063,28 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache llvm_jit_object_cache{::std::move(llvm_jit_cache_context),
                                                                                           ::uwvm2::runtime::llvm_jit_cache::default_cache_policy()};
 
-            auto raw_engine{
-                ::llvm::EngineBuilder(details::llvm_module_owner_t{llvm_module.release()})
-                    .setEngineKind(::llvm::EngineKind::JIT)
-                    .setOptLevel(options.codegen_opt_level)
-                    .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                    .setMAttrs(host_target_attributes)
-                    .setMCJITMemoryManager(llvm_jit_memory_manager_owner_t{
-                        ::uwvm2::utils::container::make_delete_owned<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_section_memory_manager>()
-                            .release()})
-                    .create(target_machine.get())};
-            if(raw_engine == nullptr) [[unlikely]] { return false; }
-            static_cast<void>(target_machine.release());
-
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> engine{raw_engine};
-
-            engine->setObjectCache(::std::addressof(llvm_jit_object_cache));
-            if(options.jit_event_listener != nullptr)
-            {
-                // Lazy unwind call-stack mode needs DWARF sections as well as executable sections so optimized inline
-                // Wasm frames can be reconstructed from the generated object.
-                engine->setProcessAllSections(true);
-                engine->RegisterJITEventListener(options.jit_event_listener);
-            }
-            engine->finalizeObject();
-            engine->setObjectCache(nullptr);
+            auto resource_tracker{add_lazy_llvm_jit_object(curr_module, storage, options, *llvm_module, *target_machine, llvm_jit_object_cache)};
+            if(resource_tracker == nullptr) [[unlikely]] { return false; }
 
             auto const import_func_count{curr_module.imported_function_vec_storage.size()};
             auto const function_index{import_func_count + local_function_index};
             using wasm_u32 = all_details::validation_module_traits_t::wasm_u32;
-            if(function_index > static_cast<::std::size_t>((::std::numeric_limits<wasm_u32>::max)())) [[unlikely]] { return false; }
+            if(function_index > static_cast<::std::size_t>((::std::numeric_limits<wasm_u32>::max)())) [[unlikely]]
+            {
+                remove_lazy_llvm_jit_resource_tracker(resource_tracker);
+                return false;
+            }
 
             auto const function_index_u32{static_cast<wasm_u32>(function_index)};
             auto const function_name{all_details::get_llvm_wasm_function_name(curr_module, function_index_u32)};
             auto const raw_function_name{all_details::get_llvm_wasm_raw_function_name(curr_module, function_index_u32)};
-            auto const entry_address{resolve_llvm_function_address(*engine, function_name)};
-            auto const raw_entry_address{resolve_llvm_function_address(*engine, raw_function_name)};
-            if(entry_address == 0u || raw_entry_address == 0u) [[unlikely]] { return false; }
+            auto const entry_address{resolve_llvm_function_address(storage, function_name)};
+            auto const raw_entry_address{resolve_llvm_function_address(storage, raw_function_name)};
+            if(entry_address == 0u || raw_entry_address == 0u) [[unlikely]]
+            {
+                remove_lazy_llvm_jit_resource_tracker(resource_tracker);
+                return false;
+            }
 
             // Reentry wrapper symbols are generated only when the local-function translator discovered tiered loop
             // reentry points.  Preserve descriptor/address index alignment for later lookup by Wasm offset.
@@ -1039,24 +1095,28 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             {
                 auto const reentry_function_name{
                     all_details::get_llvm_wasm_tiered_loop_reentry_raw_function_name(curr_module, function_index_u32, reentry.wasm_code_offset)};
-                auto const reentry_address{resolve_llvm_function_address(*engine, reentry_function_name)};
-                if(reentry_address == 0u) [[unlikely]] { return false; }
+                auto const reentry_address{resolve_llvm_function_address(storage, reentry_function_name)};
+                if(reentry_address == 0u) [[unlikely]]
+                {
+                    remove_lazy_llvm_jit_resource_tracker(resource_tracker);
+                    return false;
+                }
                 materialized.tiered_loop_reentry_raw_entry_addresses.push_back(reentry_address);
             }
 
             materialized.entry_address = entry_address;
             materialized.raw_entry_address = raw_entry_address;
-            materialized.llvm_context_holder = ::std::move(llvm_context_holder);
-            materialized.llvm_jit_engine = ::std::move(engine);
+            materialized.llvm_jit_object_owner_index = local_function_index;
+            install_lazy_llvm_jit_object(materialized, ::std::move(resource_tracker));
             // Publish the fully resolved single-function record.  Acquire readers can now safely consume the addresses
-            // and rely on the owner fields to keep MCJIT code alive.
+            // and rely on the resource tracker to keep the linked code alive.
             store_lazy_materialized_ready(materialized, true, ::std::memory_order_release);
             return true;
         }
 
-        // Materializes a group of local functions from one LLVM IR module.  All functions share one LLVMContext and one
-        // MCJIT engine; the first materialized record owns those objects and therefore owns the native code lifetime for
-        // the whole group.
+        // Materializes a group of local functions from one LLVM IR module.  All functions share one object in the module's
+        // ORC JITDylib; the first materialized record owns its resource tracker and therefore owns the native code lifetime
+        // for the whole group.
         [[nodiscard]] inline constexpr bool
             materialize_lazy_local_function_group(runtime_module_storage_t const& curr_module,
                                                   lazy_module_storage_t& storage,
@@ -1077,11 +1137,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 materialized.raw_entry_address = 0u;
                 materialized.tiered_loop_reentries.clear();
                 materialized.tiered_loop_reentry_raw_entry_addresses.clear();
-                materialized.llvm_jit_engine.reset();
-                materialized.llvm_context_holder.reset();
+                reset_lazy_llvm_jit_object(materialized);
             }
 
-            // Consume the generated IR module exactly once; the resulting ExecutionEngine owns the compiled code.
+            // Consume the generated IR module exactly once; the resulting resource tracker owns the compiled code.
             if(!llvm_ir_storage.emitted || llvm_ir_storage.llvm_context_holder == nullptr || llvm_ir_storage.llvm_module == nullptr) [[unlikely]]
             {
                 return false;
@@ -1095,7 +1154,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             if(llvm_context_holder == nullptr || llvm_module == nullptr) [[unlikely]] { return false; }
 
             // Select and apply the native target before verification/optimization so data-layout-sensitive passes see
-            // the same target description used by MCJIT.
+            // the same target description used for code generation.
             auto const& target_config{get_llvm_jit_native_target_config()};
             ::llvm::SmallVector<::llvm::StringRef, 16> host_target_attributes{};
             append_llvm_jit_host_target_attribute_refs(target_config.feature_storage, host_target_attributes);
@@ -1168,6 +1227,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
                                                                                   u8"validation-mode",
                                                                                   lazy_validation_mode_name(options.validation_mode));
+                auto const wasip1_direct_policy{::uwvm2::runtime::lib::llvm_jit_wasip1_direct_calls_enabled() ? u8"on" : u8"off"};
+                ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy, u8"wasip1-direct", wasip1_direct_policy);
+                // `-Rtiered` T1 units carry loop reentry wrappers that `-Rjit` units do not.
+                auto const tiered_loop_reentry_policy{options.compile_options.emit_tiered_loop_reentry_entries ? u8"on" : u8"off"};
+                ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                                  u8"tiered-loop-reentry",
+                                                                                  tiered_loop_reentry_policy);
                 append_llvm_jit_native_target_codegen_policy(llvm_jit_cache_codegen_policy, target_config);
             }
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
@@ -1178,45 +1244,29 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache llvm_jit_object_cache{::std::move(llvm_jit_cache_context),
                                                                                           ::uwvm2::runtime::llvm_jit_cache::default_cache_policy()};
 
-            auto raw_engine{
-                ::llvm::EngineBuilder(details::llvm_module_owner_t{llvm_module.release()})
-                    .setEngineKind(::llvm::EngineKind::JIT)
-                    .setOptLevel(options.codegen_opt_level)
-                    .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                    .setMAttrs(host_target_attributes)
-                    .setMCJITMemoryManager(llvm_jit_memory_manager_owner_t{
-                        ::uwvm2::utils::container::make_delete_owned<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_section_memory_manager>()
-                            .release()})
-                    .create(target_machine.get())};
-            if(raw_engine == nullptr) [[unlikely]] { return false; }
-            static_cast<void>(target_machine.release());
-
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> engine{raw_engine};
-
-            engine->setObjectCache(::std::addressof(llvm_jit_object_cache));
-            if(options.jit_event_listener != nullptr)
-            {
-                // Lazy group materialization can inline or split functions across one MCJIT object; keep DWARF metadata
-                // available to the listener so traps can recover the logical Wasm stack.
-                engine->setProcessAllSections(true);
-                engine->RegisterJITEventListener(options.jit_event_listener);
-            }
-            engine->finalizeObject();
-            engine->setObjectCache(nullptr);
+            auto resource_tracker{add_lazy_llvm_jit_object(curr_module, storage, options, *llvm_module, *target_machine, llvm_jit_object_cache)};
+            if(resource_tracker == nullptr) [[unlikely]] { return false; }
+
+            // Grouped addresses all point into the object above, so any failure below must free it before returning.
+            auto const fail{[&resource_tracker]() noexcept
+                            {
+                                remove_lazy_llvm_jit_resource_tracker(resource_tracker);
+                                return false;
+                            }};
 
             auto const import_func_count{curr_module.imported_function_vec_storage.size()};
             using wasm_u32 = all_details::validation_module_traits_t::wasm_u32;
             for(auto const local_function_index: local_function_indices)
             {
                 auto const function_index{import_func_count + local_function_index};
-                if(function_index > static_cast<::std::size_t>((::std::numeric_limits<wasm_u32>::max)())) [[unlikely]] { return false; }
+                if(function_index > static_cast<::std::size_t>((::std::numeric_limits<wasm_u32>::max)())) [[unlikely]] { return fail(); }
 
                 auto const function_index_u32{static_cast<wasm_u32>(function_index)};
                 auto const function_name{all_details::get_llvm_wasm_function_name(curr_module, function_index_u32)};
                 auto const raw_function_name{all_details::get_llvm_wasm_raw_function_name(curr_module, function_index_u32)};
-                auto const entry_address{resolve_llvm_function_address(*engine, function_name)};
-                auto const raw_entry_address{resolve_llvm_function_address(*engine, raw_function_name)};
-                if(entry_address == 0u || raw_entry_address == 0u) [[unlikely]] { return false; }
+                auto const entry_address{resolve_llvm_function_address(storage, function_name)};
+                auto const raw_entry_address{resolve_llvm_function_address(storage, raw_function_name)};
+                if(entry_address == 0u || raw_entry_address == 0u) [[unlikely]] { return fail(); }
 
                 auto& materialized{storage.materialized_functions.index_unchecked(local_function_index)};
                 materialized.tiered_loop_reentries = materialized.local_func.tiered_loop_reentries;
@@ -1226,21 +1276,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 {
                     auto const reentry_function_name{
                         all_details::get_llvm_wasm_tiered_loop_reentry_raw_function_name(curr_module, function_index_u32, reentry.wasm_code_offset)};
-                    auto const reentry_address{resolve_llvm_function_address(*engine, reentry_function_name)};
-                    if(reentry_address == 0u) [[unlikely]] { return false; }
+                    auto const reentry_address{resolve_llvm_function_address(storage, reentry_function_name)};
+                    if(reentry_address == 0u) [[unlikely]] { return fail(); }
                     materialized.tiered_loop_reentry_raw_entry_addresses.push_back(reentry_address);
                 }
                 materialized.entry_address = entry_address;
                 materialized.raw_entry_address = raw_entry_address;
+                materialized.llvm_jit_object_owner_index = local_function_indices.front_unchecked();
             }
 
-            // Store the shared LLVM owners on one record before publishing any member as ready.  Other records contain
-            // only addresses into the same engine, so the owner record must remain alive for as long as any grouped
+            // Store the shared resource tracker on one record before publishing any member as ready.  Other records contain
+            // only addresses into the same object, so the owner record must remain alive for as long as any grouped
             // address can be called.
             auto const owner_local_function_index{local_function_indices.front_unchecked()};
             auto& owner{storage.materialized_functions.index_unchecked(owner_local_function_index)};
-            owner.llvm_context_holder = ::std::move(llvm_context_holder);
-            owner.llvm_jit_engine = ::std::move(engine);
+            install_lazy_llvm_jit_object(owner, ::std::move(resource_tracker));
             for(auto const local_function_index: local_function_indices)
             {
                 auto& materialized{storage.materialized_functions.index_unchecked(local_function_index)};
@@ -1251,6 +1301,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return true;
         }
 
+        // Count and Wasm-byte budgets shared by opportunistic groups and static call-graph clusters.
+        inline constexpr ::std::size_t lazy_group_function_budget{16uz};
+        inline constexpr ::std::size_t lazy_group_code_size_budget{8uz * 1024uz};
+
         // Returns the Wasm byte size used by the lazy grouping budget.
         [[nodiscard]] inline constexpr ::std::size_t lazy_group_function_code_size(lazy_module_storage_t const& storage,
                                                                                    ::std::size_t local_function_index) noexcept
@@ -1346,8 +1400,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                                                              ::std::size_t entry_local_function_index,
                                                              ::uwvm2::utils::container::vector<::std::size_t>& out) noexcept
         {
-            constexpr ::std::size_t group_function_budget{16uz};
-            constexpr ::std::size_t group_code_size_budget{8uz * 1024uz};
+            constexpr ::std::size_t group_function_budget{lazy_group_function_budget};
+            constexpr ::std::size_t group_code_size_budget{lazy_group_code_size_budget};
             out.clear();
             if(entry_local_function_index >= storage.functions.size()) [[unlikely]] { return; }
 
@@ -1384,7 +1438,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
 
         // In native-unwind call-stack mode, a Wasm call should correspond to a physical generated frame.  Build the
         // complete transitive graph rooted at the demanded entry, including current-module call_indirect table targets,
-        // so one MCJIT object can avoid lazy raw-entry trampolines across Wasm-to-Wasm edges.
+        // so one JIT object can avoid lazy raw-entry trampolines across Wasm-to-Wasm edges.
         inline constexpr void collect_lazy_unwind_direct_call_group(runtime_module_storage_t const& curr_module,
                                                                     lazy_module_storage_t& storage,
                                                                     ::std::size_t entry_local_function_index,
@@ -1424,6 +1478,97 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             }
         }
 
+        // Partitions local functions into static call-graph clusters.  Roots are taken in ascending local index order; each
+        // cluster absorbs its members' unassigned direct local callees breadth-first until the shared group budget is reached,
+        // so every member is reachable from the root by direct calls.  Unrelated functions are never packed in just to fill
+        // the budget: they would be compiled (and cached) whenever the root is demanded without ever running.  Every
+        // function lands in exactly one cluster, and the result depends only on the module bytes, so a cluster materializes
+        // to the same object (and cache key) on every run.
+        inline constexpr void build_lazy_call_graph_clusters(runtime_module_storage_t const& curr_module, lazy_module_storage_t& storage) UWVM_THROWS
+        {
+            auto const local_count{storage.functions.size()};
+            storage.call_graph_cluster_begins.clear();
+            storage.call_graph_cluster_members.clear();
+            storage.call_graph_cluster_members.reserve(local_count);
+
+            ::uwvm2::utils::container::vector<::std::size_t> callees{};
+            ::std::size_t next_unassigned{};
+            for(;;)
+            {
+                while(next_unassigned != local_count &&
+                      storage.functions.index_unchecked(next_unassigned).call_graph_cluster_index != SIZE_MAX)
+                {
+                    ++next_unassigned;
+                }
+                if(next_unassigned == local_count) { break; }
+
+                auto const cluster_index{storage.call_graph_cluster_begins.size()};
+                auto const cluster_begin{storage.call_graph_cluster_members.size()};
+                storage.call_graph_cluster_begins.push_back(cluster_begin);
+
+                ::std::size_t total_code_size{};
+                auto const try_assign{[&](::std::size_t local_function_index, bool force) constexpr noexcept -> bool
+                                      {
+                                          auto& fn{storage.functions.index_unchecked(local_function_index)};
+                                          if(fn.call_graph_cluster_index != SIZE_MAX) { return false; }
+
+                                          auto const code_size{lazy_group_function_code_size(storage, local_function_index)};
+                                          auto const accounted_code_size{code_size == 0uz ? 1uz : code_size};
+                                          if(!force)
+                                          {
+                                              auto const member_count{storage.call_graph_cluster_members.size() - cluster_begin};
+                                              if(member_count >= lazy_group_function_budget) { return false; }
+                                              if(total_code_size >= lazy_group_code_size_budget) { return false; }
+                                              if(accounted_code_size > lazy_group_code_size_budget - total_code_size) { return false; }
+                                          }
+
+                                          fn.call_graph_cluster_index = cluster_index;
+                                          storage.call_graph_cluster_members.push_back(local_function_index);
+                                          total_code_size += accounted_code_size;
+                                          return true;
+                                      }};
+
+                // The root is always admitted, even when it alone exceeds the code-size budget.
+                static_cast<void>(try_assign(next_unassigned, true));
+
+                // Breadth-first over direct call edges; the cluster ends when the budget is reached or no reachable callee is left.
+                for(auto cursor{cluster_begin}; cursor != storage.call_graph_cluster_members.size(); ++cursor)
+                {
+                    auto const full{storage.call_graph_cluster_members.size() - cluster_begin >= lazy_group_function_budget ||
+                                    total_code_size >= lazy_group_code_size_budget};
+                    if(full) { break; }
+
+                    auto const member{storage.call_graph_cluster_members.index_unchecked(cursor)};
+                    if(!collect_direct_defined_callees(curr_module, member, callees)) { continue; }
+                    for(auto const callee_local_index: callees)
+                    {
+                        if(callee_local_index < local_count) { static_cast<void>(try_assign(callee_local_index, false)); }
+                    }
+                }
+            }
+            storage.call_graph_cluster_begins.push_back(storage.call_graph_cluster_members.size());
+        }
+
+        // Copies the static cluster containing `local_function_index` into `out`, in cluster member order.
+        inline constexpr void collect_lazy_call_graph_cluster(lazy_module_storage_t const& storage,
+                                                              ::std::size_t local_function_index,
+                                                              ::uwvm2::utils::container::vector<::std::size_t>& out) noexcept
+        {
+            out.clear();
+            if(local_function_index >= storage.functions.size()) [[unlikely]] { return; }
+
+            auto const cluster_index{storage.functions.index_unchecked(local_function_index).call_graph_cluster_index};
+            if(cluster_index == SIZE_MAX || cluster_index + 1uz >= storage.call_graph_cluster_begins.size()) [[unlikely]]
+            {
+                out.push_back(local_function_index);
+                return;
+            }
+
+            auto const begin{storage.call_graph_cluster_begins.index_unchecked(cluster_index)};
+            auto const end{storage.call_graph_cluster_begins.index_unchecked(cluster_index + 1uz)};
+            for(auto i{begin}; i != end; ++i) { out.push_back(storage.call_graph_cluster_members.index_unchecked(i)); }
+        }
+
         // Claims, validates, emits, materializes, publishes, and marks ready a group of lazy LLVM JIT functions.
         inline constexpr void compile_lazy_local_function_group(runtime_module_storage_t const& curr_module,
                                                                 lazy_module_storage_t& storage,
@@ -1433,16 +1578,20 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                                                                 void (*publish_materialized_function)(void*, ::std::size_t) noexcept = nullptr,
                                                                 void* publish_user_data = nullptr) UWVM_THROWS
         {
+            auto const use_static_clusters{!options.compile_options.emit_unwind_call_stack_frames &&
+                                           ::uwvm2::runtime::llvm_jit_cache::default_cache_policy().enable};
+
             ::uwvm2::utils::container::vector<::std::size_t> candidate_group{};
             if(options.compile_options.emit_unwind_call_stack_frames)
             {
                 collect_lazy_unwind_direct_call_group(curr_module, storage, entry_local_function_index, candidate_group);
             }
-            else if(::uwvm2::runtime::llvm_jit_cache::default_cache_policy().enable)
+            else if(use_static_clusters)
             {
                 // Opportunistic lazy groups depend on scheduler timing and existing cache warmth.  Cache-enabled lazy JIT
-                // uses one stable demanded function per cache object; cache-disabled mode keeps group warmup below.
-                candidate_group.push_back(entry_local_function_index);
+                // materializes the demanded function's static cluster instead, whose membership is fixed per module, so the
+                // object's cache key is stable; cache-disabled mode keeps opportunistic group warmup below.
+                collect_lazy_call_graph_cluster(storage, entry_local_function_index, candidate_group);
             }
             else
             {
@@ -1454,6 +1603,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             // `compiling` state because the caller claimed it before entering this helper.
             ::uwvm2::utils::container::vector<::std::size_t> claimed_group{};
             claimed_group.reserve(candidate_group.size());
+            // Pre-claim states of opportunistic members, kept in `claimed_group` order so a partial cluster can be released.
+            ::uwvm2::utils::container::vector<::uwvm2::utils::thread::lazy_compile_state> claimed_prior_states{};
+            claimed_prior_states.reserve(candidate_group.size());
             for(auto const local_function_index: candidate_group)
             {
                 if(local_function_index >= storage.functions.size() || local_function_index >= storage.materialized_functions.size()) [[unlikely]] { continue; }
@@ -1472,6 +1624,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                                 .state.state.store(::uwvm2::utils::thread::lazy_compile_state::compiling, ::std::memory_order_release);
                         }
                         claimed_group.push_back(local_function_index);
+                        claimed_prior_states.push_back(::uwvm2::utils::thread::lazy_compile_state::compiling);
                         continue;
                     }
 
@@ -1493,6 +1646,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                                     .state.state.store(::uwvm2::utils::thread::lazy_compile_state::compiling, ::std::memory_order_release);
                             }
                             claimed_group.push_back(local_function_index);
+                            claimed_prior_states.push_back(::uwvm2::utils::thread::lazy_compile_state::compiling);
                         }
                     }
                     continue;
@@ -1514,7 +1668,39 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                             .state.state.store(::uwvm2::utils::thread::lazy_compile_state::compiling, ::std::memory_order_release);
                     }
                     claimed_group.push_back(local_function_index);
+                    claimed_prior_states.push_back(st);
+                }
+            }
+
+            if(use_static_clusters && candidate_group.size() != 1uz && claimed_group.size() != candidate_group.size())
+            {
+                // Another thread already owns part of this cluster.  Compiling the remainder would produce an object whose
+                // key depends on that race, so hand the opportunistic claims back and compile the entry on its own.
+                lazy_runtime_log::line(u8"cluster-fallback module_id=",
+                                       options.compile_options.curr_wasm_id,
+                                       u8" local_fn=",
+                                       entry_local_function_index,
+                                       u8" cluster_size=",
+                                       candidate_group.size(),
+                                       u8" claimed=",
+                                       claimed_group.size());
+
+                ::std::size_t kept{};
+                for(::std::size_t i{}; i != claimed_group.size(); ++i)
+                {
+                    auto const local_function_index{claimed_group.index_unchecked(i)};
+                    if(local_function_index == entry_local_function_index)
+                    {
+                        claimed_group.index_unchecked(kept++) = local_function_index;
+                        continue;
+                    }
+                    // Restoring `uncompiled` or `queued` lets a waiter or the pending scheduler request claim it again.
+                    auto& fn{storage.functions.index_unchecked(local_function_index)};
+                    mark_function_compile_units_state(storage, fn, claimed_prior_states.index_unchecked(i));
                 }
+                claimed_group.resize(kept);
+                candidate_group.clear();
+                candidate_group.push_back(entry_local_function_index);
             }
 
             if(claimed_group.empty()) { return; }
@@ -1549,12 +1735,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 }
                 llvm_ir_storage.emitted = llvm_ir_storage.llvm_context_holder != nullptr && llvm_ir_storage.llvm_module != nullptr;
 
-                // MCJIT materialization consumes the IR module and resolves all function symbols before publication.
+                // ORC materialization consumes the IR module and resolves all function symbols before publication.
                 if(!materialize_lazy_local_function_group(curr_module, storage, options, claimed_group, llvm_ir_storage)) [[unlikely]]
                 {
                     ::fast_io::fast_terminate();
                 }
 
+                // Only publication is serialized: other workers keep emitting and finalizing their own groups meanwhile.
+                lazy_publish_lock_guard publish_guard{};
                 for(auto const local_function_index: claimed_group)
                 {
                     auto& fn{storage.functions.index_unchecked(local_function_index)};
@@ -1668,8 +1856,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             try
 # endif
             {
-                // LLVM materialization and runtime target publication are serialized across worker threads.
-                lazy_materialize_lock_guard materialize_guard{};
+                // Materialization runs unlocked; `compile_lazy_local_function_group` serializes only the publish step.
                 compile_lazy_local_function_group(*ctx->curr_module,
                                                   storage,
                                                   ctx->options,
@@ -1766,6 +1953,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         {
             details::append_lazy_function(curr_module, storage, options, local_function_index, err);
         }
+        details::build_lazy_call_graph_clusters(curr_module, storage);
+
+        // Cluster membership fixes the cache key of every clustered object, so it is logged once per module.
+        if(lazy_runtime_log::enabled()) [[unlikely]]
+        {
+            for(::std::size_t local_function_index{}; local_function_index != local_func_count; ++local_function_index)
+            {
+                lazy_runtime_log::line(u8"cluster-member module_id=",
+                                       options.curr_wasm_id,
+                                       u8" local_fn=",
+                                       local_function_index,
+                                       u8" cluster=",
+                                       storage.functions.index_unchecked(local_function_index).call_graph_cluster_index);
+            }
+        }
 
         return storage;
     }
@@ -1868,11 +2070,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             ::uwvm2::utils::thread::lazy_compile_thread_yield();
         }
 
-        {
-            // Keep synchronous demand compilation serialized with background worker materialization.
-            details::lazy_materialize_lock_guard materialize_guard{};
-            details::compile_lazy_local_function_group(curr_module, storage, options, cu.local_function_index, err);
-        }
+        // Synchronous demand compilation races background workers only at publication, which the group compiler serializes.
+        details::compile_lazy_local_function_group(curr_module, storage, options, cu.local_function_index, err);
         ::fast_io::unix_timestamp compile_end_time{};
         if(lazy_runtime_log::enabled()) [[unlikely]]
         {
@@ -1940,7 +2139,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
     // Retrieves the typed Wasm entry address for a materialized local function.
     //
     // The acquire `ready` load mirrors the raw-entry accessor.  It prevents a caller from consuming a typed entry address
-    // while the materializer is still resolving symbols or installing the MCJIT owner.
+    // while the materializer is still resolving symbols or installing the resource tracker.
     [[nodiscard]] inline constexpr bool try_get_lazy_entry_address(lazy_module_storage_t const& storage,
                                                                    ::std::size_t local_function_index,
                                                                    ::std::uintptr_t& function_address) noexcept
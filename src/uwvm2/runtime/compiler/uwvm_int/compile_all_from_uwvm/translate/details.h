@@ -38,6 +38,8 @@ namespace details
         bool direct_callable{};
         ::std::size_t local_defined_index{};
         ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const* function_type_ptr{};
+        // Defined function owned by another module when the chain leaves this module; null otherwise.
+        ::uwvm2::uwvm::runtime::storage::local_defined_function_storage_t const* cross_module_defined_ptr{};
     };
 
     // Runtime initialization rejects import-alias cycles and unresolved chains.  A post-initialization function alias chain
@@ -99,6 +101,7 @@ namespace details
 
                     if(local_func_begin == nullptr || defined_func_ptr < local_func_begin || defined_func_ptr >= local_func_begin + local_func_count)
                     {
+                        result.cross_module_defined_ptr = defined_func_ptr;
                         return result;
                     }
 
@@ -131,6 +134,27 @@ namespace details
         }
     }
 
+    // Call-info record for an import that resolves to a defined function, or null when the call must keep the import bridge.
+    // Same-module targets use this module's `local_defined_call_info`; targets in another preloaded wasm module use the
+    // runtime-owned record from `compile_option::resolve_cross_module_call_info`.
+    [[nodiscard]] inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*
+        resolve_runtime_import_direct_call_info(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                                ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option const& options,
+                                                ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_full_function_symbol_t const& storage,
+                                                ::std::size_t import_func_index,
+                                                ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const& callee_type) noexcept
+    {
+        auto const direct_callee{resolve_runtime_import_direct_defined_call(runtime_module, import_func_index)};
+        if(direct_callee.function_type_ptr == nullptr || !runtime_wasm_function_types_equal(*direct_callee.function_type_ptr, callee_type)) { return nullptr; }
+
+        if(direct_callee.direct_callable) { return ::std::addressof(storage.local_defined_call_info.index_unchecked(direct_callee.local_defined_index)); }
+        if(direct_callee.cross_module_defined_ptr != nullptr && options.resolve_cross_module_call_info != nullptr)
+        {
+            return options.resolve_cross_module_call_info(direct_callee.cross_module_defined_ptr);
+        }
+        return nullptr;
+    }
+
     struct trivial_call_inline_match
     {
         trivial_call_inline_kind kind{};
@@ -614,6 +638,14 @@ namespace details
         {
             if(CompileOption.v128_stack_top_end_pos > max_end) { max_end = CompileOption.v128_stack_top_end_pos; }
         }
+        if constexpr(CompileOption.memory0_begin_pos != SIZE_MAX)
+        {
+            if(CompileOption.memory0_begin_pos + 1uz > max_end) { max_end = CompileOption.memory0_begin_pos + 1uz; }
+        }
+        if constexpr(CompileOption.memory0_end_pos != SIZE_MAX)
+        {
+            if(CompileOption.memory0_end_pos + 1uz > max_end) { max_end = CompileOption.memory0_end_pos + 1uz; }
+        }
 
         return max_end;
     }
@@ -628,7 +660,8 @@ namespace details
                            in_range(pos, CompileOption.i64_stack_top_begin_pos, CompileOption.i64_stack_top_end_pos) ||
                            in_range(pos, CompileOption.f32_stack_top_begin_pos, CompileOption.f32_stack_top_end_pos) ||
                            in_range(pos, CompileOption.f64_stack_top_begin_pos, CompileOption.f64_stack_top_end_pos) ||
-                           in_range(pos, CompileOption.v128_stack_top_begin_pos, CompileOption.v128_stack_top_end_pos)};
+                           in_range(pos, CompileOption.v128_stack_top_begin_pos, CompileOption.v128_stack_top_end_pos) ||
+                           pos == CompileOption.memory0_begin_pos || pos == CompileOption.memory0_end_pos};
             if(!hit) { return false; }
         }
         return true;
@@ -654,6 +687,14 @@ namespace details
                                                   static_cast<::std::size_t>(f32_hit) + static_cast<::std::size_t>(f64_hit) +
                                                   static_cast<::std::size_t>(v128_hit)};
 
+                static_assert(!(hit_count != 0uz && (I == CompileOption.memory0_begin_pos || I == CompileOption.memory0_end_pos)),
+                              "pinned memory0 slots must not overlap a stack-top range.");
+                static_assert(CompileOption.memory0_begin_pos == SIZE_MAX || CompileOption.memory0_begin_pos != CompileOption.memory0_end_pos,
+                              "pinned memory0 begin/end must use distinct slots.");
+                static_assert((CompileOption.memory0_begin_pos == SIZE_MAX) == (CompileOption.memory0_end_pos == SIZE_MAX),
+                              "pinned memory0 begin/end must be enabled together.");
+
+                // Pinned memory0 slots are plain `::std::byte*`, same as the hit_count == 0 filler.
                 if constexpr(hit_count == 0uz) { return ::std::type_identity<::std::byte*>{}; }
                 else if constexpr(hit_count == 1uz)
                 {
@@ -1324,7 +1324,8 @@ case wasm1_code::br_if:
     // to replace the already-emitted compare with a compare-and-branch helper, but stale state must
     // never leak into the next opcode.
     auto const fuse_kind{br_if_fuse.kind};
-    auto const fuse_site{br_if_fuse.site};
+    // Compare cases record the site before emitting, i.e. on the profiling probe that precedes the compare opfunc in profiled builds.
+    auto const fuse_site{br_if_fuse.site == SIZE_MAX ? SIZE_MAX : skip_opfunc_profile_probe(bytecode, br_if_fuse.site)};
     auto const fuse_end{br_if_fuse.end};
     auto const fuse_stacktop_currpos{br_if_fuse.stacktop_currpos_at_site};
 
@@ -1375,12 +1376,15 @@ case wasm1_code::br_if:
                             native_memory_t* const memory0_p{resolved_memory0.memory_p};
                             if(memory0_p == nullptr) [[unlikely]] { return false; }
 
+                            // The load ends where the compare's profiling probe (if any) begins.
+                            auto const load_end{back_over_opfunc_profile_probe(bytecode, fuse_site)};
+
                             // Candidate 1: `f32_load_localget_off` immediately preceding the compare.
                             constexpr ::std::size_t kLoadLocalgetOffSize{sizeof(fptr_t) + sizeof(local_offset_t) + sizeof(native_memory_t*) +
                                                                          sizeof(memarg_offset_slot_t)};
-                            if(fuse_site >= kLoadLocalgetOffSize)
+                            if(load_end >= kLoadLocalgetOffSize)
                             {
-                                auto const load_site{fuse_site - kLoadLocalgetOffSize};
+                                auto const load_site{load_end - kLoadLocalgetOffSize};
 
                                 fptr_t stored_load{};  // init
                                 ::std::memcpy(::std::addressof(stored_load), bytecode.data() + load_site, sizeof(stored_load));
@@ -1457,9 +1461,9 @@ case wasm1_code::br_if:
                             // Candidate 2: `f32_load_local_plus_imm` immediately preceding the compare.
                             constexpr ::std::size_t kLoadLocalPlusImmSize{sizeof(fptr_t) + sizeof(local_offset_t) + sizeof(wasm_i32) +
                                                                           sizeof(native_memory_t*) + sizeof(memarg_offset_slot_t)};
-                            if(fuse_site >= kLoadLocalPlusImmSize)
+                            if(load_end >= kLoadLocalPlusImmSize)
                             {
-                                auto const load_site{fuse_site - kLoadLocalPlusImmSize};
+                                auto const load_site{load_end - kLoadLocalPlusImmSize};
 
                                 fptr_t stored_load{};  // init
                                 ::std::memcpy(::std::addressof(stored_load), bytecode.data() + load_site, sizeof(stored_load));
@@ -1559,8 +1563,9 @@ case wasm1_code::br_if:
 
                             // Candidate: `i32.const imm` immediately preceding `i32.eq`.
                             constexpr ::std::size_t kConstSize{sizeof(fptr_t) + sizeof(wasm_i32)};
-                            if(fuse_site < kConstSize) { return false; }
-                            auto const const_site{fuse_site - kConstSize};
+                            auto const const_end{back_over_opfunc_profile_probe(bytecode, fuse_site)};
+                            if(const_end < kConstSize) { return false; }
+                            auto const const_site{const_end - kConstSize};
 
                             fptr_t stored_const{};  // init
                             ::std::memcpy(::std::addressof(stored_const), bytecode.data() + const_site, sizeof(stored_const));
@@ -1588,8 +1593,9 @@ case wasm1_code::br_if:
                             // Candidate: `i32_load_localget_off` immediately preceding the const.
                             constexpr ::std::size_t kLoadSize{sizeof(fptr_t) + sizeof(local_offset_t) + sizeof(native_memory_t*) +
                                                               sizeof(memarg_offset_slot_t)};
-                            if(const_site < kLoadSize) { return false; }
-                            auto const load_site{const_site - kLoadSize};
+                            auto const load_end{back_over_opfunc_profile_probe(bytecode, const_site)};
+                            if(load_end < kLoadSize) { return false; }
+                            auto const load_site{load_end - kLoadSize};
 
                             fptr_t stored_load{};  // init
                             ::std::memcpy(::std::addressof(stored_load), bytecode.data() + load_site, sizeof(stored_load));
@@ -2180,7 +2186,8 @@ case wasm1_code::br_if:
                     {
                         auto const prev_start{bytecode.size() - prev_inst_size};
                         auto const& loop_label_info{labels.index_unchecked(label_id)};
-                        if(!loop_label_info.in_thunk && loop_label_info.offset == prev_start)
+                        // The loop label sits on the previous br_if's profiling probe in profiled builds.
+                        if(!loop_label_info.in_thunk && skip_opfunc_profile_probe(bytecode, loop_label_info.offset) == prev_start)
                         {
                             prev_fptr_t stored_prev{};  // init
                             ::std::memcpy(::std::addressof(stored_prev), bytecode.data() + prev_start, sizeof(stored_prev));
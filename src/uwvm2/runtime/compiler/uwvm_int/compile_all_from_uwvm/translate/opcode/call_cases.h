@@ -162,11 +162,10 @@ case wasm1_code::call:
     ::std::size_t call_function_imm{func_index_uz};
     if(func_index_uz < import_func_count)
     {
-        auto const direct_callee{details::resolve_runtime_import_direct_defined_call(curr_module, func_index_uz)};
-        if(direct_callee.direct_callable && direct_callee.function_type_ptr != nullptr &&
-           details::runtime_wasm_function_types_equal(*direct_callee.function_type_ptr, callee_type))
+        // Imports forwarded to a defined function, in this module or in another preloaded wasm module, skip the import bridge.
+        auto const info_ptr{details::resolve_runtime_import_direct_call_info(curr_module, options, storage, func_index_uz, callee_type)};
+        if(info_ptr != nullptr)
         {
-            auto const info_ptr{::std::addressof(storage.local_defined_call_info.index_unchecked(direct_callee.local_defined_index))};
             call_module_id = SIZE_MAX;
             call_function_imm = reinterpret_cast<::std::size_t>(info_ptr);
         }
@@ -998,7 +998,11 @@ case wasm1_code::end:
             static_cast<::std::size_t>(local_bytes_zeroinit_end <= internal_temp_local_off ? local_bytes_zeroinit_end : internal_temp_local_off);
         // IMPORTANT: bytecode contains self-referential absolute pointers (patched from rel offsets).
         // Copying would produce a new buffer with pointers still targeting the old buffer (UAF).
-        storage.local_funcs.index_unchecked(local_function_idx) = ::std::move(local_func_symbol);
+        if(options.translated_func_output != nullptr) { *options.translated_func_output = ::std::move(local_func_symbol); }
+        else
+        {
+            storage.local_funcs.index_unchecked(local_function_idx) = ::std::move(local_func_symbol);
+        }
 
         finished_current_func = true;
         break;
@@ -64,6 +64,8 @@ case wasm1_code::i32_load:
             }
         }
 
+        // Bounds-check hoisting: the first load of a `local.get base` group emits one guard for the whole group.
+        [[maybe_unused]] bool const bounds_hoisted{!fuse_load_add_imm && !fuse_load_and_imm && try_hoist_localget_load_bounds(conbine_pending.off1, offset, 4uz)};
         if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i32); }
         if constexpr(CompileOption.is_tail_call)
         {
@@ -81,9 +83,11 @@ case wasm1_code::i32_load:
             }
             else
             {
-                emit_opfunc_to(
-                    bytecode,
-                    translate::get_uwvmint_i32_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+                emit_opfunc_to(bytecode,
+                               translate::get_uwvmint_i32_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                           *resolved_memory0.memory_p,
+                                                                                                           interpreter_tuple,
+                                                                                                           bounds_hoisted));
             }
         }
         else
@@ -210,11 +214,14 @@ case wasm1_code::i64_load:
                 }
             }
 
+            bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 8uz)};
             if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i64); }
 
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_i64_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_i64_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                       *resolved_memory0.memory_p,
+                                                                                                       interpreter_tuple,
+                                                                                                       bounds_hoisted));
             emit_imm_to(bytecode, conbine_pending.off1);
             emit_imm_to(bytecode, resolved_memory0.memory_p);
             emit_imm_to(bytecode, offset);
@@ -273,12 +280,15 @@ case wasm1_code::f32_load:
     {
         // Conbine: `local.get addr; f32.load` fused into `f32_load_localget_off`.
         // Stack effect: push 1 (result), because the address is taken directly from the local.
+        [[maybe_unused]] bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 4uz)};
         if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::f32); }
         if constexpr(CompileOption.is_tail_call)
         {
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_f32_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_f32_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                       *resolved_memory0.memory_p,
+                                                                                                       interpreter_tuple,
+                                                                                                       bounds_hoisted));
         }
         else
         {
@@ -370,12 +380,15 @@ case wasm1_code::f64_load:
     {
         // Conbine: `local.get addr; f64.load` fused into `f64_load_localget_off`.
         // Stack effect: push 1 (result), because the address is taken directly from the local.
+        [[maybe_unused]] bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 8uz)};
         if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::f64); }
         if constexpr(CompileOption.is_tail_call)
         {
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_f64_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_f64_load_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                       *resolved_memory0.memory_p,
+                                                                                                       interpreter_tuple,
+                                                                                                       bounds_hoisted));
         }
         else
         {
@@ -467,10 +480,13 @@ case wasm1_code::i32_load8_s:
         {
             // Conbine: `local.get addr; i32.load8_s` fused into `i32_load8_s_localget_off`.
             // Stack effect: push 1 (result), because the address is taken from the local.
+            bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 1uz)};
             if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i32); }
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_i32_load8_s_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_i32_load8_s_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                          *resolved_memory0.memory_p,
+                                                                                                          interpreter_tuple,
+                                                                                                          bounds_hoisted));
             emit_imm_to(bytecode, conbine_pending.off1);
             emit_imm_to(bytecode, resolved_memory0.memory_p);
             emit_imm_to(bytecode, offset);
@@ -509,10 +525,13 @@ case wasm1_code::i32_load8_u:
         {
             // Conbine: `local.get addr; i32.load8_u` fused into `i32_load8_u_localget_off`.
             // Stack effect: push 1 (result), because the address is taken from the local.
+            bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 1uz)};
             if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i32); }
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_i32_load8_u_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_i32_load8_u_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                          *resolved_memory0.memory_p,
+                                                                                                          interpreter_tuple,
+                                                                                                          bounds_hoisted));
             emit_imm_to(bytecode, conbine_pending.off1);
             emit_imm_to(bytecode, resolved_memory0.memory_p);
             emit_imm_to(bytecode, offset);
@@ -551,10 +570,13 @@ case wasm1_code::i32_load16_s:
         {
             // Conbine: `local.get addr; i32.load16_s` fused into `i32_load16_s_localget_off`.
             // Stack effect: push 1 (result), because the address is taken from the local.
+            bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 2uz)};
             if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i32); }
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_i32_load16_s_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_i32_load16_s_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                           *resolved_memory0.memory_p,
+                                                                                                           interpreter_tuple,
+                                                                                                           bounds_hoisted));
             emit_imm_to(bytecode, conbine_pending.off1);
             emit_imm_to(bytecode, resolved_memory0.memory_p);
             emit_imm_to(bytecode, offset);
@@ -593,10 +615,13 @@ case wasm1_code::i32_load16_u:
         {
             // Conbine: `local.get addr; i32.load16_u` fused into `i32_load16_u_localget_off`.
             // Stack effect: push 1 (result), because the address is taken from the local.
+            bool const bounds_hoisted{try_hoist_localget_load_bounds(conbine_pending.off1, offset, 2uz)};
             if constexpr(stacktop_enabled) { stacktop_prepare_push1_if_reachable(bytecode, curr_operand_stack_value_type::i32); }
-            emit_opfunc_to(
-                bytecode,
-                translate::get_uwvmint_i32_load16_u_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop, *resolved_memory0.memory_p, interpreter_tuple));
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_i32_load16_u_localget_off_fptr_from_tuple<CompileOption>(curr_stacktop,
+                                                                                                           *resolved_memory0.memory_p,
+                                                                                                           interpreter_tuple,
+                                                                                                           bounds_hoisted));
             emit_imm_to(bytecode, conbine_pending.off1);
             emit_imm_to(bytecode, resolved_memory0.memory_p);
             emit_imm_to(bytecode, offset);
@@ -1,6 +1,202 @@
     // WebAssembly 1.1 instruction support for the UWVM interpreter translator.
     // Feature switches are consumed here, during translation, so runtime opfuncs stay branch-free.
 
+case opcode_byte(wasm1p1_code::return_call): [[fallthrough]];
+case opcode_byte(wasm1p1_code::return_call_indirect):
+{
+    // Tail calls leave the current frame like `return`; the runtime issues the recorded call after the frame is released, so
+    // there is no stack repair here: the opfunc reads the arguments from the top of the flushed operand stack.
+    auto const op_begin{code_curr};
+    bool const is_indirect{static_cast<wasm_byte>(*code_curr) == opcode_byte(wasm1p1_code::return_call_indirect)};
+    ::uwvm2::utils::container::u8string_view const op_name{is_indirect ? u8"return_call_indirect" : u8"return_call"};
+    ++code_curr;
+
+    if(!wasm1p1_para.enable_tail_call) [[unlikely]]
+    {
+        fail_wasm1p1_feature_required(op_begin,
+                                      opcode_u32(is_indirect ? wasm1p1_code::return_call_indirect : wasm1p1_code::return_call),
+                                      ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call,
+                                      ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+    }
+
+    ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t const* callee_type_ptr{};
+    ::std::size_t call_module_id{options.curr_wasm_id};
+    ::std::size_t callee_imm{};
+    ::std::size_t call_table_index{SIZE_MAX};
+
+    if(is_indirect)
+    {
+        auto const type_index{read_leb128.template operator()<wasm_u32>(code_curr, code_end, op_begin, op_name)};
+        auto const table_index{read_leb128.template operator()<wasm_u32>(code_curr, code_end, op_begin, op_name)};
+        check_table_index(op_begin, table_index);
+
+        if(get_table_value_type(table_index) != curr_operand_stack_value_type::funcref) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+            err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(curr_operand_stack_value_type::funcref);
+            err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(get_table_value_type(table_index));
+            err.err_code = code_validation_error_code::br_value_type_mismatch;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        auto const types_begin{curr_module.type_section_storage.type_section_begin};
+        auto const all_type_count_uz{static_cast<::std::size_t>(curr_module.type_section_storage.type_section_end - types_begin)};
+        if(static_cast<::std::size_t>(type_index) >= all_type_count_uz) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.illegal_type_index.type_index = type_index;
+            err.err_selectable.illegal_type_index.all_type_count = static_cast<wasm_u32>(all_type_count_uz);
+            err.err_code = code_validation_error_code::illegal_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        callee_type_ptr = types_begin + static_cast<::std::size_t>(type_index);
+        callee_imm = static_cast<::std::size_t>(type_index);
+        call_table_index = static_cast<::std::size_t>(table_index);
+    }
+    else
+    {
+        auto const func_index{read_leb128.template operator()<wasm_u32>(code_curr, code_end, op_begin, op_name)};
+        auto const func_index_uz{static_cast<::std::size_t>(func_index)};
+        auto const all_function_size{import_func_count + local_func_count};
+        if(func_index_uz >= all_function_size) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.invalid_function_index.function_index = func_index_uz;
+            err.err_selectable.invalid_function_index.all_function_size = all_function_size;
+            err.err_code = code_validation_error_code::invalid_function_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        // Same callee encoding as `call`: local, import-forwarded local and cross-module defined callees use a call-info pointer.
+        callee_imm = func_index_uz;
+        if(func_index_uz < import_func_count)
+        {
+            auto const imported_func_ptr{curr_module.imported_function_vec_storage.index_unchecked(func_index_uz).import_type_ptr};
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(imported_func_ptr == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#endif
+            callee_type_ptr = imported_func_ptr->imports.storage.function;
+
+            auto const info_ptr{details::resolve_runtime_import_direct_call_info(curr_module, options, storage, func_index_uz, *callee_type_ptr)};
+            if(info_ptr != nullptr)
+            {
+                call_module_id = SIZE_MAX;
+                callee_imm = reinterpret_cast<::std::size_t>(info_ptr);
+            }
+        }
+        else
+        {
+            auto const local_idx{func_index_uz - import_func_count};
+            callee_type_ptr = curr_module.local_defined_function_vec_storage.index_unchecked(local_idx).function_type_ptr;
+            call_module_id = SIZE_MAX;
+            callee_imm = reinterpret_cast<::std::size_t>(::std::addressof(storage.local_defined_call_info.index_unchecked(local_idx)));
+        }
+    }
+
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+    if(callee_type_ptr == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#endif
+
+    auto const& callee_type{*callee_type_ptr};
+    auto const param_count{static_cast<::std::size_t>(callee_type.parameter.end - callee_type.parameter.begin)};
+
+    // The callee results become this function's results, so the two result lists must be identical.
+    auto const& func_frame{control_flow_stack.index_unchecked(0u)};
+    auto const expected_result_count{static_cast<::std::size_t>(func_frame.result.end - func_frame.result.begin)};
+    auto const callee_result_count{static_cast<::std::size_t>(callee_type.result.end - callee_type.result.begin)};
+    for(::std::size_t i{}; i != expected_result_count && i != callee_result_count; ++i)
+    {
+        if(func_frame.result.begin[i] != callee_type.result.begin[i]) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+            err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(func_frame.result.begin[i]);
+            err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(callee_type.result.begin[i]);
+            err.err_code = code_validation_error_code::br_value_type_mismatch;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+    if(expected_result_count != callee_result_count) [[unlikely]]
+    {
+        err.err_curr = op_begin;
+        err.err_selectable.end_result_mismatch.block_kind = op_name;
+        err.err_selectable.end_result_mismatch.expected_count = expected_result_count;
+        err.err_selectable.end_result_mismatch.actual_count = callee_result_count;
+        err.err_selectable.end_result_mismatch.expected_type =
+            expected_result_count == 1uz ? to_wasm1_value_type(func_frame.result.begin[0]) : ::uwvm2::parser::wasm::standard::wasm1::type::value_type{};
+        err.err_selectable.end_result_mismatch.actual_type =
+            callee_result_count == 1uz ? to_wasm1_value_type(callee_type.result.begin[0]) : ::uwvm2::parser::wasm::standard::wasm1::type::value_type{};
+        err.err_code = code_validation_error_code::end_result_mismatch;
+        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+    }
+
+#ifdef UWVM_ENABLE_UWVM_INT_COMBINE_OPS
+    // The runtime reads the arguments from operand-stack memory, so pending conbine state must be materialized first.
+    flush_conbine_pending();
+#endif
+
+    auto const required_stack_size{is_indirect ? param_count + 1uz : param_count};
+    if(!is_polymorphic && concrete_operand_count() < required_stack_size) [[unlikely]]
+    {
+        report_operand_stack_underflow(op_begin, op_name, required_stack_size);
+    }
+
+    ::std::size_t arg_bytes{};
+    if(is_indirect)
+    {
+        auto const idx{try_pop_concrete_operand()};
+        if(!operand_type_matches(idx, curr_operand_stack_value_type::i32)) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_cond_type_not_i32.op_code_name = op_name;
+            err.err_selectable.br_cond_type_not_i32.cond_type = to_wasm1_value_type(idx.type);
+            err.err_code = code_validation_error_code::br_cond_type_not_i32;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+        arg_bytes += operand_stack_valtype_size(curr_operand_stack_value_type::i32);
+    }
+
+    auto const available_param_count{concrete_operand_count()};
+    auto const concrete_to_check{available_param_count < param_count ? available_param_count : param_count};
+    for(::std::size_t i{}; i != concrete_to_check; ++i)
+    {
+        auto const expected_type{callee_type.parameter.begin[param_count - 1uz - i]};
+        auto const actual_operand{operand_stack.index_unchecked(operand_stack.size() - 1uz - i)};
+        if(!stack_entry_type_matches(actual_operand, expected_type)) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+            err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(expected_type);
+            err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(actual_operand.type);
+            err.err_code = code_validation_error_code::br_value_type_mismatch;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+    for(::std::size_t i{}; i != param_count; ++i) { arg_bytes += operand_stack_valtype_size(callee_type.parameter.begin[i]); }
+
+    // Unreachable code keeps a plain `return`; the arguments are not materialized there.
+    if(is_polymorphic) { emit_return_to(bytecode); }
+    else
+    {
+        namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+        stacktop_flush_all_to_operand_stack(bytecode);
+        emit_opfunc_to(bytecode, translate::get_uwvmint_return_call_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+        emit_imm_to(bytecode, call_module_id);
+        emit_imm_to(bytecode, callee_imm);
+        emit_imm_to(bytecode, call_table_index);
+        emit_imm_to(bytecode, arg_bytes);
+    }
+
+    // The arguments and everything below them die with the frame.
+    auto const curr_frame_base{control_flow_stack.back_unchecked().operand_stack_base};
+    operand_stack_truncate_to(curr_frame_base);
+    is_polymorphic = true;
+
+    break;
+}
+
 case opcode_byte(wasm1p1_code::table_get):
 {
     auto const op_begin{code_curr};
@@ -1,7 +1,10 @@
 ﻿bool const runtime_log_on{uwvm2::uwvm::io::enable_runtime_log};
 using runtime_uwvm_int_opcode_conbination_level_t = ::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_opcode_conbination_level_t;
 #if defined(UWVM_ENABLE_UWVM_INT_COMBINE_OPS)
-[[maybe_unused]] auto const runtime_uwvm_int_opcode_conbination_level{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_opcode_conbination_level};
+// Baseline translation trades steady-state speed for translation time; the lazy hot tier re-translates with the global level.
+[[maybe_unused]] auto const runtime_uwvm_int_opcode_conbination_level{
+    options.baseline_translation ? runtime_uwvm_int_opcode_conbination_level_t::disable
+                                 : ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_opcode_conbination_level};
 #else
 [[maybe_unused]] constexpr auto runtime_uwvm_int_opcode_conbination_level{runtime_uwvm_int_opcode_conbination_level_t::disable};
 #endif
@@ -19,14 +22,14 @@ bool const runtime_uwvm_int_opcode_conbination_enabled{
                                                                  !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_delay_local};
 [[maybe_unused]] bool const runtime_uwvm_int_instruction_reorder_enabled{
 #if defined(UWVM_ENABLE_UWVM_INT_INSTRUCTION_REORDER)
-    ::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_enable_instruction_reorder
+    !options.baseline_translation && ::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_enable_instruction_reorder
 #else
     false
 #endif
 };
 [[maybe_unused]] bool const runtime_uwvm_int_loop_unwind_enabled{
 #if defined(UWVM_ENABLE_UWVM_INT_LOOP_UNWIND)
-    !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_loop_unwind
+    !options.baseline_translation && !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_loop_unwind
 #else
     false
 #endif
@@ -441,6 +444,77 @@ auto const get_branch_target_label_id{[&](block_t const& frame) constexpr noexce
                                           return frame.type == block_type::loop ? frame.start_label_id : frame.end_label_id;
                                       }};
 
+#if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+// Opfunc n-gram profiling: every opfunc is prefixed with `[probe_ptr][back_offset:u32]` (see `optable/opfunc_profile.h`).
+// Probes live below every fusion decision, so peepholes keep patching the opfunc that follows the probe.
+bool const opfunc_profile_on{!::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_opfunc_profile_path.empty()};
+::std::size_t opfunc_profile_last_probe_main{SIZE_MAX};
+::std::size_t opfunc_profile_last_probe_thunk{SIZE_MAX};
+auto const opfunc_profile_probe_fptr{
+    ::uwvm2::runtime::compiler::uwvm_int::optable::translate::get_uwvmint_opfunc_profile_probe_fptr_from_tuple<CompileOption>(interpreter_tuple)};
+constexpr ::std::size_t opfunc_profile_probe_size{sizeof(opfunc_profile_probe_fptr) +
+                                                  sizeof(::uwvm2::runtime::compiler::uwvm_int::optable::opfunc_profile::probe_back_offset_t)};
+
+// True when `site` holds a probe emitted by `emit_opfunc_profile_probe_to` (and not an opfunc).
+auto const is_opfunc_profile_probe_at{
+    [&](bytecode_vec_t const& dst, ::std::size_t site) constexpr noexcept -> bool
+    {
+        if(!opfunc_profile_on || site > dst.size() || dst.size() - site < opfunc_profile_probe_size) { return false; }
+        return ::std::memcmp(dst.data() + site, ::std::addressof(opfunc_profile_probe_fptr), sizeof(opfunc_profile_probe_fptr)) == 0;
+    }};
+
+// Invariant: with profiling on, an instruction is laid out as `[probe][opfunc][immediates...]`, so a position recorded as
+// `bytecode.size()` before an opfunc is emitted (fusion sites, label offsets) lands on the probe, not on the opfunc.
+// - Reading or patching the opfunc pointer at such a site: move past the probe first (`skip_opfunc_profile_probe`).
+// - Looking behind an opfunc for the instruction before it: step back over its probe first (`back_over_opfunc_profile_probe`).
+// - Patching `dst.size() - sizeof(fptr)` right after an emission already addresses the opfunc and needs neither.
+// - Truncating to either boundary is fine. A probe left at the end of the stream is reused by the next opfunc, and a label may
+//   point at a probe because the probe falls through into its opfunc. A truncation below the last probe restarts the chain
+//   (`back_offset = 0`), which only costs the n-grams that span it.
+[[maybe_unused]] auto const skip_opfunc_profile_probe{[&](bytecode_vec_t const& dst, ::std::size_t site) constexpr noexcept -> ::std::size_t
+                                                      { return is_opfunc_profile_probe_at(dst, site) ? site + opfunc_profile_probe_size : site; }};
+
+// End of the instruction before the opfunc at `site`: the start of that opfunc's probe, if it has one.
+[[maybe_unused]] auto const back_over_opfunc_profile_probe{
+    [&](bytecode_vec_t const& dst, ::std::size_t site) constexpr noexcept -> ::std::size_t
+    {
+        if(site < opfunc_profile_probe_size || !is_opfunc_profile_probe_at(dst, site - opfunc_profile_probe_size)) { return site; }
+        return site - opfunc_profile_probe_size;
+    }};
+
+auto const emit_opfunc_profile_probe_to{
+    [&](bytecode_vec_t& dst) constexpr UWVM_THROWS
+    {
+        using probe_back_offset_t = ::uwvm2::runtime::compiler::uwvm_int::optable::opfunc_profile::probe_back_offset_t;
+
+        bool const dst_is_thunk{::std::addressof(dst) == ::std::addressof(thunks)};
+        auto& last_probe{dst_is_thunk ? opfunc_profile_last_probe_thunk : opfunc_profile_last_probe_main};
+        ::std::size_t const curr{dst.size()};
+
+        // A truncation back to an opfunc start leaves that opfunc's probe at the end of the stream; the replacement reuses it.
+        if(curr >= opfunc_profile_probe_size && is_opfunc_profile_probe_at(dst, curr - opfunc_profile_probe_size))
+        {
+            last_probe = curr - opfunc_profile_probe_size;
+            return;
+        }
+
+        // The previous probe only counts as a layout predecessor if no truncation removed it.
+        probe_back_offset_t back_offset{};
+        if(last_probe != SIZE_MAX && last_probe < curr && is_opfunc_profile_probe_at(dst, last_probe) && curr - last_probe <= UINT_LEAST32_MAX)
+        {
+            back_offset = static_cast<probe_back_offset_t>(curr - last_probe);
+        }
+
+        emit_imm_to(dst, opfunc_profile_probe_fptr);
+        emit_imm_to(dst, back_offset);
+        last_probe = curr;
+    }};
+#else
+[[maybe_unused]] auto const skip_opfunc_profile_probe{[](bytecode_vec_t const&, ::std::size_t site) constexpr noexcept -> ::std::size_t { return site; }};
+[[maybe_unused]] auto const back_over_opfunc_profile_probe{[](bytecode_vec_t const&, ::std::size_t site) constexpr noexcept -> ::std::size_t
+                                                           { return site; }};
+#endif
+
 // Every emitted opfunc pointer must match the active interpreter calling convention. The static
 // assertion catches accidental emission of a helper from the wrong tail-call/byref mode at compile time.
 auto const emit_opfunc_to{[&](bytecode_vec_t& dst, auto fptr) constexpr UWVM_THROWS
@@ -492,6 +566,10 @@ auto const emit_opfunc_to{[&](bytecode_vec_t& dst, auto fptr) constexpr UWVM_THR
                                   }
                               }
 
+#if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+                              if(opfunc_profile_on) [[unlikely]] { emit_opfunc_profile_probe_to(dst); }
+#endif
+
                               // Note: We intentionally store the raw function pointer bytes into the bytecode stream.
                               emit_imm_to(dst, fptr);
                           }};
@@ -4125,6 +4125,238 @@ auto const flush_conbine_pending{
     }};
 #endif
 
+#ifdef UWVM_ENABLE_UWVM_INT_COMBINE_OPS
+// Bounds-check hoisting for `local.get base; <load>` groups (tail-call only). A group is a straight-line run of such loads from
+// the same base local with nothing in between that can trap, branch, call, write memory or write the base local. Its first load
+// emits one `memory_bounds_guard_localget` covering every access of the group, and the group's loads then select their hoisted
+// (check-free) variants. Only memories that pay for an explicit length compare are worth it; guard-page protected mmap memories
+// already check for free.
+struct bounds_hoist_group_t
+{
+    ::std::byte const* end{};  // wasm ip right after the memarg of the group's last load; null => no group
+    local_offset_t base_off{};
+    ::std::uint_least64_t min_offset{};
+    ::std::uint_least64_t high_end{};  // max(offset + bytes) over the group
+};
+
+bounds_hoist_group_t bounds_hoist_group{};
+
+// Returns true if the `local.get base; <load offset bytes>` being translated at `code_curr` (already past its memarg) is covered
+// by a guard, emitting that guard first when this load starts a new group.
+auto const try_hoist_localget_load_bounds{
+    [&]([[maybe_unused]] local_offset_t base_off, [[maybe_unused]] wasm_u32 offset, [[maybe_unused]] ::std::size_t bytes) constexpr UWVM_THROWS
+        -> bool
+    {
+        if constexpr(!CompileOption.is_tail_call) { return false; }
+        else
+        {
+            namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+
+            if(is_polymorphic || !translate::details::memory_bounds_check_hoistable(*resolved_memory0.memory_p)) { return false; }
+
+            auto const access_end{static_cast<::std::uint_least64_t>(offset) + static_cast<::std::uint_least64_t>(bytes)};
+            if(bounds_hoist_group.end != nullptr && code_curr <= bounds_hoist_group.end && base_off == bounds_hoist_group.base_off &&
+               offset >= bounds_hoist_group.min_offset && access_end <= bounds_hoist_group.high_end)
+            {
+                return true;
+            }
+
+            // Look ahead for further members. The bytes have not been validated yet, so any parse failure just ends the group; the
+            // translator reports the error when it gets there.
+            constexpr ::std::size_t max_group_members{16uz};
+            constexpr ::std::size_t max_scan_ops{64uz};
+
+            struct access_t
+            {
+                wasm_u32 offset{};
+                wasm_u32 bytes{};
+            };
+
+            access_t members[max_group_members]{};
+            members[0uz] = {offset, static_cast<wasm_u32>(bytes)};
+            ::std::size_t member_count{1uz};
+            ::std::byte const* group_end{code_curr};
+
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+            auto const scan_leb{[&](::std::byte const*& ip, auto& v) constexpr noexcept -> bool
+                                {
+                                    auto const [next, perr]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(ip),
+                                                                                     reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                     ::fast_io::mnp::leb128_get(v))};
+                                    if(perr != ::fast_io::parse_code::ok) { return false; }
+                                    ip = reinterpret_cast<::std::byte const*>(next);
+                                    return true;
+                                }};
+
+            // Loads that have a `*_localget_off` form with a hoisted variant.
+            auto const member_load_bytes{[](wasm1_code op) constexpr noexcept -> ::std::size_t
+                                         {
+                                             switch(op)
+                                             {
+                                                 case wasm1_code::i32_load: return 4uz;
+                                                 case wasm1_code::i64_load: return 8uz;
+                                                 case wasm1_code::f32_load: return 4uz;
+                                                 case wasm1_code::f64_load: return 8uz;
+                                                 case wasm1_code::i32_load8_s: [[fallthrough]];
+                                                 case wasm1_code::i32_load8_u: return 1uz;
+                                                 case wasm1_code::i32_load16_s: [[fallthrough]];
+                                                 case wasm1_code::i32_load16_u: return 2uz;
+                                                 default: return 0uz;
+                                             }
+                                         }};
+
+            auto ip{code_curr};
+            bool scan_on{true};
+            for(::std::size_t scanned{}; scan_on && scanned != max_scan_ops && member_count != max_group_members && ip != code_end; ++scanned)
+            {
+                wasm1_code op;  // no init
+                ::std::memcpy(::std::addressof(op), ip, sizeof(op));
+                ++ip;
+
+                switch(op)
+                {
+                    case wasm1_code::local_get: [[fallthrough]];
+                    case wasm1_code::local_set: [[fallthrough]];
+                    case wasm1_code::local_tee:
+                    {
+                        wasm_u32 local_index{};
+                        if(!scan_leb(ip, local_index) || local_index >= all_local_count)
+                        {
+                            scan_on = false;
+                            break;
+                        }
+
+                        bool const is_base{local_offset_from_index(local_index) == base_off};
+                        if(op != wasm1_code::local_get)
+                        {
+                            // A write to the base local ends the group: later loads would use a different address.
+                            scan_on = !is_base;
+                            break;
+                        }
+
+                        if(!is_base || ip == code_end) { break; }
+
+                        wasm1_code load_op;  // no init
+                        ::std::memcpy(::std::addressof(load_op), ip, sizeof(load_op));
+                        auto const load_bytes{member_load_bytes(load_op)};
+                        if(load_bytes == 0uz) { break; }
+
+                        auto memarg_ip{ip + 1};
+                        wasm_u32 load_align{};
+                        wasm_u32 load_offset{};
+                        if(!scan_leb(memarg_ip, load_align) || !scan_leb(memarg_ip, load_offset))
+                        {
+                            scan_on = false;
+                            break;
+                        }
+
+                        members[member_count++] = {load_offset, static_cast<wasm_u32>(load_bytes)};
+                        ip = memarg_ip;
+                        group_end = ip;
+                        break;
+                    }
+                    case wasm1_code::global_get:
+                    {
+                        wasm_u32 global_index{};
+                        scan_on = scan_leb(ip, global_index);
+                        break;
+                    }
+                    case wasm1_code::i32_const:
+                    {
+                        wasm_i32 imm{};
+                        scan_on = scan_leb(ip, imm);
+                        break;
+                    }
+                    case wasm1_code::i64_const:
+                    {
+                        wasm_i64 imm{};
+                        scan_on = scan_leb(ip, imm);
+                        break;
+                    }
+                    case wasm1_code::f32_const: [[fallthrough]];
+                    case wasm1_code::f64_const:
+                    {
+                        auto const imm_size{op == wasm1_code::f32_const ? 4uz : 8uz};
+                        scan_on = static_cast<::std::size_t>(code_end - ip) >= imm_size;
+                        if(scan_on) { ip += imm_size; }
+                        break;
+                    }
+                    case wasm1_code::drop: [[fallthrough]];
+                    case wasm1_code::select:
+                    {
+                        break;
+                    }
+                    // Numeric ops that can trap: integer division/remainder and float-to-int truncation.
+                    case wasm1_code::i32_div_s: [[fallthrough]];
+                    case wasm1_code::i32_div_u: [[fallthrough]];
+                    case wasm1_code::i32_rem_s: [[fallthrough]];
+                    case wasm1_code::i32_rem_u: [[fallthrough]];
+                    case wasm1_code::i64_div_s: [[fallthrough]];
+                    case wasm1_code::i64_div_u: [[fallthrough]];
+                    case wasm1_code::i64_rem_s: [[fallthrough]];
+                    case wasm1_code::i64_rem_u: [[fallthrough]];
+                    case wasm1_code::i32_trunc_f32_s: [[fallthrough]];
+                    case wasm1_code::i32_trunc_f32_u: [[fallthrough]];
+                    case wasm1_code::i32_trunc_f64_s: [[fallthrough]];
+                    case wasm1_code::i32_trunc_f64_u: [[fallthrough]];
+                    case wasm1_code::i64_trunc_f32_s: [[fallthrough]];
+                    case wasm1_code::i64_trunc_f32_u: [[fallthrough]];
+                    case wasm1_code::i64_trunc_f64_s: [[fallthrough]];
+                    case wasm1_code::i64_trunc_f64_u:
+                    {
+                        scan_on = false;
+                        break;
+                    }
+                    default:
+                    {
+                        // The rest of `i32.eqz` ... `f64.reinterpret_i64` is pure; everything else (control flow, calls, other memory
+                        // ops, `global.set`, prefixed ops) ends the group.
+                        using op_underlying_t = ::std::underlying_type_t<wasm1_code>;
+                        auto const op_u{static_cast<op_underlying_t>(op)};
+                        scan_on = op_u >= static_cast<op_underlying_t>(wasm1_code::i32_eqz) &&
+                                  op_u <= static_cast<op_underlying_t>(wasm1_code::f64_reinterpret_i64);
+                        break;
+                    }
+                }
+            }
+
+            if(member_count < 2uz) { return false; }
+
+            ::std::uint_least64_t min_offset{members[0uz].offset};
+            ::std::size_t high_index{};
+            ::std::uint_least64_t high_end{};
+            for(::std::size_t i{}; i != member_count; ++i)
+            {
+                auto const& m{members[i]};
+                if(m.offset < min_offset) { min_offset = m.offset; }
+                auto const m_end{static_cast<::std::uint_least64_t>(m.offset) + m.bytes};
+                if(m_end > high_end)
+                {
+                    high_end = m_end;
+                    high_index = i;
+                }
+            }
+
+            emit_opfunc_to(bytecode,
+                           translate::get_uwvmint_memory_bounds_guard_localget_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+            emit_imm_to(bytecode, base_off);
+            emit_imm_to(bytecode, resolved_memory0.memory_p);
+            emit_imm_to(bytecode, static_cast<wasm_u32>(min_offset));
+            emit_imm_to(bytecode, members[high_index].offset);
+            emit_imm_to(bytecode, members[high_index].bytes);
+            emit_imm_to(bytecode, static_cast<wasm_u32>(member_count));
+            for(::std::size_t i{}; i != member_count; ++i)
+            {
+                emit_imm_to(bytecode, members[i].offset);
+                emit_imm_to(bytecode, members[i].bytes);
+            }
+
+            bounds_hoist_group = {.end = group_end, .base_off = base_off, .min_offset = min_offset, .high_end = high_end};
+            return true;
+        }
+    }};
+#endif
+
 // Per-op logging snapshots both bytecode deltas and abstract stack/cache state. It is noisy by
 // design and therefore gated behind `runtime_log_emit_wasm_ops`.
 auto const runtime_log_wasm_op_state{[&]([[maybe_unused]] ::uwvm2::utils::container::u8string_view phase,
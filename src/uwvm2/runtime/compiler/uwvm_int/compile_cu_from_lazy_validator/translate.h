@@ -120,6 +120,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
         execution_unit_range
     };
 
+    // Hot-tier phases of one lazily materialized function. Only `baseline` bodies count calls; `promoted` publishes the re-translated
+    // body stored beside the module symbol table.
+    enum class lazy_hot_tier_phase : unsigned
+    {
+        none,
+        baseline,
+        promoting,
+        promoted
+    };
+
     // The execution-unit policy controls index granularity independently from compile-unit scheduling. This keeps bytecode scanning
     // decisions decoupled from threading and cache policy decisions.
     enum class lazy_execution_unit_split_policy_t : unsigned
@@ -226,6 +236,25 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
         lazy_materialization_scope materialization_scope{lazy_materialization_scope::whole_function};
     };
 
+    struct lazy_hot_tier_state
+    {
+        ::std::atomic<lazy_hot_tier_phase> phase{lazy_hot_tier_phase::none};
+        // Calls observed while the baseline body is authoritative. Relaxed: it only decides when to promote, never what runs.
+        ::std::atomic<::std::uint_least32_t> call_count{};
+
+        inline constexpr lazy_hot_tier_state() noexcept = default;
+
+        // Like lazy_compile_unit_state, copies exist only so metadata vectors can be resized before any function is materialized.
+        inline constexpr lazy_hot_tier_state(lazy_hot_tier_state const&) noexcept : phase{lazy_hot_tier_phase::none}, call_count{} {}
+
+        inline constexpr lazy_hot_tier_state& operator= (lazy_hot_tier_state const&) noexcept
+        {
+            this->phase.store(lazy_hot_tier_phase::none, ::std::memory_order_relaxed);
+            this->call_count.store(0u, ::std::memory_order_relaxed);
+            return *this;
+        }
+    };
+
     struct lazy_function_storage_t
     {
         // Whole-function state is the authoritative synchronization point while materialization emits complete functions.
@@ -240,6 +269,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
         ::std::size_t cu_count{};
         // SIZE_MAX means no schedulable compile unit has been selected yet; a fallback function unit is created in that case.
         ::std::size_t primary_cu_index{SIZE_MAX};
+        // Set by the structural scan when the body has no `loop`. A running interpreter frame cannot switch bodies, so only loop-free
+        // functions start on the baseline tier; a looping function could otherwise stay on unfused code for its whole run.
+        bool baseline_tier_eligible{};
+        lazy_hot_tier_state hot_tier{};
     };
 
     struct lazy_module_storage_t
@@ -250,6 +283,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
         ::uwvm2::utils::container::vector<lazy_function_storage_t> functions{};
         ::uwvm2::utils::container::vector<lazy_execution_unit_storage_t> execution_units{};
         ::uwvm2::utils::container::vector<lazy_compile_unit_storage_t> compile_units{};
+        // Re-translated bodies of promoted functions. Baseline bodies in `compiled.local_funcs` are never replaced because frames on
+        // other threads may still be executing them; the slot is written once and then published through the function hot-tier phase.
+        ::uwvm2::utils::container::vector<local_func_storage_t> hot_funcs{};
     };
 
     struct lazy_compile_options
@@ -261,6 +297,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
         // Validation also needs the exact feature switches used to parse that module.
         parser_feature_parameter_t const* validator_feature_parameter{};
         lazy_validation_mode validation_mode{lazy_validation_mode::validate_on_lazy_compile};
+        // Calls after which a baseline-translated function is re-translated with full opcode conbination. `0` disables the baseline
+        // tier, so every function is translated once with the full pipeline.
+        ::std::uint_least32_t hot_tier_call_threshold{};
     };
 
     struct lazy_compile_request_context
@@ -847,6 +886,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
                                                                     err);
                             return;
                         }
+                        case opcode_byte(wasm1p1_code::return_call):
+                        case opcode_byte(wasm1p1_code::return_call_indirect):
+                        {
+                            if(!wasm1p1_para.enable_tail_call) [[unlikely]]
+                            {
+                                fail_lazy_feature_required(op_begin,
+                                                           err,
+                                                           static_cast<::std::uint_least32_t>(op_byte),
+                                                           ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call,
+                                                           ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+                            }
+                            if(op_byte == static_cast<unsigned>(opcode_byte(wasm1p1_code::return_call)))
+                            {
+                                (void)read_leb128_immediate<wasm_u32>(code_curr,
+                                                                      code_end,
+                                                                      op_begin,
+                                                                      code_validation_error_code::invalid_function_index_encoding,
+                                                                      err);
+                                return;
+                            }
+                            (void)read_leb128_immediate<wasm_u32>(code_curr, code_end, op_begin, code_validation_error_code::invalid_type_index, err);
+                            (void)read_leb128_immediate<wasm_u32>(code_curr, code_end, op_begin, code_validation_error_code::invalid_table_index, err);
+                            return;
+                        }
                         case opcode_byte(wasm1p1_code::table_get):
                         case opcode_byte(wasm1p1_code::table_set):
                         {
@@ -1460,6 +1523,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
 
             ::uwvm2::utils::container::vector<lazy_split_control_frame> control_stack{};
             control_stack.reserve(32uz);
+            bool has_loop{};
             control_stack.push_back({.eu_index = function_eu_index, .kind = lazy_execution_unit_kind::function});
 
             auto code_curr{code_begin};
@@ -1514,6 +1578,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
                         auto const eu_index{
                             append_execution_unit(storage, function_index, local_function_index, parent_eu_index, depth, code_begin, op_begin, nullptr, kind)};
                         control_stack.push_back({.eu_index = eu_index, .kind = kind});
+                        has_loop |= kind == lazy_execution_unit_kind::loop;
                         break;
                     }
                     case wasm1_code::else_:
@@ -1554,6 +1619,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
                             if(code_curr != code_end) [[unlikely]] { fail_lazy_split(op_begin, code_validation_error_code::trailing_code_after_end, err); }
 
                             fn.eu_count = storage.execution_units.size() - fn.first_eu_index;
+                            // Function-only splitting skips this scan, so its functions conservatively stay on the full tier.
+                            fn.baseline_tier_eligible = !has_loop;
                             append_function_compile_units(storage, fn, cfg);
                             return;
                         }
@@ -1681,12 +1748,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
 
             // Materialize with the eager single-function compiler. This deliberately trades partial compilation for identical emitted
             // opfunc streams, stack metadata, and call handling across lazy and non-lazy modes.
+            auto& fn{storage.functions.index_unchecked(local_function_index)};
+            bool const baseline{options.hot_tier_call_threshold != 0u && fn.baseline_tier_eligible};
+            auto compile_options{options.compile_options};
+            compile_options.baseline_translation = baseline;
             ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::details::compile_all_from_uwvm_local_func<CompileOption>(curr_module,
-                                                                                                                                  options.compile_options,
+                                                                                                                                  compile_options,
                                                                                                                                   storage.compiled,
                                                                                                                                   local_function_index,
                                                                                                                                   options.validator_feature_parameter,
                                                                                                                                   err);
+            // Published by the caller's release store of the materialization state.
+            fn.hot_tier.phase.store(baseline ? lazy_hot_tier_phase::baseline : lazy_hot_tier_phase::none, ::std::memory_order_relaxed);
         }
 
         template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption>
@@ -1837,6 +1910,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
 
         storage.functions.clear();
         storage.functions.resize(local_func_count);
+        storage.hot_funcs.clear();
+        storage.hot_funcs.resize(local_func_count);
         storage.execution_units.clear();
         storage.compile_units.clear();
         storage.execution_units.reserve(local_func_count);
@@ -1984,6 +2059,97 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::compile_cu_from
                                                                      compile_end_time - compile_start_time);
     }
 
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption>
+    [[nodiscard]] inline constexpr local_func_storage_t const* promote_lazy_local_function(runtime_module_storage_t const& curr_module,
+                                                                                          lazy_module_storage_t& storage,
+                                                                                          lazy_compile_options const& options,
+                                                                                          ::std::size_t local_function_index) noexcept
+    {
+        // Re-translate one hot baseline function with the full pipeline. Exactly one caller wins the claim; everyone else, including
+        // callers racing the winner, keeps running the baseline body until the promoted phase is published.
+        if(local_function_index >= storage.functions.size() || local_function_index >= storage.hot_funcs.size()) [[unlikely]] { return nullptr; }
+        auto& fn{storage.functions.index_unchecked(local_function_index)};
+
+        auto expected{lazy_hot_tier_phase::baseline};
+        if(!fn.hot_tier.phase.compare_exchange_strong(expected, lazy_hot_tier_phase::promoting, ::std::memory_order_acq_rel, ::std::memory_order_acquire))
+        {
+            return expected == lazy_hot_tier_phase::promoted ? ::std::addressof(storage.hot_funcs.index_unchecked(local_function_index)) : nullptr;
+        }
+
+        ::fast_io::unix_timestamp compile_start_time{};
+        if(::uwvm2::runtime::compiler::uwvm_int::lazy_runtime_log::enabled()) [[unlikely]]
+        {
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                compile_start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // do nothing
+            }
+# endif
+        }
+
+        // The baseline compile already validated the body, so promotion only re-runs translation into the dedicated slot.
+        auto compile_options{options.compile_options};
+        compile_options.baseline_translation = false;
+        compile_options.translated_func_output = ::std::addressof(storage.hot_funcs.index_unchecked(local_function_index));
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+# ifdef UWVM_CPP_EXCEPTIONS
+        try
+# endif
+        {
+            ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::details::compile_all_from_uwvm_local_func<CompileOption>(curr_module,
+                                                                                                                                  compile_options,
+                                                                                                                                  storage.compiled,
+                                                                                                                                  local_function_index,
+                                                                                                                                  options.validator_feature_parameter,
+                                                                                                                                  err);
+        }
+# ifdef UWVM_CPP_EXCEPTIONS
+        catch(...)
+        {
+            // A failed re-translation is not a wasm error: the validated baseline body simply stays authoritative.
+            fn.hot_tier.phase.store(lazy_hot_tier_phase::none, ::std::memory_order_release);
+            return nullptr;
+        }
+# endif
+
+        // Release pairs with the acquire load on the call path so the promoted bytecode is visible before anyone dispatches into it.
+        fn.hot_tier.phase.store(lazy_hot_tier_phase::promoted, ::std::memory_order_release);
+
+        ::fast_io::unix_timestamp compile_end_time{};
+        if(::uwvm2::runtime::compiler::uwvm_int::lazy_runtime_log::enabled()) [[unlikely]]
+        {
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                compile_end_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // do nothing
+            }
+# endif
+        }
+        ::uwvm2::runtime::compiler::uwvm_int::lazy_runtime_log::line(u8"hot-tier-promote module_id=",
+                                                                     options.compile_options.curr_wasm_id,
+                                                                     u8" local_fn=",
+                                                                     local_function_index,
+                                                                     u8" fn=",
+                                                                     fn.function_index,
+                                                                     u8" calls=",
+                                                                     fn.hot_tier.call_count.load(::std::memory_order_relaxed),
+                                                                     u8" time=",
+                                                                     compile_end_time - compile_start_time);
+        return ::std::addressof(storage.hot_funcs.index_unchecked(local_function_index));
+    }
+
     template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption>
     [[nodiscard]] inline constexpr ::uwvm2::utils::thread::lazy_compile_request make_lazy_compile_request(lazy_compile_request_context & ctx,
                                                                                                           unsigned priority = 0u) noexcept
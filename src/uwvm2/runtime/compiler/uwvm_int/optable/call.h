@@ -91,6 +91,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
 
             ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_func(curr_module_id, type_index, table_index, uwvm_int_operand_stack_top_ptr);
         }
+
+        /// @brief Runtime call bridge: records a pending `return_call`/`return_call_indirect`.
+        /// @details
+        /// - Stack-top optimization: not applicable (the arguments are read from the operand stack memory below `uwvm_int_operand_stack_top`).
+        /// - Bytecode layout: not applicable.
+        /// @note `tail_call_func` must be set during interpreter initialization; debug builds may trap on null.
+        UWVM_GNU_HOT inline constexpr void tail_call(::std::size_t curr_module_id,
+                                                     ::std::size_t callee,
+                                                     ::std::size_t table_index,
+                                                     ::std::size_t arg_bytes,
+                                                     ::std::byte const* uwvm_int_operand_stack_top) noexcept
+        {
+            if(::uwvm2::runtime::compiler::uwvm_int::optable::tail_call_func == nullptr) [[unlikely]]
+            {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+# endif
+                ::fast_io::fast_terminate();
+            }
+
+            ::uwvm2::runtime::compiler::uwvm_int::optable::tail_call_func(curr_module_id,
+                                                                           callee,
+                                                                           table_index,
+                                                                           uwvm_int_operand_stack_top - arg_bytes,
+                                                                           arg_bytes);
+        }
     }  // namespace details
 
     /// @brief `call` opcode (tail-call): calls a function and then tail-calls the next interpreter op.
@@ -268,6 +294,81 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(typeref...[1]));
     }
 
+    /// @brief `return_call`/`return_call_indirect` opcode (tail-call): records the pending call and leaves the frame like `return`.
+    /// @details
+    /// - Stack-top optimization: requires the arguments (and the i32 selector for `return_call_indirect`) to reside in the operand stack memory; the
+    ///   compiler flushes the stack-top cache first, as for `return`. Operands below the arguments are simply abandoned with the frame.
+    /// - `type[0]` layout: `[opfunc_ptr][curr_module_id][callee][table_index][arg_bytes]` (terminal op, no `next_opfunc_ptr`).
+    /// @note The call itself is issued by the runtime after this frame has been released; see `interpreter_tail_call_func_t`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+        requires (CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_return_call(Type... type) UWVM_THROWS
+    {
+        static_assert(sizeof...(Type) >= 2uz);
+        static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+
+        type...[0] += sizeof(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...>);
+
+        ::std::size_t curr_module_id;  // no init
+        ::std::memcpy(::std::addressof(curr_module_id), type...[0], sizeof(curr_module_id));
+        type...[0] += sizeof(curr_module_id);
+
+        ::std::size_t callee;  // no init
+        ::std::memcpy(::std::addressof(callee), type...[0], sizeof(callee));
+        type...[0] += sizeof(callee);
+
+        ::std::size_t table_index;  // no init
+        ::std::memcpy(::std::addressof(table_index), type...[0], sizeof(table_index));
+        type...[0] += sizeof(table_index);
+
+        ::std::size_t arg_bytes;  // no init
+        ::std::memcpy(::std::addressof(arg_bytes), type...[0], sizeof(arg_bytes));
+
+        details::tail_call(curr_module_id, callee, table_index, arg_bytes, type...[1]);
+
+        // Like `return`, ending the dispatch chain hands control back to `execute_compiled_defined`.
+    }
+
+    /// @brief `return_call`/`return_call_indirect` opcode (non-tail-call/byref): records the pending call and signals loop termination.
+    /// @details
+    /// - Stack-top optimization: not supported (byref mode disables stack-top caching).
+    /// - `type[0]` layout: `[opfunc_byref_ptr][curr_module_id][callee][table_index][arg_bytes]`; sets `typeref...[0] = nullptr` like `return`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeRef>
+        requires (!CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_return_call(TypeRef & ... typeref) UWVM_THROWS
+    {
+        static_assert(sizeof...(TypeRef) >= 2uz);
+        static_assert(::std::same_as<TypeRef...[0u], ::std::byte const*>);
+        static_assert(CompileOption.i32_stack_top_begin_pos == SIZE_MAX && CompileOption.i32_stack_top_end_pos == SIZE_MAX);
+        static_assert(CompileOption.i64_stack_top_begin_pos == SIZE_MAX && CompileOption.i64_stack_top_end_pos == SIZE_MAX);
+        static_assert(CompileOption.f32_stack_top_begin_pos == SIZE_MAX && CompileOption.f32_stack_top_end_pos == SIZE_MAX);
+        static_assert(CompileOption.f64_stack_top_begin_pos == SIZE_MAX && CompileOption.f64_stack_top_end_pos == SIZE_MAX);
+        static_assert(CompileOption.v128_stack_top_begin_pos == SIZE_MAX && CompileOption.v128_stack_top_end_pos == SIZE_MAX);
+
+        auto curr{typeref...[0] + sizeof(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_byref_t<TypeRef...>)};
+
+        ::std::size_t curr_module_id;  // no init
+        ::std::memcpy(::std::addressof(curr_module_id), curr, sizeof(curr_module_id));
+        curr += sizeof(curr_module_id);
+
+        ::std::size_t callee;  // no init
+        ::std::memcpy(::std::addressof(callee), curr, sizeof(callee));
+        curr += sizeof(callee);
+
+        ::std::size_t table_index;  // no init
+        ::std::memcpy(::std::addressof(table_index), curr, sizeof(table_index));
+        curr += sizeof(table_index);
+
+        ::std::size_t arg_bytes;  // no init
+        ::std::memcpy(::std::addressof(arg_bytes), curr, sizeof(arg_bytes));
+
+        details::tail_call(curr_module_id, callee, table_index, arg_bytes, typeref...[1]);
+
+        typeref...[0] = nullptr;
+    }
+
     namespace translate
     {
         /// @brief Translator: returns the interpreter function pointer for `call` (tail-call).
@@ -351,6 +452,38 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             get_uwvmint_call_indirect_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                       ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
         { return get_uwvmint_call_indirect_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+
+        /// @brief Translator: returns the interpreter function pointer for `return_call`/`return_call_indirect` (tail-call).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<Type...>
+            get_uwvmint_return_call_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_return_call<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_return_call_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_return_call_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+
+        /// @brief Translator: returns the interpreter function pointer for `return_call`/`return_call_indirect` (non-tail-call/byref).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_byref_t<Type...>
+            get_uwvmint_return_call_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_return_call<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_return_call_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_return_call_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
     }  // namespace translate
 }
 #endif
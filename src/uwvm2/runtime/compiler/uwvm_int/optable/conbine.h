@@ -9522,6 +9522,77 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             }
         }
 
+        // -------------------------------------------------
+        // Hoisted bounds check for a group of `local.get base; load` (no push)
+        // Layout: [op][local_off][memory*][min_offset:u32][high_offset:u32][high_bytes:u32][count:u32]([offset:u32][bytes:u32] * count)[next]
+        // -------------------------------------------------
+
+        /// @brief Internal range check covering a straight-line group of loads that share one `local.get` base (tail-call).
+        /// @details
+        /// The translator only forms a group when nothing between its loads can trap, branch, call or write the base local, and emits the
+        /// group's loads with `bounds_check_hoisted`. One check of `[base + min_offset, base + high_offset + high_bytes)`, where `high` is
+        /// the access that ends last, therefore covers every load of the group. When it fails, the accesses are replayed in program order
+        /// and the first one that is out of bounds is reported, so the trap is the one the unhoisted loads would have raised.
+        template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void memory_bounds_guard_localget(Type... type) UWVM_THROWS
+        {
+            using wasm_i32 = details::wasm_i32;
+            using wasm_u32 = details::wasm_u32;
+            using native_memory_t = ::uwvm2::object::memory::linear::native_memory_t;
+
+            static_assert(sizeof...(Type) >= 3uz);
+            static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+            static_assert(::std::same_as<::std::remove_cvref_t<Type...[1u]>, ::std::byte*>);
+            static_assert(::std::same_as<::std::remove_cvref_t<Type...[2u]>, ::std::byte*>);
+
+            auto const op_begin{type...[0]};
+            type...[0] += sizeof(uwvm_interpreter_opfunc_t<Type...>);
+
+            local_offset_t const local_off{details::read_imm<local_offset_t>(type...[0])};
+            native_memory_t* memory_p{details::read_imm<native_memory_t*>(type...[0])};
+            wasm_u32 const min_offset{details::read_imm<wasm_u32>(type...[0])};
+            wasm_u32 const high_offset{details::read_imm<wasm_u32>(type...[0])};
+            wasm_u32 const high_bytes{details::read_imm<wasm_u32>(type...[0])};
+            wasm_u32 const count{details::read_imm<wasm_u32>(type...[0])};
+            auto const accesses_begin{type...[0]};
+            type...[0] += static_cast<::std::size_t>(count) * (2uz * sizeof(wasm_u32));
+
+            wasm_i32 const addr{load_local<wasm_i32>(type...[2u], local_off)};
+            auto const low{details::wasm32_effective_offset(addr, min_offset)};
+            auto const high{details::wasm32_effective_offset(addr, high_offset)};
+
+            auto const& memory{*memory_p};
+            details::enter_memory_operation_memory_lock(memory);
+            if(low.offset_65_bit || details::should_trap_oob_unlocked(memory, high, static_cast<::std::size_t>(high_bytes))) [[unlikely]]
+            {
+                // Cold path: find the access that faults first. The range above is the union of the group, so one always does.
+                auto accesses_curr{accesses_begin};
+                for(wasm_u32 i{}; i != count; ++i)
+                {
+                    wasm_u32 const offset{details::read_imm<wasm_u32>(accesses_curr)};
+                    ::std::size_t const bytes{static_cast<::std::size_t>(details::read_imm<wasm_u32>(accesses_curr))};
+                    auto const eff65{details::wasm32_effective_offset(addr, offset)};
+                    if(details::should_trap_oob_unlocked(memory, eff65, bytes))
+                    {
+                        type...[0] = op_begin;
+                        auto const memory_length{details::load_memory_length_for_oob_unlocked(memory)};
+                        details::memory_oob_terminate(0uz, static_cast<::std::uint_least64_t>(offset), eff65, memory_length, bytes);
+                    }
+                }
+
+#  if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#  endif
+                ::fast_io::fast_terminate();
+            }
+            details::exit_memory_operation_memory_lock(memory);
+
+            uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
+            ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+            UWVM_MUSTTAIL return next_interpreter(type...);
+        }
+
         // -------------------------------------------------
         // local.get + load (push result)
         // Layout: [op][local_off][memory*][offset:u32][next]
@@ -13200,14 +13271,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_i32_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i32_stack_top_begin_pos,
                                                        CompileOption.i32_stack_top_end_pos,
                                                        details::i32_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
@@ -13254,8 +13326,20 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i32_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
+
+        template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_memory_bounds_guard_localget_fptr(uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return details::op_details::memop::memory_bounds_guard_localget<CompileOption, Type...>; }
+
+        template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr auto get_uwvmint_memory_bounds_guard_localget_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                                                       ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_memory_bounds_guard_localget_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
@@ -13283,26 +13367,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f32_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept;
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept;
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f64_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept;
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept;
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_f32_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_f32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_f32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_f64_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_f64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_f64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 #  endif
 
         // Forward declare to satisfy two-phase lookup in the `_from_tuple` selector.
@@ -13322,131 +13410,143 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...>
             get_uwvmint_i32_load8_u_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                      details::op_details::native_memory_t const& memory) noexcept
+                                                      details::op_details::native_memory_t const& memory,
+                                                      bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i32_stack_top_begin_pos,
                                                        CompileOption.i32_stack_top_end_pos,
                                                        details::i32_load8_u_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...>
             get_uwvmint_i32_load8_s_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                      details::op_details::native_memory_t const& memory) noexcept
+                                                      details::op_details::native_memory_t const& memory,
+                                                      bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i32_stack_top_begin_pos,
                                                        CompileOption.i32_stack_top_end_pos,
                                                        details::i32_load8_s_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...>
             get_uwvmint_i32_load16_u_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                       details::op_details::native_memory_t const& memory) noexcept
+                                                       details::op_details::native_memory_t const& memory,
+                                                       bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i32_stack_top_begin_pos,
                                                        CompileOption.i32_stack_top_end_pos,
                                                        details::i32_load16_u_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...>
             get_uwvmint_i32_load16_s_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                       details::op_details::native_memory_t const& memory) noexcept
+                                                       details::op_details::native_memory_t const& memory,
+                                                       bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i32_stack_top_begin_pos,
                                                        CompileOption.i32_stack_top_end_pos,
                                                        details::i32_load16_s_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i32_load8_u_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                    details::op_details::native_memory_t const& memory,
-                                                                                   ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i32_load8_u_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                   ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                   bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i32_load8_u_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i32_load8_s_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                    details::op_details::native_memory_t const& memory,
-                                                                                   ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i32_load8_s_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                   ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                   bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i32_load8_s_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i32_load16_u_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                     details::op_details::native_memory_t const& memory,
-                                                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i32_load16_u_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                    bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i32_load16_u_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i32_load16_s_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                     details::op_details::native_memory_t const& memory,
-                                                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i32_load16_s_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                    bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i32_load16_s_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_i64_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.i64_stack_top_begin_pos,
                                                        CompileOption.i64_stack_top_end_pos,
                                                        details::i64_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.i64_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.i64_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_i64_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_i64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_i64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
 #  ifndef UWVM_ENABLE_UWVM_INT_HEAVY_COMBINE_OPS
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f32_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.f32_stack_top_begin_pos,
                                                        CompileOption.f32_stack_top_end_pos,
                                                        details::f32_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.f32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.f32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f64_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.f64_stack_top_begin_pos,
                                                        CompileOption.f64_stack_top_end_pos,
                                                        details::f64_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.f64_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.f64_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 #  endif
 
@@ -13629,22 +13629,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f32_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.f32_stack_top_begin_pos,
                                                        CompileOption.f32_stack_top_end_pos,
                                                        details::f32_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.f32_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.f32_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_f32_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_f32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_f32_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (!CompileOption.is_tail_call)
@@ -13841,22 +13843,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (CompileOption.is_tail_call)
         inline constexpr uwvm_interpreter_opfunc_t<Type...> get_uwvmint_f64_load_localget_off_fptr(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
-                                                                                                   details::op_details::native_memory_t const& memory) noexcept
+                                                                                                   details::op_details::native_memory_t const& memory,
+                                                                                                   bool bounds_check_hoisted = false) noexcept
         {
             return details::select_mem_fptr_or_default<CompileOption,
                                                        CompileOption.f64_stack_top_begin_pos,
                                                        CompileOption.f64_stack_top_end_pos,
                                                        details::f64_load_localget_off_op_with,
                                                        0uz,
-                                                       Type...>(curr_stacktop.f64_stack_top_curr_pos, memory);
+                                                       Type...>(curr_stacktop.f64_stack_top_curr_pos, memory, bounds_check_hoisted);
         }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... TypeInTuple>
             requires (CompileOption.is_tail_call)
         inline constexpr auto get_uwvmint_f64_load_localget_off_fptr_from_tuple(uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
                                                                                 details::op_details::native_memory_t const& memory,
-                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
-        { return get_uwvmint_f64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory); }
+                                                                                ::uwvm2::utils::container::tuple<TypeInTuple...> const&,
+                                                                                bool bounds_check_hoisted = false) noexcept
+        { return get_uwvmint_f64_load_localget_off_fptr<CompileOption, TypeInTuple...>(curr_stacktop, memory, bounds_check_hoisted); }
 
         template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
             requires (!CompileOption.is_tail_call)
@@ -341,6 +341,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ///          must be handled separately.
         ::std::size_t v128_stack_top_begin_pos{SIZE_MAX};
         ::std::size_t v128_stack_top_end_pos{SIZE_MAX};
+
+        /// @brief   Pinned memory0 slots (`::std::byte*` begin/end of the linear memory as last observed by this frame).
+        /// @details Both are either `SIZE_MAX` or distinct positions outside every stack-top range. They start out null on function entry, so the
+        ///          first checked access refreshes them; afterwards loads/stores compare against the pinned length and index the pinned base without
+        ///          reloading either from `native_memory_t`. Only used where the base cannot move (mmap backends); a stale end is always smaller than
+        ///          the real one because memory never shrinks, and a failed pinned check re-reads the live length before trapping.
+        ::std::size_t memory0_begin_pos{SIZE_MAX};
+        ::std::size_t memory0_end_pos{SIZE_MAX};
     };
 
     struct uwvm_interpreter_stacktop_currpos_t
@@ -391,6 +399,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::std::size_t wasm_module_id, ::std::size_t type_index, ::std::size_t table_index, ::std::byte** stack_top_ptr)
         UWVM_THROWS;
 
+    /// @details `return_call`/`return_call_indirect` only record the pending call here and then leave the current frame like `return`. The runtime
+    ///          performs the call after the frame is gone, so a chain of tail calls runs in constant native stack. `table_index == SIZE_MAX`
+    ///          marks a direct call (`callee` is then encoded exactly like the `call` immediate); otherwise `callee` is the type index.
+    ///          `[args, args + arg_bytes)` are the top operands: the arguments, plus the i32 selector for indirect calls.
+    using interpreter_tail_call_func_t = void(UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::std::size_t wasm_module_id,
+                                                                                  ::std::size_t callee,
+                                                                                  ::std::size_t table_index,
+                                                                                  ::std::byte const* args,
+                                                                                  ::std::size_t arg_bytes) noexcept;
+
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
     inline constexpr ::std::uintptr_t interpreter_tiered_loop_osr_disabled_state_address{::std::numeric_limits<::std::uintptr_t>::max()};
 
@@ -475,6 +493,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     {
         // Indicates the module number of the currently compiled WASM, used for external function calls.
         ::std::size_t curr_wasm_id{};
+        // Quick first-tier translation: one opfunc per wasm instruction, without opcode conbination, delay-local peepholes,
+        // instruction reordering or loop unwinding. Lazy mode uses it for cold functions and re-translates them once hot.
+        bool baseline_translation{};
+        // When non-null the finished body is moved here instead of into `local_funcs`, so a re-translation can be published while
+        // frames are still executing the previous body.
+        local_func_storage_t* translated_func_output{};
+        // Maps a defined function owned by another module (runtime storage, opaque here) to a call-info record whose address stays
+        // valid for the runtime's lifetime. Imports linked to another wasm module then use the direct call-info encoding instead of
+        // the import bridge. Null, or a null result, keeps the import bridge.
+        compiled_defined_call_info const* (*resolve_cross_module_call_info)(void const* runtime_func) noexcept {};
     };
 
     template <uwvm_int_stack_top_type... Type>
@@ -44,6 +44,7 @@ export import :delay_local;
 export import :instruction_reorder;
 export import :conbine_heavy;
 export import :combine_extra_heavy;
+export import :opfunc_profile;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
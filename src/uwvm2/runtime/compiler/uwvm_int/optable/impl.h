@@ -41,4 +41,5 @@
 # include "instruction_reorder.h"
 # include "conbine_heavy.h"
 # include "combine_extra_heavy.h"
+# include "opfunc_profile.h"
 #endif
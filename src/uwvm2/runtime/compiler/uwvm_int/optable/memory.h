@@ -653,6 +653,84 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         }
 # endif
 
+        /// @brief Used by loads whose range was already proven by a preceding `memory_bounds_guard_localget` (see conbine.h).
+        /// @note  Memory never shrinks, so a range that was in bounds at the guard stays in bounds for the rest of its group.
+        UWVM_ALWAYS_INLINE inline constexpr void bounds_check_hoisted([[maybe_unused]] native_memory_t const& memory,
+                                                                      [[maybe_unused]] ::std::size_t memory_idx,
+                                                                      [[maybe_unused]] ::std::uint_least64_t memory_static_offset,
+                                                                      [[maybe_unused]] memory_offset_t effective_offset,
+                                                                      [[maybe_unused]] ::std::size_t wasm_bytes) noexcept
+        {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(memory.memory_begin == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+            if(should_trap_oob_unlocked(memory, effective_offset, wasm_bytes)) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+# endif
+        }
+
+        /// @brief Whether loads/stores selected with `BoundsCheckFn` check and address memory0 through the pinned argument slots.
+        /// @note  Only the dynamic-length mmap variant is pinned: the mmap base never moves, and the acquire load of the length is what pinning saves.
+        template <uwvm_interpreter_translate_option_t CompileOption, auto BoundsCheckFn>
+        inline consteval bool memory0_pinned_for() noexcept
+        {
+# if defined(UWVM_SUPPORT_MMAP)
+            if constexpr(CompileOption.is_tail_call && CompileOption.memory0_begin_pos != SIZE_MAX) { return BoundsCheckFn == bounds_check_mmap_judge; }
+            else
+            {
+                return false;
+            }
+# else
+            return false;
+# endif
+        }
+
+# if defined(UWVM_SUPPORT_MMAP)
+        /// @brief Bounds check against the pinned `[begin, end)` of memory0, re-pinning from the live length on a miss.
+        /// @note  Pins are null on function entry and may lag behind `memory.grow` (here or on another thread), so a miss is not yet a trap.
+        template <uwvm_interpreter_translate_option_t CompileOption, uwvm_int_stack_top_type... Type>
+        UWVM_ALWAYS_INLINE inline constexpr void bounds_check_pinned_memory0(native_memory_t const& memory,
+                                                                              ::std::uint_least64_t memory_static_offset,
+                                                                              memory_offset_t effective_offset,
+                                                                              ::std::size_t wasm_bytes,
+                                                                              Type&... type) noexcept
+        {
+            constexpr ::std::size_t begin_pos{CompileOption.memory0_begin_pos};
+            constexpr ::std::size_t end_pos{CompileOption.memory0_end_pos};
+            static_assert(begin_pos < sizeof...(Type) && end_pos < sizeof...(Type));
+            static_assert(::std::same_as<Type...[begin_pos], ::std::byte*> && ::std::same_as<Type...[end_pos], ::std::byte*>);
+
+            auto const pinned_length{static_cast<::std::size_t>(type...[end_pos] - type...[begin_pos])};
+            if(effective_offset.offset_65_bit || wasm_bytes > pinned_length ||
+               effective_offset.offset > static_cast<::std::uint_least64_t>(pinned_length - wasm_bytes)) [[unlikely]]
+            {
+#  if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                if(memory.memory_begin == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+                if(memory.memory_length_p == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#  endif
+
+                auto const memory_length{memory.memory_length_p->load(::std::memory_order_acquire)};
+                if(effective_offset.offset_65_bit || wasm_bytes > memory_length ||
+                   effective_offset.offset > static_cast<::std::uint_least64_t>(memory_length - wasm_bytes)) [[unlikely]]
+                {
+                    memory_oob_terminate(0uz, memory_static_offset, effective_offset, memory_length, wasm_bytes);
+                }
+
+                type...[begin_pos] = memory.memory_begin;
+                type...[end_pos] = memory.memory_begin + memory_length;
+            }
+        }
+# endif
+
+        /// @brief Base address for a load/store selected with `BoundsCheckFn`: the pinned slot when pinned, otherwise `memory.memory_begin`.
+        template <uwvm_interpreter_translate_option_t CompileOption, auto BoundsCheckFn, uwvm_int_stack_top_type... Type>
+        UWVM_ALWAYS_INLINE inline constexpr ::std::byte* memory0_begin(native_memory_t const& memory, [[maybe_unused]] Type const&... type) noexcept
+        {
+            if constexpr(memory0_pinned_for<CompileOption, BoundsCheckFn>()) { return type...[CompileOption.memory0_begin_pos]; }
+            else
+            {
+                return memory.memory_begin;
+            }
+        }
+
         UWVM_ALWAYS_INLINE inline constexpr memory_offset_t wasm32_effective_offset(wasm_i32 addr, wasm_u32 static_offset) noexcept
         {
             // uwvm2 memory addressing rule for wasm32:
@@ -1002,13 +1080,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<4uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 4uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 4uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            auto const out{details::load_i32_le(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            auto const out{details::load_i32_le(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             if constexpr(details::stacktop_enabled_for<CompileOption, wasm_i32>())
             {
@@ -1064,13 +1147,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<8uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 8uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 8uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            auto const out{details::load_i64_le(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            auto const out{details::load_i64_le(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             if constexpr(details::stacktop_enabled_for<CompileOption, wasm_i64>())
             {
@@ -1134,13 +1222,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<4uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 4uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 4uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            auto const out{details::load_f32_le(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            auto const out{details::load_f32_le(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             if constexpr(details::stacktop_enabled_for<CompileOption, wasm_f32>())
             {
@@ -1204,13 +1297,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<8uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 8uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 8uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            auto const out{details::load_f64_le(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            auto const out{details::load_f64_le(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             if constexpr(details::stacktop_enabled_for<CompileOption, wasm_f64>())
             {
@@ -1489,13 +1587,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<1uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 1uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 1uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            ::std::uint_least8_t b{details::load_u8(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            ::std::uint_least8_t b{details::load_u8(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             wasm_i32 out{};
             if constexpr(Signed) { out = static_cast<wasm_i32>(static_cast<::std::int_least32_t>(static_cast<::std::int_least8_t>(b))); }
@@ -1554,14 +1657,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<2uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 2uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 2uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
             ::std::uint_least16_t tmp;  // no init
-            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory.memory_begin, eff), sizeof(tmp));
+            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory_base, eff), sizeof(tmp));
             tmp = ::fast_io::little_endian(tmp);
             details::exit_memory_operation_memory_lock(memory);
 
@@ -1623,13 +1731,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<1uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 1uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 1uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            ::std::uint_least8_t b{details::load_u8(details::ptr_add_u64(memory.memory_begin, eff))};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            ::std::uint_least8_t b{details::load_u8(details::ptr_add_u64(memory_base, eff))};
             details::exit_memory_operation_memory_lock(memory);
             wasm_i64 out{};
             if constexpr(Signed) { out = static_cast<wasm_i64>(static_cast<::std::int_least64_t>(static_cast<::std::int_least8_t>(b))); }
@@ -1701,14 +1814,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<2uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 2uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 2uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
             ::std::uint_least16_t tmp;  // no init
-            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory.memory_begin, eff), sizeof(tmp));
+            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory_base, eff), sizeof(tmp));
             tmp = ::fast_io::little_endian(tmp);
             details::exit_memory_operation_memory_lock(memory);
 
@@ -1782,14 +1900,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32addr<4uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 4uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 4uz);
             }
 
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
             ::std::uint_least32_t tmp;  // no init
-            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory.memory_begin, eff), sizeof(tmp));
+            ::std::memcpy(::std::addressof(tmp), details::ptr_add_u64(memory_base, eff), sizeof(tmp));
             tmp = ::fast_io::little_endian(tmp);
             details::exit_memory_operation_memory_lock(memory);
 
@@ -1972,12 +2095,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32_store<4uz, CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 4uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 4uz);
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            details::store_i32_le(details::ptr_add_u64(memory.memory_begin, eff), value);
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            details::store_i32_le(details::ptr_add_u64(memory_base, eff), value);
             details::exit_memory_operation_memory_lock(memory);
 
             uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
@@ -2052,12 +2180,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i64_store<8uz, CompileOption, curr_i64_stack_top, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 8uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 8uz);
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            details::store_i64_le(details::ptr_add_u64(memory.memory_begin, eff), value);
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            details::store_i64_le(details::ptr_add_u64(memory_base, eff), value);
             details::exit_memory_operation_memory_lock(memory);
 
             uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
@@ -2132,12 +2265,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_f32_store<4uz, CompileOption, curr_f32_stack_top, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 4uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 4uz);
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            details::store_f32_le(details::ptr_add_u64(memory.memory_begin, eff), value);
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            details::store_f32_le(details::ptr_add_u64(memory_base, eff), value);
             details::exit_memory_operation_memory_lock(memory);
 
             uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
@@ -2212,12 +2350,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_f64_store<8uz, CompileOption, curr_f64_stack_top, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory, static_cast<::std::uint_least64_t>(offset), eff65, 8uz, type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, 8uz);
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
-            details::store_f64_le(details::ptr_add_u64(memory.memory_begin, eff), value);
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
+            details::store_f64_le(details::ptr_add_u64(memory_base, eff), value);
             details::exit_memory_operation_memory_lock(memory);
 
             uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
@@ -2281,20 +2424,29 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     UWVM_MUSTTAIL return trap_oob_i32_store<static_cast<::std::size_t>(StoreBytes), CompileOption, curr_i32_stack_top, Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory,
+                                                                    static_cast<::std::uint_least64_t>(offset),
+                                                                    eff65,
+                                                                    static_cast<::std::size_t>(StoreBytes),
+                                                                    type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, static_cast<::std::size_t>(StoreBytes));
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
 
             if constexpr(StoreBytes == 1u)
             {
-                details::store_u8(details::ptr_add_u64(memory.memory_begin, eff),
+                details::store_u8(details::ptr_add_u64(memory_base, eff),
                                   static_cast<::std::uint_least8_t>(::std::bit_cast<::std::uint_least32_t>(value)));
             }
             else
             {
-                details::store_u16_le(details::ptr_add_u64(memory.memory_begin, eff),
+                details::store_u16_le(details::ptr_add_u64(memory_base, eff),
                                       static_cast<::std::uint_least16_t>(::std::bit_cast<::std::uint_least32_t>(value)));
             }
             details::exit_memory_operation_memory_lock(memory);
@@ -2377,25 +2529,34 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                                                             Type...>(type...);
                 }
             }
+            else if constexpr(details::memory0_pinned_for<CompileOption, BoundsCheckFn>())
+            {
+                details::bounds_check_pinned_memory0<CompileOption>(memory,
+                                                                    static_cast<::std::uint_least64_t>(offset),
+                                                                    eff65,
+                                                                    static_cast<::std::size_t>(StoreBytes),
+                                                                    type...);
+            }
             else
             {
                 BoundsCheckFn(memory, 0uz, static_cast<::std::uint_least64_t>(offset), eff65, static_cast<::std::size_t>(StoreBytes));
             }
             ::std::size_t const eff{static_cast<::std::size_t>(eff65.offset)};
+            auto const memory_base{details::memory0_begin<CompileOption, BoundsCheckFn>(memory, type...)};
 
             if constexpr(StoreBytes == 1u)
             {
-                details::store_u8(details::ptr_add_u64(memory.memory_begin, eff),
+                details::store_u8(details::ptr_add_u64(memory_base, eff),
                                   static_cast<::std::uint_least8_t>(::std::bit_cast<::std::uint_least64_t>(value)));
             }
             else if constexpr(StoreBytes == 2u)
             {
-                details::store_u16_le(details::ptr_add_u64(memory.memory_begin, eff),
+                details::store_u16_le(details::ptr_add_u64(memory_base, eff),
                                       static_cast<::std::uint_least16_t>(::std::bit_cast<::std::uint_least64_t>(value)));
             }
             else
             {
-                details::store_u32_le(details::ptr_add_u64(memory.memory_begin, eff),
+                details::store_u32_le(details::ptr_add_u64(memory_base, eff),
                                       static_cast<::std::uint_least32_t>(::std::bit_cast<::std::uint_least64_t>(value)));
             }
             details::exit_memory_operation_memory_lock(memory);
@@ -3712,6 +3873,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             }
 # endif
 
+            /// @brief Whether loads on `memory` pay for an explicit bounds check, so that hoisting it out of a group of loads is worthwhile.
+            /// @details Allocator-backed and custom-page memories always compare against the current length. mmap-backed memories only do
+            ///          so when their size must be determined dynamically; full and partial guard-page protection is already cheap.
+            inline constexpr bool memory_bounds_check_hoistable([[maybe_unused]] op_details::native_memory_t const& memory) noexcept
+            {
+# if defined(UWVM_SUPPORT_MMAP)
+                return select_mmap_variant(memory) == mmap_variant::judge;
+# else
+                return true;
+# endif
+            }
+
             template <uwvm_interpreter_translate_option_t CompileOption,
                       ::std::size_t Begin,
                       ::std::size_t End,
@@ -3719,9 +3892,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                       auto Extra,
                       uwvm_int_stack_top_type... Type>
                 requires (CompileOption.is_tail_call)
-            inline constexpr uwvm_interpreter_opfunc_t<Type...> select_mem_fptr_or_default(::std::size_t pos,
-                                                                                           op_details::native_memory_t const& memory) noexcept
+            inline constexpr uwvm_interpreter_opfunc_t<Type...>
+                select_mem_fptr_or_default(::std::size_t pos, op_details::native_memory_t const& memory, bool bounds_check_hoisted = false) noexcept
             {
+                if(bounds_check_hoisted)
+                {
+                    // The translator only passes `true` after emitting a `memory_bounds_guard_localget` that covers this access.
+                    return select_stacktop_fptr_or_default_with<CompileOption, Begin, End, OpWithBoundsCheck, &op_details::bounds_check_hoisted, Extra, Type...>(
+                        pos);
+                }
+
 # if defined(UWVM_SUPPORT_MMAP)
                 switch(select_mmap_variant(memory))
                 {
@@ -0,0 +1,61 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/runtime/compiler/uwvm_int/macro/push_macros.h>
+// platform
+#if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+# if !(defined(_WIN32) && !defined(__CYGWIN__)) && __has_include(<dlfcn.h>)
+#  include <dlfcn.h>
+# endif
+# if __has_include(<cxxabi.h>)
+#  include <cxxabi.h>
+# endif
+#endif
+
+export module uwvm2.runtime.compiler.uwvm_int.optable:opfunc_profile;
+
+import fast_io;
+import uwvm2.utils.container;
+import uwvm2.utils.mutex;
+import :define;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "opfunc_profile.h"
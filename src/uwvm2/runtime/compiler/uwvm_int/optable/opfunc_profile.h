@@ -0,0 +1,507 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <algorithm>
+# include <concepts>
+# include <cstddef>
+# include <cstdint>
+# include <cstdlib>
+# include <cstring>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/runtime/compiler/uwvm_int/macro/push_macros.h>
+# include <uwvm2/uwvm/runtime/macro/push_macros.h>
+// platform
+# if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+#  if !(defined(_WIN32) && !defined(__CYGWIN__)) && __has_include(<dlfcn.h>)
+#   include <dlfcn.h>
+#  endif
+#  if __has_include(<cxxabi.h>)
+#   include <cxxabi.h>
+#  endif
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include "define.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+# if !(__cpp_pack_indexing >= 202311L)
+#  error "UWVM requires at least C++26 standard compiler. See https://en.cppreference.com/w/cpp/feature_test#cpp_pack_indexing"
+# endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
+{
+# ifdef UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE
+
+    /**
+     * @brief Dynamic opfunc n-gram profiler (instrumented builds only).
+     *
+     * @details
+     * The fusion layers (`conbine.h`, `conbine_heavy.h`, `combine_extra_heavy.h`) were picked from static opcode frequencies. This
+     * profiler measures what is actually dispatched instead. With `--runtime-uwvm-int-opfunc-profile`, the translator prefixes every
+     * emitted opfunc with a probe:
+     *
+     * @code
+     * [probe_ptr][back_offset:u32][opfunc_ptr][immediates...]
+     * @endcode
+     *
+     * The probe reads the opfunc pointer that follows it at run time, so it sees the stream after delay-local variantization and every
+     * combine peephole has patched it. `back_offset` is the byte distance back to the previous probe of the same stream (`0` for the
+     * first one). Two dispatches extend an n-gram only when they are consecutive at run time *and* the earlier probe is the layout
+     * predecessor of the later one, i.e. straight-line code a fused opfunc could replace. Taken branches, calls, and returns break the
+     * chain.
+     *
+     * Peepholes that patch the last emitted opfunc are unaffected by the probes. The few lookbehind fusions that also verify the
+     * instruction *before* it step back over its probe first, so a profiled stream fuses like a production one (see the invariant
+     * next to `skip_opfunc_profile_probe` in the translator).
+     *
+     * Counts go into a per-thread table (one mutex-guarded table without `UWVM_USE_THREAD_LOCAL`). `write_opfunc_profile` merges the
+     * tables and ranks sequences by projected dispatch savings: fusing an n-gram removes `n - 1` dispatches per execution.
+     */
+    namespace opfunc_profile
+    {
+        using opfunc_bits_t = ::std::uintptr_t;
+        using probe_back_offset_t = ::std::uint_least32_t;
+
+        inline constexpr ::std::size_t max_ngram_length{3uz};
+
+        struct ngram_key_t
+        {
+            opfunc_bits_t ops[max_ngram_length]{};
+            // `0` marks an empty table slot.
+            ::std::size_t length{};
+
+            [[nodiscard]] inline friend constexpr bool operator== (ngram_key_t const&, ngram_key_t const&) noexcept = default;
+        };
+
+        struct ngram_entry_t
+        {
+            ngram_key_t key{};
+            ::std::uint_least64_t count{};
+        };
+
+        /// @brief Open-addressing n-gram counters plus the dispatch history of the thread that owns them.
+        struct ngram_table_t
+        {
+            ::uwvm2::utils::container::vector<ngram_entry_t> slots{};
+            ::std::size_t used{};
+
+            ::std::byte const* last_probe_ip{};
+            // history[0]: previous opfunc, history[1]: the one before.
+            opfunc_bits_t history[max_ngram_length - 1uz]{};
+            // Number of entries of `history` that are layout predecessors of the current dispatch.
+            ::std::size_t chain{};
+        };
+
+        struct registry_t
+        {
+            ::uwvm2::utils::mutex::mutex_t mutex{};
+            ::uwvm2::utils::container::vector<ngram_table_t*> tables{};
+        };
+
+        inline registry_t registry{};  // [global]
+
+#  if defined(UWVM_USE_THREAD_LOCAL)
+        inline thread_local ngram_table_t* current_table{};  // [global] [thread_local]
+#  endif
+
+        [[nodiscard]] inline constexpr ::std::size_t hash_ngram_key(ngram_key_t const& key) noexcept
+        {
+            // Opfunc addresses are aligned and share their high bits, so mix every bit before masking.
+            ::std::uint_least64_t h{static_cast<::std::uint_least64_t>(key.length)};
+            for(::std::size_t i{}; i != key.length; ++i) { h ^= static_cast<::std::uint_least64_t>(key.ops[i]) + 0x9e3779b97f4a7c15u + (h << 6u) + (h >> 2u); }
+            h ^= h >> 33u;
+            h *= 0xff51afd7ed558ccdu;
+            h ^= h >> 33u;
+            return static_cast<::std::size_t>(h);
+        }
+
+        inline constexpr void ngram_table_add(ngram_table_t& table, ngram_key_t const& key, ::std::uint_least64_t n) noexcept
+        {
+            if((table.used + 1uz) * 2uz > table.slots.size()) [[unlikely]]
+            {
+                auto const old_slots{::std::move(table.slots)};
+                table.slots = ::uwvm2::utils::container::vector<ngram_entry_t>(old_slots.empty() ? 4096uz : old_slots.size() * 2uz);
+                table.used = 0uz;
+                for(auto const& e: old_slots)
+                {
+                    if(e.key.length != 0uz) { ngram_table_add(table, e.key, e.count); }
+                }
+            }
+
+            auto const mask{table.slots.size() - 1uz};
+            for(auto i{hash_ngram_key(key) & mask};; i = (i + 1uz) & mask)
+            {
+                auto& slot{table.slots.index_unchecked(i)};
+                if(slot.key.length == 0uz)
+                {
+                    slot.key = key;
+                    slot.count = n;
+                    ++table.used;
+                    return;
+                }
+                if(slot.key == key)
+                {
+                    slot.count += n;
+                    return;
+                }
+            }
+        }
+
+        inline constexpr void record_into(ngram_table_t& table, ::std::byte const* probe_ip, probe_back_offset_t back_offset, opfunc_bits_t op) noexcept
+        {
+            bool const adjacent{back_offset != 0u && table.last_probe_ip != nullptr &&
+                                reinterpret_cast<::std::uintptr_t>(table.last_probe_ip) + back_offset == reinterpret_cast<::std::uintptr_t>(probe_ip)};
+            if(!adjacent) { table.chain = 0uz; }
+            else if(table.chain != max_ngram_length - 1uz) { ++table.chain; }
+
+            ngram_table_add(table, ngram_key_t{{op}, 1uz}, 1u);
+            if(table.chain >= 1uz) { ngram_table_add(table, ngram_key_t{{table.history[0], op}, 2uz}, 1u); }
+            if(table.chain >= 2uz) { ngram_table_add(table, ngram_key_t{{table.history[1], table.history[0], op}, 3uz}, 1u); }
+
+            table.history[1] = table.history[0];
+            table.history[0] = op;
+            table.last_probe_ip = probe_ip;
+        }
+
+        /// @note Caller holds `registry.mutex`.
+        [[nodiscard]] inline ngram_table_t* register_table_locked() noexcept
+        {
+            using allocator_t = ::fast_io::native_typed_global_allocator<ngram_table_t>;
+            auto const table{::std::construct_at(allocator_t::allocate(1uz))};
+            registry.tables.push_back(table);
+            return table;
+        }
+
+        /// @brief Called by the probe opfunc for every dispatch. Kept out of line so the probe stays a small tail-calling shim.
+        UWVM_NOINLINE inline void record(::std::byte const* probe_ip, probe_back_offset_t back_offset, opfunc_bits_t op) noexcept
+        {
+#  if defined(UWVM_USE_THREAD_LOCAL)
+            auto table{current_table};
+            if(table == nullptr) [[unlikely]]
+            {
+                ::uwvm2::utils::mutex::mutex_guard_t registry_guard{registry.mutex};
+                table = register_table_locked();
+                current_table = table;
+            }
+            record_into(*table, probe_ip, back_offset, op);
+#  else
+            // Without thread_local every guest thread shares one table and one history; concurrent guests blur adjacency.
+            ::uwvm2::utils::mutex::mutex_guard_t registry_guard{registry.mutex};
+            auto const table{registry.tables.empty() ? register_table_locked() : registry.tables.front_unchecked()};
+            record_into(*table, probe_ip, back_offset, op);
+#  endif
+        }
+
+        namespace details
+        {
+            [[nodiscard]] inline ::uwvm2::utils::container::u8string trimmed_symbol_name([[maybe_unused]] char const* mangled)
+            {
+                char const* name{mangled};
+#  if __has_include(<cxxabi.h>)
+                int status{};
+                char* const demangled{::abi::__cxa_demangle(mangled, nullptr, nullptr, ::std::addressof(status))};
+                if(status == 0 && demangled != nullptr) { name = demangled; }
+#  endif
+
+                // "void uwvm2::...::optable::uwvmint_i32_add<...>(...)" -> "uwvmint_i32_add". Stack-top variants of one opfunc share a
+                // name on purpose: fusion candidates are about the operation sequence, not the ring position.
+                auto name_end{name};
+                while(*name_end != '\0' && *name_end != '<' && *name_end != '(') { ++name_end; }
+                auto name_begin{name_end};
+                while(name_begin != name && name_begin[-1] != ':' && name_begin[-1] != ' ') { --name_begin; }
+
+                auto result{::uwvm2::utils::container::u8concat_uwvm(
+                    ::uwvm2::utils::container::u8string_view{reinterpret_cast<char8_t const*>(name_begin), static_cast<::std::size_t>(name_end - name_begin)})};
+
+#  if __has_include(<cxxabi.h>)
+                ::std::free(demangled);
+#  endif
+                return result;
+            }
+        }  // namespace details
+
+        /// @brief Best-effort display name of an opfunc: its trimmed symbol name, its offset in the loaded image, or the raw address.
+        /// @details `dladdr` only sees exported symbols, so names need a `-rdynamic` build; image offsets are stable across runs of one
+        ///          binary and can be resolved with `addr2line -f -C -e <uwvm>`.
+        [[nodiscard]] inline ::uwvm2::utils::container::u8string opfunc_display_name(opfunc_bits_t bits)
+        {
+#  if !(defined(_WIN32) && !defined(__CYGWIN__)) && __has_include(<dlfcn.h>)
+            ::Dl_info info{};
+            if(::dladdr(reinterpret_cast<void*>(bits), ::std::addressof(info)) != 0)
+            {
+                // dladdr falls back to the nearest exported symbol; only an exact match names this opfunc.
+                if(info.dli_sname != nullptr && reinterpret_cast<opfunc_bits_t>(info.dli_saddr) == bits)
+                {
+                    return details::trimmed_symbol_name(info.dli_sname);
+                }
+                if(info.dli_fbase != nullptr)
+                {
+                    return ::uwvm2::utils::container::u8concat_uwvm(u8"+", ::fast_io::mnp::hex0x(bits - reinterpret_cast<opfunc_bits_t>(info.dli_fbase)));
+                }
+            }
+#  endif
+            return ::uwvm2::utils::container::u8concat_uwvm(::fast_io::mnp::hex0x(bits));
+        }
+
+        /// @brief Merge every thread's counters and write the ranked report.
+        /// @details Output is line oriented and tab separated so that reports of several corpora can be merged
+        ///          (`tools/uwvm_int_opfunc_ngram`):
+        /// @code
+        /// # uwvm-int opfunc n-gram profile
+        /// # dispatches	<total>
+        /// # n	count	saved_dispatches	saved_percent	sequence
+        /// 2	1200	1200	12.00	uwvmint_local_get uwvmint_i32_add
+        /// @endcode
+        ///          N-grams (n >= 2) come first, ranked by saved dispatches; single opfuncs (`n = 1`, nothing saved) follow, ranked by count.
+        /// @note Call only after guest execution has stopped: the per-thread tables are read without their owners' cooperation.
+        template <typename Output>
+        inline void write_opfunc_profile(Output& out)
+        {
+            ngram_table_t merged{};
+            {
+                ::uwvm2::utils::mutex::mutex_guard_t registry_guard{registry.mutex};
+                for(auto const table: registry.tables)
+                {
+                    for(auto const& e: table->slots)
+                    {
+                        if(e.key.length != 0uz) { ngram_table_add(merged, e.key, e.count); }
+                    }
+                }
+            }
+
+            // Every opfunc of an n-gram was also counted alone, so the unigrams list all addresses to name.
+            struct opfunc_name_t
+            {
+                opfunc_bits_t bits{};
+                ::uwvm2::utils::container::u8string name{};
+            };
+
+            ::uwvm2::utils::container::vector<opfunc_name_t> names{};
+            ::std::uint_least64_t total_dispatches{};
+            for(auto const& e: merged.slots)
+            {
+                if(e.key.length != 1uz) { continue; }
+                total_dispatches += e.count;
+                names.push_back(opfunc_name_t{e.key.ops[0], opfunc_display_name(e.key.ops[0])});
+            }
+            ::std::sort(names.begin(), names.end(), [](opfunc_name_t const& a, opfunc_name_t const& b) constexpr noexcept { return a.bits < b.bits; });
+
+            auto const name_of{[&](opfunc_bits_t bits) constexpr noexcept -> ::uwvm2::utils::container::u8string_view
+                               {
+                                   auto const it{::std::lower_bound(names.begin(),
+                                                                    names.end(),
+                                                                    bits,
+                                                                    [](opfunc_name_t const& a, opfunc_bits_t b) constexpr noexcept { return a.bits < b; })};
+                                   return ::uwvm2::utils::container::u8string_view{it->name.data(), it->name.size()};
+                               }};
+
+            struct row_t
+            {
+                ::std::size_t length{};
+                ::std::uint_least64_t count{};
+                ::uwvm2::utils::container::u8string sequence{};
+            };
+
+            ::uwvm2::utils::container::vector<row_t> rows{};
+            for(auto const& e: merged.slots)
+            {
+                if(e.key.length == 0uz) { continue; }
+                row_t row{e.key.length, e.count, {}};
+                for(::std::size_t i{}; i != e.key.length; ++i)
+                {
+                    if(i != 0uz) { row.sequence.push_back(u8' '); }
+                    row.sequence.append(name_of(e.key.ops[i]));
+                }
+                rows.push_back(::std::move(row));
+            }
+
+            // Variants that print the same (e.g. stack-top ring positions of one opfunc) are one candidate.
+            ::std::sort(rows.begin(),
+                        rows.end(),
+                        [](row_t const& a, row_t const& b) constexpr noexcept
+                        { return a.length != b.length ? a.length < b.length : a.sequence < b.sequence; });
+            ::uwvm2::utils::container::vector<row_t> merged_rows{};
+            for(auto& row: rows)
+            {
+                if(!merged_rows.empty() && merged_rows.back_unchecked().length == row.length && merged_rows.back_unchecked().sequence == row.sequence)
+                {
+                    merged_rows.back_unchecked().count += row.count;
+                }
+                else
+                {
+                    merged_rows.push_back(::std::move(row));
+                }
+            }
+
+            ::std::sort(merged_rows.begin(),
+                        merged_rows.end(),
+                        [](row_t const& a, row_t const& b) constexpr noexcept
+                        {
+                            bool const a_candidate{a.length != 1uz};
+                            bool const b_candidate{b.length != 1uz};
+                            if(a_candidate != b_candidate) { return a_candidate; }
+                            auto const a_key{a.count * (a_candidate ? a.length - 1uz : 1uz)};
+                            auto const b_key{b.count * (b_candidate ? b.length - 1uz : 1uz)};
+                            if(a_key != b_key) { return a_key > b_key; }
+                            return a.sequence < b.sequence;
+                        });
+
+            ::fast_io::io::print(out,
+                                 u8"# uwvm-int opfunc n-gram profile\n"
+                                 u8"# dispatches\t",
+                                 total_dispatches,
+                                 u8"\n"
+                                 u8"# n\tcount\tsaved_dispatches\tsaved_percent\tsequence\n");
+            for(auto const& row: merged_rows)
+            {
+                auto const saved{row.count * static_cast<::std::uint_least64_t>(row.length - 1uz)};
+                // Basis points, printed as a fixed two-decimal percentage.
+                auto const saved_bp{total_dispatches == 0u ? 0u : saved * 10000u / total_dispatches};
+                ::fast_io::io::print(out,
+                                     row.length,
+                                     u8"\t",
+                                     row.count,
+                                     u8"\t",
+                                     saved,
+                                     u8"\t",
+                                     saved_bp / 100u,
+                                     saved_bp % 100u < 10u ? u8".0" : u8".",
+                                     saved_bp % 100u,
+                                     u8"\t",
+                                     row.sequence,
+                                     u8"\n");
+            }
+        }
+    }  // namespace opfunc_profile
+
+    /// @brief Profiling probe (tail-call): records the opfunc that follows it, then dispatches to that opfunc.
+    /// @details
+    /// - Stack-top optimization: transparent; every cached value is forwarded untouched.
+    /// - `type[0]` layout: `[probe_ptr][back_offset:u32][opfunc_ptr]...`; after execution `type...[0]` points at `opfunc_ptr`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+        requires (CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_opfunc_profile_probe(Type... type) UWVM_THROWS
+    {
+        static_assert(sizeof...(Type) >= 1uz);
+        static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+
+        using opfunc_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...>;
+
+        ::std::byte const* const probe_ip{type...[0]};
+        opfunc_profile::probe_back_offset_t back_offset;  // no init
+        ::std::memcpy(::std::addressof(back_offset), probe_ip + sizeof(opfunc_t), sizeof(back_offset));
+
+        type...[0] += sizeof(opfunc_t) + sizeof(back_offset);
+
+        // next_opfunc ...
+        // safe
+        // ^^ type...[0]
+
+        opfunc_t next_interpreter;  // no init
+        ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+
+        opfunc_profile::opfunc_bits_t bits{};
+        constexpr ::std::size_t copy_n{sizeof(bits) < sizeof(next_interpreter) ? sizeof(bits) : sizeof(next_interpreter)};
+        ::std::memcpy(::std::addressof(bits), ::std::addressof(next_interpreter), copy_n);
+        opfunc_profile::record(probe_ip, back_offset, bits);
+
+        UWVM_MUSTTAIL return next_interpreter(type...);
+    }
+
+    /// @brief Profiling probe (non-tail-call/byref): records the opfunc that follows it and advances `typeref...[0]` to it.
+    /// @details
+    /// - Stack-top optimization: not supported (byref mode disables stack-top caching).
+    /// - `type[0]` layout: `[probe_byref_ptr][back_offset:u32][opfunc_byref_ptr]...`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeRef>
+        requires (!CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_opfunc_profile_probe(TypeRef & ... typeref) UWVM_THROWS
+    {
+        static_assert(sizeof...(TypeRef) >= 1uz);
+        static_assert(::std::same_as<TypeRef...[0u], ::std::byte const*>);
+
+        using opfunc_byref_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_byref_t<TypeRef...>;
+
+        ::std::byte const* const probe_ip{typeref...[0]};
+        opfunc_profile::probe_back_offset_t back_offset;  // no init
+        ::std::memcpy(::std::addressof(back_offset), probe_ip + sizeof(opfunc_byref_t), sizeof(back_offset));
+
+        typeref...[0] += sizeof(opfunc_byref_t) + sizeof(back_offset);
+
+        opfunc_byref_t next_interpreter;  // no init
+        ::std::memcpy(::std::addressof(next_interpreter), typeref...[0], sizeof(next_interpreter));
+
+        opfunc_profile::opfunc_bits_t bits{};
+        constexpr ::std::size_t copy_n{sizeof(bits) < sizeof(next_interpreter) ? sizeof(bits) : sizeof(next_interpreter)};
+        ::std::memcpy(::std::addressof(bits), ::std::addressof(next_interpreter), copy_n);
+        opfunc_profile::record(probe_ip, back_offset, bits);
+
+        // Function calls are initiated by higher-level functions.
+    }
+
+    namespace translate
+    {
+        /// @brief Translator: infers types from a tuple and returns the profiling probe (tail-call).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<TypeInTuple...>
+            get_uwvmint_opfunc_profile_probe_fptr_from_tuple(::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        {
+            // The probe forwards the whole argument pack, so one version serves every stack-top state.
+            return uwvmint_opfunc_profile_probe<CompileOption, TypeInTuple...>;
+        }
+
+        /// @brief Translator: infers types from a tuple and returns the profiling probe (non-tail-call/byref).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_byref_t<TypeInTuple...>
+            get_uwvmint_opfunc_profile_probe_fptr_from_tuple(::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return uwvmint_opfunc_profile_probe<CompileOption, TypeInTuple...>; }
+    }  // namespace translate
+
+# endif
+}  // namespace uwvm2::runtime::compiler::uwvm_int::optable
+#endif
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+# include <uwvm2/runtime/compiler/uwvm_int/macro/pop_macros.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
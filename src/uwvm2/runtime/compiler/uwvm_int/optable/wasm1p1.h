@@ -62,6 +62,13 @@
 
 UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
 {
+    /// @details Fills the flattened call_indirect entry (`call_sig_id`/`call_target`) of a `funcref` slot that table.set, table.init,
+    ///          table.fill or table.grow is about to store. The runtime installs it with the other callbacks; keeping the fill on the
+    ///          writer means call_indirect only ever reads table slots. Without a hook slots keep the checked path.
+    using table_elem_flatten_func_t = void(UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_t&) noexcept;
+
+    inline table_elem_flatten_func_t table_elem_flatten_func{};  // [global]
+
     namespace wasm1p1_details
     {
         using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
@@ -169,6 +176,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
             }
         }
 
+        [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr runtime_table_elem_storage_t flatten_table_elem(runtime_table_elem_storage_t elem) noexcept
+        {
+            auto const flatten{::uwvm2::runtime::compiler::uwvm_int::optable::table_elem_flatten_func};
+            if(flatten != nullptr && elem.type == runtime_table_elem_type::func_ref_defined) { flatten(elem); }
+            return elem;
+        }
+
+        /// @note Only used for table writes, so defined-function slots come back flattened.
         [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr runtime_table_elem_storage_t table_elem_from_funcref(runtime_module_storage_t const* module,
                                                                                                                wasm_funcref const& ref) noexcept
         {
@@ -181,7 +196,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                 }
                 case ::uwvm2::object::global::wasm_ref_kind::wasm_func:
                 {
-                    return resolve_table_elem_from_func_index(module, ref.ref.storage.func_idx);
+                    return flatten_table_elem(resolve_table_elem_from_func_index(module, ref.ref.storage.func_idx));
                 }
                 case ::uwvm2::object::global::wasm_ref_kind::wasm_func_imported:
                 {
@@ -195,7 +210,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                     out.storage.defined_ptr = static_cast<::uwvm2::uwvm::runtime::storage::local_defined_function_storage_t const*>(ref.ref.storage.ptr);
                     if(out.storage.defined_ptr == nullptr) { return {}; }
                     out.type = runtime_table_elem_type::func_ref_defined;
-                    return out;
+                    return flatten_table_elem(out);
                 }
                 [[unlikely]] default:
                 {
@@ -4561,9 +4576,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         for(::std::size_t i{}; i != len; ++i)
         {
             auto const funcidx{begin[src + i]};
-            table->elems.index_unchecked(dst + i) = funcidx == (::std::numeric_limits<wasm1p1_details::wasm_u32>::max)()
-                                                        ? wasm1p1_details::runtime_table_elem_storage_t{}
-                                                        : wasm1p1_details::resolve_table_elem_from_func_index(module, funcidx);
+            if(funcidx == (::std::numeric_limits<wasm1p1_details::wasm_u32>::max)())
+            {
+                table->elems.index_unchecked(dst + i) = wasm1p1_details::runtime_table_elem_storage_t{};
+                continue;
+            }
+            auto const elem{wasm1p1_details::resolve_table_elem_from_func_index(module, funcidx)};
+            table->elems.index_unchecked(dst + i) = wasm1p1_details::flatten_table_elem(elem);
         }
 
         uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
@@ -4595,9 +4614,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         for(::std::size_t i{}; i != len; ++i)
         {
             auto const funcidx{begin[src + i]};
-            table->elems.index_unchecked(dst + i) = funcidx == (::std::numeric_limits<wasm1p1_details::wasm_u32>::max)()
-                                                        ? wasm1p1_details::runtime_table_elem_storage_t{}
-                                                        : wasm1p1_details::resolve_table_elem_from_func_index(module, funcidx);
+            if(funcidx == (::std::numeric_limits<wasm1p1_details::wasm_u32>::max)())
+            {
+                table->elems.index_unchecked(dst + i) = wasm1p1_details::runtime_table_elem_storage_t{};
+                continue;
+            }
+            auto const elem{wasm1p1_details::resolve_table_elem_from_func_index(module, funcidx)};
+            table->elems.index_unchecked(dst + i) = wasm1p1_details::flatten_table_elem(elem);
         }
     }
 
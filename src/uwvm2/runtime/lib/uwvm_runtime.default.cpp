@@ -174,6 +174,24 @@ extern "C" void __deregister_frame(void const*);
 # else
 #  define UWVM2_RUNTIME_LLVM_JIT_HAS_EXECINFO_BACKTRACE 0
 # endif
+// The guest sampling profiler reads the thread_local logical stack from a SIGPROF handler. The map-backed thread-state fallback is
+// not async-signal-safe, so sampling needs direct TLS, the mmap signal layer (instruction address + sigaction) and setitimer.
+# if defined(UWVM_USE_THREAD_LOCAL) && defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && __has_include(<sys/time.h>)
+#  include <sys/time.h>
+#  define UWVM2_RUNTIME_HAS_PROFILE_SAMPLER 1
+# else
+#  define UWVM2_RUNTIME_HAS_PROFILE_SAMPLER 0
+# endif
+// `--runtime-guest-stack` switches to an mmap'd stack with ucontext. Guard faults are matched against a thread_local range inside the
+// signal layer, so the feature needs the same direct-TLS POSIX configuration as the sampler.
+# if defined(UWVM_USE_THREAD_LOCAL) && defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && __has_include(<ucontext.h>)
+#  include <signal.h>
+#  include <sys/mman.h>
+#  include <ucontext.h>
+#  define UWVM2_RUNTIME_HAS_GUEST_STACK 1
+# else
+#  define UWVM2_RUNTIME_HAS_GUEST_STACK 0
+# endif
 # ifndef UWVM2_RUNTIME_LLVM_JIT_UNWIND_REPLACES_INSTRUCTION_FRAMES
 #  if UWVM2_RUNTIME_LLVM_JIT_HAS_UNWIND_BACKTRACE && UWVM2_RUNTIME_LLVM_JIT_ENABLE_NATIVE_UNWIND_BACKTRACE
 #   define UWVM2_RUNTIME_LLVM_JIT_UNWIND_REPLACES_INSTRUCTION_FRAMES 1
@@ -220,6 +238,7 @@ extern "C" void __deregister_frame(void const*);
 # include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/impl.h>
 # include <uwvm2/runtime/compiler/llvm_jit/compile_cu_from_lazy_validator/impl.h>
 # include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/section_memory_manager.h>
+# include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/orc_session.h>
 # if defined(UWVM_RUNTIME_LLVM_JIT)
 #  include <uwvm2/runtime/llvm_jit_cache/impl.h>
 # endif
@@ -228,12 +247,14 @@ extern "C" void __deregister_frame(void const*);
 # include <uwvm2/runtime/compiler/uwvm_int/utils/impl.h>
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/local_imported/impl.h>
 # include <uwvm2/uwvm/wasm/feature/impl.h>
 # include <uwvm2/uwvm/wasm/type/impl.h>
 # include <uwvm2/uwvm/wasm/storage/impl.h>
 # include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
 # include <uwvm2/uwvm/runtime/storage/impl.h>
 # include <uwvm2/uwvm/crtmain/global/process_time.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 # include <uwvm2/runtime/lib/uwvm_runtime.h>
 #endif
 
@@ -467,6 +488,9 @@ namespace uwvm2::runtime::lib
             ::uwvm2::utils::container::vector<::std::uintptr_t> llvm_jit_local_raw_entry_addresses{};
             ::uwvm2::utils::container::vector<runtime_llvm_jit_raw_call_target_t> llvm_jit_lazy_direct_call_targets{};
             ::uwvm2::utils::container::vector<::std::uintptr_t> llvm_jit_lazy_direct_typed_entry_targets{};
+            // Full mode, per import: typed entry of the other module's defined function the import links to, 0 while unpublished.
+            // Generated code loads these slots, so the buffer is sized before translation and never reallocated afterwards.
+            ::uwvm2::utils::container::vector<::std::uintptr_t> llvm_jit_cross_module_import_entries{};
             bool llvm_jit_ready{};
 #endif
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -481,11 +505,19 @@ namespace uwvm2::runtime::lib
             ::std::uint_least8_t tiered_large_long_run_ready{};
             ::uwvm2::utils::container::vector<::std::uint_least32_t> tiered_entry_hot_counters{};
             ::uwvm2::utils::container::vector<::std::uint_least32_t> tiered_osr_request_counters{};
+            // Per local function: 1 once its T0 interpreter code was freed after T2 publication (atomic_ref, release/acquire).
+            ::uwvm2::utils::container::vector<::std::uint_least8_t> tiered_t0_reclaimed{};
+            // Per local function: T2 loop reentry wrapper addresses, parallel to `llvm_jit_compiled.local_funcs[i].tiered_loop_reentries`.
+            // Written before `tiered_full_ready` is published and read only after observing it.
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::vector<::std::uintptr_t>> tiered_full_loop_reentry_raw_entry_addresses{};
 #endif
 
             // Canonical type-index table for fast call_indirect signature checks.
             // Maps each type index to its canonical representative (deduplicated by {params, results}).
             ::uwvm2::utils::container::vector<::std::size_t> type_canon_index{};
+            // Process-wide canonical signature id per type index (1-based, 0 = none). Unlike `type_canon_index` these ids compare
+            // across modules, so flattened table entries can be checked with a single integer compare.
+            ::uwvm2::utils::container::vector<::std::uint_least32_t> type_sig_id{};
 #if defined(UWVM_RUNTIME_LLVM_JIT)
             ::uwvm2::utils::container::vector<::uwvm2::utils::container::vector<runtime_llvm_jit_raw_call_target_t>> llvm_jit_call_indirect_targets{};
 #endif
@@ -525,6 +557,14 @@ namespace uwvm2::runtime::lib
             ::std::uintptr_t end{};
         };
 
+        // Immutable copy of the unwind entries and code ranges handed to readers.  Traps and profile samples are resolved on guest
+        // threads while lazy workers keep publishing, so readers never walk the writer-side vectors, which may reallocate.
+        struct llvm_jit_unwind_table
+        {
+            ::uwvm2::utils::container::vector<llvm_jit_unwind_entry> entries{};
+            ::uwvm2::utils::container::vector<llvm_jit_code_range> code_ranges{};
+        };
+
         // Minimal section relocation record retained beside the copied JIT object.  DWARF lookup sometimes needs both the
         // loaded native address and the original object-section address to recover inline call chains reliably.
         struct llvm_jit_debug_loaded_section
@@ -571,6 +611,8 @@ namespace uwvm2::runtime::lib
         {
             ::uwvm2::utils::container::vector<compiled_module_record> modules{};
             ::uwvm2::utils::container::unordered_flat_map<::uwvm2::utils::container::u8string_view, ::std::size_t> module_name_to_id{};
+            // Generated JIT wrappers identify their module by storage address; this keeps raw host bridges off a scan of `modules`.
+            ::uwvm2::utils::container::unordered_flat_map<runtime_module_storage_t const*, ::std::size_t> runtime_module_to_id{};
 
             // Full-compile: keep the hot local-call path O(1) by indexing local funcs with vectors (not hash maps).
             ::uwvm2::utils::container::vector<::uwvm2::utils::container::vector<compiled_defined_func_info>> defined_func_cache{};
@@ -579,11 +621,31 @@ namespace uwvm2::runtime::lib
             // map pointer-address to {module_id, local_index} via a sorted range table.
             ::uwvm2::utils::container::vector<defined_func_ptr_range> defined_func_ptr_ranges{};
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            // Call-info copies indexed like `defined_func_cache`. Translators embed their addresses at imports linked to another
+            // module's defined function, which may not be translated yet, so the slots are sized before any translation and filled
+            // once every module has published its own call info.
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info>>
+                cross_module_call_info{};
+#endif
+
+            // Canonical signature id (1-based, in first-seen order) per distinct function signature, shared by every loaded module. Keys
+            // point into type sections, which live as long as the module records.
+            ::uwvm2::utils::container::unordered_flat_map<::uwvm2::parser::wasm::standard::wasm1::features::type_function_checker, ::std::uint_least32_t>
+                canonical_sig_ids{};
+
 #if defined(UWVM_RUNTIME_LLVM_JIT)
             // JIT unwind/debug metadata is published during materialization and read during trap reporting. Urgent schedulers are
             // separated from normal lazy background work so demand compilation is not starved.
+            // Writer side, only touched under the lazy publish lock.
             ::uwvm2::utils::container::vector<llvm_jit_unwind_entry> llvm_jit_unwind_entries{};
             ::uwvm2::utils::container::vector<llvm_jit_code_range> llvm_jit_code_ranges{};
+            // Reader side (copy-on-write).  The first lookup after a change copies the writer side into a new table and swaps it
+            // in; replaced tables stay owned by `llvm_jit_unwind_tables` until no reader is inside a lookup.
+            ::std::atomic<llvm_jit_unwind_table const*> llvm_jit_unwind_published{};
+            ::std::atomic_bool llvm_jit_unwind_stale{};
+            ::std::atomic_size_t llvm_jit_unwind_readers{};
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::delete_owned_ptr<llvm_jit_unwind_table>> llvm_jit_unwind_tables{};
             ::uwvm2::utils::container::vector<::uwvm2::utils::container::delete_owned_ptr<llvm_jit_debug_object>> llvm_jit_debug_objects{};
             ::uwvm2::utils::thread::lazy_compile_scheduler llvm_jit_urgent_scheduler{};
             ::std::atomic_flag llvm_jit_urgent_start_lock = ATOMIC_FLAG_INIT;
@@ -603,6 +665,7 @@ namespace uwvm2::runtime::lib
             ::std::size_t lazy_prefetch_local_function_index{SIZE_MAX};
             ::std::atomic_size_t lazy_runtime_miss_count{};
             ::std::atomic_size_t lazy_runtime_compiled_hit_count{};
+            ::std::atomic_size_t lazy_hot_tier_promotion_count{};
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             // Tiered counters feed adaptive scheduling and runtime logs. Exact counts are not correctness-critical, so relaxed atomics
             // are used where the hot path only needs approximate pressure signals.
@@ -616,10 +679,13 @@ namespace uwvm2::runtime::lib
             ::std::atomic_size_t tiered_osr_deferred_count{};
             ::std::atomic_size_t tiered_osr_compile_request_count{};
             ::std::atomic_size_t tiered_osr_urgent_request_count{};
+            ::std::atomic_size_t tiered_osr_full_ready_count{};
             ::std::atomic_size_t tiered_full_compile_request_count{};
             ::std::atomic_size_t tiered_full_compile_ready_count{};
             ::std::atomic_size_t tiered_full_compile_failed_count{};
             ::std::atomic_size_t tiered_full_publish_count{};
+            ::std::atomic_size_t tiered_reclaim_tier0_bytes{};
+            ::std::atomic_size_t tiered_reclaim_tier1_bytes{};
 # endif
 #endif
         };
@@ -650,6 +716,30 @@ namespace uwvm2::runtime::lib
 #  endif
         inline thread_local ::std::uint_least32_t tiered_counter_sample_tick{};  // [global] [thread-local]
 # endif
+
+        // Quiescent-state record for superseded-code reclamation (see `tiered_reclaim_state`). Written by its own thread; the
+        // shared fields it mirrors are updated under the reclaim lock.
+        struct tiered_reclaim_thread_state
+        {
+            // Address inside the outermost tiered entry frame while this thread runs guest code, 0 otherwise. The conservative
+            // stack scan covers [current frame, guest_stack_top).
+            ::std::uintptr_t guest_stack_top{};
+            // Last reclaim epoch this thread has scanned its stack for, or entered guest code after.
+            ::std::uint_least64_t acked_epoch{};
+            // Safepoint counter that periodically reopens an epoch for artifacts a previous scan found live.
+            ::std::uint_least32_t safepoint_tick{};
+        };
+
+# if defined(UWVM_USE_THREAD_LOCAL)
+#  if UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__tls_model__)
+#   ifdef UWVM
+        [[__gnu__::__tls_model__("local-exec")]]
+#   else
+        [[__gnu__::__tls_model__("local-dynamic")]]
+#   endif
+#  endif
+        inline thread_local tiered_reclaim_thread_state g_tiered_reclaim_thread_state{};  // [global] [thread-local]
+# endif
 #endif
 
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER) || defined(UWVM_RUNTIME_LLVM_JIT)
@@ -724,11 +814,13 @@ namespace uwvm2::runtime::lib
                 // than running destructors that may touch already-destroyed LLVM globals.
                 static_cast<void>(llvm_jit_compiled.llvm_jit_module.llvm_module.release());
                 static_cast<void>(llvm_jit_compiled.llvm_jit_module.llvm_context_holder.release());
+                // Lazy code lives in the leaked ORC session; drop the tracker references and the module dylib without
+                // removing anything from it.
                 for(auto& materialized_func: llvm_jit_lazy_compiled.materialized_functions)
                 {
-                    static_cast<void>(materialized_func.llvm_jit_engine.release());
-                    static_cast<void>(materialized_func.llvm_context_holder.release());
+                    materialized_func.llvm_jit_resource_tracker.resetWithoutRelease();
                 }
+                static_cast<void>(llvm_jit_lazy_compiled.orc_dylib.release());
                 static_cast<void>(llvm_jit_engine.release());
                 static_cast<void>(llvm_jit_context_holder.release());
             }
@@ -801,6 +893,12 @@ namespace uwvm2::runtime::lib
             using thread_local_allocator = ::fast_io::native_thread_local_allocator;
             ::uwvm2::utils::container::vector<call_stack_frame, thread_local_allocator> frames{};
 
+            // Lean mode (`--runtime-guest-stack` without `backtrace`): the guard page bounds recursion, so only the innermost frame and
+            // the depth are tracked. `call_stack_guard` keeps the caller's frame on the native stack and restores it on return.
+            bool keep_frames{true};
+            call_stack_frame lean_top{};
+            ::std::size_t lean_depth{};
+
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             // Active only while a tiered raw JIT entry is executing below an interpreter caller. It lives in the same TLS object as
             // the logical stack so a trap can merge both views without consulting shared runtime state during unwinding.
@@ -830,22 +928,90 @@ namespace uwvm2::runtime::lib
             static_assert((kCallIndirectCacheEntries & (kCallIndirectCacheEntries - 1uz)) == 0uz, "cache size must be power-of-two.");
             ::uwvm2::utils::container::array<call_indirect_cache_entry, kCallIndirectCacheEntries> call_indirect_cache{};
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            // A `return_call`/`return_call_indirect` recorded by the interpreter frame that is returning. `execute_compiled_defined`
+            // rebuilds that frame for an interpreted callee; any other callee is issued by the bridge that entered the frame, after the
+            // frame has been released. Either way a tail-call chain keeps a constant native stack depth.
+            struct pending_tail_call_t
+            {
+                ::std::size_t module_id{};
+                ::std::size_t callee{};
+                ::std::size_t table_index{};
+                ::std::size_t result_bytes{};
+                // The recorded operands in the returning frame's operand stack; valid only until that frame is released.
+                ::std::byte const* frame_args{};
+                ::std::size_t frame_arg_bytes{};
+                // Operands copied out of the dying frame for a bridge-issued call; the buffer keeps its capacity across calls.
+                ::uwvm2::utils::container::vector<::std::byte, thread_local_allocator> args{};
+                bool active{};
+            };
+
+            pending_tail_call_t pending_tail_call{};
+#endif
+
+#if UWVM2_RUNTIME_HAS_PROFILE_SAMPLER
+            // Set while `frames` reallocates past its reserved depth. The profiler's SIGPROF handler runs on this thread and reads
+            // `frames`; it records only the PC while the vector moves.
+            bool frames_growing{};
+#endif
+
             inline constexpr call_stack_tls_state() noexcept { frames.reserve(kCallStackMaxDepth); }
 
             inline constexpr void push(call_stack_frame fr) noexcept
             {
+                if(!keep_frames)
+                {
+                    lean_top = fr;
+                    ++lean_depth;
+                    return;
+                }
+
                 // Reserve the common maximum depth up front, but allow slow-path growth instead of failing on diagnostic-heavy stacks.
                 if(frames.size() < frames.capacity()) [[likely]] { frames.push_back_unchecked(fr); }
                 else
                 {
+#if UWVM2_RUNTIME_HAS_PROFILE_SAMPLER
+                    frames_growing = true;
+                    ::std::atomic_signal_fence(::std::memory_order_seq_cst);
+                    frames.push_back(fr);
+                    ::std::atomic_signal_fence(::std::memory_order_seq_cst);
+                    frames_growing = false;
+#else
                     frames.push_back(fr);
+#endif
                 }
             }
 
             inline constexpr void pop() noexcept
             {
+                if(!keep_frames)
+                {
+                    if(lean_depth != 0uz) [[likely]] { --lean_depth; }
+                    return;
+                }
+
                 if(!frames.empty()) [[likely]] { frames.pop_back_unchecked(); }
             }
+
+            inline constexpr void replace_top(call_stack_frame fr) noexcept
+            {
+                // A tail call replaces the innermost frame instead of pushing a new one.
+                if(!keep_frames)
+                {
+                    lean_top = fr;
+                    return;
+                }
+
+                if(!frames.empty()) [[likely]] { frames.back_unchecked() = fr; }
+            }
+
+            [[nodiscard]] inline constexpr ::std::size_t depth() const noexcept { return keep_frames ? frames.size() : lean_depth; }
+
+            [[nodiscard]] inline constexpr ::std::size_t innermost_module_id_or(::std::size_t fallback) const noexcept
+            {
+                if(!keep_frames) { return lean_depth != 0uz ? lean_top.module_id : fallback; }
+                return frames.empty() ? fallback : frames.back().module_id;
+            }
         };
 
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -972,6 +1138,7 @@ namespace uwvm2::runtime::lib
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             ::std::uint_least32_t tiered_entry_hot_probe_tick{};
             ::std::uint_least32_t tiered_counter_sample_tick{};
+            tiered_reclaim_thread_state tiered_reclaim{};
 # endif
         };
 
@@ -1060,6 +1227,19 @@ namespace uwvm2::runtime::lib
         { return get_thread_state().tiered_counter_sample_tick; }
 #endif
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        // Reclaim participation goes through `g_thread_states` in the fallback build, so a quiescence check sees the same per-thread
+        // record the rest of the runtime uses for that thread.
+        [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr tiered_reclaim_thread_state& get_tiered_reclaim_thread_state() noexcept
+        {
+# if defined(UWVM_USE_THREAD_LOCAL)
+            return g_tiered_reclaim_thread_state;
+# else
+            return get_thread_state().tiered_reclaim;
+# endif
+        }
+#endif
+
         struct preload_call_context_guard
         {
             preload_call_context_t* ctx{};
@@ -1074,12 +1254,7 @@ namespace uwvm2::runtime::lib
                 if(caller_module_id != preload_call_context_t::invalid_module_id) { ctx->module_id = caller_module_id; }
                 else
                 {
-                    auto& call_stack{get_call_stack()};
-                    if(!call_stack.frames.empty()) [[likely]] { ctx->module_id = call_stack.frames.back().module_id; }
-                    else
-                    {
-                        ctx->module_id = preload_call_context_t::invalid_module_id;
-                    }
+                    ctx->module_id = get_call_stack().innermost_module_id_or(preload_call_context_t::invalid_module_id);
                 }
                 ctx->preload_module_memory_attribute = attribute;
                 ctx->capi_function = function;
@@ -1127,12 +1302,74 @@ namespace uwvm2::runtime::lib
             return info;
         }
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+        inline constexpr void reset_cross_module_call_info_slots() noexcept
+        {
+            // Size every slot up front; translator-embedded slot addresses must not move afterwards.
+            g_runtime.cross_module_call_info.clear();
+            g_runtime.cross_module_call_info.resize(g_runtime.modules.size());
+            for(::std::size_t module_id{}; module_id != g_runtime.modules.size(); ++module_id)
+            {
+                auto const rt{g_runtime.modules.index_unchecked(module_id).runtime_module};
+                if(rt == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+                g_runtime.cross_module_call_info.index_unchecked(module_id).resize(rt->local_defined_function_vec_storage.size());
+            }
+        }
+
+        [[nodiscard]] inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*
+            resolve_cross_module_call_info(void const* runtime_func) noexcept
+        {
+            // `compile_option::resolve_cross_module_call_info` callback. The address ranges are not published yet while modules are still
+            // being translated, so scan the module list; this runs once per translated call site, never per call.
+            // `--runtime-disable-cross-module-direct-call` answers null so every such call keeps the import bridge.
+            if(::uwvm2::uwvm::runtime::runtime_mode::runtime_disable_cross_module_direct_call) { return nullptr; }
+            auto const f{static_cast<runtime_local_func_storage_t const*>(runtime_func)};
+            if(f == nullptr) [[unlikely]] { return nullptr; }
+
+            for(::std::size_t module_id{}; module_id != g_runtime.modules.size(); ++module_id)
+            {
+                auto const rt{g_runtime.modules.index_unchecked(module_id).runtime_module};
+                if(rt == nullptr) [[unlikely]] { continue; }
+                auto const local_begin{rt->local_defined_function_vec_storage.data()};
+                auto const local_n{rt->local_defined_function_vec_storage.size()};
+                if(local_begin == nullptr || f < local_begin || f >= local_begin + local_n) { continue; }
+
+                if(module_id >= g_runtime.cross_module_call_info.size()) [[unlikely]] { return nullptr; }
+                auto const& slots{g_runtime.cross_module_call_info.index_unchecked(module_id)};
+                auto const local_index{static_cast<::std::size_t>(f - local_begin)};
+                if(local_index >= slots.size()) [[unlikely]] { return nullptr; }
+                return ::std::addressof(slots.index_unchecked(local_index));
+            }
+            return nullptr;
+        }
+
+        inline constexpr void publish_cross_module_call_info() noexcept
+        {
+            // Copy each module's own call info into the stable slots. The call bridge only reads the record's fields, so a copy dispatches
+            // exactly like a same-module call, including trivial-call, lazy and tiered handling keyed by module/function id.
+            auto const module_n{::std::min(g_runtime.cross_module_call_info.size(), g_runtime.defined_func_cache.size())};
+            for(::std::size_t module_id{}; module_id != module_n; ++module_id)
+            {
+                auto& slots{g_runtime.cross_module_call_info.index_unchecked(module_id)};
+                auto const& mod_cache{g_runtime.defined_func_cache.index_unchecked(module_id)};
+                auto const local_n{::std::min(slots.size(), mod_cache.size())};
+                for(::std::size_t i{}; i != local_n; ++i)
+                {
+                    auto const compiled_call_info{mod_cache.index_unchecked(i).compiled_call_info};
+                    if(compiled_call_info != nullptr) { slots.index_unchecked(i) = *compiled_call_info; }
+                }
+            }
+        }
+#endif
+
         struct call_stack_guard
         {
             call_stack_tls_state* tls{};
+            call_stack_frame saved_lean_top{};
 
             // RAII keeps logical call-stack frames balanced across normal returns and fast_io exceptions converted into traps.
-            inline constexpr explicit call_stack_guard(call_stack_tls_state& s, ::std::size_t module_id, ::std::size_t function_index) noexcept : tls{&s}
+            inline constexpr explicit call_stack_guard(call_stack_tls_state& s, ::std::size_t module_id, ::std::size_t function_index) noexcept :
+                tls{&s}, saved_lean_top{s.lean_top}
             { tls->push(call_stack_frame{module_id, function_index}); }
 
             call_stack_guard(call_stack_guard const&) = delete;
@@ -1140,7 +1377,11 @@ namespace uwvm2::runtime::lib
 
             inline constexpr ~call_stack_guard()
             {
-                if(tls) [[likely]] { tls->pop(); }
+                if(tls) [[likely]]
+                {
+                    tls->pop();
+                    tls->lean_top = saved_lean_top;
+                }
             }
         };
 
@@ -1161,7 +1402,9 @@ namespace uwvm2::runtime::lib
             memory_out_of_bounds,
             runtime_invariant_failure,
             // uncatched int error (wasm 3.0, exception)
-            uncatched_int_tag
+            uncatched_int_tag,
+            // guard page below the guest stack (--runtime-guest-stack)
+            call_stack_exhausted
 
         };
 
@@ -1213,6 +1456,10 @@ namespace uwvm2::runtime::lib
                 {
                     return ::uwvm2::utils::container::u8string_view{u8"tag: uncatched wasm exception"};
                 }
+                case trap_kind::call_stack_exhausted:
+                {
+                    return ::uwvm2::utils::container::u8string_view{u8"call stack exhausted"};
+                }
                 [[unlikely]] default:
                 {
                     return ::uwvm2::utils::container::u8string_view{u8"unknown trap"};
@@ -1422,6 +1669,19 @@ namespace uwvm2::runtime::lib
             refresh_llvm_jit_unwind_entry_bounds();
         }
 
+        inline constexpr void erase_llvm_jit_unwind_entries_in_range(::std::uintptr_t begin, ::std::uintptr_t end) noexcept
+        {
+            // Tiered reclamation frees whole objects; drop their entries so a recycled address cannot resolve to a stale function.
+            auto& entries{g_runtime.llvm_jit_unwind_entries};
+            auto const removed{::std::remove_if(entries.begin(),
+                                                entries.end(),
+                                                [begin, end](llvm_jit_unwind_entry const& entry) constexpr noexcept
+                                                { return entry.address >= begin && entry.address < end; })};
+            if(removed == entries.end()) { return; }
+            entries.resize(static_cast<::std::size_t>(removed - entries.begin()));
+            refresh_llvm_jit_unwind_entry_bounds();
+        }
+
         inline constexpr void record_llvm_jit_code_range(::std::uintptr_t begin, ::std::uintptr_t size) noexcept
         {
             // Keep ranges merged. Trap reporting first tests whether an IP belongs to any generated section before doing heavier
@@ -1452,10 +1712,10 @@ namespace uwvm2::runtime::lib
             refresh_llvm_jit_unwind_entry_bounds();
         }
 
-        [[nodiscard]] inline constexpr bool llvm_jit_ip_in_code_range(::std::uintptr_t ip) noexcept
+        [[nodiscard]] inline constexpr bool llvm_jit_ip_in_code_range(llvm_jit_unwind_table const& table, ::std::uintptr_t ip) noexcept
         {
             // Upper-bound lookup works because record_llvm_jit_code_range maintains a sorted non-overlapping range vector.
-            auto const& ranges{g_runtime.llvm_jit_code_ranges};
+            auto const& ranges{table.code_ranges};
             if(ranges.empty()) [[unlikely]] { return false; }
 
             auto const it{::std::upper_bound(ranges.begin(),
@@ -1503,8 +1763,51 @@ namespace uwvm2::runtime::lib
                 if(code_range_end != 0u && code_range_end > entry.address && (end == 0u || code_range_end < end)) { end = code_range_end; }
                 entry.end = end;
             }
+
+            // Every writer ends here, so this is where readers learn that their table is out of date.
+            g_runtime.llvm_jit_unwind_stale.store(true, ::std::memory_order_release);
+        }
+
+        // Copies the writer side into a fresh reader table if a publication changed it since the last lookup.
+        inline void refresh_published_llvm_jit_unwind_table() noexcept
+        {
+            if(!g_runtime.llvm_jit_unwind_stale.load(::std::memory_order_acquire)) { return; }
+
+            ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_publish_lock_guard publish_guard{};
+            // Another reader may have rebuilt the table while this one waited for the lock.
+            if(!g_runtime.llvm_jit_unwind_stale.exchange(false, ::std::memory_order_acq_rel)) { return; }
+
+            auto& tables{g_runtime.llvm_jit_unwind_tables};
+            tables.push_back(::uwvm2::utils::container::make_delete_owned<llvm_jit_unwind_table>(
+                llvm_jit_unwind_table{g_runtime.llvm_jit_unwind_entries, g_runtime.llvm_jit_code_ranges}));
+            g_runtime.llvm_jit_unwind_published.exchange(tables.back().get(), ::std::memory_order_seq_cst);
+
+            // seq_cst pairs with the reader guard: a reader that registers after this load also loads the table swapped in
+            // above, so with no reader registered every older table is unreachable.
+            if(g_runtime.llvm_jit_unwind_readers.load(::std::memory_order_seq_cst) != 0uz) { return; }
+            auto newest{::std::move(tables.back())};
+            tables.clear();
+            tables.push_back(::std::move(newest));
         }
 
+        // Pins the published unwind table for the guard's lifetime; `table` is null before anything was published.
+        struct llvm_jit_unwind_read_guard
+        {
+            llvm_jit_unwind_table const* table{};
+
+            inline llvm_jit_unwind_read_guard() noexcept
+            {
+                refresh_published_llvm_jit_unwind_table();
+                g_runtime.llvm_jit_unwind_readers.fetch_add(1uz, ::std::memory_order_seq_cst);
+                table = g_runtime.llvm_jit_unwind_published.load(::std::memory_order_seq_cst);
+            }
+
+            inline llvm_jit_unwind_read_guard(llvm_jit_unwind_read_guard const&) noexcept = delete;
+            inline llvm_jit_unwind_read_guard& operator= (llvm_jit_unwind_read_guard const&) noexcept = delete;
+
+            inline ~llvm_jit_unwind_read_guard() { g_runtime.llvm_jit_unwind_readers.fetch_sub(1uz, ::std::memory_order_release); }
+        };
+
         [[nodiscard, maybe_unused]] inline constexpr bool
             parse_llvm_jit_inline_frame_name(::uwvm2::utils::container::u8string_view name, ::std::size_t& module_id, ::std::size_t& function_index) noexcept
         {
@@ -1587,13 +1890,18 @@ namespace uwvm2::runtime::lib
             {
                 // MCJIT reports loaded sections through this listener. Capture text ranges for fast IP filtering and retain debug
                 // objects so DWARF inline-frame lookup remains valid after finalization.
-                for(auto const& section: obj.sections())
+                // Lazy workers finalize their own engines concurrently, so only the shared table updates take the publish
+                // lock; DWARF context construction below stays outside it.
                 {
-                    if(!section.isText()) { continue; }
+                    ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_publish_lock_guard publish_guard{};
+                    for(auto const& section: obj.sections())
+                    {
+                        if(!section.isText()) { continue; }
 
-                    auto const load_address{static_cast<::std::uintptr_t>(loaded.getSectionLoadAddress(section))};
-                    auto const size{static_cast<::std::uintptr_t>(section.getSize())};
-                    record_llvm_jit_code_range(load_address, size);
+                        auto const load_address{static_cast<::std::uintptr_t>(loaded.getSectionLoadAddress(section))};
+                        auto const size{static_cast<::std::uintptr_t>(section.getSize())};
+                        record_llvm_jit_code_range(load_address, size);
+                    }
                 }
 
                 auto debug_object{loaded.getObjectForDebug(obj)};
@@ -1635,6 +1943,8 @@ namespace uwvm2::runtime::lib
                 record->object = ::std::move(debug_object);
                 record->loaded_info.reset(loaded_info.release());
                 record->dwarf_context.reset(dwarf_context.release());
+
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_publish_lock_guard publish_guard{};
                 g_runtime.llvm_jit_debug_objects.push_back(::std::move(record));
             }
         };
@@ -1647,16 +1957,20 @@ namespace uwvm2::runtime::lib
 
         struct resolved_llvm_jit_unwind_entry
         {
-            llvm_jit_unwind_entry const* entry{};
+            // A copy: the table it was found in may be replaced as soon as the lookup returns.
+            llvm_jit_unwind_entry entry{};
             ::std::uintptr_t offset{};
+            bool found{};
         };
 
         [[nodiscard, maybe_unused]] inline constexpr resolved_llvm_jit_unwind_entry resolve_llvm_jit_unwind_entry(::std::uintptr_t ip) noexcept
         {
             // Resolve to the nearest entry at or before the IP, after confirming the IP belongs to generated code.
-            auto const& entries{g_runtime.llvm_jit_unwind_entries};
+            llvm_jit_unwind_read_guard const read_guard{};
+            if(read_guard.table == nullptr) [[unlikely]] { return {}; }
+            auto const& entries{read_guard.table->entries};
             if(entries.empty()) [[unlikely]] { return {}; }
-            if(!llvm_jit_ip_in_code_range(ip)) [[unlikely]] { return {}; }
+            if(!llvm_jit_ip_in_code_range(*read_guard.table, ip)) [[unlikely]] { return {}; }
 
             auto const it{::std::upper_bound(entries.begin(),
                                              entries.end(),
@@ -1668,7 +1982,7 @@ namespace uwvm2::runtime::lib
             auto const entry_it{it - 1u};
             if(entry_it->end != 0u && ip >= entry_it->end) [[unlikely]] { return {}; }
             auto const offset{ip - entry_it->address};
-            return resolved_llvm_jit_unwind_entry{::std::addressof(*entry_it), offset};
+            return resolved_llvm_jit_unwind_entry{*entry_it, offset, true};
         }
 
         [[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string_view runtime_llvm_jit_unwind_backend_name() noexcept
@@ -1933,7 +2247,7 @@ namespace uwvm2::runtime::lib
 
                 auto ip{return_address};
                 if(ip != 0u) { --ip; }
-                if(resolve_llvm_jit_unwind_entry(ip).entry == nullptr) { break; }
+                if(!resolve_llvm_jit_unwind_entry(ip).found) { break; }
 
                 if(frame_index >= omit) { storage.frames[storage.size++] = ip; }
 
@@ -1994,7 +2308,7 @@ namespace uwvm2::runtime::lib
 
                 auto ip{return_address};
                 if(ip != 0u) { --ip; }
-                if(resolve_llvm_jit_unwind_entry(ip).entry == nullptr) { continue; }
+                if(!resolve_llvm_jit_unwind_entry(ip).found) { continue; }
 
                 auto const next_frame_pointer{llvm_jit_load_frame_record_word(candidate)};
                 if(next_frame_pointer != 0u && !llvm_jit_frame_pointer_link_plausible(candidate, next_frame_pointer)) { continue; }
@@ -2007,7 +2321,7 @@ namespace uwvm2::runtime::lib
 
                     auto frame_ip{frame_return_address};
                     if(frame_ip != 0u) { --frame_ip; }
-                    if(resolve_llvm_jit_unwind_entry(frame_ip).entry == nullptr) { break; }
+                    if(!resolve_llvm_jit_unwind_entry(frame_ip).found) { break; }
 
                     if(frame_index >= omit) { storage.frames[storage.size++] = frame_ip; }
 
@@ -2109,7 +2423,7 @@ namespace uwvm2::runtime::lib
                 if(frame_index < omit) { continue; }
 
                 auto const frame_ip{llvm_jit_win64_context_control_pc(context)};
-                if(resolve_llvm_jit_unwind_entry(frame_ip).entry == nullptr) { break; }
+                if(!resolve_llvm_jit_unwind_entry(frame_ip).found) { break; }
                 storage.frames[storage.size++] = frame_ip;
             }
 
@@ -2841,14 +3155,14 @@ namespace uwvm2::runtime::lib
                                                 {
                                                     auto const resolved{resolve_llvm_jit_unwind_entry(ip)};
                                                     if(current_trap_kind == trap_kind::call_indirect_type_mismatch && printed_frame_count != 0uz &&
-                                                       resolved.entry != nullptr && resolved.entry->raw_entry)
+                                                       resolved.found && resolved.entry.raw_entry)
                                                     {
                                                         return;
                                                     }
-                                                    if(print_debug_inline_frames(ip, resolved.entry)) { return; }
+                                                    if(print_debug_inline_frames(ip, resolved.found ? ::std::addressof(resolved.entry) : nullptr)) { return; }
 
-                                                    if(resolved.entry == nullptr) { return; }
-                                                    print_wasm_frame(resolved.entry->module_id, resolved.entry->function_index);
+                                                    if(!resolved.found) { return; }
+                                                    print_wasm_frame(resolved.entry.module_id, resolved.entry.function_index);
                                                 }};
 
 #  if !defined(UWVM_USE_THREAD_LOCAL)
@@ -2874,7 +3188,7 @@ namespace uwvm2::runtime::lib
                     {
                         auto const ip{backtrace.frames[i]};
                         if(llvm_jit_trap_return_address != 0u && (ip == llvm_jit_trap_return_address || ip == llvm_jit_trap_return_address - 1u)) { continue; }
-                        if(resolve_llvm_jit_unwind_entry(ip).entry != nullptr) { return true; }
+                        if(resolve_llvm_jit_unwind_entry(ip).found) { return true; }
                     }
                     return false;
                 }};
@@ -2906,7 +3220,7 @@ namespace uwvm2::runtime::lib
                 {
                     continue;
                 }
-                if(printed_frame_count != 0uz && resolve_llvm_jit_unwind_entry(ip).entry == nullptr) { continue; }
+                if(printed_frame_count != 0uz && !resolve_llvm_jit_unwind_entry(ip).found) { continue; }
                 print_resolved_unwind_ip(ip);
             }
 # endif
@@ -2973,6 +3287,18 @@ namespace uwvm2::runtime::lib
                 }
             }
 
+            if(auto const& call_stack{get_call_stack()}; !call_stack.keep_frames && call_stack.lean_depth != 0uz)
+            {
+                // Lean mode only knows the innermost frame; `--runtime-guest-stack <MiB> backtrace` keeps the full vector.
+                auto const& fr{call_stack.lean_top};
+                if(!printed_frames.contains(fr.module_id, fr.function_index) &&
+                   dump_call_stack_frame_for_trap(u8log_output_ul, printed_frame_count, fr.module_id, fr.function_index))
+                {
+                    printed_frames.record(fr.module_id, fr.function_index);
+                    ++printed_frame_count;
+                }
+            }
+
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             auto const& tiered_snapshot{tiered_snapshot_for_trap};
             if(tiered_snapshot.active)
@@ -3231,8 +3557,35 @@ namespace uwvm2::runtime::lib
             dump_call_stack_for_trap(trap_kind::memory_out_of_bounds);
         }
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && defined(UWVM_USE_THREAD_LOCAL)
+        inline constexpr void print_guest_stack_overflow_trap(::std::uintptr_t instruction_address,
+                                                              ::std::uintptr_t frame_address,
+                                                              ::std::uintptr_t stack_pointer) noexcept
+        {
+            // Runs on the alternate signal stack. The fault is reported like a guard-page memory trap so JIT unwinding starts at the
+            // faulting instruction.
+#  if defined(UWVM_RUNTIME_LLVM_JIT)
+            store_llvm_jit_trap_context(::uwvm2::runtime::lib::llvm_jit_trap_kind::memory_out_of_bounds,
+                                        llvm_jit_signal_trap_return_address(instruction_address),
+                                        frame_address,
+                                        stack_pointer);
+#  else
+            static_cast<void>(instruction_address);
+            static_cast<void>(frame_address);
+            static_cast<void>(stack_pointer);
+#  endif
+            print_trap_fatal_message(trap_kind::call_stack_exhausted);
+            dump_call_stack_for_trap(trap_kind::call_stack_exhausted);
+        }
+# endif
+
         inline constexpr void ensure_memory_signal_trap_bridge_initialized() noexcept
-        { ::uwvm2::object::memory::signal::set_mmap_memory_out_of_bounds_handler(print_mmap_memory_out_of_bounds_trap); }
+        {
+            ::uwvm2::object::memory::signal::set_mmap_memory_out_of_bounds_handler(print_mmap_memory_out_of_bounds_trap);
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && defined(UWVM_USE_THREAD_LOCAL)
+            ::uwvm2::object::memory::signal::set_guest_stack_overflow_handler(print_guest_stack_overflow_trap);
+# endif
+        }
 #else
         // Non-mmap builds cannot receive guard-page memory traps, so the bridge initializer is intentionally a no-op.
         inline constexpr void ensure_memory_signal_trap_bridge_initialized() noexcept {}
@@ -3740,6 +4093,7 @@ namespace uwvm2::runtime::lib
             auto const compiled_functions{lazy_compiled_function_count()};
             auto const miss_count{g_runtime.lazy_runtime_miss_count.load(::std::memory_order_relaxed)};
             auto const compiled_hit_count{g_runtime.lazy_runtime_compiled_hit_count.load(::std::memory_order_relaxed)};
+            auto const hot_tier_promotions{g_runtime.lazy_hot_tier_promotion_count.load(::std::memory_order_relaxed)};
 # if defined(UWVM_RUNTIME_LLVM_JIT)
             auto const llvm_jit_urgent_requests{g_runtime.llvm_jit_urgent_request_count.load(::std::memory_order_relaxed)};
 # endif
@@ -3755,10 +4109,13 @@ namespace uwvm2::runtime::lib
             ::std::size_t tiered_osr_deferred{};
             ::std::size_t tiered_osr_compile_requests{};
             ::std::size_t tiered_osr_urgent_requests{};
+            ::std::size_t tiered_osr_full_ready{};
             ::std::size_t tiered_full_compile_requests{};
             ::std::size_t tiered_full_compile_ready{};
             ::std::size_t tiered_full_compile_failed{};
             ::std::size_t tiered_full_publishes{};
+            ::std::size_t tiered_reclaim_tier0_bytes{};
+            ::std::size_t tiered_reclaim_tier1_bytes{};
             auto const tiered_backend{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler ==
                                       ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered};
             if(tiered_backend)
@@ -3780,10 +4137,13 @@ namespace uwvm2::runtime::lib
                 tiered_osr_deferred = g_runtime.tiered_osr_deferred_count.load(::std::memory_order_relaxed);
                 tiered_osr_compile_requests = g_runtime.tiered_osr_compile_request_count.load(::std::memory_order_relaxed);
                 tiered_osr_urgent_requests = g_runtime.tiered_osr_urgent_request_count.load(::std::memory_order_relaxed);
+                tiered_osr_full_ready = g_runtime.tiered_osr_full_ready_count.load(::std::memory_order_relaxed);
                 tiered_full_compile_requests = g_runtime.tiered_full_compile_request_count.load(::std::memory_order_relaxed);
                 tiered_full_compile_ready = g_runtime.tiered_full_compile_ready_count.load(::std::memory_order_relaxed);
                 tiered_full_compile_failed = g_runtime.tiered_full_compile_failed_count.load(::std::memory_order_relaxed);
                 tiered_full_publishes = g_runtime.tiered_full_publish_count.load(::std::memory_order_relaxed);
+                tiered_reclaim_tier0_bytes = g_runtime.tiered_reclaim_tier0_bytes.load(::std::memory_order_relaxed);
+                tiered_reclaim_tier1_bytes = g_runtime.tiered_reclaim_tier1_bytes.load(::std::memory_order_relaxed);
             }
 # endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
@@ -3812,7 +4172,9 @@ namespace uwvm2::runtime::lib
                                  u8" demand_misses=",
                                  miss_count,
                                  u8" compiled_hits=",
-                                 compiled_hit_count
+                                 compiled_hit_count,
+                                 u8" hot_tier_promotions=",
+                                 hot_tier_promotions
 # if defined(UWVM_RUNTIME_LLVM_JIT)
                                  ,
                                  u8" llvm_jit_urgent_requests=",
@@ -3846,6 +4208,8 @@ namespace uwvm2::runtime::lib
                                      tiered_osr_compile_requests,
                                      u8" tiered_osr_urgent_requests=",
                                      tiered_osr_urgent_requests,
+                                     u8" tiered_osr_full_ready=",
+                                     tiered_osr_full_ready,
                                      u8" tiered_full_requests=",
                                      tiered_full_compile_requests,
                                      u8" tiered_full_ready=",
@@ -3853,7 +4217,11 @@ namespace uwvm2::runtime::lib
                                      u8" tiered_full_failed=",
                                      tiered_full_compile_failed,
                                      u8" tiered_full_publishes=",
-                                     tiered_full_publishes);
+                                     tiered_full_publishes,
+                                     u8" tiered_reclaim_tier0_bytes=",
+                                     tiered_reclaim_tier0_bytes,
+                                     u8" tiered_reclaim_tier1_bytes=",
+                                     tiered_reclaim_tier1_bytes);
             }
 # endif
 
@@ -3959,6 +4327,45 @@ namespace uwvm2::runtime::lib
                                      g_runtime.llvm_jit_urgent_scheduler.queue_capacity,
                                      u8"\n");
             }
+
+            if(auto const arena_stats{::uwvm2::runtime::compiler::llvm_jit::details::get_runtime_llvm_jit_code_arena_stats()};
+               arena_stats.reserved_bytes != 0uz)
+            {
+                ::fast_io::io::print(::uwvm2::uwvm::io::u8runtime_log_output,
+                                     log_prefix,
+                                     u8"code-arena reserved_bytes=",
+                                     arena_stats.reserved_bytes,
+                                     u8" code_bytes=",
+                                     arena_stats.code_bytes,
+                                     u8" data_bytes=",
+                                     arena_stats.data_bytes,
+                                     u8" fallback_allocations=",
+                                     arena_stats.fallback_allocations,
+                                     u8" huge_pages=",
+                                     arena_stats.huge_pages ? u8"advised" : u8"off",
+                                     u8"\n");
+            }
+
+            if(auto const session_stats{::uwvm2::runtime::compiler::llvm_jit::details::get_runtime_llvm_jit_orc_session_stats()}; session_stats.created)
+            {
+                ::fast_io::io::print(::uwvm2::uwvm::io::u8runtime_log_output,
+                                     log_prefix,
+                                     u8"orc-session objects_linked=",
+                                     session_stats.memory.objects_linked,
+                                     u8" live_objects=",
+                                     session_stats.memory.live_objects,
+                                     u8" exec_bytes=",
+                                     session_stats.memory.exec_bytes,
+                                     u8" private_data_bytes=",
+                                     session_stats.memory.private_data_bytes,
+                                     u8" shared_data_bytes=",
+                                     session_stats.memory.shared_data_bytes,
+                                     u8" shared_data_chunk_bytes=",
+                                     session_stats.memory.shared_data_chunk_bytes,
+                                     u8" event_listeners=",
+                                     session_stats.event_listeners,
+                                     u8"\n");
+            }
 # endif
         }
 #endif
@@ -4112,7 +4519,7 @@ namespace uwvm2::runtime::lib
 
         inline constexpr void publish_llvm_jit_lazy_materialized_function(void* user_data, ::std::size_t local_function_index) noexcept
         {
-            // Lazy LLVM materialization callback: once MCJIT finalizes a function, publish all addresses that can reach it.
+            // Lazy LLVM materialization callback: once ORC links a function, publish all addresses that can reach it.
             auto const rec{static_cast<compiled_module_record*>(user_data)};
             if(rec == nullptr || rec->runtime_module == nullptr) [[unlikely]] { return; }
             if(local_function_index >= rec->llvm_jit_lazy_compiled.materialized_functions.size()) [[unlikely]] { return; }
@@ -4573,88 +4980,675 @@ namespace uwvm2::runtime::lib
                                                                                  ::std::memory_order_release);
         }
 
-        [[nodiscard]] inline constexpr ::std::uint_least32_t tiered_large_long_run_counter_sample_stride(compiled_module_record const& rec) noexcept
+        // Superseded-code reclamation. Once T2 is published for a module, new calls stop reaching that module's T0 bytecode and
+        // lazy T1 objects, but frames already running them can still return into them. Each retired artifact is queued as a
+        // `tiered_reclaim_unit`: a unit no guest stack references is first unpublished, and freed one epoch later, so a thread that
+        // loaded an entry address just before the unpublish has passed a safepoint before the code goes away.
+        //
+        // An epoch completes once every thread running guest code has passed a safepoint (OSR back-edge probe or host import call)
+        // or left guest code. At its safepoint a thread scans its own stack conservatively, from the current frame up to its
+        // outermost tiered entry frame, and keeps every unit a stack word points into. Threads that enter guest code after an epoch
+        // opened cannot reach unpublished code and are not waited for.
+        struct tiered_reclaim_unit
         {
-            // Sampling keeps per-entry accounting cheap in large modules while still accumulating enough evidence for long runs.
-            auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
-            if(local_n >= 8192uz) { return 16u; }
-            if(local_n >= 1024uz) { return 16u; }
-            if(local_n >= 512uz) { return 8u; }
-            return 16u;
-        }
+            ::std::size_t module_id{};
+            // T0: the local function whose bytecode is retired. T1: the owner record of the retired object.
+            ::std::size_t local_index{};
+            // T0 only: index in the same queue of the T1 object this function's loop reentries enter, SIZE_MAX if none.
+            ::std::size_t tier1_unit{SIZE_MAX};
+            ::std::size_t bytes{};
+            ::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_orc_code_range> code_ranges{};
+            bool tier1{};
+            // Entry points are still reachable through the interpreter or the lazy T1 tables.
+            bool published{true};
+            // A stack scanned in the current epoch points into this unit.
+            bool live{};
+        };
 
-        [[nodiscard]] inline constexpr bool tiered_large_long_run_counter_sampled(::std::size_t local_index, ::std::uint_least32_t stride) noexcept
+        struct tiered_reclaim_range
         {
-            // Mix the thread-local tick with the function index so adjacent hot functions do not sample in lockstep.
-            if(stride <= 1u) { return true; }
-#  if defined(UWVM_USE_THREAD_LOCAL)
-            auto const tick{++tiered_counter_sample_tick};
+            ::std::uintptr_t begin{};
+            ::std::uintptr_t end{};
+            ::std::size_t unit{};
+        };
+
+        // Memory taken out of the runtime under the reclaim lock and released after it is dropped.
+        struct tiered_reclaim_freed
+        {
+            ::uwvm2::utils::container::vector<::std::byte> tier0_code{};
+            ::llvm::orc::ResourceTrackerSP tier1_tracker{};
+            ::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_orc_code_range> tier1_ranges{};
+            ::std::size_t bytes{};
+            bool tier1{};
+        };
+
+        struct tiered_reclaim_state
+        {
+            ::std::atomic_flag lock = ATOMIC_FLAG_INIT;
+            // Bumped when an epoch opens; safepoints compare it with the thread's `acked_epoch` without taking the lock.
+            ::std::atomic_uint_least64_t epoch{};
+            // `!units.empty()`, readable without the lock so safepoints can reopen an epoch for retained units.
+            ::std::atomic_bool has_units{};
+            bool epoch_open{};
+            ::std::size_t guest_threads{};
+            ::std::size_t pending_acks{};
+            ::uwvm2::utils::container::vector<tiered_reclaim_unit> units{};
+            // Code ranges of `units`, sorted by begin for the stack scan.
+            ::uwvm2::utils::container::vector<tiered_reclaim_range> ranges{};
+            // Units retired while an epoch is open; merged when it completes so every scan of an epoch sees the same set.
+            ::uwvm2::utils::container::vector<tiered_reclaim_unit> incoming{};
+        };
+
+        inline tiered_reclaim_state g_tiered_reclaim{};  // [global]
+
+#  if UWVM_HAS_BUILTIN(__builtin_unwind_init)
+        inline constexpr bool tiered_reclaim_supported{true};
 #  else
-            auto const tick{++get_tiered_counter_sample_tick()};
+        // Without spilling callee-saved registers the scan could miss a live frame, so superseded code stays resident.
+        inline constexpr bool tiered_reclaim_supported{};
 #  endif
-            auto const phase{static_cast<::std::uint_least32_t>((local_index + 1uz) * 0x85ebca6buz)};
-            return ((tick ^ phase) & (stride - 1u)) == 0u;
+
+        // Safepoints between attempts to reopen an epoch for units a previous scan found live.
+        inline constexpr ::std::uint_least32_t tiered_reclaim_reopen_interval_mask{0xffffu};
+
+        struct tiered_reclaim_lock_guard
+        {
+            inline constexpr tiered_reclaim_lock_guard() noexcept
+            {
+                while(g_tiered_reclaim.lock.test_and_set(::std::memory_order_acquire)) { ::uwvm2::utils::thread::lazy_compile_thread_yield(); }
+            }
+
+            inline constexpr tiered_reclaim_lock_guard(tiered_reclaim_lock_guard const&) noexcept = delete;
+            inline constexpr tiered_reclaim_lock_guard& operator= (tiered_reclaim_lock_guard const&) noexcept = delete;
+
+            inline constexpr ~tiered_reclaim_lock_guard() { g_tiered_reclaim.lock.clear(::std::memory_order_release); }
+        };
+
+        inline constexpr void clear_tiered_reclaim_queue() noexcept
+        {
+            // Queued units name records of a registry that is being rebuilt; their memory goes away with those records.
+            tiered_reclaim_lock_guard reclaim_guard{};
+            auto& state{g_tiered_reclaim};
+            state.units.clear();
+            state.ranges.clear();
+            state.incoming.clear();
+            state.epoch_open = false;
+            state.pending_acks = 0uz;
+            state.has_units.store(false, ::std::memory_order_relaxed);
         }
 
-        [[nodiscard]] inline constexpr bool tiered_large_module_long_run_active(compiled_module_record const& rec) noexcept
+        [[nodiscard]] inline constexpr bool tiered_t0_code_reclaimed(compiled_module_record const& rec, ::std::size_t local_index) noexcept
         {
-            // Large modules need runtime evidence before aggressive JIT scheduling. Once the threshold is crossed, publish a sticky
-            // ready bit so future checks stay cheap.
-            auto& ready{const_cast<::std::uint_least8_t&>(rec.tiered_large_long_run_ready)};
-            ::std::atomic_ref<::std::uint_least8_t> ready_ref{ready};
-            if(ready_ref.load(::std::memory_order_acquire) != 0u) { return true; }
+            // Set with release once the function's bytecode is unpublished; callers then enter the LLVM tiers instead.
+            if(local_index >= rec.tiered_t0_reclaimed.size()) { return false; }
+            auto& reclaimed{const_cast<::std::uint_least8_t&>(rec.tiered_t0_reclaimed.index_unchecked(local_index))};
+            return ::std::atomic_ref<::std::uint_least8_t>{reclaimed}.load(::std::memory_order_acquire) != 0u;
+        }
 
-            auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
-            auto& large_loop_sample_counter{const_cast<::std::size_t&>(rec.tiered_large_loop_sample_count)};
-            auto const large_loop_sample_count{::std::atomic_ref<::std::size_t>{large_loop_sample_counter}.load(::std::memory_order_relaxed)};
-            if(local_n < tiered_large_long_run_local_function_threshold && large_loop_sample_count < tiered_large_long_run_loop_sample_threshold)
+        [[nodiscard]] inline constexpr bool tiered_t0_code_reclaimed(::std::size_t module_id, ::std::size_t function_index) noexcept
+        {
+            if(module_id >= g_runtime.modules.size()) [[unlikely]] { return false; }
+            auto const& rec{g_runtime.modules.index_unchecked(module_id)};
+            if(rec.runtime_module == nullptr) [[unlikely]] { return false; }
+            auto const import_n{rec.runtime_module->imported_function_vec_storage.size()};
+            if(function_index < import_n) { return false; }
+            return tiered_t0_code_reclaimed(rec, function_index - import_n);
+        }
+
+        inline constexpr void rebuild_tiered_reclaim_ranges_locked() noexcept
+        {
+            auto& state{g_tiered_reclaim};
+            state.ranges.clear();
+            for(::std::size_t i{}; i != state.units.size(); ++i)
             {
-                return false;
+                for(auto const& range: state.units.index_unchecked(i).code_ranges)
+                {
+                    state.ranges.push_back(tiered_reclaim_range{range.begin, range.begin + range.size, i});
+                }
             }
+            ::std::sort(state.ranges.begin(),
+                        state.ranges.end(),
+                        [](auto const& lhs, auto const& rhs) constexpr noexcept { return lhs.begin < rhs.begin; });
+            state.has_units.store(!state.units.empty(), ::std::memory_order_relaxed);
+        }
 
-            auto& fallback_counter{const_cast<::std::size_t&>(rec.tiered_interpreter_fallback_count)};
-            auto& entry_miss_counter{const_cast<::std::size_t&>(rec.tiered_entry_miss_count)};
-            auto& switch_counter{const_cast<::std::size_t&>(rec.tiered_switch_count)};
-            auto const fallback_count{::std::atomic_ref<::std::size_t>{fallback_counter}.load(::std::memory_order_relaxed)};
-            auto const entry_miss_count{::std::atomic_ref<::std::size_t>{entry_miss_counter}.load(::std::memory_order_relaxed)};
-            auto const switch_count{::std::atomic_ref<::std::size_t>{switch_counter}.load(::std::memory_order_relaxed)};
-            if(fallback_count < tiered_large_long_run_entry_counter_threshold && entry_miss_count < tiered_large_long_run_entry_counter_threshold &&
-               switch_count < tiered_large_long_run_switch_counter_threshold && large_loop_sample_count < tiered_large_long_run_loop_sample_threshold)
+        UWVM_NOINLINE UWVM_NO_SANITIZE inline constexpr void scan_tiered_reclaim_stack_locked(::std::uintptr_t stack_top) noexcept
+        {
+            // Conservative: any word that looks like an address inside a unit keeps it, whether it is a return address, a spilled
+            // interpreter instruction pointer, or a stale slot. The caller spilled callee-saved registers into its frame first.
+            auto& state{g_tiered_reclaim};
+            if(state.ranges.empty()) { return; }
+
+            ::std::uintptr_t const marker{};
+            auto word{reinterpret_cast<::std::uintptr_t>(::std::addressof(marker)) & ~static_cast<::std::uintptr_t>(alignof(::std::uintptr_t) - 1uz)};
+            if(word >= stack_top) [[unlikely]]
             {
-                return false;
+                // The scan assumes a downward-growing stack; anything else keeps every unit.
+                for(auto& unit: state.units) { unit.live = true; }
+                return;
             }
 
-            ::std::uint_least8_t expected{};
-            if(ready_ref.compare_exchange_strong(expected, static_cast<::std::uint_least8_t>(1u), ::std::memory_order_acq_rel, ::std::memory_order_acquire) &&
-               ::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+            auto const lowest{state.ranges.front_unchecked().begin};
+            for(; word < stack_top; word += sizeof(::std::uintptr_t))
             {
-                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::lazy_runtime_log::line(u8"tiered-large-long-run module=\"",
-                                                                                                             rec.module_name,
-                                                                                                             u8"\" module_id=",
-                                                                                                             module_id_from_record(rec),
-                                                                                                             u8" local_functions=",
-                                                                                                             local_n,
-                                                                                                             u8" fallback_count=",
-                                                                                                             fallback_count,
-                                                                                                             u8" entry_miss_count=",
-                                                                                                             entry_miss_count,
-                                                                                                             u8" switch_count=",
-                                                                                                             switch_count,
-                                                                                                             u8" large_loop_samples=",
-                                                                                                             large_loop_sample_count,
-                                                                                                             u8" entry_threshold=",
-                                                                                                             tiered_large_long_run_entry_counter_threshold,
-                                                                                                             u8" switch_threshold=",
-                                                                                                             tiered_large_long_run_switch_counter_threshold,
-                                                                                                             u8" large_loop_threshold=",
-                                                                                                             tiered_large_long_run_loop_sample_threshold);
+                auto const value{*reinterpret_cast<::std::uintptr_t const volatile*>(word)};
+                if(value < lowest) { continue; }
+
+                auto const it{::std::upper_bound(state.ranges.begin(),
+                                                 state.ranges.end(),
+                                                 value,
+                                                 [](auto const address, tiered_reclaim_range const& range) constexpr noexcept
+                                                 { return address < range.begin; })};
+                if(it == state.ranges.begin()) { continue; }
+
+                auto const& range{*(it - 1u)};
+                if(value < range.end) { state.units.index_unchecked(range.unit).live = true; }
             }
-            return true;
         }
 
-        [[nodiscard]] inline constexpr bool tiered_large_loop_sentinel_compile_active(compiled_module_record const& rec) noexcept
+        inline constexpr void merge_tiered_reclaim_incoming_locked() noexcept
         {
-            // The sentinel path opens only after the module has proven it is long-running or after a large-loop sample is seen.
+            auto& state{g_tiered_reclaim};
+            auto const offset{state.units.size()};
+            for(auto& unit: state.incoming)
+            {
+                if(unit.tier1_unit != SIZE_MAX) { unit.tier1_unit += offset; }
+                state.units.push_back(::std::move(unit));
+            }
+            state.incoming.clear();
+        }
+
+        // Opens the next epoch over the queued units. Returns false when nothing is left to reclaim.
+        inline constexpr bool open_tiered_reclaim_epoch_locked() noexcept
+        {
+            auto& state{g_tiered_reclaim};
+            merge_tiered_reclaim_incoming_locked();
+            rebuild_tiered_reclaim_ranges_locked();
+            if(state.units.empty()) { return false; }
+
+            for(auto& unit: state.units) { unit.live = false; }
+            state.epoch.store(state.epoch.load(::std::memory_order_relaxed) + 1u, ::std::memory_order_release);
+            state.epoch_open = true;
+            state.pending_acks = state.guest_threads;
+            return true;
+        }
+
+        inline constexpr void unpublish_tiered_reclaim_tier1_locked(::std::size_t module_id) noexcept
+        {
+            // Clear `ready` on every record pointing into an unpublished object of this module; lookups then miss and callers take
+            // the T2 entries. Records of objects unpublished earlier are simply cleared again.
+            auto& rec{g_runtime.modules.index_unchecked(module_id)};
+            auto& materialized_functions{rec.llvm_jit_lazy_compiled.materialized_functions};
+            ::uwvm2::utils::container::vector<::std::uint_least8_t> unpublished_owner{};
+            unpublished_owner.resize(materialized_functions.size());
+            for(auto const& unit: g_tiered_reclaim.units)
+            {
+                if(!unit.tier1 || unit.published || unit.module_id != module_id || unit.local_index >= unpublished_owner.size()) { continue; }
+                unpublished_owner.index_unchecked(unit.local_index) = 1u;
+            }
+
+            for(auto& materialized: materialized_functions)
+            {
+                auto const owner{materialized.llvm_jit_object_owner_index};
+                if(owner >= unpublished_owner.size() || unpublished_owner.index_unchecked(owner) == 0u) { continue; }
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::store_lazy_materialized_ready(materialized,
+                                                                                                                               false,
+                                                                                                                               ::std::memory_order_release);
+            }
+        }
+
+        inline constexpr void take_tiered_reclaim_unit_locked(tiered_reclaim_unit& unit,
+                                                              ::uwvm2::utils::container::vector<tiered_reclaim_freed>& freed) noexcept
+        {
+            auto& rec{g_runtime.modules.index_unchecked(unit.module_id)};
+            tiered_reclaim_freed item{};
+            item.bytes = unit.bytes;
+            item.tier1 = unit.tier1;
+            if(!unit.tier1) { item.tier0_code = ::std::move(rec.lazy_compiled.compiled.local_funcs.index_unchecked(unit.local_index).op.operands); }
+            else
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_publish_lock_guard publish_guard{};
+                auto& owner{rec.llvm_jit_lazy_compiled.materialized_functions.index_unchecked(unit.local_index)};
+                item.tier1_tracker = ::std::move(owner.llvm_jit_resource_tracker);
+                item.tier1_ranges = ::std::move(unit.code_ranges);
+                owner.llvm_jit_code_ranges.clear();
+                owner.llvm_jit_object_bytes = 0uz;
+            }
+            freed.push_back(::std::move(item));
+        }
+
+        // Runs when the last pending thread acked. Returns true when another epoch should follow right away.
+        inline constexpr bool complete_tiered_reclaim_epoch_locked(::uwvm2::utils::container::vector<tiered_reclaim_freed>& freed) noexcept
+        {
+            auto& state{g_tiered_reclaim};
+            auto& units{state.units};
+            state.epoch_open = false;
+
+            // A live T0 frame may still OSR into its function's T1 loop reentries.
+            for(::std::size_t i{}; i != units.size(); ++i)
+            {
+                auto const& unit{units.index_unchecked(i)};
+                if(unit.live && !unit.tier1 && unit.tier1_unit != SIZE_MAX) { units.index_unchecked(unit.tier1_unit).live = true; }
+            }
+
+            // Units unpublished by the previous epoch and still unreferenced are freed; the rest are compacted.
+            ::uwvm2::utils::container::vector<::std::size_t> remap{};
+            remap.resize(units.size());
+            ::std::size_t write_index{};
+            for(::std::size_t read_index{}; read_index != units.size(); ++read_index)
+            {
+                auto& unit{units.index_unchecked(read_index)};
+                if(!unit.live && !unit.published)
+                {
+                    take_tiered_reclaim_unit_locked(unit, freed);
+                    remap.index_unchecked(read_index) = SIZE_MAX;
+                    continue;
+                }
+                remap.index_unchecked(read_index) = write_index;
+                if(write_index != read_index) { units.index_unchecked(write_index) = ::std::move(unit); }
+                ++write_index;
+            }
+            units.resize(write_index);
+            for(auto& unit: units)
+            {
+                if(unit.tier1_unit != SIZE_MAX) { unit.tier1_unit = remap.index_unchecked(unit.tier1_unit); }
+            }
+
+            // Unreferenced published units are unpublished now and freed by the next epoch.
+            bool grace{};
+            for(auto& unit: units)
+            {
+                if(unit.live || !unit.published) { continue; }
+                unit.published = false;
+                grace = true;
+                if(!unit.tier1)
+                {
+                    auto& rec{g_runtime.modules.index_unchecked(unit.module_id)};
+                    ::std::atomic_ref<::std::uint_least8_t>{rec.tiered_t0_reclaimed.index_unchecked(unit.local_index)}.store(1u, ::std::memory_order_release);
+                }
+            }
+            if(grace)
+            {
+                ::uwvm2::utils::container::vector<::std::size_t> tier1_modules{};
+                for(auto const& unit: units)
+                {
+                    if(!unit.tier1 || unit.published) { continue; }
+                    if(::std::find(tier1_modules.begin(), tier1_modules.end(), unit.module_id) != tier1_modules.end()) { continue; }
+                    tier1_modules.push_back(unit.module_id);
+                    unpublish_tiered_reclaim_tier1_locked(unit.module_id);
+                }
+            }
+
+            rebuild_tiered_reclaim_ranges_locked();
+            return grace || !state.incoming.empty();
+        }
+
+        // `complete` first finishes the epoch whose acks just ran out, then epochs keep opening while none has to wait for a thread.
+        inline constexpr void run_tiered_reclaim_epochs_locked(::uwvm2::utils::container::vector<tiered_reclaim_freed>& freed, bool complete) noexcept
+        {
+            for(;;)
+            {
+                if(complete && !complete_tiered_reclaim_epoch_locked(freed)) { return; }
+                if(!open_tiered_reclaim_epoch_locked()) { return; }
+                if(g_tiered_reclaim.pending_acks != 0uz) { return; }
+                complete = true;
+            }
+        }
+
+        inline constexpr void ack_tiered_reclaim_epoch_locked(tiered_reclaim_thread_state& thread_state,
+                                                              ::uwvm2::utils::container::vector<tiered_reclaim_freed>& freed) noexcept
+        {
+            // Completing an epoch may open the next one; this thread acks it immediately since its stack is unchanged.
+            auto& state{g_tiered_reclaim};
+            while(state.epoch_open && thread_state.acked_epoch != state.epoch.load(::std::memory_order_relaxed))
+            {
+                scan_tiered_reclaim_stack_locked(thread_state.guest_stack_top);
+                thread_state.acked_epoch = state.epoch.load(::std::memory_order_relaxed);
+                if(--state.pending_acks == 0uz) { run_tiered_reclaim_epochs_locked(freed, true); }
+            }
+            thread_state.acked_epoch = state.epoch.load(::std::memory_order_relaxed);
+        }
+
+        inline void free_tiered_reclaimed(::uwvm2::utils::container::vector<tiered_reclaim_freed>& freed) noexcept
+        {
+            if(freed.empty()) { return; }
+
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_publish_lock_guard publish_guard{};
+                for(auto const& item: freed)
+                {
+                    for(auto const& range: item.tier1_ranges) { erase_llvm_jit_unwind_entries_in_range(range.begin, range.begin + range.size); }
+                }
+            }
+
+            ::std::size_t tier0_functions{};
+            ::std::size_t tier0_bytes{};
+            ::std::size_t tier1_objects{};
+            ::std::size_t tier1_bytes{};
+            for(auto& item: freed)
+            {
+                if(item.tier1)
+                {
+                    ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::remove_lazy_llvm_jit_resource_tracker(item.tier1_tracker);
+                    ++tier1_objects;
+                    tier1_bytes += item.bytes;
+                }
+                else
+                {
+                    ++tier0_functions;
+                    tier0_bytes += item.bytes;
+                }
+            }
+            freed.clear();
+
+            g_runtime.tiered_reclaim_tier0_bytes.fetch_add(tier0_bytes, ::std::memory_order_relaxed);
+            g_runtime.tiered_reclaim_tier1_bytes.fetch_add(tier1_bytes, ::std::memory_order_relaxed);
+
+            if(::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::lazy_runtime_log::line(u8"tiered-reclaim tier0_functions=",
+                                                                                                             tier0_functions,
+                                                                                                             u8" tier0_bytes=",
+                                                                                                             tier0_bytes,
+                                                                                                             u8" tier1_objects=",
+                                                                                                             tier1_objects,
+                                                                                                             u8" tier1_bytes=",
+                                                                                                             tier1_bytes);
+            }
+        }
+
+        UWVM_NOINLINE inline void tiered_reclaim_safepoint_slow() noexcept
+        {
+            auto& thread_state{get_tiered_reclaim_thread_state()};
+            if(thread_state.guest_stack_top == 0u)
+            {
+                // Not inside a tiered entry: this thread is never waited for.
+                thread_state.acked_epoch = g_tiered_reclaim.epoch.load(::std::memory_order_relaxed);
+                return;
+            }
+
+#  if UWVM_HAS_BUILTIN(__builtin_unwind_init)
+            // Spill callee-saved registers into this frame so values held only in registers are covered by the scan.
+            __builtin_unwind_init();
+#  endif
+
+            ::uwvm2::utils::container::vector<tiered_reclaim_freed> freed{};
+            {
+                tiered_reclaim_lock_guard reclaim_guard{};
+                if(!g_tiered_reclaim.epoch_open) { run_tiered_reclaim_epochs_locked(freed, false); }
+                ack_tiered_reclaim_epoch_locked(thread_state, freed);
+            }
+            free_tiered_reclaimed(freed);
+        }
+
+        UWVM_ALWAYS_INLINE inline constexpr void tiered_reclaim_safepoint() noexcept
+        {
+            // Fast path: one relaxed load and a thread-local compare while no epoch waits for this thread.
+            if constexpr(tiered_reclaim_supported)
+            {
+                auto& thread_state{get_tiered_reclaim_thread_state()};
+                if(g_tiered_reclaim.epoch.load(::std::memory_order_relaxed) != thread_state.acked_epoch) [[unlikely]]
+                {
+                    tiered_reclaim_safepoint_slow();
+                    return;
+                }
+                if((++thread_state.safepoint_tick & tiered_reclaim_reopen_interval_mask) == 0u && g_tiered_reclaim.has_units.load(::std::memory_order_relaxed))
+                    [[unlikely]]
+                {
+                    tiered_reclaim_safepoint_slow();
+                }
+            }
+        }
+
+        // Marks the outermost tiered entry on this thread as guest code for reclamation epochs. Nested entries are no-ops.
+        struct tiered_reclaim_guest_guard
+        {
+            tiered_reclaim_thread_state* thread_state{};
+
+            inline constexpr tiered_reclaim_guest_guard() noexcept
+            {
+                if constexpr(tiered_reclaim_supported)
+                {
+                    // Only tiered runs reclaim; other backends share the entry points that install this guard.
+                    if(!tiered_runtime_active()) { return; }
+                    auto& st{get_tiered_reclaim_thread_state()};
+                    if(st.guest_stack_top != 0u) { return; }
+
+                    tiered_reclaim_lock_guard reclaim_guard{};
+                    ++g_tiered_reclaim.guest_threads;
+                    // Open epochs never wait for a thread that enters after them.
+                    st.acked_epoch = g_tiered_reclaim.epoch.load(::std::memory_order_relaxed);
+                    // Every frame this guard encloses lies below the guard itself.
+                    st.guest_stack_top = reinterpret_cast<::std::uintptr_t>(this);
+                    thread_state = ::std::addressof(st);
+                }
+            }
+
+            inline constexpr tiered_reclaim_guest_guard(tiered_reclaim_guest_guard const&) noexcept = delete;
+            inline constexpr tiered_reclaim_guest_guard& operator= (tiered_reclaim_guest_guard const&) noexcept = delete;
+
+            inline constexpr ~tiered_reclaim_guest_guard() { leave(); }
+
+            // Ends the guest region before the guard goes out of scope; entry points that keep running host code after the
+            // guest returns call this so reclamation stops waiting for them.
+            inline constexpr void leave() noexcept
+            {
+                auto const curr_thread_state{::std::exchange(thread_state, nullptr)};
+                if(curr_thread_state == nullptr) { return; }
+
+                ::uwvm2::utils::container::vector<tiered_reclaim_freed> freed{};
+                {
+                    tiered_reclaim_lock_guard reclaim_guard{};
+                    auto& state{g_tiered_reclaim};
+                    --state.guest_threads;
+                    // Leaving guest code counts as the ack of an epoch this thread still owed.
+                    if(state.epoch_open && curr_thread_state->acked_epoch != state.epoch.load(::std::memory_order_relaxed) && --state.pending_acks == 0uz)
+                    {
+                        run_tiered_reclaim_epochs_locked(freed, true);
+                    }
+                    curr_thread_state->guest_stack_top = 0u;
+                }
+                free_tiered_reclaimed(freed);
+            }
+        };
+
+        inline void retire_tiered_superseded_code(compiled_module_record& rec, ::std::size_t module_id) noexcept
+        {
+            // Queue the module's T0 bytecode and lazy T1 objects once its T2 entries are published.
+            if constexpr(!tiered_reclaim_supported) { return; }
+            namespace llvm_lazy = ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator;
+
+            auto const runtime_module{rec.runtime_module};
+            if(runtime_module == nullptr) [[unlikely]] { return; }
+            auto const local_n{runtime_module->local_defined_function_vec_storage.size()};
+
+            ::uwvm2::utils::container::vector<tiered_reclaim_unit> batch{};
+            ::uwvm2::utils::container::vector<::std::size_t> tier1_unit_of_function{};
+            tier1_unit_of_function.resize(local_n);
+            for(auto& unit_index: tier1_unit_of_function) { unit_index = SIZE_MAX; }
+
+            // The JIT event listener keeps code ranges and DWARF objects of every loaded object, so T1 stays resident with it.
+            if(rec.llvm_jit_lazy_compile_options.jit_event_listener == nullptr)
+            {
+                auto& lazy{rec.llvm_jit_lazy_compiled};
+                auto const n{(::std::min)({local_n, lazy.functions.size(), lazy.materialized_functions.size()})};
+                ::uwvm2::utils::container::vector<::std::size_t> owner_unit{};
+                owner_unit.resize(n);
+
+                llvm_lazy::details::lazy_publish_lock_guard publish_guard{};
+                for(::std::size_t i{}; i != n; ++i)
+                {
+                    owner_unit.index_unchecked(i) = SIZE_MAX;
+                    if(lazy.functions.index_unchecked(i).materialization_state.state.load(::std::memory_order_acquire) !=
+                       ::uwvm2::utils::thread::lazy_compile_state::compiled)
+                    {
+                        continue;
+                    }
+
+                    auto const& materialized{lazy.materialized_functions.index_unchecked(i)};
+                    if(materialized.llvm_jit_resource_tracker == nullptr || materialized.llvm_jit_code_ranges.empty() ||
+                       !llvm_lazy::details::load_lazy_materialized_ready(materialized, ::std::memory_order_acquire))
+                    {
+                        continue;
+                    }
+
+                    owner_unit.index_unchecked(i) = batch.size();
+                    tiered_reclaim_unit unit{};
+                    unit.module_id = module_id;
+                    unit.local_index = i;
+                    unit.bytes = materialized.llvm_jit_object_bytes;
+                    unit.tier1 = true;
+                    for(auto const& range: materialized.llvm_jit_code_ranges) { unit.code_ranges.push_back(range); }
+                    batch.push_back(::std::move(unit));
+                }
+
+                for(::std::size_t i{}; i != n; ++i)
+                {
+                    auto const owner{lazy.materialized_functions.index_unchecked(i).llvm_jit_object_owner_index};
+                    if(owner < n) { tier1_unit_of_function.index_unchecked(i) = owner_unit.index_unchecked(owner); }
+                }
+            }
+
+            auto const tier1_objects{batch.size()};
+            if(tiered_t0_enabled())
+            {
+                auto& compiled{rec.lazy_compiled.compiled};
+                auto const n{(::std::min)({local_n, rec.lazy_compiled.functions.size(), compiled.local_funcs.size(), rec.tiered_t0_reclaimed.size()})};
+                for(::std::size_t i{}; i != n; ++i)
+                {
+                    if(!tiered_local_function_direct_supported(rec, i) || tiered_t0_code_reclaimed(rec, i)) { continue; }
+                    if(rec.lazy_compiled.functions.index_unchecked(i).materialization_state.state.load(::std::memory_order_acquire) !=
+                       ::uwvm2::utils::thread::lazy_compile_state::compiled)
+                    {
+                        continue;
+                    }
+
+                    auto const& operands{compiled.local_funcs.index_unchecked(i).op.operands};
+                    if(operands.empty()) { continue; }
+
+                    tiered_reclaim_unit unit{};
+                    unit.module_id = module_id;
+                    unit.local_index = i;
+                    unit.tier1_unit = tier1_unit_of_function.index_unchecked(i);
+                    unit.bytes = operands.size();
+                    // One past the end too: an interpreter frame may hold the end pointer of its bytecode.
+                    unit.code_ranges.push_back(::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_orc_code_range{
+                        reinterpret_cast<::std::uintptr_t>(operands.data()),
+                        operands.size() + 1uz});
+                    batch.push_back(::std::move(unit));
+                }
+            }
+            if(batch.empty()) { return; }
+
+            if(::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+            {
+                llvm_lazy::lazy_runtime_log::line(u8"tiered-reclaim-retire module=\"",
+                                                  rec.module_name,
+                                                  u8"\" module_id=",
+                                                  module_id,
+                                                  u8" tier0_functions=",
+                                                  batch.size() - tier1_objects,
+                                                  u8" tier1_objects=",
+                                                  tier1_objects);
+            }
+
+            ::uwvm2::utils::container::vector<tiered_reclaim_freed> freed{};
+            {
+                tiered_reclaim_lock_guard reclaim_guard{};
+                auto& state{g_tiered_reclaim};
+                auto const offset{state.incoming.size()};
+                for(auto& unit: batch)
+                {
+                    if(unit.tier1_unit != SIZE_MAX) { unit.tier1_unit += offset; }
+                    state.incoming.push_back(::std::move(unit));
+                }
+                if(!state.epoch_open) { run_tiered_reclaim_epochs_locked(freed, false); }
+            }
+            free_tiered_reclaimed(freed);
+        }
+
+        [[nodiscard]] inline constexpr ::std::uint_least32_t tiered_large_long_run_counter_sample_stride(compiled_module_record const& rec) noexcept
+        {
+            // Sampling keeps per-entry accounting cheap in large modules while still accumulating enough evidence for long runs.
+            auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
+            if(local_n >= 8192uz) { return 16u; }
+            if(local_n >= 1024uz) { return 16u; }
+            if(local_n >= 512uz) { return 8u; }
+            return 16u;
+        }
+
+        [[nodiscard]] inline constexpr bool tiered_large_long_run_counter_sampled(::std::size_t local_index, ::std::uint_least32_t stride) noexcept
+        {
+            // Mix the thread-local tick with the function index so adjacent hot functions do not sample in lockstep.
+            if(stride <= 1u) { return true; }
+#  if defined(UWVM_USE_THREAD_LOCAL)
+            auto const tick{++tiered_counter_sample_tick};
+#  else
+            auto const tick{++get_tiered_counter_sample_tick()};
+#  endif
+            auto const phase{static_cast<::std::uint_least32_t>((local_index + 1uz) * 0x85ebca6buz)};
+            return ((tick ^ phase) & (stride - 1u)) == 0u;
+        }
+
+        [[nodiscard]] inline constexpr bool tiered_large_module_long_run_active(compiled_module_record const& rec) noexcept
+        {
+            // Large modules need runtime evidence before aggressive JIT scheduling. Once the threshold is crossed, publish a sticky
+            // ready bit so future checks stay cheap.
+            auto& ready{const_cast<::std::uint_least8_t&>(rec.tiered_large_long_run_ready)};
+            ::std::atomic_ref<::std::uint_least8_t> ready_ref{ready};
+            if(ready_ref.load(::std::memory_order_acquire) != 0u) { return true; }
+
+            auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
+            auto& large_loop_sample_counter{const_cast<::std::size_t&>(rec.tiered_large_loop_sample_count)};
+            auto const large_loop_sample_count{::std::atomic_ref<::std::size_t>{large_loop_sample_counter}.load(::std::memory_order_relaxed)};
+            if(local_n < tiered_large_long_run_local_function_threshold && large_loop_sample_count < tiered_large_long_run_loop_sample_threshold)
+            {
+                return false;
+            }
+
+            auto& fallback_counter{const_cast<::std::size_t&>(rec.tiered_interpreter_fallback_count)};
+            auto& entry_miss_counter{const_cast<::std::size_t&>(rec.tiered_entry_miss_count)};
+            auto& switch_counter{const_cast<::std::size_t&>(rec.tiered_switch_count)};
+            auto const fallback_count{::std::atomic_ref<::std::size_t>{fallback_counter}.load(::std::memory_order_relaxed)};
+            auto const entry_miss_count{::std::atomic_ref<::std::size_t>{entry_miss_counter}.load(::std::memory_order_relaxed)};
+            auto const switch_count{::std::atomic_ref<::std::size_t>{switch_counter}.load(::std::memory_order_relaxed)};
+            if(fallback_count < tiered_large_long_run_entry_counter_threshold && entry_miss_count < tiered_large_long_run_entry_counter_threshold &&
+               switch_count < tiered_large_long_run_switch_counter_threshold && large_loop_sample_count < tiered_large_long_run_loop_sample_threshold)
+            {
+                return false;
+            }
+
+            ::std::uint_least8_t expected{};
+            if(ready_ref.compare_exchange_strong(expected, static_cast<::std::uint_least8_t>(1u), ::std::memory_order_acq_rel, ::std::memory_order_acquire) &&
+               ::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::lazy_runtime_log::line(u8"tiered-large-long-run module=\"",
+                                                                                                             rec.module_name,
+                                                                                                             u8"\" module_id=",
+                                                                                                             module_id_from_record(rec),
+                                                                                                             u8" local_functions=",
+                                                                                                             local_n,
+                                                                                                             u8" fallback_count=",
+                                                                                                             fallback_count,
+                                                                                                             u8" entry_miss_count=",
+                                                                                                             entry_miss_count,
+                                                                                                             u8" switch_count=",
+                                                                                                             switch_count,
+                                                                                                             u8" large_loop_samples=",
+                                                                                                             large_loop_sample_count,
+                                                                                                             u8" entry_threshold=",
+                                                                                                             tiered_large_long_run_entry_counter_threshold,
+                                                                                                             u8" switch_threshold=",
+                                                                                                             tiered_large_long_run_switch_counter_threshold,
+                                                                                                             u8" large_loop_threshold=",
+                                                                                                             tiered_large_long_run_loop_sample_threshold);
+            }
+            return true;
+        }
+
+        [[nodiscard]] inline constexpr bool tiered_large_loop_sentinel_compile_active(compiled_module_record const& rec) noexcept
+        {
+            // The sentinel path opens only after the module has proven it is long-running or after a large-loop sample is seen.
             if(!tiered_large_module_long_run_active(rec)) { return false; }
 
             auto& large_loop_sample_counter{const_cast<::std::size_t&>(rec.tiered_large_loop_sample_count)};
@@ -4761,6 +5755,43 @@ namespace uwvm2::runtime::lib
             return true;
         }
 
+        [[nodiscard]] inline constexpr bool try_get_tiered_full_loop_reentry(compiled_module_record const& rec,
+                                                                             ::std::size_t local_index,
+                                                                             ::std::size_t loop_wasm_code_offset,
+                                                                             ::std::uintptr_t& reentry_address) noexcept
+        {
+            // T2 loop reentry lookup. The wrapper restores the interpreter's serialized locals into the T2 core and branches to the
+            // recorded loop header; loop polls sit only where the operand stack is empty, so locals are the whole live state.
+            reentry_address = 0u;
+            if(!tiered_t2_enabled()) { return false; }
+            if(!tiered_full_ready(rec)) { return false; }
+            if(local_index >= rec.llvm_jit_compiled.local_funcs.size() || local_index >= rec.tiered_full_loop_reentry_raw_entry_addresses.size())
+                [[unlikely]]
+            {
+                return false;
+            }
+
+            auto const& reentries{rec.llvm_jit_compiled.local_funcs.index_unchecked(local_index).tiered_loop_reentries};
+            auto const& reentry_addresses{rec.tiered_full_loop_reentry_raw_entry_addresses.index_unchecked(local_index)};
+            if(reentries.size() != reentry_addresses.size()) [[unlikely]] { return false; }
+
+            for(::std::size_t i{}; i != reentries.size(); ++i)
+            {
+                if(reentries.index_unchecked(i).wasm_code_offset != loop_wasm_code_offset) { continue; }
+                reentry_address = reentry_addresses.index_unchecked(i);
+                return reentry_address != 0u;
+            }
+            return false;
+        }
+
+        [[nodiscard]] inline constexpr bool tiered_full_loop_osr_pending(compiled_module_record const& rec) noexcept
+        {
+            // True while this module's T2 can still be published, so a live interpreter loop has a later tier to OSR into.
+            if(!tiered_t2_enabled()) { return false; }
+            if(tiered_full_ready(rec)) { return false; }
+            return rec.tiered_full_compile_state.state.load(::std::memory_order_acquire) != ::uwvm2::utils::thread::lazy_compile_state::failed;
+        }
+
         inline constexpr void tiered_full_compile_request_entry(void* user_data) noexcept
         {
             // Background job for producing the full LLVM tier. It validates, emits, materializes, and publishes all entries as one
@@ -4781,6 +5812,9 @@ namespace uwvm2::runtime::lib
             opt.curr_wasm_id = module_id;
             opt.verify_llvm_jit_ir = !::uwvm2::uwvm::runtime::runtime_mode::runtime_llvm_jit_disable_ir_verifaction;
             configure_runtime_llvm_jit_call_stack_policy(opt);
+            // T2 carries the same loop reentry wrappers as T1, so an interpreter frame already inside a long loop can move to T2
+            // at its next loop poll instead of waiting for the function to be called again.
+            opt.emit_tiered_loop_reentry_entries = tiered_t0_enabled();
 
             bool compiled_ok{};
 #  ifdef UWVM_CPP_EXCEPTIONS
@@ -4838,6 +5872,9 @@ namespace uwvm2::runtime::lib
                                                                                                              u8" functions=",
                                                                                                              local_func_count);
             }
+
+            // T2 now answers every new call into this module; the tiers it replaced are freed once no frame uses them.
+            retire_tiered_superseded_code(*rec, module_id);
         }
 
         inline constexpr void maybe_request_tiered_full_compile(compiled_module_record& rec,
@@ -4994,10 +6031,13 @@ namespace uwvm2::runtime::lib
             g_runtime.tiered_osr_deferred_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_osr_compile_request_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_osr_urgent_request_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.tiered_osr_full_ready_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_full_compile_request_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_full_compile_ready_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_full_compile_failed_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.tiered_full_publish_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.tiered_reclaim_tier0_bytes.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.tiered_reclaim_tier1_bytes.store(0uz, ::std::memory_order_relaxed);
         }
 
         [[nodiscard]] inline constexpr ::std::uint_least32_t tiered_entry_hot_request_threshold(compiled_module_record const& rec,
@@ -5442,6 +6482,13 @@ namespace uwvm2::runtime::lib
             // whenever a matching loop body is already materialized.
             reentry_address = 0u;
             auto const full_ready{tiered_full_ready(rec)};
+            if(full_ready && try_get_tiered_full_loop_reentry(rec, local_index, loop_wasm_code_offset, reentry_address))
+            {
+                // T2 supersedes T1 for loop reentry exactly as it does for calls.
+                ::std::uintptr_t full_raw_entry_address{};
+                static_cast<void>(try_publish_tiered_ready_full_llvm_jit_entry(rec, module_id, local_index, full_raw_entry_address));
+                return true;
+            }
             if(::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::try_get_lazy_tiered_loop_reentry_raw_entry_address(
                    rec.llvm_jit_lazy_compiled,
                    local_index,
@@ -5622,6 +6669,8 @@ namespace uwvm2::runtime::lib
             // Interpreter loop polls arrive here when execution might jump into generated code. Keep this noinline so profiler and
             // trap diagnostics see a clear boundary between interpreter execution and runtime OSR glue.
             if(!tiered_runtime_active()) { return false; }
+            // Loop back-edge polls double as reclamation safepoints, so long-running loops still let epochs complete.
+            tiered_reclaim_safepoint();
             auto const log_enabled{::uwvm2::uwvm::io::enable_runtime_log};
             if(log_enabled) [[unlikely]] { g_runtime.tiered_osr_callback_count.fetch_add(1uz, ::std::memory_order_relaxed); }
             // If this OSR site proves unusable, write the disabled sentinel back into the interpreter-side poll state.
@@ -5666,12 +6715,50 @@ namespace uwvm2::runtime::lib
                 disable_poll();
                 return record_miss();
             }
+
+            // Tiered OSR reentry wrappers are generated as raw Wasm-entry targets.  Keep this pointer ABI in lockstep
+            // with the LLVM raw-entry calling convention and uwvm-int's opfunc ABI policy: Windows x86_64 is SysV,
+            // every i686 target is fastcall, and the rest use the platform default.
+            using entry_fn_t =
+                void(UWVM2_RUNTIME_LLVM_JIT_RAW_ENTRY_PTR_ABI*)(::std::uintptr_t, ::std::uintptr_t, ::std::size_t, ::std::uintptr_t, ::std::size_t);
+            auto const enter_reentry{[&](::std::uintptr_t reentry_address) constexpr noexcept -> bool
+                                     {
+                                         auto const entry_fn{reinterpret_cast<entry_fn_t>(reentry_address)};
+                                         auto& call_stack{get_call_stack()};
+                                         // OSR transfers control from an interpreter loop into a generated loop body without creating a
+                                         // normal wasm native-call edge for the interpreter callers. Capture the boundary before the raw
+                                         // entry so a trap inside an inlined or optimized loop body can still report the interpreter
+                                         // caller chain below the generated frame.
+                                         tiered_jit_entry_call_stack_snapshot_guard snapshot_guard{call_stack};
+                                         entry_fn(0u,
+                                                  reinterpret_cast<::std::uintptr_t>(result_buffer),
+                                                  result_bytes,
+                                                  reinterpret_cast<::std::uintptr_t>(local_base),
+                                                  local_bytes);
+                                         if(log_enabled) [[unlikely]] { g_runtime.tiered_osr_ready_count.fetch_add(1uz, ::std::memory_order_relaxed); }
+                                         record_tiered_llvm_jit_switch(rec);
+                                         return true;
+                                     }};
+
+            // Once T2 is published, a loop header it recorded is entered directly: the T1 gates below only decide whether a
+            // per-function compile is worth requesting, and T2 code already exists.
+            if(::std::uintptr_t full_reentry_address{}; tiered_local_function_direct_supported(rec, local_index) &&
+                                                       try_get_tiered_full_loop_reentry(rec, local_index, loop_wasm_code_offset, full_reentry_address))
+            {
+                ::std::uintptr_t full_raw_entry_address{};
+                static_cast<void>(try_publish_tiered_ready_full_llvm_jit_entry(rec, module_id, local_index, full_raw_entry_address));
+                if(log_enabled) [[unlikely]] { g_runtime.tiered_osr_full_ready_count.fetch_add(1uz, ::std::memory_order_relaxed); }
+                return enter_reentry(full_reentry_address);
+            }
+
             auto const large_loop_sentinel{tiered_large_loop_sentinel_candidate(rec, local_index)};
             // Large-loop sentinels record evidence even when the normal OSR gate is not open yet.
             if(large_loop_sentinel) { record_tiered_large_loop_sample(rec, local_index, loop_wasm_code_offset); }
             if(!tiered_loop_osr_can_request_llvm(rec, local_index))
             {
                 if(large_loop_sentinel) { return record_miss(); }
+                // Keep polling at the counter-only rate while T2 may still arrive; the frame can then OSR straight into it.
+                if(tiered_full_loop_osr_pending(rec)) { return record_miss(); }
                 disable_poll();
                 return record_miss();
             }
@@ -5717,21 +6804,7 @@ namespace uwvm2::runtime::lib
                 }
             }
 
-            // Tiered OSR reentry wrappers are generated as raw Wasm-entry targets.  Keep this pointer ABI in lockstep
-            // with the LLVM raw-entry calling convention and uwvm-int's opfunc ABI policy: Windows x86_64 is SysV,
-            // every i686 target is fastcall, and the rest use the platform default.
-            using entry_fn_t =
-                void(UWVM2_RUNTIME_LLVM_JIT_RAW_ENTRY_PTR_ABI*)(::std::uintptr_t, ::std::uintptr_t, ::std::size_t, ::std::uintptr_t, ::std::size_t);
-            auto const entry_fn{reinterpret_cast<entry_fn_t>(reentry_address)};
-            auto& call_stack{get_call_stack()};
-            // OSR transfers control from an interpreter loop into a generated loop body without creating a normal wasm native-call
-            // edge for the interpreter callers. Capture the boundary before the raw entry so a trap inside an inlined or optimized
-            // loop body can still report the interpreter caller chain below the generated frame.
-            tiered_jit_entry_call_stack_snapshot_guard snapshot_guard{call_stack};
-            entry_fn(0u, reinterpret_cast<::std::uintptr_t>(result_buffer), result_bytes, reinterpret_cast<::std::uintptr_t>(local_base), local_bytes);
-            if(log_enabled) [[unlikely]] { g_runtime.tiered_osr_ready_count.fetch_add(1uz, ::std::memory_order_relaxed); }
-            record_tiered_llvm_jit_switch(rec);
-            return true;
+            return enter_reentry(reentry_address);
         }
 
         [[nodiscard]] UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr bool
@@ -6640,17 +7713,14 @@ namespace uwvm2::runtime::lib
             }
         }
 
-        inline constexpr void call_local_imported_with_wasip1_env(local_imported_t const& module,
-                                                                  ::std::size_t function_index,
-                                                                  ::std::byte* result_buffer,
-                                                                  ::std::byte* param_buffer,
-                                                                  ::std::size_t caller_module_id) noexcept
+        template <typename Invoke>
+        inline constexpr void invoke_with_caller_wasip1_env(::std::size_t caller_module_id, Invoke&& invoke) noexcept
         {
             // Select the caller-specific WASI environment around local-imported calls only when overrides make the default fast path
             // insufficient.
             if(try_prepare_default_global_wasip1_env_fast_path(caller_module_id)) [[likely]]
             {
-                module.call_func_index(function_index, result_buffer, param_buffer);
+                invoke();
                 return;
             }
 
@@ -6659,12 +7729,22 @@ namespace uwvm2::runtime::lib
 
             if(is_current_wasip1_env_selected(wasip1_env)) [[likely]]
             {
-                module.call_func_index(function_index, result_buffer, param_buffer);
+                invoke();
                 return;
             }
 
             ::uwvm2::uwvm::imported::wasi::wasip1::storage::scoped_current_wasip1_env_t wasip1_env_guard{wasip1_env};
-            module.call_func_index(function_index, result_buffer, param_buffer);
+            invoke();
+        }
+
+        inline constexpr void call_local_imported_with_wasip1_env(local_imported_t const& module,
+                                                                  ::std::size_t function_index,
+                                                                  ::std::byte* result_buffer,
+                                                                  ::std::byte* param_buffer,
+                                                                  ::std::size_t caller_module_id) noexcept
+        {
+            invoke_with_caller_wasip1_env(caller_module_id,
+                                          [&]() constexpr noexcept { module.call_func_index(function_index, result_buffer, param_buffer); });
         }
 
         inline constexpr void call_capi_with_wasip1_env(capi_function_t const& function,
@@ -7298,7 +8378,14 @@ namespace uwvm2::runtime::lib
             // aarch64: AAPCS64 (x0-x7 integer args, v0-v7 fp/simd args)
             // 3 fixed args: (ip, operand_stack_top, local_base) => occupy x0-x2
             // Use remaining integer args (x3-x7) for i32/i64 stack-top caching, and fp/simd args (v0-v7) for f32/f64/v128.
+#  if defined(UWVM_ENABLE_UWVM_INT_PIN_MEMORY0) && defined(UWVM_SUPPORT_MMAP)
+            // Pinned memory0 begin/end take x3-x4; the i32/i64 ring keeps x5-x7.
+            res.memory0_begin_pos = 3uz;
+            res.memory0_end_pos = 4uz;
+            res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 5uz;
+#  else
             res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 3uz;
+#  endif
             res.i32_stack_top_end_pos = res.i64_stack_top_end_pos = 8uz;
             res.f32_stack_top_begin_pos = res.f64_stack_top_begin_pos = res.v128_stack_top_begin_pos = 8uz;
             res.f32_stack_top_end_pos = res.f64_stack_top_end_pos = res.v128_stack_top_end_pos = 16uz;
@@ -7344,7 +8431,14 @@ namespace uwvm2::runtime::lib
 #  else
             // riscv64: psABI (a0-a7 integer args, fa0-fa7 fp args). Keep v128 caching off by default:
             // `wasm_v128` argument passing is not consistently vector-reg based across toolchains/ABIs.
+#   if defined(UWVM_ENABLE_UWVM_INT_PIN_MEMORY0) && defined(UWVM_SUPPORT_MMAP)
+            // Pinned memory0 begin/end take a3-a4; the i32/i64 ring keeps a5-a7.
+            res.memory0_begin_pos = 3uz;
+            res.memory0_end_pos = 4uz;
+            res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 5uz;
+#   else
             res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 3uz;
+#   endif
             res.i32_stack_top_end_pos = res.i64_stack_top_end_pos = 8uz;
             res.f32_stack_top_begin_pos = res.f64_stack_top_begin_pos = 8uz;
             res.f32_stack_top_end_pos = res.f64_stack_top_end_pos = 16uz;
@@ -7360,7 +8454,14 @@ namespace uwvm2::runtime::lib
 #  else
             // loongarch64: LP64D (a0-a7 integer args, fa0-fa7 fp args). Keep v128 caching off by default:
             // `wasm_v128` argument passing may be lowered to GPR pairs/stack depending on ABI + vector extension.
+#   if defined(UWVM_ENABLE_UWVM_INT_PIN_MEMORY0) && defined(UWVM_SUPPORT_MMAP)
+            // Pinned memory0 begin/end take a3-a4; the i32/i64 ring keeps a5-a7.
+            res.memory0_begin_pos = 3uz;
+            res.memory0_end_pos = 4uz;
+            res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 5uz;
+#   else
             res.i32_stack_top_begin_pos = res.i64_stack_top_begin_pos = 3uz;
+#   endif
             res.i32_stack_top_end_pos = res.i64_stack_top_end_pos = 8uz;
             res.f32_stack_top_begin_pos = res.f64_stack_top_begin_pos = 8uz;
             res.f32_stack_top_end_pos = res.f64_stack_top_end_pos = 16uz;
@@ -7550,6 +8651,69 @@ namespace uwvm2::runtime::lib
             return invalid_llvm_jit_encoded_type_id();
         }
 
+        inline constexpr void assign_canonical_sig_ids(compiled_module_record& rec) noexcept
+        {
+            // Intern the module's types into the process-wide signature map. In-module duplicates reuse `type_canon_index`, so only
+            // distinct signatures are hashed.
+            rec.type_sig_id.clear();
+            auto const runtime_module{rec.runtime_module};
+            if(runtime_module == nullptr) [[unlikely]] { return; }
+
+            auto const type_begin{runtime_module->type_section_storage.type_section_begin};
+            auto const type_end{runtime_module->type_section_storage.type_section_end};
+            if(type_begin == nullptr || type_end == nullptr || type_begin > type_end) [[unlikely]] { return; }
+
+            auto const total{static_cast<::std::size_t>(type_end - type_begin)};
+            auto const canon_ok{rec.type_canon_index.size() == total};
+            rec.type_sig_id.resize(total);
+
+            auto& sig_ids{g_runtime.canonical_sig_ids};
+            for(::std::size_t i{}; i != total; ++i)
+            {
+                auto const canonical_index{canon_ok ? rec.type_canon_index.index_unchecked(i) : i};
+                if(canonical_index < i)
+                {
+                    rec.type_sig_id.index_unchecked(i) = rec.type_sig_id.index_unchecked(canonical_index);
+                    continue;
+                }
+
+                auto const& ft{type_begin[i]};
+                ::uwvm2::parser::wasm::standard::wasm1::features::type_function_checker key{};
+                key.parameter.begin = reinterpret_cast<::std::byte const*>(ft.parameter.begin);
+                key.parameter.end = reinterpret_cast<::std::byte const*>(ft.parameter.end);
+                key.result.begin = reinterpret_cast<::std::byte const*>(ft.result.begin);
+                key.result.end = reinterpret_cast<::std::byte const*>(ft.result.end);
+
+                if(auto const it{sig_ids.find(key)}; it != sig_ids.end())
+                {
+                    rec.type_sig_id.index_unchecked(i) = it->second;
+                    continue;
+                }
+
+                // Id 0 is reserved for "no flat entry"; types past the id range simply keep the checked call_indirect path.
+                if(sig_ids.size() >= static_cast<::std::size_t>((::std::numeric_limits<::std::uint_least32_t>::max)())) [[unlikely]] { continue; }
+                auto const sig_id{static_cast<::std::uint_least32_t>(sig_ids.size() + 1uz)};
+                sig_ids.try_emplace(key, sig_id);
+                rec.type_sig_id.index_unchecked(i) = sig_id;
+            }
+        }
+
+        [[nodiscard]] inline constexpr ::std::uint_least32_t canonical_sig_id_of_defined(compiled_defined_func_info const& info) noexcept
+        {
+            // A defined function's type pointer lives in its owning module's type section.
+            if(info.runtime_func == nullptr || info.module_id >= g_runtime.modules.size()) [[unlikely]] { return 0u; }
+            auto const& rec{g_runtime.modules.index_unchecked(info.module_id)};
+            if(rec.runtime_module == nullptr) [[unlikely]] { return 0u; }
+
+            auto const type_begin{rec.runtime_module->type_section_storage.type_section_begin};
+            auto const ft_ptr{info.runtime_func->function_type_ptr};
+            if(type_begin == nullptr || ft_ptr == nullptr || ft_ptr < type_begin) [[unlikely]] { return 0u; }
+
+            auto const type_index{static_cast<::std::size_t>(ft_ptr - type_begin)};
+            if(type_index >= rec.type_sig_id.size()) [[unlikely]] { return 0u; }
+            return rec.type_sig_id.index_unchecked(type_index);
+        }
+
         [[maybe_unused]] [[nodiscard]] inline constexpr ::std::uintptr_t pointer_to_uintptr(void const* ptr) noexcept
         { return reinterpret_cast<::std::uintptr_t>(ptr); }
 
@@ -7693,61 +8857,91 @@ namespace uwvm2::runtime::lib
             return try_execute_trivial_defined_call(*compiled_call_info, stack_top_ptr);
         }
 
-        inline constexpr void execute_compiled_defined(call_stack_tls_state& call_stack,
-                                                       [[maybe_unused]] runtime_local_func_storage_t const* runtime_func,
-                                                       compiled_local_func_t const* compiled_func,
-                                                       ::std::size_t param_bytes,
-                                                       ::std::size_t result_bytes,
-                                                       ::std::byte** caller_stack_top_ptr) noexcept
+        // Frame sizes derived from compiler metadata. Every interpreter frame uses this layout, so a tail call can rebuild the next
+        // frame inside the buffer of the frame it replaces.
+        struct interpreter_frame_layout_t
         {
-            // Build the interpreter frame from compiler metadata: params become locals, wasm-visible locals are zeroed, and operands
-            // live on a separate byte-packed stack sized for the function's maximum depth.
-            auto const local_bytes_raw{compiled_func->local_bytes_max};
-            auto const stack_cap_raw{compiled_func->operand_stack_byte_max};
+            ::std::size_t local_bytes_raw{};
+            ::std::size_t stack_cap_raw{};
+            ::std::size_t zero_n{};
+            ::std::size_t local_alloc_n{};
+            ::std::size_t frame_alloc_n{};
+            bool align_wasm_locals_start{};
+        };
+
+        inline constexpr ::std::size_t interpreter_frame_align{16uz};
+
+        [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr interpreter_frame_layout_t
+            get_interpreter_frame_layout(compiled_local_func_t const* compiled_func, ::std::size_t param_bytes, ::std::size_t result_bytes) noexcept
+        {
+            interpreter_frame_layout_t layout{.local_bytes_raw = compiled_func->local_bytes_max, .stack_cap_raw = compiled_func->operand_stack_byte_max};
             constexpr ::std::size_t kInternalTempLocalBytes{8uz};
-            ::std::size_t wasm_locals_bytes{local_bytes_raw};
-            if(local_bytes_raw >= kInternalTempLocalBytes) [[likely]] { wasm_locals_bytes = local_bytes_raw - kInternalTempLocalBytes; }
+            ::std::size_t wasm_locals_bytes{layout.local_bytes_raw};
+            if(layout.local_bytes_raw >= kInternalTempLocalBytes) [[likely]] { wasm_locals_bytes = layout.local_bytes_raw - kInternalTempLocalBytes; }
             if(param_bytes > wasm_locals_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
             auto const zeroinit_end_raw{compiled_func->local_bytes_zeroinit_end};
             if(zeroinit_end_raw < param_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
             if(zeroinit_end_raw > wasm_locals_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
-            auto const zero_n{zeroinit_end_raw - param_bytes};
-            constexpr ::std::size_t kFrameAlign{16uz};
-            constexpr ::std::size_t kFrameAlignPad{kFrameAlign - 1uz};
-            bool const align_wasm_locals_start{zero_n >= 64uz};
+            layout.zero_n = zeroinit_end_raw - param_bytes;
+            constexpr ::std::size_t kFrameAlignPad{interpreter_frame_align - 1uz};
+            layout.align_wasm_locals_start = layout.zero_n >= 64uz;
 
             // Frame layout:
             // - locals region (with optional padding for aligning the Wasm-locals start after params)
             // - operand stack region (16-byte aligned)
-            ::std::size_t local_alloc_n{local_bytes_raw};
-            if(local_alloc_n == 0uz) [[unlikely]] { local_alloc_n = 1uz; }
-            if(align_wasm_locals_start)
+            layout.local_alloc_n = layout.local_bytes_raw;
+            if(layout.local_alloc_n == 0uz) [[unlikely]] { layout.local_alloc_n = 1uz; }
+            if(layout.align_wasm_locals_start)
             {
-                if(local_alloc_n > (::std::numeric_limits<::std::size_t>::max() - kFrameAlignPad)) [[unlikely]] { ::fast_io::fast_terminate(); }
-                local_alloc_n += kFrameAlignPad;
+                if(layout.local_alloc_n > (::std::numeric_limits<::std::size_t>::max() - kFrameAlignPad)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                layout.local_alloc_n += kFrameAlignPad;
             }
 
-            ::std::size_t frame_alloc_n{local_alloc_n};
-            if(stack_cap_raw != 0uz) [[likely]]
+            layout.frame_alloc_n = layout.local_alloc_n;
+            if(layout.stack_cap_raw != 0uz) [[likely]]
             {
-                if(frame_alloc_n > (::std::numeric_limits<::std::size_t>::max() - (kFrameAlignPad + stack_cap_raw))) [[unlikely]]
+                if(layout.frame_alloc_n > (::std::numeric_limits<::std::size_t>::max() - (kFrameAlignPad + layout.stack_cap_raw))) [[unlikely]]
                 {
                     ::fast_io::fast_terminate();
                 }
-                frame_alloc_n += kFrameAlignPad + stack_cap_raw;
+                layout.frame_alloc_n += kFrameAlignPad + layout.stack_cap_raw;
             }
 
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(layout.stack_cap_raw == 0uz && compiled_func->operand_stack_max != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+# endif
+            if(layout.stack_cap_raw < result_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            return layout;
+        }
+
+        // Defined with the call_indirect table helpers below.
+        [[nodiscard]] inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*
+            resolve_frame_reusable_tail_call(call_stack_tls_state::pending_tail_call_t const& pending) noexcept;
+        [[nodiscard]] inline constexpr compiled_local_func_t const*
+            prepare_frame_reusable_tail_call_target(::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info) noexcept;
+
+        inline constexpr void execute_compiled_defined(call_stack_tls_state& call_stack,
+                                                       [[maybe_unused]] runtime_local_func_storage_t const* runtime_func,
+                                                       compiled_local_func_t const* compiled_func,
+                                                       ::std::size_t param_bytes,
+                                                       ::std::size_t result_bytes,
+                                                       ::std::byte** caller_stack_top_ptr) noexcept
+        {
+            // Build the interpreter frame from compiler metadata: params become locals, wasm-visible locals are zeroed, and operands
+            // live on a separate byte-packed stack sized for the function's maximum depth.
+            auto layout{get_interpreter_frame_layout(compiled_func, param_bytes, result_bytes)};
+
             constexpr ::std::size_t kAllocaMaxBytesPerFrame{4096uz};
             constexpr ::std::size_t kAllocaMaxCallDepth{128uz};
 # if defined(UWVM_USE_THREAD_LOCAL)
-            bool const use_scratch{frame_alloc_n > kAllocaMaxBytesPerFrame || call_stack.frames.size() > kAllocaMaxCallDepth};
-            thread_local_bump_allocator::mark_t scratch_mark{};
-            if(use_scratch) { scratch_mark = g_call_scratch.mark(); }
+            auto& scratch{g_call_scratch};
 # else
-            bool const use_scratch{frame_alloc_n > kAllocaMaxBytesPerFrame || call_stack.frames.size() > kAllocaMaxCallDepth};
-            thread_local_bump_allocator::mark_t scratch_mark{};
-            if(use_scratch) { scratch_mark = get_call_scratch().mark(); }
+            auto& scratch{get_call_scratch()};
 # endif
+            bool use_scratch{layout.frame_alloc_n > kAllocaMaxBytesPerFrame || call_stack.depth() > kAllocaMaxCallDepth};
+            thread_local_bump_allocator::mark_t scratch_mark{};
+            if(use_scratch) { scratch_mark = scratch.mark(); }
 
             auto caller_stack_top{*caller_stack_top_ptr};
             auto const caller_args_begin{caller_stack_top - param_bytes};
@@ -7755,98 +8949,179 @@ namespace uwvm2::runtime::lib
             *caller_stack_top_ptr = caller_args_begin;
 
             ::std::byte* frame_alloc{};
-# if defined(UWVM_USE_THREAD_LOCAL)
-            if(use_scratch) { frame_alloc = g_call_scratch.allocate_bytes(frame_alloc_n, kFrameAlign); }
-            else
-# else
-            if(use_scratch) { frame_alloc = get_call_scratch().allocate_bytes(frame_alloc_n, kFrameAlign); }
+            if(use_scratch) { frame_alloc = scratch.allocate_bytes(layout.frame_alloc_n, interpreter_frame_align); }
             else
-# endif
             {
-                frame_alloc = static_cast<::std::byte*>(UWVM_ALLOCA_BYTES(frame_alloc_n));
+                frame_alloc = static_cast<::std::byte*>(UWVM_ALLOCA_BYTES(layout.frame_alloc_n));
             }
+            // Later frames of a tail-call chain are rebuilt in this buffer while they fit.
+            auto frame_capacity{layout.frame_alloc_n};
 
-            // Allocate locals as a packed byte buffer (i32/f32=4, i64/f64=8, plus the internal temp local).
-            ::std::byte* const local_alloc{frame_alloc};
-            ::std::byte* local_base{};
-            if(align_wasm_locals_start)
-            {
-                // Align the start of the Wasm locals region (after params). This can improve bulk-zero performance on some libc `memset`s.
-                local_base = align_ptr_up(local_alloc + param_bytes, kFrameAlign) - param_bytes;
-            }
-            else
-            {
-                local_base = local_alloc;
-            }
+            auto& pending{call_stack.pending_tail_call};
+            ::std::byte const* args{caller_args_begin};
+            bool args_in_frame{};
+            ::std::byte* operand_base{};
+            ::std::byte operand_dummy{};
 
-            if(param_bytes > local_bytes_raw) [[unlikely]]
+            for(;;)
             {
+                // Allocate locals as a packed byte buffer (i32/f32=4, i64/f64=8, plus the internal temp local).
+                ::std::byte* const local_alloc{frame_alloc};
+                ::std::byte* local_base{};
+                if(layout.align_wasm_locals_start)
+                {
+                    // Align the start of the Wasm locals region (after params). This can improve bulk-zero performance on some libc `memset`s.
+                    local_base = align_ptr_up(local_alloc + param_bytes, interpreter_frame_align) - param_bytes;
+                }
+                else
+                {
+                    local_base = local_alloc;
+                }
+
+                if(param_bytes > layout.local_bytes_raw) [[unlikely]]
+                {
 # if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+                    ::uwvm2::utils::debug::trap_and_inform_bug_pos();
 # else
-                ::fast_io::fast_terminate();
+                    ::fast_io::fast_terminate();
 # endif
-            }
+                }
+
+                if(param_bytes != 0uz)
+                {
+                    // Tail-call arguments still sit in the operand stack of the frame being replaced, which may overlap the new locals.
+                    if(args_in_frame) { ::std::memmove(local_base, args, param_bytes); }
+                    else
+                    {
+                        copy_bytes_small(local_base, args, param_bytes);
+                    }
+                }
 
-            if(param_bytes != 0uz) { copy_bytes_small(local_base, caller_args_begin, param_bytes); }
+                // Wasm-visible locals (excluding params) are zero-initialized. The internal temp local (last 8 bytes) is not Wasm-visible and does
+                // not require initialization; avoiding a tiny `memset` per call saves a lot of overhead on call-heavy benchmarks.
+                if(layout.zero_n != 0uz) { zero_bytes_small(local_base + param_bytes, layout.zero_n); }
 
-            // Wasm-visible locals (excluding params) are zero-initialized. The internal temp local (last 8 bytes) is not Wasm-visible and does not
-            // require initialization; avoiding a tiny `memset` per call saves a lot of overhead on call-heavy benchmarks.
-            if(zero_n != 0uz) { zero_bytes_small(local_base + param_bytes, zero_n); }
+                // Operand stack with the exact max byte size computed by the compiler (byte-packed: i32/f32=4, i64/f64=8).
+                if(layout.stack_cap_raw == 0uz) [[unlikely]] { operand_base = ::std::addressof(operand_dummy); }
+                else
+                {
+                    operand_base = align_ptr_up(frame_alloc + layout.local_alloc_n, interpreter_frame_align);
+                }
 
-            // Allocate operand stack with the exact max byte size computed by the compiler (byte-packed: i32/f32=4, i64/f64=8).
 # if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-            if(stack_cap_raw == 0uz && compiled_func->operand_stack_max != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+                // Operand stack is fully defined by writes along interpreter execution; it does not require zero-initialization.
+                // Keep it zeroed only in detailed debug-check builds to catch any accidental reads of uninitialized operands.
+                ::std::memset(operand_base, 0, (layout.stack_cap_raw == 0uz ? 1uz : layout.stack_cap_raw));
 # endif
-            if(stack_cap_raw < result_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
 
-            ::std::byte* operand_base{};
-            ::std::byte operand_dummy{};
-            if(stack_cap_raw == 0uz) [[unlikely]] { operand_base = ::std::addressof(operand_dummy); }
-            else
-            {
-                operand_base = align_ptr_up(frame_alloc + local_alloc_n, kFrameAlign);
-            }
+                ::std::byte const* ip{compiled_func->op.operands.data()};
+                ::std::byte* stack_top{operand_base};
 
-# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-            // Operand stack is fully defined by writes along interpreter execution; it does not require zero-initialization.
-            // Keep it zeroed only in detailed debug-check builds to catch any accidental reads of uninitialized operands.
-            ::std::memset(operand_base, 0, (stack_cap_raw == 0uz ? 1uz : stack_cap_raw));
-# endif
+                constexpr auto curr_target_tranopt{get_curr_target_tranopt()};
 
-            ::std::byte const* ip{compiled_func->op.operands.data()};
-            ::std::byte* stack_top{operand_base};
+                if constexpr(curr_target_tranopt.is_tail_call)
+                {
+                    constexpr ::std::size_t tuple_size{
+                        ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::details::interpreter_tuple_size<curr_target_tranopt>()};
+                    execute_compiled_defined_tailcall_impl<curr_target_tranopt>(::std::make_index_sequence<tuple_size>{}, ip, stack_top, local_base);
+                }
+                else
+                {
+                    while(ip != nullptr) [[likely]]
+                    {
+                        opfunc_byref_t fn;  // no init
+                        ::std::memcpy(::std::addressof(fn), ip, sizeof(fn));
+                        fn(ip, stack_top, local_base);
+                    }
 
-            constexpr auto curr_target_tranopt{get_curr_target_tranopt()};
+                    auto const actual_result_bytes{static_cast<::std::size_t>(stack_top - operand_base)};
+                    if(actual_result_bytes != result_bytes && !pending.active) [[unlikely]] { ::fast_io::fast_terminate(); }
+                }
 
-            if constexpr(curr_target_tranopt.is_tail_call)
-            {
-                constexpr ::std::size_t tuple_size{
-                    ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::details::interpreter_tuple_size<curr_target_tranopt>()};
-                execute_compiled_defined_tailcall_impl<curr_target_tranopt>(::std::make_index_sequence<tuple_size>{}, ip, stack_top, local_base);
-            }
-            else
-            {
-                while(ip != nullptr) [[likely]]
+                if(!pending.active) [[likely]] { break; }
+
+                auto const next{resolve_frame_reusable_tail_call(pending)};
+                if(next == nullptr)
+                {
+                    // Imports, call_indirect misses and tiered targets go back to the entering bridge. The frame dies below, so its
+                    // arguments are copied out now and the caller stack stays at `caller_args_begin` until the bridge pushes the results.
+                    pending.args.clear();
+                    pending.args.resize(pending.frame_arg_bytes);
+                    if(pending.frame_arg_bytes != 0uz) { ::std::memcpy(pending.args.data(), pending.frame_args, pending.frame_arg_bytes); }
+                    pending.result_bytes = result_bytes;
+                    break;
+                }
+
+                // The callee replaces this function in place: validation proved the result types equal, and its arguments are the first
+                // `param_bytes` of the recorded operands (an indirect selector sits above them).
+                pending.active = false;
+                compiled_func = prepare_frame_reusable_tail_call_target(*next);
+                if(next->result_bytes != result_bytes || next->param_bytes > pending.frame_arg_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
+                param_bytes = next->param_bytes;
+                args = pending.frame_args;
+                args_in_frame = true;
+                call_stack.replace_top({.module_id = next->module_id, .function_index = next->function_index});
+
+                layout = get_interpreter_frame_layout(compiled_func, param_bytes, result_bytes);
+                if(layout.frame_alloc_n > frame_capacity)
                 {
-                    opfunc_byref_t fn;  // no init
-                    ::std::memcpy(::std::addressof(fn), ip, sizeof(fn));
-                    fn(ip, stack_top, local_base);
+                    // Grow into call scratch, releasing any earlier scratch frame first so a chain holds at most one. Released scratch
+                    // bytes are not touched by the allocator, so the arguments are still intact for the move above.
+                    if(use_scratch) { scratch.release(scratch_mark); }
+                    else
+                    {
+                        use_scratch = true;
+                        scratch_mark = scratch.mark();
+                    }
+                    frame_alloc = scratch.allocate_bytes(layout.frame_alloc_n, interpreter_frame_align);
+                    frame_capacity = layout.frame_alloc_n;
                 }
+            }
 
-                auto const actual_result_bytes{static_cast<::std::size_t>(stack_top - operand_base)};
-                if(actual_result_bytes != result_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
+            if(!pending.active) [[likely]]
+            {
+                // Append results back to caller stack.
+                copy_bytes_small(*caller_stack_top_ptr, operand_base, result_bytes);
+                *caller_stack_top_ptr += result_bytes;
             }
 
-            // Append results back to caller stack.
-            copy_bytes_small(*caller_stack_top_ptr, operand_base, result_bytes);
-            *caller_stack_top_ptr += result_bytes;
+            if(use_scratch) { scratch.release(scratch_mark); }
+        }
+
+        template <typename Dispatch>
+        inline constexpr void run_pending_tail_calls(call_stack_tls_state& call_stack, ::std::byte** stack_top_ptr, Dispatch&& dispatch) UWVM_THROWS
+        {
+            // Issue the tail calls left by the frame that just returned to this caller. Each hop starts from here after the previous
+            // frame is gone; the arguments are staged in call scratch sized for both the arguments and the results.
+            auto& pending{call_stack.pending_tail_call};
+            while(pending.active)
+            {
+                pending.active = false;
+
+                auto const arg_bytes{pending.args.size()};
+                auto const buffer_bytes{arg_bytes < pending.result_bytes ? pending.result_bytes : arg_bytes};
 
 # if defined(UWVM_USE_THREAD_LOCAL)
-            if(use_scratch) { g_call_scratch.release(scratch_mark); }
+                auto& scratch{g_call_scratch};
 # else
-            if(use_scratch) { get_call_scratch().release(scratch_mark); }
+                auto& scratch{get_call_scratch()};
 # endif
+                auto const scratch_mark{scratch.mark()};
+                auto const buffer{scratch.allocate_bytes(buffer_bytes)};
+                if(arg_bytes != 0uz) { ::std::memcpy(buffer, pending.args.data(), arg_bytes); }
+
+                ::std::byte* top{buffer + arg_bytes};
+                dispatch(pending.module_id, pending.callee, pending.table_index, ::std::addressof(top));
+
+                if(!pending.active)
+                {
+                    auto const produced_bytes{static_cast<::std::size_t>(top - buffer)};
+                    copy_bytes_small(*stack_top_ptr, buffer, produced_bytes);
+                    *stack_top_ptr += produced_bytes;
+                }
+
+                scratch.release(scratch_mark);
+            }
         }
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -7980,6 +9255,51 @@ namespace uwvm2::runtime::lib
         }
 # endif
 
+        [[nodiscard]] inline constexpr ::std::uint_least32_t uwvm_int_lazy_hot_tier_call_threshold() noexcept
+        {
+            // Tiered T0 bodies are reclaimed once T2 publishes and the tiered call path never consults the hot tier, so T0 keeps
+            // translating with the full pipeline.
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler ==
+               ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered)
+            {
+                return 0u;
+            }
+# endif
+            return ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_hot_tier_call_threshold;
+        }
+
+        [[nodiscard]] inline constexpr compiled_local_func_t const*
+            select_lazy_hot_tier_compiled_func(::std::size_t module_id, ::std::size_t function_index, compiled_local_func_t const* compiled_func) noexcept
+        {
+            // Runs after the demand gate. Baseline bodies count calls; the caller that crosses the threshold re-translates the function
+            // with the full pipeline on its own thread, and later calls dispatch into the published body. Frames already running the
+            // baseline body finish on it, which is why the baseline body is never freed or overwritten.
+            if(!g_runtime.lazy_compile_active) { return compiled_func; }
+
+            auto& rec{g_runtime.modules.index_unchecked(module_id)};
+            auto const local_index{function_index - rec.runtime_module->imported_function_vec_storage.size()};
+            auto& fn{rec.lazy_compiled.functions.index_unchecked(local_index)};
+
+            using hot_tier_phase = ::uwvm2::runtime::compiler::uwvm_int::compile_cu_from_lazy_validator::lazy_hot_tier_phase;
+            auto const phase{fn.hot_tier.phase.load(::std::memory_order_acquire)};
+            if(phase == hot_tier_phase::promoted) [[likely]] { return ::std::addressof(rec.lazy_compiled.hot_funcs.index_unchecked(local_index)); }
+            if(phase != hot_tier_phase::baseline) { return compiled_func; }
+
+            auto const calls{fn.hot_tier.call_count.fetch_add(1u, ::std::memory_order_relaxed) + 1u};
+            if(calls < rec.lazy_compile_options.hot_tier_call_threshold) { return compiled_func; }
+
+            auto const promoted{
+                ::uwvm2::runtime::compiler::uwvm_int::compile_cu_from_lazy_validator::promote_lazy_local_function<get_curr_target_tranopt()>(
+                    *rec.runtime_module,
+                    rec.lazy_compiled,
+                    rec.lazy_compile_options,
+                    local_index)};
+            if(promoted == nullptr) { return compiled_func; }
+            g_runtime.lazy_hot_tier_promotion_count.fetch_add(1uz, ::std::memory_order_relaxed);
+            return promoted;
+        }
+
 #endif
 
         // =========================================================================
@@ -8019,7 +9339,7 @@ namespace uwvm2::runtime::lib
             if(para_bytes != 0uz) { ::std::memcpy(parbuf, caller_args_begin, para_bytes); }
 
             auto& call_stack{get_call_stack()};
-            auto const caller_module_id{call_stack.frames.empty() ? preload_call_context_t::invalid_module_id : call_stack.frames.back().module_id};
+            auto const caller_module_id{call_stack.innermost_module_id_or(preload_call_context_t::invalid_module_id)};
             call_local_imported_with_wasip1_env(*m, tgt.index, resbuf, parbuf, caller_module_id);
 
             if(res_bytes != 0uz) { ::std::memcpy(*caller_stack_top_ptr, resbuf, res_bytes); }
@@ -8049,7 +9369,7 @@ namespace uwvm2::runtime::lib
             if(para_bytes != 0uz) { ::std::memcpy(parbuf, caller_args_begin, para_bytes); }
 
             auto& call_stack{get_call_stack()};
-            auto const caller_module_id{call_stack.frames.empty() ? preload_call_context_t::invalid_module_id : call_stack.frames.back().module_id};
+            auto const caller_module_id{call_stack.innermost_module_id_or(preload_call_context_t::invalid_module_id)};
             call_capi_with_wasip1_env(*f, preload_module_memory_attribute, resbuf, parbuf, caller_module_id);
 
             if(res_bytes != 0uz) { ::std::memcpy(*caller_stack_top_ptr, resbuf, res_bytes); }
@@ -8490,6 +9810,7 @@ namespace uwvm2::runtime::lib
             // Normal interpreter execution path: materialize the function lazily when needed, then run the compiled interpreter body.
             if(runtime_func == nullptr || compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
             ensure_lazy_defined_function_compiled(module_id, function_index);
+            compiled_func = select_lazy_hot_tier_compiled_func(module_id, function_index, compiled_func);
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, stack_top_ptr);
         }
 
@@ -8536,6 +9857,15 @@ namespace uwvm2::runtime::lib
             }
             if(compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
             if(try_execute_tiered_llvm_jit_defined_from_stack_active(module_id, function_index, param_bytes, result_bytes, stack_top_ptr)) { return; }
+            if(tiered_t0_code_reclaimed(module_id, function_index)) [[unlikely]]
+            {
+                // The T0 bytecode was freed after T2 publication; T2 is the only tier left for this function.
+                if(!invoke_tiered_llvm_jit_defined_from_stack_sync(module_id, function_index, param_bytes, result_bytes, stack_top_ptr)) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+                return;
+            }
             record_tiered_interpreter_entry(module_id, function_index);
             ensure_tiered_lazy_defined_function_compiled(module_id, function_index);
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, stack_top_ptr);
@@ -8621,6 +9951,27 @@ namespace uwvm2::runtime::lib
                 ::fast_io::fast_terminate();
             }
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            if constexpr(UseTieredEnsure)
+            {
+                if(tiered_t0_code_reclaimed(frame.module_id, frame.function_index)) [[unlikely]]
+                {
+                    // Freed T0 bytecode: enter T2 directly with the caller's buffers.
+                    if(!try_invoke_runtime_llvm_jit_raw_defined_entry(frame.module_id,
+                                                                      frame.function_index,
+                                                                      result_buffer,
+                                                                      result_bytes,
+                                                                      param_buffer,
+                                                                      param_bytes,
+                                                                      true)) [[unlikely]]
+                    {
+                        ::fast_io::fast_terminate();
+                    }
+                    return;
+                }
+            }
+# endif
+
             auto const stack_bytes{param_bytes < result_bytes ? result_bytes : param_bytes};
             heap_buf_guard host_stack_guard{};
             ::std::byte* host_stack_base{};
@@ -8636,9 +9987,25 @@ namespace uwvm2::runtime::lib
 # endif
             {
                 ensure_lazy_defined_function_compiled(frame.module_id, frame.function_index);
+                compiled_func = select_lazy_hot_tier_compiled_func(frame.module_id, frame.function_index, compiled_func);
             }
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, ::std::addressof(stack_top_ptr));
 
+            if(call_stack.pending_tail_call.active) [[unlikely]]
+            {
+                // Hand the first hop to the configured interpreter bridge; bridges drain any further tail calls themselves.
+                run_pending_tail_calls(call_stack,
+                                       ::std::addressof(stack_top_ptr),
+                                       [](::std::size_t module_id, ::std::size_t callee, ::std::size_t table_index, ::std::byte** top_ptr) constexpr UWVM_THROWS
+                                       {
+                                           if(table_index == SIZE_MAX) { ::uwvm2::runtime::compiler::uwvm_int::optable::call_func(module_id, callee, top_ptr); }
+                                           else
+                                           {
+                                               ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_func(module_id, callee, table_index, top_ptr);
+                                           }
+                                       });
+            }
+
             if(result_bytes != 0uz) { ::std::memcpy(result_buffer, host_stack_base, result_bytes); }
         }
 
@@ -8885,6 +10252,11 @@ namespace uwvm2::runtime::lib
                     ::fast_io::fast_terminate();
                 }
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+                // Import calls from generated code are reclamation safepoints; the scan sees the calling JIT frames.
+                if(tiered_runtime_active()) { tiered_reclaim_safepoint(); }
+#endif
+
                 auto& call_stack{get_call_stack()};
 
                 switch(tgt->k)
@@ -9064,6 +10436,62 @@ namespace uwvm2::runtime::lib
             return ::std::addressof(module.local_defined_table_vec_storage.index_unchecked(local_index));
         }
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+        [[nodiscard]] inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*
+            resolve_frame_reusable_tail_call(call_stack_tls_state::pending_tail_call_t const& pending) noexcept
+        {
+            // Interpreted wasm callees reuse the returning frame. Everything else (imports, tables whose slot is not a flat hit, traps)
+            // returns null and is left to the bridge, which performs the full call and reports traps exactly like `call_indirect`.
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            // Tiered T0 frames go back to the tier-aware bridge, which may enter a ready LLVM entry for the callee instead.
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler ==
+               ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered)
+            {
+                return nullptr;
+            }
+# endif
+            using call_info_t = ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info;
+
+            if(pending.table_index == SIZE_MAX)
+            {
+                // SIZE_MAX marks a pre-resolved call-info pointer, exactly as for `call`; other encodings are imports.
+                if(pending.module_id != SIZE_MAX) { return nullptr; }
+                return reinterpret_cast<call_info_t const*>(pending.callee);
+            }
+
+            if(pending.module_id >= g_runtime.modules.size()) [[unlikely]] { return nullptr; }
+            auto const& module_rec{g_runtime.modules.index_unchecked(pending.module_id)};
+            if(pending.callee >= module_rec.type_sig_id.size()) [[unlikely]] { return nullptr; }
+            auto const expected_sig_id{module_rec.type_sig_id.index_unchecked(pending.callee)};
+            if(expected_sig_id == 0u) [[unlikely]] { return nullptr; }
+
+            auto const table{resolve_table(*module_rec.runtime_module, pending.table_index)};
+            if(table == nullptr) [[unlikely]] { return nullptr; }
+
+            // The i32 selector is the top recorded operand.
+            if(pending.frame_arg_bytes < sizeof(wasm_i32)) [[unlikely]] { ::fast_io::fast_terminate(); }
+            wasm_i32 selector_i32;  // no init
+            ::std::memcpy(::std::addressof(selector_i32), pending.frame_args + (pending.frame_arg_bytes - sizeof(selector_i32)), sizeof(selector_i32));
+            auto const selector_u32{::std::bit_cast<::std::uint_least32_t>(selector_i32)};
+            if(selector_u32 >= table->elems.size()) { return nullptr; }
+
+            // Same flat entry as call_indirect. It is only written together with the slot, so a matching id always comes with its
+            // target.
+            auto const& elem{table->elems.index_unchecked(static_cast<::std::size_t>(selector_u32))};
+            if(elem.call_sig_id != expected_sig_id) { return nullptr; }
+            return static_cast<call_info_t const*>(elem.call_target);
+        }
+
+        [[nodiscard]] inline constexpr compiled_local_func_t const*
+            prepare_frame_reusable_tail_call_target(::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info) noexcept
+        {
+            // Same demand path as `execute_defined_with_optional_tiered_jit`: materialize a lazy body, then pick the hot tier if published.
+            if(info.runtime_func == nullptr || info.compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+            ensure_lazy_defined_function_compiled(info.module_id, info.function_index);
+            return select_lazy_hot_tier_compiled_func(info.module_id, info.function_index, info.compiled_func);
+        }
+#endif
+
         [[maybe_unused]] [[nodiscard]] inline constexpr func_sig_view
             expected_sig_from_type_index(runtime_module_storage_t const& module, ::std::size_t type_index, bool& ok) noexcept
         {
@@ -9087,15 +10515,110 @@ namespace uwvm2::runtime::lib
         {
             if(runtime_module_ptr == nullptr) [[unlikely]] { return ::std::numeric_limits<::std::size_t>::max(); }
 
-            for(::std::size_t module_id{}; module_id != g_runtime.modules.size(); ++module_id)
+            auto const it{g_runtime.runtime_module_to_id.find(runtime_module_ptr)};
+            return it == g_runtime.runtime_module_to_id.end() ? ::std::numeric_limits<::std::size_t>::max() : it->second;
+        }
+
+#if defined(UWVM_RUNTIME_LLVM_JIT) && !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
+        template <typename... Rs>
+        struct llvm_jit_wasip1_direct_result
+        {
+            using type = void;
+        };
+
+        template <typename R>
+        struct llvm_jit_wasip1_direct_result<R>
+        {
+            using type = R;
+        };
+
+        template <typename Wrapper,
+                  typename ResTuple = typename Wrapper::local_imported_function_type::result_type,
+                  typename ParaTuple = typename Wrapper::local_imported_function_type::parameter_type>
+        struct llvm_jit_wasip1_direct_thunk;
+
+        // Typed WASI Preview1 entry called directly from LLVM-generated code. The call site passes the caller module address followed
+        // by the Wasm scalars in import order, so the thunk only selects the caller's WASI environment and forwards to the wrapper: no
+        // raw argument buffers, no byte copies and no import-cache lookup.
+        template <typename Wrapper, typename... Rs, typename... Ps>
+        struct llvm_jit_wasip1_direct_thunk<Wrapper, ::uwvm2::utils::container::tuple<Rs...>, ::uwvm2::utils::container::tuple<Ps...>>
+        {
+            static_assert(sizeof...(Rs) <= 1uz, "WASI Preview1 functions return at most one value");
+
+            using result_type = typename llvm_jit_wasip1_direct_result<Rs...>::type;
+
+            inline static result_type call(::std::uintptr_t runtime_module_address, Ps... params) noexcept
             {
-                if(g_runtime.modules.index_unchecked(module_id).runtime_module == runtime_module_ptr) { return module_id; }
+                // Generated code only runs after its module set was compiled, so the module-identity table is already populated.
+                auto const caller_module_id{
+                    find_runtime_module_id_from_storage_ptr(reinterpret_cast<runtime_module_storage_t const*>(runtime_module_address))};
+                if(caller_module_id == ::std::numeric_limits<::std::size_t>::max()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+                typename Wrapper::local_imported_function_type func_type{.params{params...}};
+                invoke_with_caller_wasip1_env(caller_module_id, [&]() constexpr noexcept { Wrapper::call(func_type); });
+
+                if constexpr(sizeof...(Rs) != 0uz) { return ::uwvm2::utils::container::get<0>(func_type.res); }
             }
+        };
 
-            return ::std::numeric_limits<::std::size_t>::max();
-        }
+        // One entry per element of the WASI Preview1 local-imported function tuple, so the local-imported function index addresses
+        // the table directly.
+        template <typename FunctionTuple>
+        struct llvm_jit_wasip1_direct_entry_table;
+
+        template <typename... Wrappers>
+        struct llvm_jit_wasip1_direct_entry_table<::uwvm2::utils::container::tuple<Wrappers...>>
+        {
+            inline static llvm_jit_wasip1_direct_host_entry_t const entries[]{
+                {.entry_address = reinterpret_cast<::std::uintptr_t>(&llvm_jit_wasip1_direct_thunk<Wrappers>::call),
+                 .function_name = Wrappers::function_name,
+                 .parameter_count = Wrappers::base_type::parameter_count,
+                 .result_count = ::std::is_void_v<typename Wrappers::base_type::ret_type> ? 0uz : 1uz}
+                ...};
+        };
+
+        using llvm_jit_wasip1_direct_entries_t = llvm_jit_wasip1_direct_entry_table<
+            typename ::uwvm2::uwvm::imported::wasi::wasip1::local_imported::wasip1_local_imported_module_t::local_function_tuple>;
+#endif
 
 #if defined(UWVM_RUNTIME_LLVM_JIT)
+        inline constexpr void populate_llvm_jit_cross_module_import_entries() noexcept
+        {
+            // Full-mode modules are materialized one by one, so an import linked to another module's defined function cannot name the
+            // callee's typed entry. Publish it into the caller's slot once every module is materialized; an empty slot keeps the raw bridge.
+            for(::std::size_t caller_module_id{}; caller_module_id != g_runtime.modules.size(); ++caller_module_id)
+            {
+                auto& slots{g_runtime.modules.index_unchecked(caller_module_id).llvm_jit_cross_module_import_entries};
+                if(slots.empty()) { continue; }
+                if(caller_module_id >= g_import_call_cache.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+                auto const& cache{g_import_call_cache.index_unchecked(caller_module_id)};
+                if(slots.size() != cache.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+                for(::std::size_t import_index{}; import_index != slots.size(); ++import_index)
+                {
+                    auto& slot{slots.index_unchecked(import_index)};
+                    slot = 0u;
+
+                    // `--runtime-disable-cross-module-direct-call` leaves every slot empty.
+                    if(::uwvm2::uwvm::runtime::runtime_mode::runtime_disable_cross_module_direct_call) { continue; }
+
+                    auto const& tgt{cache.index_unchecked(import_index)};
+                    if(tgt.k != cached_import_target::kind::defined || tgt.frame.module_id == caller_module_id) { continue; }
+                    if(tgt.frame.module_id >= g_runtime.modules.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+                    auto const& callee_rec{g_runtime.modules.index_unchecked(tgt.frame.module_id)};
+                    if(!callee_rec.llvm_jit_ready) { continue; }
+                    auto const callee_import_n{callee_rec.runtime_module->imported_function_vec_storage.size()};
+                    if(tgt.frame.function_index < callee_import_n) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    auto const local_index{tgt.frame.function_index - callee_import_n};
+                    if(local_index < callee_rec.llvm_jit_local_entry_addresses.size())
+                    {
+                        slot = callee_rec.llvm_jit_local_entry_addresses.index_unchecked(local_index);
+                    }
+                }
+            }
+        }
+
         inline constexpr void populate_llvm_jit_call_indirect_table_views() noexcept
         {
             // LLVM call_indirect lowers through compact table-view arrays. They are rebuilt after initialization/materialization so
@@ -9405,6 +10928,19 @@ namespace uwvm2::runtime::lib
                 static_cast<llvm_jit_translate_details::validation_module_traits_t::wasm_u32>(func_index));
         }
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        [[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string get_runtime_llvm_jit_wasm_tiered_loop_reentry_raw_function_name(
+            runtime_module_storage_t const& runtime_module, ::std::size_t func_index, ::std::size_t wasm_code_offset) noexcept
+        {
+            // Loop reentry symbols use the same raw ABI; the Wasm byte offset of the loop header distinguishes them.
+            namespace llvm_jit_translate_details = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::details;
+            return llvm_jit_translate_details::get_llvm_wasm_tiered_loop_reentry_raw_function_name(
+                runtime_module,
+                static_cast<llvm_jit_translate_details::validation_module_traits_t::wasm_u32>(func_index),
+                wasm_code_offset);
+        }
+# endif
+
         template <typename ValueType>
         [[nodiscard]] inline constexpr bool
             runtime_llvm_jit_cache_range_bytes(ValueType const* begin, ValueType const* end, ::std::byte const*& first, ::std::size_t& size) noexcept
@@ -9625,19 +11161,20 @@ namespace uwvm2::runtime::lib
             store_runtime_llvm_jit_parallel_object_cache(::uwvm2::runtime::llvm_jit_cache::cache_context const& base_context,
                                                          ::uwvm2::runtime::llvm_jit_cache::cache_policy const& cache_policy,
                                                          ::uwvm2::utils::container::u8string_view module_name,
-                                                         ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string> const& object_outputs) noexcept
+                                                         ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string>&& object_outputs) noexcept
         {
             if(!cache_policy.enable) { return; }
 
+            // The object strings move into the store queue: the engine already holds its own copies, and blob construction happens on
+            // the store worker, so this loop costs neither a copy nor compression time on the materialization thread.
             auto const object_count{object_outputs.size()};
             for(::std::size_t object_index{}; object_index != object_count; ++object_index)
             {
                 auto object_context{runtime_llvm_jit_parallel_object_cache_context(base_context, object_count, object_index)};
-                auto const& object_output{object_outputs.index_unchecked(object_index)};
-                auto const first{reinterpret_cast<::std::byte const*>(object_output.cbegin())};
+                auto& object_output{object_outputs.index_unchecked(object_index)};
+                auto const object_bytes{object_output.size()};
                 auto const status{::uwvm2::runtime::llvm_jit_cache::store_object_async(object_context,
-                                                                                       first,
-                                                                                       object_output.size(),
+                                                                                       ::std::move(object_output),
                                                                                        cache_policy,
                                                                                        module_name,
                                                                                        true,
@@ -9648,7 +11185,7 @@ namespace uwvm2::runtime::lib
                                                                                   u8"\" status=",
                                                                                   ::uwvm2::runtime::llvm_jit_cache::cache_status_name(status),
                                                                                   u8" bytes=",
-                                                                                  object_output.size(),
+                                                                                  object_bytes,
                                                                                   u8" object_index=",
                                                                                   object_index,
                                                                                   u8" object_count=",
@@ -10557,6 +12094,9 @@ namespace uwvm2::runtime::lib
             // while this materialization attempt is still in progress.
             rec.llvm_jit_local_entry_addresses.clear();
             rec.llvm_jit_local_raw_entry_addresses.clear();
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            rec.tiered_full_loop_reentry_raw_entry_addresses.clear();
+# endif
             rec.llvm_jit_engine.reset();
             rec.llvm_jit_context_holder.reset();
 
@@ -10648,6 +12188,9 @@ namespace uwvm2::runtime::lib
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_key, u8"module", rec.module_name);
             auto full_module_wasm_hash{runtime_llvm_jit_full_module_cache_fingerprint(*runtime_module)};
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_key, u8"module-wasm-hash", full_module_wasm_hash);
+            // Tiered T2 code carries loop reentry wrappers that `-Rcm full` code does not; both must never share a cache entry.
+            auto const tiered_loop_reentry_policy{rec.llvm_jit_compiled.tiered_loop_reentry_entries ? u8"on" : u8"off"};
+            ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_key, u8"tiered-loop-reentry", tiered_loop_reentry_policy);
             auto llvm_jit_cache_codegen_policy{::uwvm2::runtime::llvm_jit_cache::details::make_cache_key(u8"codegen-policy")};
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy, u8"cache-unit", u8"full");
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
@@ -10660,6 +12203,12 @@ namespace uwvm2::runtime::lib
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
                                                                               u8"call-stack",
                                                                               get_runtime_llvm_jit_call_stack_mode_name());
+            ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                              u8"wasip1-direct",
+                                                                              llvm_jit_wasip1_direct_calls_enabled() ? u8"on" : u8"off");
+            ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                              u8"tiered-loop-reentry",
+                                                                              tiered_loop_reentry_policy);
             append_runtime_llvm_jit_native_target_codegen_policy(llvm_jit_cache_codegen_policy, host_cpu_name, host_tune_cpu_name);
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_key.data(), llvm_jit_cache_key.size()},
@@ -10671,6 +12220,8 @@ namespace uwvm2::runtime::lib
             ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string> parallel_object_outputs{};
             ::std::size_t parallel_object_defined_function_count{};
             bool use_parallel_objects{};
+            // Freshly emitted objects are handed to the cache only after they are loaded, so the strings can be moved instead of copied.
+            bool store_parallel_objects{};
             if(extra_materialize_threads != 0uz)
             {
                 ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string> parallel_function_names{};
@@ -10780,9 +12331,9 @@ namespace uwvm2::runtime::lib
                 if(object_emit_result == runtime_llvm_jit_parallel_object_emit_result::success)
                 {
                     use_parallel_objects = true;
+                    store_parallel_objects = true;
                     ::std::size_t object_bytes{};
                     for(auto const& object_output: parallel_object_outputs) { object_bytes += object_output.size(); }
-                    store_runtime_llvm_jit_parallel_object_cache(llvm_jit_cache_context, llvm_jit_cache_policy, rec.module_name, parallel_object_outputs);
                     llvm_jit_materialize_runtime_log_line(u8"object-emit-end module=\"",
                                                           rec.module_name,
                                                           u8"\" functions=",
@@ -10922,6 +12473,14 @@ namespace uwvm2::runtime::lib
                                                       rec.module_name,
                                                       u8"\" time=",
                                                       llvm_jit_materialize_runtime_log_now() - object_load_start_time);
+
+                if(store_parallel_objects)
+                {
+                    store_runtime_llvm_jit_parallel_object_cache(llvm_jit_cache_context,
+                                                                 llvm_jit_cache_policy,
+                                                                 rec.module_name,
+                                                                 ::std::move(parallel_object_outputs));
+                }
             }
             auto const finalize_start_time{llvm_jit_materialize_runtime_log_now()};
             llvm_jit_materialize_runtime_log_line(u8"finalize-object-start module=\"", rec.module_name, u8"\"");
@@ -10937,6 +12496,9 @@ namespace uwvm2::runtime::lib
             auto const import_func_count{runtime_module->imported_function_vec_storage.size()};
             rec.llvm_jit_local_entry_addresses.resize(local_func_count);
             rec.llvm_jit_local_raw_entry_addresses.resize(local_func_count);
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            rec.tiered_full_loop_reentry_raw_entry_addresses.resize(local_func_count);
+# endif
             for(::std::size_t local_index{}; local_index != local_func_count; ++local_index)
             {
                 // Resolve and publish both typed wasm entries and raw buffer entries for every local function.
@@ -10994,9 +12556,32 @@ namespace uwvm2::runtime::lib
 
                 if(materialized_module_id != ::std::numeric_limits<::std::size_t>::max())
                 {
-                    record_llvm_jit_unwind_entry(materialized_module_id, function_index, function_address, false);
-                    record_llvm_jit_unwind_entry(materialized_module_id, function_index, raw_function_address, true);
+                    record_llvm_jit_unwind_entry(materialized_module_id, function_index, function_address, false);
+                    record_llvm_jit_unwind_entry(materialized_module_id, function_index, raw_function_address, true);
+                }
+
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+                if(local_index < rec.llvm_jit_compiled.local_funcs.size())
+                {
+                    // Loop reentry wrappers exist only when the compile asked for them (tiered T2); resolve them with the entries so
+                    // loop OSR never has to look up symbols on the interpreter thread.
+                    auto const& reentries{rec.llvm_jit_compiled.local_funcs.index_unchecked(local_index).tiered_loop_reentries};
+                    auto& reentry_addresses{rec.tiered_full_loop_reentry_raw_entry_addresses.index_unchecked(local_index)};
+                    reentry_addresses.reserve(reentries.size());
+                    for(auto const& reentry: reentries)
+                    {
+                        auto const reentry_function_name{
+                            get_runtime_llvm_jit_wasm_tiered_loop_reentry_raw_function_name(*runtime_module, function_index, reentry.wasm_code_offset)};
+                        auto const reentry_address{resolve_function_address(reentry_function_name)};
+                        if(reentry_address == 0u) [[unlikely]] { return false; }
+                        reentry_addresses.push_back(reentry_address);
+                        if(materialized_module_id != ::std::numeric_limits<::std::size_t>::max())
+                        {
+                            record_llvm_jit_unwind_entry(materialized_module_id, function_index, reentry_address, true);
+                        }
+                    }
                 }
+# endif
             }
 
             rec.llvm_jit_context_holder = ::std::move(llvm_context_holder);
@@ -11128,6 +12713,10 @@ namespace uwvm2::runtime::lib
 
             if(func_index < import_n)
             {
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+                // Host import calls are reclamation safepoints for interpreted guest code.
+                if constexpr(TryTieredJit) { tiered_reclaim_safepoint(); }
+# endif
                 // Import call sites are resolved through a cache built at runtime initialization, avoiding repeated alias chasing and
                 // giving native/preload imports the caller module context they need.
                 if(wasm_module_id >= g_import_call_cache.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -11184,11 +12773,65 @@ namespace uwvm2::runtime::lib
             execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
         }
 
+        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void flatten_table_elem(runtime_table_elem_storage_t& elem) noexcept
+        {
+            // Only defined functions with an interpreter call record get a flat entry; everything else keeps the checked path. Runs at
+            // instantiation and, through `table_elem_flatten_func`, on the thread executing a table write before the slot is stored;
+            // call_indirect and tail calls never write the entry.
+            elem.call_sig_id = 0u;
+            elem.call_target = nullptr;
+            if(elem.type != ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_defined) { return; }
+
+            auto const info{find_defined_func_info(elem.storage.defined_ptr)};
+            if(info == nullptr || info->compiled_call_info == nullptr) { return; }
+
+            auto const sig_id{canonical_sig_id_of_defined(*info)};
+            if(sig_id == 0u) [[unlikely]] { return; }
+
+            elem.call_target = info->compiled_call_info;
+            elem.call_sig_id = sig_id;
+        }
+
+        inline constexpr void flatten_runtime_call_indirect_tables() noexcept
+        {
+            // Element initialization has already run; flatten every slot once so the first call_indirect through it is a hit.
+            for(auto& [module_name, rt]: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage)
+            {
+                for(auto& table: rt.local_defined_table_vec_storage)
+                {
+                    for(auto& elem: table.elems) { flatten_table_elem(elem); }
+                }
+            }
+        }
+
+        template <bool TryTieredJit>
+        inline constexpr void call_indirect_bridge_impl(::std::size_t wasm_module_id,
+                                                        ::std::size_t type_index,
+                                                        ::std::size_t table_index,
+                                                        ::std::byte** stack_top_ptr) UWVM_THROWS;
+
+        template <bool TryTieredJit>
+        UWVM_GNU_COLD inline constexpr void drain_pending_tail_calls(::std::byte** stack_top_ptr) UWVM_THROWS
+        {
+            // Bridges dispatch every hop through the non-draining impls, so the whole chain runs from this one loop.
+            run_pending_tail_calls(get_call_stack(),
+                                   stack_top_ptr,
+                                   [](::std::size_t module_id, ::std::size_t callee, ::std::size_t table_index, ::std::byte** top_ptr) constexpr UWVM_THROWS
+                                   {
+                                       if(table_index == SIZE_MAX) { call_bridge_impl<TryTieredJit>(module_id, callee, top_ptr); }
+                                       else
+                                       {
+                                           call_indirect_bridge_impl<TryTieredJit>(module_id, callee, table_index, top_ptr);
+                                       }
+                                   });
+        }
+
         UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void
             call_bridge(::std::size_t wasm_module_id, ::std::size_t func_index, ::std::byte** stack_top_ptr) UWVM_THROWS
         {
             // Standard interpreter direct-call callback; it can still use ready LLVM entries when the generic optional path allows it.
             call_bridge_impl<false>(wasm_module_id, func_index, stack_top_ptr);
+            if(get_call_stack().pending_tail_call.active) [[unlikely]] { drain_pending_tail_calls<false>(stack_top_ptr); }
         }
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -11197,6 +12840,7 @@ namespace uwvm2::runtime::lib
         {
             // Tier-aware direct-call callback gives every interpreter call boundary a chance to promote into LLVM.
             call_bridge_impl<true>(wasm_module_id, func_index, stack_top_ptr);
+            if(get_call_stack().pending_tail_call.active) [[unlikely]] { drain_pending_tail_calls<true>(stack_top_ptr); }
         }
 # endif
 
@@ -11228,6 +12872,22 @@ namespace uwvm2::runtime::lib
 
             auto const& elem{table->elems.index_unchecked(static_cast<::std::size_t>(selector_u32))};
 
+            // Flat entry: process-wide signature ids make the wasm type check a single compare, and the slot already holds the callee's
+            // call record, so a hit goes straight into the frame. Table writers refill the entry with the slot, so id 0 only marks
+            // slots without a flat entry (null, imported, or no interpreter call record).
+            if(type_index < module_rec.type_sig_id.size()) [[likely]]
+            {
+                auto const expected_sig_id{module_rec.type_sig_id.index_unchecked(type_index)};
+                if(elem.call_sig_id == expected_sig_id && expected_sig_id != 0u) [[likely]]
+                {
+                    auto const& info{*static_cast<::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*>(elem.call_target)};
+                    if(try_execute_trivial_defined_call(info, stack_top_ptr)) { return; }
+                    call_stack_guard g{call_stack, info.module_id, info.function_index};
+                    execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+                    return;
+                }
+            }
+
             // The expected signature is taken from the caller module's type section, as required by the wasm call_indirect operand.
             auto const type_begin{module.type_section_storage.type_section_begin};
             auto const type_end{module.type_section_storage.type_section_end};
@@ -11512,6 +13172,7 @@ namespace uwvm2::runtime::lib
         {
             // Standard interpreter call_indirect callback with wasm table/type checks and optional backend dispatch.
             call_indirect_bridge_impl<false>(wasm_module_id, type_index, table_index, stack_top_ptr);
+            if(get_call_stack().pending_tail_call.active) [[unlikely]] { drain_pending_tail_calls<false>(stack_top_ptr); }
         }
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -11522,13 +13183,35 @@ namespace uwvm2::runtime::lib
         {
             // Tier-aware indirect-call callback keeps wasm validation checks identical while allowing ready generated targets.
             call_indirect_bridge_impl<true>(wasm_module_id, type_index, table_index, stack_top_ptr);
+            if(get_call_stack().pending_tail_call.active) [[unlikely]] { drain_pending_tail_calls<true>(stack_top_ptr); }
         }
 # endif
 
+        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void tail_call_bridge(::std::size_t wasm_module_id,
+                                                                                            ::std::size_t callee,
+                                                                                            ::std::size_t table_index,
+                                                                                            ::std::byte const* args,
+                                                                                            ::std::size_t arg_bytes) noexcept
+        {
+            // `return_call` opfuncs only record the call. The operands stay in the returning frame, which `execute_compiled_defined`
+            // either rebuilds for the callee or copies them out of before it is released.
+            auto& pending{get_call_stack().pending_tail_call};
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(pending.active) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+# endif
+            pending.module_id = wasm_module_id;
+            pending.callee = callee;
+            pending.table_index = table_index;
+            pending.frame_args = args;
+            pending.frame_arg_bytes = arg_bytes;
+            pending.active = true;
+        }
+
         inline constexpr void configure_interpreter_call_bridges_for_current_runtime() noexcept
         {
             // Bridge function pointers live in the interpreter optable and may be observed by already-compiled opfuncs. Reconfigure
             // them whenever the runtime mode changes so tiered T0 can switch call boundaries to the tier-aware callbacks.
+            ::uwvm2::runtime::compiler::uwvm_int::optable::tail_call_func = tail_call_bridge;
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler ==
                    ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered &&
@@ -11572,6 +13255,7 @@ namespace uwvm2::runtime::lib
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_integer_overflow_func = trap_integer_overflow;
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_table_out_of_bounds_func = trap_table_out_of_bounds;
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_memory_out_of_bounds_func = trap_memory_out_of_bounds;
+                ::uwvm2::runtime::compiler::uwvm_int::optable::table_elem_flatten_func = flatten_table_elem;
 
 # if defined(UWVM_RUNTIME_LLVM_JIT) && defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
                 ::uwvm2::runtime::compiler::uwvm_int::optable::tiered_loop_osr_func = tiered_try_enter_loop_osr;
@@ -11953,12 +13637,18 @@ namespace uwvm2::runtime::lib
             g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.lazy_hot_tier_promotion_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
 # endif
             g_runtime.modules.clear();
             g_runtime.module_name_to_id.clear();
+            g_runtime.runtime_module_to_id.clear();
             g_runtime.defined_func_cache.clear();
             g_runtime.defined_func_ptr_ranges.clear();
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            g_runtime.cross_module_call_info.clear();
+# endif
+            g_runtime.canonical_sig_ids.clear();
             g_import_call_cache.clear();
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             g_wasip1_runtime_module_context_cache.clear();
@@ -11967,6 +13657,7 @@ namespace uwvm2::runtime::lib
             auto const& rt_map{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage};
             g_runtime.modules.reserve(rt_map.size());
             g_runtime.module_name_to_id.reserve(rt_map.size());
+            g_runtime.runtime_module_to_id.reserve(rt_map.size());
 
             // Module ids are dense indices into g_runtime.modules. They are also embedded into generated code and diagnostics, so the
             // name-to-id map is built before any backend emits per-module artifacts.
@@ -11974,6 +13665,7 @@ namespace uwvm2::runtime::lib
             for(auto const& kv: rt_map)
             {
                 g_runtime.module_name_to_id.emplace(kv.first, id);
+                g_runtime.runtime_module_to_id.emplace(::std::addressof(kv.second), id);
                 compiled_module_record rec{};
                 rec.module_name = kv.first;
                 rec.runtime_module = ::std::addressof(kv.second);
@@ -11982,6 +13674,9 @@ namespace uwvm2::runtime::lib
             }
 
             g_runtime.defined_func_cache.resize(g_runtime.modules.size());
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            reset_cross_module_call_info_slots();
+# endif
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             rebuild_wasip1_runtime_module_context_cache();
 # endif
@@ -12036,6 +13731,7 @@ namespace uwvm2::runtime::lib
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
                 ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option opt{};
                 opt.curr_wasm_id = module_id;
+                opt.resolve_cross_module_call_info = resolve_cross_module_call_info;
                 // First resolve the split size against the actual module before deciding how many worker threads are worthwhile.
                 auto const thread_resolution_compile_task_split_conf{
                     ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::resolve_effective_compile_task_split_config(*rec.runtime_module,
@@ -12246,6 +13942,11 @@ namespace uwvm2::runtime::lib
                         llvm_jit_opt.curr_wasm_id = module_id;
                         llvm_jit_opt.verify_llvm_jit_ir = !::uwvm2::uwvm::runtime::runtime_mode::runtime_llvm_jit_disable_ir_verifaction;
                         configure_runtime_llvm_jit_call_stack_policy(llvm_jit_opt);
+                        rec.llvm_jit_cross_module_import_entries.clear();
+                        rec.llvm_jit_cross_module_import_entries.resize(rec.runtime_module->imported_function_vec_storage.size());
+                        llvm_jit_opt.cross_module_import_entry_base_address =
+                            reinterpret_cast<::std::uintptr_t>(rec.llvm_jit_cross_module_import_entries.data());
+                        llvm_jit_opt.cross_module_import_entry_count = rec.llvm_jit_cross_module_import_entries.size();
                         runtime_llvm_jit_legacy_light_task_preopt_context legacy_light_task_preopt_context{};
                         bool legacy_light_task_preopt_enabled{};
                         if(effective_module_extra_compile_threads != 0uz)
@@ -12317,6 +14018,7 @@ namespace uwvm2::runtime::lib
 # endif
 
                 rec.type_canon_index = build_type_canon_index(*rec.runtime_module);
+                assign_canonical_sig_ids(rec);
 
                 auto const local_n{rec.runtime_module->local_defined_function_vec_storage.size()};
                 // Backend artifacts must match the local function count exactly; mismatches indicate translator/runtime cache drift.
@@ -12456,6 +14158,9 @@ namespace uwvm2::runtime::lib
             // Import-cache publication is separated from module translation because imported functions can target modules that appear
             // later in the runtime storage map. Waiting until every defined-function cache is built lets all import aliases resolve to
             // final backend-neutral call records.
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            publish_cross_module_call_info();
+# endif
             g_import_call_cache.resize(g_runtime.modules.size());
             for(::std::size_t mid{}; mid != g_runtime.modules.size(); ++mid)
             {
@@ -12571,6 +14276,7 @@ namespace uwvm2::runtime::lib
             }
 
 # if defined(UWVM_RUNTIME_LLVM_JIT)
+            populate_llvm_jit_cross_module_import_entries();
             populate_llvm_jit_call_indirect_table_views();
 # endif
 
@@ -12622,6 +14328,9 @@ namespace uwvm2::runtime::lib
                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
             }
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            flatten_runtime_call_indirect_tables();
+# endif
             g_runtime.compiled_all.store(true, ::std::memory_order_release);
             compile_lock.clear(::std::memory_order_release);
 #endif
@@ -12675,11 +14384,15 @@ namespace uwvm2::runtime::lib
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
             g_runtime.modules.clear();
             g_runtime.module_name_to_id.clear();
+            g_runtime.runtime_module_to_id.clear();
             g_runtime.defined_func_cache.clear();
             g_runtime.defined_func_ptr_ranges.clear();
+            g_runtime.cross_module_call_info.clear();
+            g_runtime.canonical_sig_ids.clear();
             g_import_call_cache.clear();
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.lazy_hot_tier_promotion_count.store(0uz, ::std::memory_order_relaxed);
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             g_wasip1_runtime_module_context_cache.clear();
 # endif
@@ -12687,12 +14400,14 @@ namespace uwvm2::runtime::lib
             auto const& rt_map{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage};
             g_runtime.modules.reserve(rt_map.size());
             g_runtime.module_name_to_id.reserve(rt_map.size());
+            g_runtime.runtime_module_to_id.reserve(rt_map.size());
 
             ::std::size_t id{};
             for(auto const& kv: rt_map)
             {
                 // Preserve the same dense module-id assignment used by eager mode so host APIs and diagnostics are mode-independent.
                 g_runtime.module_name_to_id.emplace(kv.first, id);
+                g_runtime.runtime_module_to_id.emplace(::std::addressof(kv.second), id);
                 compiled_module_record rec{};
                 rec.module_name = kv.first;
                 rec.runtime_module = ::std::addressof(kv.second);
@@ -12701,6 +14416,7 @@ namespace uwvm2::runtime::lib
             }
 
             g_runtime.defined_func_cache.resize(g_runtime.modules.size());
+            reset_cross_module_call_info_slots();
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             rebuild_wasip1_runtime_module_context_cache();
 # endif
@@ -12733,9 +14449,11 @@ namespace uwvm2::runtime::lib
 
                 ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option opt{};
                 opt.curr_wasm_id = module_id;
+                opt.resolve_cross_module_call_info = resolve_cross_module_call_info;
 
                 rec.lazy_compile_options.compile_options = opt;
                 rec.lazy_compile_options.validation_mode = lazy_validation_mode;
+                rec.lazy_compile_options.hot_tier_call_threshold = uwvm_int_lazy_hot_tier_call_threshold();
                 rec.lazy_compile_options.validator_module_storage = find_lazy_validator_module_storage(rec.module_name);
                 rec.lazy_compile_options.validator_feature_parameter = find_lazy_validator_feature_parameter_storage(rec.module_name);
                 if(rec.lazy_compile_options.validator_feature_parameter == nullptr ||
@@ -12765,6 +14483,7 @@ namespace uwvm2::runtime::lib
 # endif
 
                 rec.type_canon_index = build_type_canon_index(*rec.runtime_module);
+                assign_canonical_sig_ids(rec);
 
                 auto const local_n{rec.runtime_module->local_defined_function_vec_storage.size()};
                 if(local_n != rec.lazy_compiled.compiled.local_funcs.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -12822,6 +14541,7 @@ namespace uwvm2::runtime::lib
                             [](defined_func_ptr_range const& a, defined_func_ptr_range const& b) constexpr noexcept { return a.begin < b.begin; });
             }
 
+            publish_cross_module_call_info();
             g_import_call_cache.resize(g_runtime.modules.size());
             for(::std::size_t mid{}; mid != g_runtime.modules.size(); ++mid)
             {
@@ -12920,6 +14640,7 @@ namespace uwvm2::runtime::lib
 
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.lazy_hot_tier_promotion_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_prefetch_module_id = SIZE_MAX;
             g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
@@ -12983,6 +14704,9 @@ namespace uwvm2::runtime::lib
                                             .refill_user_data = nullptr});
             g_runtime.lazy_compile_active = true;
             if(worker_count != 0uz) { (void)lazy_background_refill_callback(nullptr, g_runtime.lazy_scheduler); }
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            flatten_runtime_call_indirect_tables();
+# endif
             g_runtime.compiled_all.store(true, ::std::memory_order_release);
             g_runtime.lazy_initialized.store(true, ::std::memory_order_release);
             lazy_init_lock.clear(::std::memory_order_release);
@@ -13044,13 +14768,19 @@ namespace uwvm2::runtime::lib
 # endif
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             g_runtime.tiered_urgent_scheduler.stop();
+            clear_tiered_reclaim_queue();
 # endif
             // Drop every previous publication array before rebuilding lazy LLVM placeholders and tiered counters.
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
             g_runtime.modules.clear();
             g_runtime.module_name_to_id.clear();
+            g_runtime.runtime_module_to_id.clear();
             g_runtime.defined_func_cache.clear();
             g_runtime.defined_func_ptr_ranges.clear();
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            g_runtime.cross_module_call_info.clear();
+# endif
+            g_runtime.canonical_sig_ids.clear();
             g_import_call_cache.clear();
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             g_wasip1_runtime_module_context_cache.clear();
@@ -13059,12 +14789,14 @@ namespace uwvm2::runtime::lib
             auto const& rt_map{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage};
             g_runtime.modules.reserve(rt_map.size());
             g_runtime.module_name_to_id.reserve(rt_map.size());
+            g_runtime.runtime_module_to_id.reserve(rt_map.size());
 
             ::std::size_t id{};
             for(auto const& kv: rt_map)
             {
                 // Lazy LLVM uses the same module-id namespace as full LLVM so generated call targets and host APIs stay compatible.
                 g_runtime.module_name_to_id.emplace(kv.first, id);
+                g_runtime.runtime_module_to_id.emplace(::std::addressof(kv.second), id);
                 compiled_module_record rec{};
                 rec.module_name = kv.first;
                 rec.runtime_module = ::std::addressof(kv.second);
@@ -13073,6 +14805,9 @@ namespace uwvm2::runtime::lib
             }
 
             g_runtime.defined_func_cache.resize(g_runtime.modules.size());
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            reset_cross_module_call_info_slots();
+# endif
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             rebuild_wasip1_runtime_module_context_cache();
 # endif
@@ -13161,6 +14896,7 @@ namespace uwvm2::runtime::lib
                     // Build interpreter T0 storage beside LLVM lazy storage so tiered execution can start immediately.
                     ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option interpreter_opt{};
                     interpreter_opt.curr_wasm_id = module_id;
+                    interpreter_opt.resolve_cross_module_call_info = resolve_cross_module_call_info;
 
                     rec.lazy_compile_options.compile_options = interpreter_opt;
                     rec.lazy_compile_options.validation_mode = interpreter_lazy_validation_mode;
@@ -13195,6 +14931,7 @@ namespace uwvm2::runtime::lib
 # endif
 
                 rec.type_canon_index = build_type_canon_index(*rec.runtime_module);
+                assign_canonical_sig_ids(rec);
 
                 auto const local_n{rec.runtime_module->local_defined_function_vec_storage.size()};
                 if(local_n != rec.llvm_jit_lazy_compiled.compiled.local_funcs.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -13275,6 +15012,9 @@ namespace uwvm2::runtime::lib
                     rec.tiered_entry_hot_counters.resize(local_n);
                     rec.tiered_osr_request_counters.clear();
                     rec.tiered_osr_request_counters.resize(local_n);
+                    rec.tiered_t0_reclaimed.clear();
+                    rec.tiered_t0_reclaimed.resize(local_n);
+                    rec.tiered_full_loop_reentry_raw_entry_addresses.clear();
                 }
                 else
                 {
@@ -13286,6 +15026,8 @@ namespace uwvm2::runtime::lib
                     rec.tiered_large_long_run_ready = 0u;
                     rec.tiered_entry_hot_counters.clear();
                     rec.tiered_osr_request_counters.clear();
+                    rec.tiered_t0_reclaimed.clear();
+                    rec.tiered_full_loop_reentry_raw_entry_addresses.clear();
                 }
 # endif
 
@@ -13337,6 +15079,9 @@ namespace uwvm2::runtime::lib
                             [](defined_func_ptr_range const& a, defined_func_ptr_range const& b) constexpr noexcept { return a.begin < b.begin; });
             }
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            publish_cross_module_call_info();
+# endif
             g_import_call_cache.resize(g_runtime.modules.size());
             for(::std::size_t mid{}; mid != g_runtime.modules.size(); ++mid)
             {
@@ -13441,6 +15186,7 @@ namespace uwvm2::runtime::lib
             // Runtime log counters are reset after table views are live so the first execution sample reflects steady lazy operation.
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.lazy_hot_tier_promotion_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.llvm_jit_urgent_request_count.store(0uz, ::std::memory_order_relaxed);
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             if(tiered_backend) { reset_tiered_runtime_log_metrics(); }
@@ -13493,78 +15239,706 @@ namespace uwvm2::runtime::lib
                 }
             }
 
-            // Native unwind call-stack mode needs the first demanded direct-call graph to materialize as one stable group.
-            // Background prefetch can otherwise claim small subgroups first, forcing later direct calls through lazy raw-entry
-            // trampolines whose host ABI frames are not part of the Wasm stack.
-            auto const llvm_lazy_background_enabled{!tiered_t0_backend && !runtime_llvm_jit_unwind_call_stack_requested()};
-            if(llvm_lazy_background_enabled && g_runtime.lazy_prefetch_module_id < g_runtime.modules.size())
+            // Native unwind call-stack mode needs the first demanded direct-call graph to materialize as one stable group.
+            // Background prefetch can otherwise claim small subgroups first, forcing later direct calls through lazy raw-entry
+            // trampolines whose host ABI frames are not part of the Wasm stack.
+            auto const llvm_lazy_background_enabled{!tiered_t0_backend && !runtime_llvm_jit_unwind_call_stack_requested()};
+            if(llvm_lazy_background_enabled && g_runtime.lazy_prefetch_module_id < g_runtime.modules.size())
+            {
+                auto& preferred_rec{g_runtime.modules.index_unchecked(g_runtime.lazy_prefetch_module_id)};
+                // For LLVM lazy mode, seeding the direct-call graph around the entry function usually compiles a better first batch
+                // than a simple linear prefetch.
+                if(!seed_llvm_jit_lazy_background_entry_direct_graph(preferred_rec, g_runtime.lazy_prefetch_local_function_index))
+                {
+                    prioritize_llvm_jit_lazy_background_entry(preferred_rec, g_runtime.lazy_prefetch_local_function_index);
+                }
+            }
+
+            auto const worker_count{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compile_threads_resolved};
+            auto const has_lazy_background_work{llvm_lazy_background_enabled && worker_count != 0uz && has_llvm_jit_lazy_background_work()};
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            bool has_tiered_urgent_scheduler_candidate{};
+            bool tiered_defer_jit_scheduler_start{};
+            if(tiered_t0_backend && worker_count != 0uz)
+            {
+                // The current urgent scheduler is a conservative background lane for
+                // counter-hot entries and loop OSR.  Future policy should route these samples
+                // through the execution thread and a main-thread coordinator, then optionally
+                // fan out when WASI threads are implemented.
+                bool has_medium_or_large_module{};
+                for(auto const& rec: g_runtime.modules)
+                {
+                    auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
+                    if(local_n != 0uz)
+                    {
+                        has_tiered_urgent_scheduler_candidate = true;
+                        if(local_n >= 128uz) { has_medium_or_large_module = true; }
+                    }
+                }
+                tiered_defer_jit_scheduler_start = has_tiered_urgent_scheduler_candidate && !has_medium_or_large_module;
+            }
+            g_runtime.tiered_schedulers_deferred.store(tiered_defer_jit_scheduler_start, ::std::memory_order_release);
+            g_runtime.tiered_deferred_worker_count = tiered_defer_jit_scheduler_start ? worker_count : 0uz;
+# endif
+            auto const lazy_scheduler_worker_count{
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+                tiered_t0_backend ? (worker_count == 0uz || tiered_defer_jit_scheduler_start ? 0uz : 1uz) :
+# endif
+                                  (has_lazy_background_work ? worker_count : 0uz)};
+            // Scheduler workers are intentionally split by urgency: normal lazy prefetch fills background code, while urgent/tiered
+            // lanes are reserved for direct demand and loop OSR so they are not hidden behind broad module prefetching.
+            g_runtime.lazy_scheduler.start({.worker_count = lazy_scheduler_worker_count,
+                                            .queue_capacity = 0uz,
+                                            .refill_callback = has_lazy_background_work ? &llvm_jit_lazy_background_refill_callback : nullptr,
+                                            .refill_user_data = nullptr});
+            g_runtime.llvm_jit_urgent_scheduler.start({.worker_count = 0uz, .queue_capacity = 0uz, .refill_callback = nullptr, .refill_user_data = nullptr});
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+            auto const urgent_scheduler_worker_count{has_tiered_urgent_scheduler_candidate && !tiered_defer_jit_scheduler_start ? 1uz : 0uz};
+            if(tiered_t0_backend && !tiered_defer_jit_scheduler_start)
+            {
+                g_runtime.tiered_urgent_scheduler.start({.worker_count = urgent_scheduler_worker_count,
+                                                         .queue_capacity = urgent_scheduler_worker_count == 0uz ? 0uz : tiered_urgent_scheduler_queue_capacity,
+                                                         .refill_callback = nullptr,
+                                                         .refill_user_data = nullptr});
+                verbose_log_registered_tiered_urgent_scheduler(urgent_scheduler_worker_count);
+            }
+            else
+            {
+                g_runtime.tiered_urgent_scheduler.stop();
+            }
+# endif
+            if(has_lazy_background_work) { (void)llvm_jit_lazy_background_refill_callback(nullptr, g_runtime.lazy_scheduler); }
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            flatten_runtime_call_indirect_tables();
+# endif
+            g_runtime.compiled_all.store(true, ::std::memory_order_release);
+            g_runtime.lazy_initialized.store(true, ::std::memory_order_release);
+            lazy_init_lock.clear(::std::memory_order_release);
+        }
+#endif
+
+#if UWVM2_RUNTIME_HAS_PROFILE_SAMPLER
+        // =========================================================================
+        // Guest sampling profiler
+        // -------------------------------------------------------------------------
+        // `--runtime-profile-sample` arms a process-wide ITIMER_PROF. Every SIGPROF copies the
+        // interrupted thread's logical wasm stack and instruction address into that thread's
+        // preallocated buffer; names, tiers and JIT code ranges are resolved only after execution stops.
+        //
+        // Coverage invariants:
+        // - The handler never allocates, locks, runs TLS initializers, or reads shared runtime registries.
+        // - Buffers are registered by their thread before it can be sampled; other threads only bump a counter.
+        // - Samples beyond a buffer's capacity are counted as dropped, not recorded.
+        // - JIT unwind entries are resolved at dump time, after lazy schedulers have stopped.
+        // =========================================================================
+        struct profile_sample_frame
+        {
+            ::std::uint_least32_t module_id{};
+            ::std::uint_least32_t function_index{};
+        };
+
+        struct profile_sample_record
+        {
+            // Only the innermost frames are kept; deeper stacks are rooted at a synthetic `[truncated]` frame.
+            inline static constexpr ::std::size_t max_frames{32uz};
+
+            ::std::uintptr_t instruction_address{};
+            ::std::uint_least32_t depth{};
+            bool truncated{};
+            profile_sample_frame frames[max_frames]{};
+        };
+
+        // Fixed-capacity sample buffer of one guest thread. It is allocated and published through `g_profile_sample_thread` before
+        // the thread can take a tick, so the handler only writes memory that already exists and never touches a shared counter.
+        struct profile_sample_thread_buffer
+        {
+            // About 9 MiB of preallocated samples; at 1 kHz this covers more than half a minute of CPU time.
+            inline static constexpr ::std::size_t max_samples{32768uz};
+
+            call_stack_tls_state const* call_stack{};
+            ::uwvm2::utils::container::vector<profile_sample_record> samples{};
+            // Written only by SIGPROF handlers running on the owning thread; read by the dump once the timer is disarmed.
+            ::std::size_t sample_count{};
+            ::std::size_t dropped_count{};
+        };
+
+        struct profile_sampler_state
+        {
+            // Guest threads that registered a buffer. Only the entry thread runs guest code today; the bound leaves room for more.
+            inline static constexpr ::std::size_t max_threads{64uz};
+
+            profile_sample_thread_buffer* threads[max_threads]{};
+            ::std::size_t thread_count{};
+            // Ticks taken on threads without a buffer (compiler and scheduler threads). A lock-free counter is async-signal-safe.
+            ::std::atomic_size_t unregistered_ticks{};
+            ::std::atomic_bool accepting{};
+            bool handler_installed{};
+            bool armed{};
+
+            inline constexpr profile_sampler_state() noexcept = default;
+            inline constexpr profile_sampler_state(profile_sampler_state const&) noexcept = delete;
+            inline constexpr profile_sampler_state& operator= (profile_sampler_state const&) noexcept = delete;
+
+            inline constexpr ~profile_sampler_state()
+            {
+                using allocator_t = ::fast_io::native_typed_global_allocator<profile_sample_thread_buffer>;
+                for(::std::size_t i{}; i != this->thread_count; ++i)
+                {
+                    ::std::destroy_at(this->threads[i]);
+                    allocator_t::deallocate_n(this->threads[i], 1uz);
+                }
+            }
+        };
+
+        inline profile_sampler_state g_profile_sampler{};  // [global]
+
+        // Constant-initialized and trivially destructible, so reading it from the handler never runs a TLS initializer or registers a
+        // TLS destructor (both may allocate). It stays null on threads that never ran guest code.
+# if UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__tls_model__)
+#  ifdef UWVM
+        [[__gnu__::__tls_model__("local-exec")]]
+#  else
+        [[__gnu__::__tls_model__("local-dynamic")]]
+#  endif
+# endif
+        inline thread_local profile_sample_thread_buffer* g_profile_sample_thread{};  // [global] [thread_local]
+
+        inline void profile_sampler_signal_handler(int, ::siginfo_t*, void* context) noexcept
+        {
+            // A SIGPROF can still be pending after the timer is disarmed, so the handler stays installed and checks this flag instead.
+            if(!g_profile_sampler.accepting.load(::std::memory_order_acquire)) [[unlikely]] { return; }
+
+            auto const buffer{g_profile_sample_thread};
+            if(buffer == nullptr)
+            {
+                g_profile_sampler.unregistered_ticks.fetch_add(1uz, ::std::memory_order_relaxed);
+                return;
+            }
+
+            // The handler runs on the buffer's owner, so a plain counter is enough; the fences keep its update ordered with the record.
+            auto const slot{buffer->sample_count};
+            if(slot >= profile_sample_thread_buffer::max_samples) [[unlikely]]
+            {
+                ++buffer->dropped_count;
+                return;
+            }
+
+            auto& rec{buffer->samples.index_unchecked(slot)};
+            rec.instruction_address = ::uwvm2::object::memory::signal::detail::get_signal_instruction_address(context);
+
+            // `call_stack` is this thread's logical stack. Frames are written before the size is bumped, so an interrupted push is at
+            // worst missing its newest frame. While the frame vector reallocates past its reserved depth, only the PC is recorded.
+            auto const& cs{*buffer->call_stack};
+            ::std::size_t depth{};
+            ::std::size_t skip{};
+            if(!cs.frames_growing) [[likely]]
+            {
+                auto const frame_count{cs.frames.size()};
+                auto const frames{cs.frames.data()};
+                skip = frame_count > profile_sample_record::max_frames ? frame_count - profile_sample_record::max_frames : 0uz;
+                depth = frame_count - skip;
+                for(::std::size_t i{}; i != depth; ++i)
+                {
+                    auto const fr{frames[skip + i]};
+                    rec.frames[i] =
+                        profile_sample_frame{static_cast<::std::uint_least32_t>(fr.module_id), static_cast<::std::uint_least32_t>(fr.function_index)};
+                }
+            }
+            rec.depth = static_cast<::std::uint_least32_t>(depth);
+            rec.truncated = skip != 0uz;
+
+            // Publish the slot last; a handler cut short by the timer being disarmed leaves it uncounted.
+            ::std::atomic_signal_fence(::std::memory_order_release);
+            buffer->sample_count = slot + 1uz;
+        }
+
+        /// @brief Give the calling thread its sample buffer. Runs outside the handler, before the thread can be sampled.
+        inline void register_profile_sample_thread() noexcept
+        {
+            if(g_profile_sample_thread != nullptr) { return; }
+            if(g_profile_sampler.thread_count == profile_sampler_state::max_threads) [[unlikely]] { return; }
+
+            using allocator_t = ::fast_io::native_typed_global_allocator<profile_sample_thread_buffer>;
+            auto const buffer{::std::construct_at(allocator_t::allocate(1uz))};
+            buffer->samples.resize(profile_sample_thread_buffer::max_samples);
+            // Touch the logical stack here, so its TLS initialization (which reserves the frame vector) never happens in the handler.
+            buffer->call_stack = ::std::addressof(get_call_stack());
+
+            g_profile_sampler.threads[g_profile_sampler.thread_count++] = buffer;
+            ::std::atomic_signal_fence(::std::memory_order_release);
+            g_profile_sample_thread = buffer;
+        }
+
+        inline void start_profile_sampler() noexcept
+        {
+            auto const sample_hz{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_profile_sample_hz};
+            if(sample_hz == 0uz || g_profile_sampler.armed) { return; }
+
+            // The entry thread is the guest thread; all of its storage exists before the first tick.
+            register_profile_sample_thread();
+
+            if(!g_profile_sampler.handler_installed)
+            {
+                struct ::sigaction act{};
+                act.sa_sigaction = profile_sampler_signal_handler;
+                ::sigemptyset(::std::addressof(act.sa_mask));
+                // SA_RESTART restarts reads and writes; waits that the kernel never restarts (poll_oneoff) mask SIGPROF themselves.
+                act.sa_flags = SA_SIGINFO | SA_RESTART;
+                if(::uwvm2::object::memory::signal::posix::sigaction(SIGPROF, ::std::addressof(act), nullptr) != 0) [[unlikely]]
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        u8"[warn]  ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Cannot install the SIGPROF handler; guest profiling is disabled.\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                    return;
+                }
+                g_profile_sampler.handler_installed = true;
+            }
+
+            auto const period_us{sample_hz >= 1000000uz ? 1uz : 1000000uz / sample_hz};
+            ::itimerval timer{};
+            timer.it_interval.tv_sec = static_cast<decltype(timer.it_interval.tv_sec)>(period_us / 1000000uz);
+            timer.it_interval.tv_usec = static_cast<decltype(timer.it_interval.tv_usec)>(period_us % 1000000uz);
+            timer.it_value = timer.it_interval;
+
+            g_profile_sampler.accepting.store(true, ::std::memory_order_release);
+            if(::setitimer(ITIMER_PROF, ::std::addressof(timer), nullptr) != 0) [[unlikely]]
+            {
+                g_profile_sampler.accepting.store(false, ::std::memory_order_release);
+                return;
+            }
+            g_profile_sampler.armed = true;
+        }
+
+        // One sample after its JIT leaf has been resolved. Identical stacks sort next to each other and are emitted once with a count.
+        struct profile_resolved_sample
+        {
+            profile_sample_record const* rec{};
+            profile_sample_frame jit_leaf{};
+            bool has_jit_leaf{};
+        };
+
+        [[nodiscard]] inline constexpr profile_resolved_sample resolve_profile_sample(profile_sample_record const& rec) noexcept
+        {
+            profile_resolved_sample res{.rec = ::std::addressof(rec)};
+# if defined(UWVM_RUNTIME_LLVM_JIT)
+            // A PC inside generated code identifies the JIT tier and its function, even when JIT code does not push logical frames.
+            auto const resolved{resolve_llvm_jit_unwind_entry(rec.instruction_address)};
+            if(resolved.found)
+            {
+                res.jit_leaf = profile_sample_frame{static_cast<::std::uint_least32_t>(resolved.entry.module_id),
+                                                    static_cast<::std::uint_least32_t>(resolved.entry.function_index)};
+                res.has_jit_leaf = true;
+            }
+# endif
+            return res;
+        }
+
+        [[nodiscard]] inline constexpr int compare_profile_samples(profile_resolved_sample const& a, profile_resolved_sample const& b) noexcept
+        {
+            auto const key{[](profile_sample_frame f) constexpr noexcept
+                           { return (static_cast<::std::uint_least64_t>(f.module_id) << 32u) | static_cast<::std::uint_least64_t>(f.function_index); }};
+
+            if(a.rec->truncated != b.rec->truncated) { return a.rec->truncated ? 1 : -1; }
+            auto const common{a.rec->depth < b.rec->depth ? a.rec->depth : b.rec->depth};
+            for(::std::uint_least32_t i{}; i != common; ++i)
+            {
+                auto const ka{key(a.rec->frames[i])};
+                auto const kb{key(b.rec->frames[i])};
+                if(ka != kb) { return ka < kb ? -1 : 1; }
+            }
+            if(a.rec->depth != b.rec->depth) { return a.rec->depth < b.rec->depth ? -1 : 1; }
+            if(a.has_jit_leaf != b.has_jit_leaf) { return a.has_jit_leaf ? 1 : -1; }
+            if(a.has_jit_leaf && key(a.jit_leaf) != key(b.jit_leaf)) { return key(a.jit_leaf) < key(b.jit_leaf) ? -1 : 1; }
+            return 0;
+        }
+
+        template <typename Output>
+        inline constexpr void print_profile_folded_name(Output& out, ::uwvm2::utils::container::u8string_view name)
+        {
+            // `;` separates frames and the last space separates the count in the folded format.
+            for(auto const ch: name) { ::fast_io::io::print(out, ::fast_io::mnp::chvw(ch == u8';' || ch == u8' ' ? u8'_' : ch)); }
+        }
+
+        template <typename Output>
+        inline constexpr void print_profile_folded_frame(Output& out, profile_sample_frame fr, bool jit)
+        {
+            if(static_cast<::std::size_t>(fr.module_id) >= g_runtime.modules.size()) [[unlikely]]
+            {
+                ::fast_io::io::print(out, u8"[unknown]");
+                return;
+            }
+
+            auto const& mod_rec{g_runtime.modules.index_unchecked(fr.module_id)};
+            print_profile_folded_name(out, resolve_module_display_name(mod_rec.module_name));
+            ::fast_io::io::print(out, u8"!");
+            auto const fn_name{resolve_func_display_name(mod_rec.module_name, fr.function_index)};
+            if(fn_name.empty()) { ::fast_io::io::print(out, u8"func[", fr.function_index, u8"]"); }
+            else
+            {
+                print_profile_folded_name(out, fn_name);
+            }
+            // flamegraph.pl colors `_[j]` frames as JIT code; interpreter frames keep the bare name.
+            if(jit) { ::fast_io::io::print(out, u8"_[j]"); }
+        }
+
+        template <typename Output>
+        inline constexpr void print_profile_folded_stack(Output& out, profile_resolved_sample const& s)
+        {
+            auto const& rec{*s.rec};
+            bool first{true};
+            auto const sep{[&]() constexpr
+                           {
+                               if(!first) { ::fast_io::io::print(out, u8";"); }
+                               first = false;
+                           }};
+
+            if(rec.truncated)
+            {
+                sep();
+                ::fast_io::io::print(out, u8"[truncated]");
+            }
+
+            // When generated code pushes logical frames, the JIT leaf is already the innermost frame and is only tagged.
+            auto const leaf_is_logical{s.has_jit_leaf && rec.depth != 0u && rec.frames[rec.depth - 1u].module_id == s.jit_leaf.module_id &&
+                                       rec.frames[rec.depth - 1u].function_index == s.jit_leaf.function_index};
+            for(::std::uint_least32_t i{}; i != rec.depth; ++i)
             {
-                auto& preferred_rec{g_runtime.modules.index_unchecked(g_runtime.lazy_prefetch_module_id)};
-                // For LLVM lazy mode, seeding the direct-call graph around the entry function usually compiles a better first batch
-                // than a simple linear prefetch.
-                if(!seed_llvm_jit_lazy_background_entry_direct_graph(preferred_rec, g_runtime.lazy_prefetch_local_function_index))
+                sep();
+                print_profile_folded_frame(out, rec.frames[i], leaf_is_logical && i + 1u == rec.depth);
+            }
+            if(s.has_jit_leaf && !leaf_is_logical)
+            {
+                sep();
+                print_profile_folded_frame(out, s.jit_leaf, true);
+            }
+
+            // Ticks outside any wasm frame are runtime work: startup, compilation threads, or host code after the entry returned.
+            if(first) { ::fast_io::io::print(out, u8"[runtime]"); }
+        }
+
+        inline void stop_profile_sampler_and_dump() noexcept
+        {
+            if(!g_profile_sampler.armed) { return; }
+            g_profile_sampler.armed = false;
+
+            ::itimerval const disarm{};
+            ::setitimer(ITIMER_PROF, ::std::addressof(disarm), nullptr);
+            g_profile_sampler.accepting.store(false, ::std::memory_order_release);
+
+            // Handlers only run on their buffer's owner, which is this thread or a thread that no longer takes ticks, so the
+            // per-thread counters are stable here.
+            ::std::atomic_signal_fence(::std::memory_order_acquire);
+            ::std::size_t recorded{};
+            ::std::size_t dropped{};
+            for(::std::size_t t{}; t != g_profile_sampler.thread_count; ++t)
+            {
+                recorded += g_profile_sampler.threads[t]->sample_count;
+                dropped += g_profile_sampler.threads[t]->dropped_count;
+            }
+            auto const unregistered_ticks{g_profile_sampler.unregistered_ticks.exchange(0uz, ::std::memory_order_relaxed)};
+
+            ::uwvm2::utils::container::vector<profile_resolved_sample> resolved{};
+            resolved.reserve(recorded);
+            for(::std::size_t t{}; t != g_profile_sampler.thread_count; ++t)
+            {
+                auto& buffer{*g_profile_sampler.threads[t]};
+                for(::std::size_t i{}; i != buffer.sample_count; ++i)
                 {
-                    prioritize_llvm_jit_lazy_background_entry(preferred_rec, g_runtime.lazy_prefetch_local_function_index);
+                    resolved.push_back_unchecked(resolve_profile_sample(buffer.samples.index_unchecked(i)));
                 }
+                buffer.sample_count = 0uz;
+                buffer.dropped_count = 0uz;
             }
 
-            auto const worker_count{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compile_threads_resolved};
-            auto const has_lazy_background_work{llvm_lazy_background_enabled && worker_count != 0uz && has_llvm_jit_lazy_background_work()};
-# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
-            bool has_tiered_urgent_scheduler_candidate{};
-            bool tiered_defer_jit_scheduler_start{};
-            if(tiered_t0_backend && worker_count != 0uz)
+            ::std::sort(resolved.begin(),
+                        resolved.end(),
+                        [](profile_resolved_sample const& a, profile_resolved_sample const& b) constexpr noexcept
+                        { return compare_profile_samples(a, b) < 0; });
+
+            auto const& path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_profile_sample_path};
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
             {
-                // The current urgent scheduler is a conservative background lane for
-                // counter-hot entries and loop OSR.  Future policy should route these samples
-                // through the execution thread and a main-thread coordinator, then optionally
-                // fan out when WASI threads are implemented.
-                bool has_medium_or_large_module{};
-                for(auto const& rec: g_runtime.modules)
+                ::fast_io::u8obuf_file file{path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+                auto const n{resolved.size()};
+                bool runtime_printed{};
+                for(::std::size_t i{}; i != n;)
                 {
-                    auto const local_n{rec.llvm_jit_lazy_compiled.functions.size()};
-                    if(local_n != 0uz)
-                    {
-                        has_tiered_urgent_scheduler_candidate = true;
-                        if(local_n >= 128uz) { has_medium_or_large_module = true; }
-                    }
+                    auto j{i + 1uz};
+                    while(j != n && compare_profile_samples(resolved.index_unchecked(i), resolved.index_unchecked(j)) == 0) { ++j; }
+                    auto const& s{resolved.index_unchecked(i)};
+                    print_profile_folded_stack(file, s);
+                    // Ticks of threads without a buffer are runtime work too; fold them into the one `[runtime]` line.
+                    bool const is_runtime{s.rec->depth == 0u && !s.rec->truncated && !s.has_jit_leaf};
+                    ::fast_io::io::println(file, u8" ", j - i + (is_runtime ? unregistered_ticks : 0uz));
+                    runtime_printed = runtime_printed || is_runtime;
+                    i = j;
                 }
-                tiered_defer_jit_scheduler_start = has_tiered_urgent_scheduler_candidate && !has_medium_or_large_module;
+                if(!runtime_printed && unregistered_ticks != 0uz) { ::fast_io::io::println(file, u8"[runtime] ", unregistered_ticks); }
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error e)
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    u8"[warn]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Cannot write guest profile \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\". error: ",
+                                    e,
+                                    u8"\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                return;
             }
-            g_runtime.tiered_schedulers_deferred.store(tiered_defer_jit_scheduler_start, ::std::memory_order_release);
-            g_runtime.tiered_deferred_worker_count = tiered_defer_jit_scheduler_start ? worker_count : 0uz;
 # endif
-            auto const lazy_scheduler_worker_count{
-# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
-                tiered_t0_backend ? (worker_count == 0uz || tiered_defer_jit_scheduler_start ? 0uz : 1uz) :
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Guest profile: samples=",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                resolved.size() + unregistered_ticks,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" dropped=",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                dropped,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" output=\"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                path,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\"\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+#else
+        inline void start_profile_sampler() noexcept
+        {
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_profile_sample_hz == 0uz) { return; }
+
+            // The sampler needs direct thread_local stacks and POSIX interval timers; other targets keep running without a profile.
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Guest sampling profiler is unavailable on this platform; --runtime-profile-sample is ignored.\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_profile_sample_hz = 0uz;
+        }
+
+        inline constexpr void stop_profile_sampler_and_dump() noexcept {}
+#endif
+
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+        // Both the normal return and `proc_exit` paths reach the dump; only the first one writes the report.
+        inline ::std::atomic_bool g_opfunc_profile_written{};
+
+        inline void write_uwvm_int_opfunc_profile() noexcept
+        {
+            auto const& path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_opfunc_profile_path};
+            if(path.empty() || g_opfunc_profile_written.exchange(true, ::std::memory_order_acq_rel)) { return; }
+
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
 # endif
-                                  (has_lazy_background_work ? worker_count : 0uz)};
-            // Scheduler workers are intentionally split by urgency: normal lazy prefetch fills background code, while urgent/tiered
-            // lanes are reserved for direct demand and loop OSR so they are not hidden behind broad module prefetching.
-            g_runtime.lazy_scheduler.start({.worker_count = lazy_scheduler_worker_count,
-                                            .queue_capacity = 0uz,
-                                            .refill_callback = has_lazy_background_work ? &llvm_jit_lazy_background_refill_callback : nullptr,
-                                            .refill_user_data = nullptr});
-            g_runtime.llvm_jit_urgent_scheduler.start({.worker_count = 0uz, .queue_capacity = 0uz, .refill_callback = nullptr, .refill_user_data = nullptr});
-# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
-            auto const urgent_scheduler_worker_count{has_tiered_urgent_scheduler_candidate && !tiered_defer_jit_scheduler_start ? 1uz : 0uz};
-            if(tiered_t0_backend && !tiered_defer_jit_scheduler_start)
             {
-                g_runtime.tiered_urgent_scheduler.start({.worker_count = urgent_scheduler_worker_count,
-                                                         .queue_capacity = urgent_scheduler_worker_count == 0uz ? 0uz : tiered_urgent_scheduler_queue_capacity,
-                                                         .refill_callback = nullptr,
-                                                         .refill_user_data = nullptr});
-                verbose_log_registered_tiered_urgent_scheduler(urgent_scheduler_worker_count);
+                ::fast_io::u8obuf_file file{path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+                ::uwvm2::runtime::compiler::uwvm_int::optable::opfunc_profile::write_opfunc_profile(file);
             }
-            else
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error e)
             {
-                g_runtime.tiered_urgent_scheduler.stop();
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    u8"[warn]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Cannot write opfunc n-gram profile \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\". error: ",
+                                    e,
+                                    u8"\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                return;
             }
 # endif
-            if(has_lazy_background_work) { (void)llvm_jit_lazy_background_refill_callback(nullptr, g_runtime.lazy_scheduler); }
-            g_runtime.compiled_all.store(true, ::std::memory_order_release);
-            g_runtime.lazy_initialized.store(true, ::std::memory_order_release);
-            lazy_init_lock.clear(::std::memory_order_release);
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Opfunc n-gram profile: output=\"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                path,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\"\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+#else
+        inline constexpr void write_uwvm_int_opfunc_profile() noexcept {}
+#endif
+
+#if UWVM2_RUNTIME_HAS_GUEST_STACK
+        // `--runtime-guest-stack`: the entry function is re-run on a dedicated mmap'd stack laid out as
+        // [guard | guest stack | signal stack]. Recursion that reaches the PROT_NONE guard faults inside the range registered with the
+        // memory signal layer, which reports `call stack exhausted` from the signal stack instead of letting the host crash.
+        // Only the thread that calls the entry function runs guest code. Lazy-compile and tiered workers translate and compile but
+        // never call into the guest, and guests cannot spawn threads (the threads proposal is unsupported), so no other thread
+        // gets a guest stack. A guest thread spawn path must switch its thread onto its own guest stack the same way.
+        inline constexpr ::std::size_t guest_stack_guard_bytes{256uz * 1024uz};
+        inline constexpr ::std::size_t guest_stack_signal_stack_bytes{256uz * 1024uz};
+
+        struct guest_stack_entry_t
+        {
+            void (*func)(void*) noexcept {};
+            void* arg{};
+        };
+
+        inline thread_local guest_stack_entry_t g_guest_stack_entry{};  // [global] [thread-local]
+        inline thread_local bool g_on_guest_stack{};                     // [global] [thread-local]
+
+        [[nodiscard]] inline bool on_guest_stack() noexcept { return g_on_guest_stack; }
+
+        inline void guest_stack_trampoline() noexcept
+        {
+            // makecontext cannot pass pointers portably; uc_link returns to the host context when the entry returns.
+            auto const entry{g_guest_stack_entry};
+            entry.func(entry.arg);
+        }
+
+        [[nodiscard]] inline bool guest_stack_call_stack_frames_required() noexcept
+        {
+            // The guard page replaces the frame vector as the recursion bound. Keep the vector only where something reads it.
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_backtrace) { return true; }
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_profile_sample_hz != 0uz) { return true; }
+# if defined(UWVM_RUNTIME_LLVM_JIT)
+            if(runtime_llvm_jit_uses_instruction_call_stack_frames()) { return true; }
+# endif
+            return false;
+        }
+
+        inline void warn_guest_stack_unavailable(::uwvm2::utils::container::u8string_view reason) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                reason,
+                                u8"; running on the host stack.\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size = 0uz;
+        }
+
+        /// @return false if the guest stack could not be set up; the caller then runs `func` on the current stack.
+        template <typename Func>
+        [[nodiscard]] inline bool run_on_guest_stack(Func& func) noexcept
+        {
+            auto const stack_bytes{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size};
+            auto const total_bytes{guest_stack_guard_bytes + stack_bytes + guest_stack_signal_stack_bytes};
+
+            constexpr int map_flags{MAP_PRIVATE | MAP_ANONYMOUS
+# if defined(MAP_NORESERVE)
+                                    | MAP_NORESERVE
+# endif
+# if defined(MAP_STACK)
+                                    | MAP_STACK
+# endif
+            };
+
+            ::std::byte* base{};
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                base = ::fast_io::details::sys_mmap(nullptr, total_bytes, PROT_READ | PROT_WRITE, map_flags, -1, 0u);
+                ::fast_io::details::sys_mprotect(base, guest_stack_guard_bytes, PROT_NONE);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                if(base != nullptr) { ::fast_io::details::sys_munmap_nothrow(base, total_bytes); }
+                warn_guest_stack_unavailable(u8"Cannot map the guest stack");
+                return false;
+            }
+# endif
+
+            auto const guard_end{base + guest_stack_guard_bytes};
+
+            // The guard fault is delivered with SA_ONSTACK; without a signal stack the kernel could not run the handler at all.
+            ::stack_t signal_stack{};
+            signal_stack.ss_sp = guard_end + stack_bytes;
+            signal_stack.ss_size = guest_stack_signal_stack_bytes;
+            ::stack_t previous_signal_stack{};
+
+            ::ucontext_t host_context{};
+            ::ucontext_t guest_context{};
+            if(::sigaltstack(::std::addressof(signal_stack), ::std::addressof(previous_signal_stack)) != 0 ||
+               ::getcontext(::std::addressof(guest_context)) != 0) [[unlikely]]
+            {
+                ::fast_io::details::sys_munmap_nothrow(base, total_bytes);
+                warn_guest_stack_unavailable(u8"Cannot install the guest signal stack");
+                return false;
+            }
+
+            guest_context.uc_stack.ss_sp = guard_end;
+            guest_context.uc_stack.ss_size = stack_bytes;
+            guest_context.uc_link = ::std::addressof(host_context);
+            ::makecontext(::std::addressof(guest_context), guest_stack_trampoline, 0);
+
+            g_guest_stack_entry = guest_stack_entry_t{[](void* p) noexcept { (*static_cast<Func*>(p))(); }, ::std::addressof(func)};
+            get_call_stack().keep_frames = guest_stack_call_stack_frames_required();
+            ::uwvm2::object::memory::signal::register_guest_stack_guard(base, guard_end);
+            g_on_guest_stack = true;
+
+            ::swapcontext(::std::addressof(host_context), ::std::addressof(guest_context));
+
+            g_on_guest_stack = false;
+            ::uwvm2::object::memory::signal::unregister_guest_stack_guard();
+            // The entry erases the thread state on return, so fetch it again instead of holding a reference across the switch.
+            get_call_stack().keep_frames = true;
+            ::sigaltstack(::std::addressof(previous_signal_stack), nullptr);
+            ::fast_io::details::sys_munmap_nothrow(base, total_bytes);
+            return true;
+        }
+#else
+        [[nodiscard]] inline constexpr bool on_guest_stack() noexcept { return false; }
+
+        template <typename Func>
+        [[nodiscard]] inline bool run_on_guest_stack(Func&) noexcept
+        {
+            // Switching stacks needs ucontext, mmap guard pages and the direct-TLS signal bridge.
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Guest stack switching is unavailable on this platform; --runtime-guest-stack is ignored.\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size = 0uz;
+            return false;
         }
 #endif
 
@@ -13752,6 +16126,12 @@ namespace uwvm2::runtime::lib
     // =========================================================================
     extern "C++" void lazy_compile_and_run_main_module(::uwvm2::utils::container::u8string_view main_module_name, lazy_compile_run_config cfg) noexcept
     {
+        if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size != 0uz && !on_guest_stack())
+        {
+            auto reenter{[&]() noexcept { lazy_compile_and_run_main_module(main_module_name, cfg); }};
+            if(run_on_guest_stack(reenter)) { return; }
+        }
+
         // Lazy execution initializes backend metadata, validates the host-provided entry ABI buffers, then invokes exactly one entry
         // function. Background schedulers are stopped before return because the current host API models a bounded run.
         auto const lazy_log_enabled{::uwvm2::uwvm::io::enable_runtime_log};
@@ -13767,18 +16147,27 @@ namespace uwvm2::runtime::lib
             false
 #  endif
         };
-        // Select the lazy initializer matching the runtime compiler. Tiered LLVM may also build interpreter T0 metadata inside the
-        // LLVM lazy initializer.
-        if(llvm_jit_lazy_backend || tiered_lazy_backend) { initialize_llvm_jit_lazy_modules_if_needed(main_module_name, cfg); }
-        else
+# endif
+        {
+            // Lazy translation itself happens on first call; the startup `translate` phase only covers the eager metadata build.
+            ::uwvm2::utils::debug::timer translate_timer{
+                u8"translate",
+                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::translate)};
+
+# if defined(UWVM_RUNTIME_LLVM_JIT)
+            // Select the lazy initializer matching the runtime compiler. Tiered LLVM may also build interpreter T0 metadata inside the
+            // LLVM lazy initializer.
+            if(llvm_jit_lazy_backend || tiered_lazy_backend) { initialize_llvm_jit_lazy_modules_if_needed(main_module_name, cfg); }
+            else
 # endif
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
-            initialize_lazy_modules_if_needed(main_module_name, cfg);
+                initialize_lazy_modules_if_needed(main_module_name, cfg);
 # else
-        {
-            ::fast_io::fast_terminate();
-        }
+            {
+                ::fast_io::fast_terminate();
+            }
 # endif
+        }
 
         auto const it{g_runtime.module_name_to_id.find(main_module_name)};
         if(it == g_runtime.module_name_to_id.end()) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -13888,7 +16277,13 @@ namespace uwvm2::runtime::lib
 # endif
 
         auto const lazy_exec_start{lazy_log_enabled ? lazy_clock_now() : ::fast_io::unix_timestamp{}};
+        start_profile_sampler();
         ::uwvm2::uwvm::global::record_total_wasm_time_start();
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        // Every dispatch below runs guest code until the entry returns, whichever backend it picks; superseded-code reclamation
+        // scans this thread's stack up to here.
+        tiered_reclaim_guest_guard reclaim_guest_guard{};
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
         if(llvm_jit_lazy_backend)
         {
@@ -14025,6 +16420,9 @@ namespace uwvm2::runtime::lib
             ::fast_io::fast_terminate();
         }
 # endif
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        reclaim_guest_guard.leave();
+# endif
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
         if(entry_result_on_stack && result_bytes != 0uz) { ::std::memcpy(cfg.entry_abi_buffers.result_buffer, host_stack_base, result_bytes); }
@@ -14041,6 +16439,9 @@ namespace uwvm2::runtime::lib
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
         g_runtime.tiered_urgent_scheduler.stop();
 # endif
+        // JIT ranges are stable once the lazy workers are quiescent, so profile PCs are resolved only now.
+        stop_profile_sampler_and_dump();
+        write_uwvm_int_opfunc_profile();
 
         if(lazy_log_enabled)
         {
@@ -14065,9 +16466,20 @@ namespace uwvm2::runtime::lib
     // =========================================================================
     extern "C++" void full_compile_and_run_main_module(::uwvm2::utils::container::u8string_view main_module_name, full_compile_run_config cfg) noexcept
     {
+        if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size != 0uz && !on_guest_stack())
+        {
+            auto reenter{[&]() noexcept { full_compile_and_run_main_module(main_module_name, cfg); }};
+            if(run_on_guest_stack(reenter)) { return; }
+        }
+
         // Full execution forces all requested backend artifacts to be ready before selecting the entry. This keeps the run path simple
         // and makes JIT fallback policy an explicit choice below.
-        compile_all_modules_if_needed();
+        {
+            ::uwvm2::utils::debug::timer translate_timer{
+                u8"translate",
+                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::translate)};
+            compile_all_modules_if_needed();
+        }
 
         auto const it{g_runtime.module_name_to_id.find(main_module_name)};
         if(it == g_runtime.module_name_to_id.end()) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -14169,6 +16581,7 @@ namespace uwvm2::runtime::lib
         {
             // Prefer the fully materialized native entry in LLVM-capable modes. Interpreter fallback is allowed only when the selected
             // runtime compiler does not require JIT execution.
+            start_profile_sampler();
             ::uwvm2::uwvm::global::record_total_wasm_time_start();
             if(try_invoke_runtime_llvm_jit_raw_defined_entry(llvm_jit_entry_module_id,
                                                              llvm_jit_entry_function_index,
@@ -14178,6 +16591,8 @@ namespace uwvm2::runtime::lib
                                                              param_bytes))
             {
                 ::uwvm2::uwvm::global::record_total_wasm_time_end();
+                stop_profile_sampler_and_dump();
+                write_uwvm_int_opfunc_profile();
                 erase_current_thread_state();
                 return;
             }
@@ -14238,6 +16653,7 @@ namespace uwvm2::runtime::lib
         try
 # endif
         {
+            start_profile_sampler();
             ::uwvm2::uwvm::global::record_total_wasm_time_start();
             call_bridge(main_id, cfg.entry_function_index, ::std::addressof(stack_top_ptr));
             ::uwvm2::uwvm::global::record_total_wasm_time_end();
@@ -14249,6 +16665,8 @@ namespace uwvm2::runtime::lib
         }
 # endif
         if(result_bytes != 0uz) { ::std::memcpy(cfg.entry_abi_buffers.result_buffer, host_stack_base, result_bytes); }
+        stop_profile_sampler_and_dump();
+        write_uwvm_int_opfunc_profile();
 
         // Currently only main-thread execution exists. Clean up current thread state on exit to avoid state growth and
         // possible thread-id reuse issues. Do NOT `clear()` here: main-thread exit does not imply other threads exit.
@@ -14268,9 +16686,10 @@ namespace uwvm2::runtime::lib
                                                                  InvokeBridge&& invoke_bridge) noexcept
     {
         // Raw host bridge helpers are used by generated JIT wrappers that need to re-enter interpreter call bridges. The optional
-        // trailer writes operands such as function/table indices after the normal parameter payload.
-        compile_all_modules_if_needed();
-        ensure_bridges_initialized();
+        // trailer writes operands such as function/table indices after the normal parameter payload. Generated code only runs
+        // after both one-time initializers, so the per-call cost is two acquire loads.
+        if(!g_runtime.compiled_all.load(::std::memory_order_acquire)) [[unlikely]] { compile_all_modules_if_needed(); }
+        if(!g_runtime.bridges_initialized.load(::std::memory_order_acquire)) [[unlikely]] { ensure_bridges_initialized(); }
 
         if((result_bytes != 0uz && result_buffer == nullptr) || (param_bytes != 0uz && param_buffer == nullptr)) [[unlikely]] { ::fast_io::fast_terminate(); }
 
@@ -14291,6 +16710,10 @@ namespace uwvm2::runtime::lib
 
         ::std::byte* stack_top_ptr{host_stack_base + input_bytes};
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        // Nested under the entry's guard when reached from generated code; a host thread calling in directly registers here.
+        tiered_reclaim_guest_guard reclaim_guest_guard{};
+# endif
 # ifdef UWVM_CPP_EXCEPTIONS
         try
 # endif
@@ -14334,6 +16757,9 @@ namespace uwvm2::runtime::lib
         g_runtime.tiered_urgent_scheduler.stop();
 # endif
 #endif
+        // proc_exit never returns to the run entry points, so the guest profile is written here as well.
+        stop_profile_sampler_and_dump();
+        write_uwvm_int_opfunc_profile();
     }
 
 #if defined(UWVM_RUNTIME_LLVM_JIT)
@@ -14356,13 +16782,19 @@ namespace uwvm2::runtime::lib
         g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
         g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
         g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+        g_runtime.lazy_hot_tier_promotion_count.store(0uz, ::std::memory_order_relaxed);
         g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
 # endif
 
         g_runtime.modules.clear();
         g_runtime.module_name_to_id.clear();
+        g_runtime.runtime_module_to_id.clear();
         g_runtime.defined_func_cache.clear();
         g_runtime.defined_func_ptr_ranges.clear();
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+        g_runtime.cross_module_call_info.clear();
+# endif
+        g_runtime.canonical_sig_ids.clear();
         g_import_call_cache.clear();
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
         g_wasip1_runtime_module_context_cache.clear();
@@ -14383,7 +16815,7 @@ namespace uwvm2::runtime::lib
     {
         // External raw calls use explicit ABI byte buffers and a runtime module pointer supplied by the host. The function validates
         // the pointer against the runtime registry before dispatching to either a cached import or a local defined entry.
-        compile_all_modules_if_needed(false);
+        if(!g_runtime.compiled_all.load(::std::memory_order_acquire)) [[unlikely]] { compile_all_modules_if_needed(false); }
 
         if((result_bytes != 0uz && result_buffer == nullptr) || (param_bytes != 0uz && param_buffer == nullptr)) [[unlikely]] { ::fast_io::fast_terminate(); }
 
@@ -14395,6 +16827,11 @@ namespace uwvm2::runtime::lib
         auto const curr_runtime_module{rec.runtime_module};
         if(curr_runtime_module == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
 
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
+        // Embedders may call in from any thread; every dispatch below runs guest code or a host import that can call back into it.
+        tiered_reclaim_guest_guard reclaim_guest_guard{};
+# endif
+
         auto const import_n{curr_runtime_module->imported_function_vec_storage.size()};
         if(func_index < import_n)
         {
@@ -14472,6 +16909,48 @@ namespace uwvm2::runtime::lib
 
         ::fast_io::fast_terminate();
     }
+
+    extern "C++" [[nodiscard]] bool llvm_jit_wasip1_direct_calls_enabled() noexcept
+    {
+        // `--runtime-llvm-jit-disable-wasip1-direct-call` keeps every WASI Preview1 call on the raw host bridge, so both paths can be
+        // compared in one build.
+        return !::uwvm2::uwvm::runtime::runtime_mode::runtime_llvm_jit_disable_wasip1_direct_call;
+    }
+
+    extern "C++" [[nodiscard]] llvm_jit_wasip1_direct_host_entry_t llvm_jit_find_wasip1_direct_host_api(void const* local_imported_module_ptr,
+                                                                                                          ::std::size_t function_index) noexcept
+    {
+        // The translator asks once per import while emitting IR. Only the built-in WASI Preview1 local-imported module is accepted, and
+        // the exported name at `function_index` must match the wrapper the thunk was instantiated for, so a foreign module that reuses the
+        // module name can never be bound to a WASI thunk.
+# if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
+        if(!llvm_jit_wasip1_direct_calls_enabled()) { return {}; }
+
+        auto const local_imported_module{static_cast<local_imported_t const*>(local_imported_module_ptr)};
+        if(local_imported_module == nullptr) [[unlikely]] { return {}; }
+        if(local_imported_module->get_module_name() !=
+           ::uwvm2::uwvm::imported::wasi::wasip1::local_imported::wasip1_local_imported_module_t::module_name)
+        {
+            return {};
+        }
+
+        auto const& entries{llvm_jit_wasip1_direct_entries_t::entries};
+        if(function_index >= ::std::size(entries)) [[unlikely]] { return {}; }
+
+        auto const& entry{entries[function_index]};
+        auto const info{local_imported_module->get_function_information_from_index(function_index)};
+        if(!info.successed || info.function_name != entry.function_name) [[unlikely]] { return {}; }
+
+        return {.entry_address = entry.entry_address,
+                .function_name = entry.function_name,
+                .parameter_count = entry.parameter_count,
+                .result_count = entry.result_count};
+# else
+        static_cast<void>(local_imported_module_ptr);
+        static_cast<void>(function_index);
+        return {};
+# endif
+    }
 #endif
 
     // Preload memory host APIs expose only the memories selected by the active preload call context. They are thin wrappers so the C
@@ -59,6 +59,7 @@
 # include <llvm/Transforms/Scalar/GVN.h>
 # include <llvm/Transforms/Utils.h>
 # include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/section_memory_manager.h>
+# include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/orc_session.h>
 #endif
 
 import fast_io;
@@ -73,12 +74,15 @@ import uwvm2.runtime.compiler.uwvm_int.optable;
 import uwvm2.runtime.compiler.llvm_jit.compile_all_from_uwvm;
 import uwvm2.runtime.compiler.llvm_jit.compile_cu_from_lazy_validator;
 import uwvm2.utils.container;
+import uwvm2.utils.debug;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.imported.wasi.wasip1.storage;
+import uwvm2.uwvm.imported.wasi.wasip1.local_imported;
 import uwvm2.uwvm.wasm.feature;
 import uwvm2.uwvm.wasm.type;
 import uwvm2.uwvm.runtime.runtime_mode;
 import uwvm2.uwvm.wasm.storage;
+import uwvm2.uwvm.utils.timing;
 import uwvm2.runtime;
 
 #include "uwvm_runtime.default.cpp"
@@ -112,6 +112,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
         bool verify_signature{true};                                     // Readers verify by default because cached code is executable native code.
         compression_kind compression{compression_kind::uwvm_native_lz};  // Native-LZ is the default balance for object-file-like byte streams.
         ::std::size_t max_object_bytes{512uz * 1024uz * 1024uz};         // The limit bounds memory use before allocation or decompression.
+        ::std::size_t max_async_store_bytes{256uz * 1024uz * 1024uz};    // Raw bytes held by pending async stores; the oldest store is dropped first.
     };
 
     struct cache_context
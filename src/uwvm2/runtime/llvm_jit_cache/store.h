@@ -693,7 +693,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                                                        ::std::byte const* object,
                                                        ::std::size_t size,
                                                        cache_policy const& policy,
-                                                       ::uwvm2::utils::container::vector<::std::byte>& blob) noexcept
+                                                       ::uwvm2::utils::container::vector<::std::byte>& blob,
+                                                       ::std::chrono::nanoseconds* compress_time = nullptr) noexcept
         {
             // A non-null object pointer is required only when there are bytes to read.
             if(object == nullptr && size != 0uz) [[unlikely]] { return cache_status::malformed; }
@@ -705,6 +706,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
             {
                 ::uwvm2::utils::container::vector<::std::byte> payload{};
                 auto compression{policy.compression};
+                auto const compress_start{::std::chrono::steady_clock::now()};
                 switch(policy.compression)
                 {
                     // The uncompressed path is preserved for small or already-compressed object files.
@@ -716,6 +718,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                     case compression_kind::uwvm_native_lz: payload = compress_native_lz(object, size); break;
                     default: return cache_status::unsupported_compression;
                 }
+                if(compress_time != nullptr) { *compress_time = ::std::chrono::steady_clock::now() - compress_start; }
 
                 if(compression != compression_kind::none && payload.size() >= size)
                 {
@@ -827,7 +830,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
         struct cache_store_request
         {
             cache_context ctx{};
-            ::uwvm2::utils::container::vector<::std::byte> blob{};
+            cache_policy policy{};
+            // Raw object bytes owned by the request. Compression, hashing and signing run on the store worker, not the compile thread.
+            ::uwvm2::utils::container::u8string object{};
             ::uwvm2::utils::container::u8string log_module{};
             ::std::size_t object_bytes{};
             ::std::size_t object_index{};
@@ -849,9 +854,35 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
 #endif
         }
 
-        inline constexpr void log_cache_store_completion(cache_store_request const& request, cache_status status) noexcept
+        /// @brief  Two requests with the same identity publish the same cache file, so only the newest one needs to be written.
+        [[nodiscard]] inline constexpr bool same_cache_identity(cache_context const& a, cache_context const& b) noexcept
+        {
+            return a.cache_key == b.cache_key && a.cache_dir == b.cache_dir && a.target_triple == b.target_triple && a.cpu_name == b.cpu_name &&
+                   a.cpu_features == b.cpu_features && a.llvm_version == b.llvm_version && a.uwvm_abi == b.uwvm_abi &&
+                   a.codegen_policy == b.codegen_policy;
+        }
+
+        [[nodiscard]] inline constexpr cache_status build_and_write_cache_object(cache_store_request const& request,
+                                                                                 ::std::chrono::nanoseconds& compress_time) noexcept
+        {
+            ::uwvm2::utils::container::vector<::std::byte> blob{};
+            auto const first{reinterpret_cast<::std::byte const*>(request.object.cbegin())};
+            if(auto const status{build_cache_blob(request.ctx, first, request.object.size(), request.policy, blob, ::std::addressof(compress_time))};
+               status != cache_status::ok) [[unlikely]]
+            {
+                return status;
+            }
+            return write_cache_blob_atomic(request.ctx, blob);
+        }
+
+        inline constexpr void log_cache_store_completion(cache_store_request const& request,
+                                                         cache_status status,
+                                                         ::std::size_t queue_depth,
+                                                         ::std::uint_least64_t dropped_total,
+                                                         ::std::chrono::nanoseconds compress_time) noexcept
         {
             if(!request.log_completion) { return; }
+            auto const compress_us{static_cast<::std::uint_least64_t>(::std::chrono::duration_cast<::std::chrono::microseconds>(compress_time).count())};
             if(request.log_parallel_object)
             {
                 runtime_cache_log_line(u8"object-cache-store-complete module=\"",
@@ -863,7 +894,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                                        u8" object_index=",
                                        request.object_index,
                                        u8" object_count=",
-                                       request.object_count);
+                                       request.object_count,
+                                       u8" compress_us=",
+                                       compress_us,
+                                       u8" queue_depth=",
+                                       queue_depth,
+                                       u8" dropped=",
+                                       dropped_total);
                 return;
             }
 
@@ -872,7 +909,26 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                                    u8"\" status=",
                                    cache_status_name(status),
                                    u8" bytes=",
-                                   request.object_bytes);
+                                   request.object_bytes,
+                                   u8" compress_us=",
+                                   compress_us,
+                                   u8" queue_depth=",
+                                   queue_depth,
+                                   u8" dropped=",
+                                   dropped_total);
+        }
+
+        inline constexpr void log_cache_store_drop(cache_store_request const& request, ::std::size_t queued_bytes) noexcept
+        {
+            runtime_cache_log_line(u8"object-cache-store-drop module=\"",
+                                   request.log_module,
+                                   u8"\" bytes=",
+                                   request.object_bytes,
+                                   u8" object_index=",
+                                   request.object_index,
+                                   u8" queued_bytes=",
+                                   queued_bytes,
+                                   u8" reason=queue-full");
         }
 
         struct async_cache_store_worker
@@ -882,6 +938,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
             ::std::thread worker{};
             ::std::deque<cache_store_request> requests{};
             ::std::size_t active_requests{};
+            // Raw object bytes currently waiting in `requests`; bounded by cache_policy::max_async_store_bytes.
+            ::std::size_t queued_bytes{};
+            ::std::uint_least64_t dropped_requests{};
+            ::std::uint_least64_t coalesced_requests{};
             bool stop_requested{};
             bool worker_started{};
 
@@ -910,18 +970,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
 
                         request = ::std::move(this->requests.front());
                         this->requests.pop_front();
+                        this->queued_bytes -= request.object.size();
                         ++this->active_requests;
                     }
 
-                    auto const status{write_cache_blob_atomic(request.ctx, request.blob)};
-                    log_cache_store_completion(request, status);
+                    ::std::chrono::nanoseconds compress_time{};
+                    auto const status{build_and_write_cache_object(request, compress_time)};
 
+                    ::std::size_t queue_depth{};
+                    ::std::uint_least64_t dropped_total{};
                     {
                         // active_requests lets flush() wait for both queued and currently-writing objects.
                         ::std::lock_guard lock{this->mutex};
                         --this->active_requests;
+                        queue_depth = this->requests.size();
+                        dropped_total = this->dropped_requests;
                     }
                     this->condition.notify_all();
+                    log_cache_store_completion(request, status, queue_depth, dropped_total, compress_time);
                 }
             }
 
@@ -946,6 +1012,44 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
 #endif
             }
 
+            /// @brief  Queue admission; the caller holds `mutex`.
+            /// @return false when `request` alone exceeds cache_policy::max_async_store_bytes. Queuing it would drop every pending
+            ///         store and still break the bound, so the caller writes it synchronously instead and `request` is left intact.
+            [[nodiscard]] inline constexpr bool admit_locked(cache_store_request& request) noexcept
+            {
+                auto const incoming_bytes{request.object.size()};
+                auto const max_bytes{request.policy.max_async_store_bytes};
+
+                // A newer object for the same cache file supersedes the pending one; writing both would only publish the older
+                // blob first and then overwrite it. The superseded store leaves the queue before the bound is checked.
+                for(auto it{this->requests.begin()}; it != this->requests.end(); ++it)
+                {
+                    if(!same_cache_identity(it->ctx, request.ctx)) { continue; }
+                    this->queued_bytes -= it->object.size();
+                    this->requests.erase(it);
+                    ++this->coalesced_requests;
+                    break;
+                }
+
+                if(incoming_bytes > max_bytes) [[unlikely]] { return false; }
+
+                // Drop the oldest pending stores until the new one fits. Losing a cache store only costs a recompile in a later
+                // run, while unbounded growth would hold every emitted object in memory behind a slow disk.
+                while(!this->requests.empty() && this->queued_bytes + incoming_bytes > max_bytes)
+                {
+                    auto& oldest{this->requests.front()};
+                    this->queued_bytes -= oldest.object.size();
+                    ++this->dropped_requests;
+                    log_cache_store_drop(oldest, this->queued_bytes);
+                    this->requests.pop_front();
+                }
+
+                // Ownership of the raw object moves to the queue so the caller can return immediately.
+                this->queued_bytes += incoming_bytes;
+                this->requests.push_back(::std::move(request));
+                return true;
+            }
+
             [[nodiscard]] inline constexpr cache_status enqueue(cache_store_request&& request) noexcept
             {
                 bool run_synchronously{};
@@ -957,10 +1061,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                     ::std::lock_guard lock{this->mutex};
                     if(this->stop_requested) { run_synchronously = true; }
                     else if(!this->start_locked()) { run_synchronously = true; }
+                    else if(!this->admit_locked(request)) { run_synchronously = true; }
                     else
                     {
-                        // Ownership of the complete blob moves to the queue so the caller can return immediately.
-                        this->requests.push_back(::std::move(request));
                         this->condition.notify_one();
                         return cache_status::ok;
                     }
@@ -974,9 +1077,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
 
                 if(run_synchronously)
                 {
-                    // Synchronous fallback preserves cache correctness when the worker cannot be started or is shutting down.
-                    auto const status{write_cache_blob_atomic(request.ctx, request.blob)};
-                    log_cache_store_completion(request, status);
+                    // Synchronous fallback preserves cache correctness when the worker cannot be started, is shutting down, or the
+                    // object is larger than the whole async queue bound.
+                    ::std::chrono::nanoseconds compress_time{};
+                    auto const status{build_and_write_cache_object(request, compress_time)};
+                    log_cache_store_completion(request, status, 0uz, 0u, compress_time);
                     return status;
                 }
 
@@ -1002,6 +1107,34 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
             }
         };
 
+        /// @brief  Builds the request for an async store; `object` is moved in, never copied.
+        [[nodiscard]] inline constexpr cache_store_request make_cache_store_request(cache_context const& ctx,
+                                                                                    ::uwvm2::utils::container::u8string&& object,
+                                                                                    cache_policy const& policy,
+                                                                                    ::uwvm2::utils::container::u8string_view log_module,
+                                                                                    bool log_completion,
+                                                                                    ::std::size_t object_index,
+                                                                                    ::std::size_t object_count) noexcept
+        {
+            cache_store_request request{};
+            request.ctx = ctx;
+            request.policy = policy;
+            request.object_bytes = object.size();
+            request.object = ::std::move(object);
+            request.object_index = object_index;
+            request.object_count = object_count;
+            request.log_completion = log_completion;
+            request.log_parallel_object = object_count != 0uz;
+            if(log_completion)
+            {
+                request.log_module.reserve(log_module.size());
+                // The module name must be copied because the async request can outlive LLVM's callback frame.
+                ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(request.log_module)};
+                ::fast_io::io::print(ref, log_module);
+            }
+            return request;
+        }
+
         [[nodiscard]] inline constexpr async_cache_store_worker& async_cache_store_worker_instance() noexcept
         {
             static async_cache_store_worker worker{};  // [global]
@@ -1009,6 +1142,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
         }
     }  // namespace details
 
+    /// @brief      Queue `object` for an asynchronous cache store, taking ownership of the bytes.
+    /// @details    Blob construction (compression, SHA-256, Ed25519 signing) runs on the store worker. The queue is bounded by
+    ///             cache_policy::max_async_store_bytes with drop-oldest semantics and coalesces pending stores of the same cache key.
+    ///             An object larger than the whole bound is written synchronously instead, and its status is returned.
+    /// @return     For a queued object, `cache_status::ok` means only that the store was accepted: it is returned before the blob
+    ///             is built, so compression, signing and write failures (and drops under queue pressure) are reported solely by the
+    ///             `object-cache-store-complete` / `object-cache-store-drop` runtime log lines. Use store_object for a checked store.
+    [[nodiscard]] inline constexpr cache_status store_object_async(cache_context const& ctx,
+                                                                   ::uwvm2::utils::container::u8string&& object,
+                                                                   cache_policy const& policy,
+                                                                   ::uwvm2::utils::container::u8string_view log_module = {},
+                                                                   bool log_completion = false,
+                                                                   ::std::size_t object_index = 0uz,
+                                                                   ::std::size_t object_count = 0uz) noexcept
+    {
+        if(!policy.enable) { return cache_status::disabled; }
+        // Reject oversized objects before they occupy queue space; the worker would refuse them anyway.
+        if(object.size() > policy.max_object_bytes) [[unlikely]] { return cache_status::size_limit_exceeded; }
+
+        return details::async_cache_store_worker_instance().enqueue(
+            details::make_cache_store_request(ctx, ::std::move(object), policy, log_module, log_completion, object_index, object_count));
+    }
+
+    /// @brief      Copying overload for callers that do not own the object bytes (e.g. LLVM's ObjectCache callback).
     [[nodiscard]] inline constexpr cache_status store_object_async(cache_context const& ctx,
                                                                    ::std::byte const* object,
                                                                    ::std::size_t size,
@@ -1019,24 +1176,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::llvm_jit_cache
                                                                    ::std::size_t object_count = 0uz) noexcept
     {
         if(!policy.enable) { return cache_status::disabled; }
+        if(object == nullptr && size != 0uz) [[unlikely]] { return cache_status::malformed; }
+        if(size > policy.max_object_bytes) [[unlikely]] { return cache_status::size_limit_exceeded; }
 
-        details::cache_store_request request{};
-        request.ctx = ctx;
-        request.object_bytes = size;
-        request.object_index = object_index;
-        request.object_count = object_count;
-        request.log_completion = log_completion;
-        request.log_parallel_object = object_count != 0uz;
-        if(log_completion)
-        {
-            request.log_module.reserve(log_module.size());
-            // The module name must be copied because the async request can outlive LLVM's callback frame.
-            ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(request.log_module)};
-            ::fast_io::io::print(ref, log_module);
-        }
-        if(auto const status{details::build_cache_blob(ctx, object, size, policy, request.blob)}; status != cache_status::ok) [[unlikely]] { return status; }
-
-        return details::async_cache_store_worker_instance().enqueue(::std::move(request));
+        ::uwvm2::utils::container::u8string owned{::uwvm2::utils::container::u8string_view{reinterpret_cast<char8_t const*>(object), size}};
+        return store_object_async(ctx, ::std::move(owned), policy, log_module, log_completion, object_index, object_count);
     }
 
     inline constexpr void flush_async_store_objects() noexcept { details::async_cache_store_worker_instance().flush(); }
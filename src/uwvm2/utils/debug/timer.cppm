@@ -22,6 +22,10 @@
 
 module;
 
+// std
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
 // macro
 #include <uwvm2/uwvm_predefine/utils/ansies/uwvm_color_push_macro.h>
 #include <uwvm2/utils/macro/push_macros.h>
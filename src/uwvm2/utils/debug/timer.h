@@ -23,6 +23,10 @@
 #pragma once
 
 #ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
 // macro
 # include <uwvm2/uwvm_predefine/utils/ansies/uwvm_color_push_macro.h>
 # include <uwvm2/utils/macro/push_macros.h>
@@ -40,20 +44,58 @@
 
 UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
 {
+    /// @brief Running total that `timer`s add their measurements to, e.g. one row of `--log-timing-report`.
+    struct timer_accumulator
+    {
+        // Timers sharing one accumulator may run on several threads at once (concurrent module parsing), so every counter is atomic.
+        ::std::atomic<::std::uint_least64_t> total_ns{};
+        ::std::atomic<::std::uint_least64_t> count{};
+        ::std::atomic<::std::uint_least64_t> bytes{};
+    };
+
+    /// @brief Nanoseconds in a non-negative `unix_timestamp` duration.
+    inline constexpr ::std::uint_least64_t timestamp_to_ns(::fast_io::unix_timestamp ts) noexcept
+    {
+        constexpr ::std::uint_least64_t subseconds_per_ns{::fast_io::uint_least64_subseconds_per_second / 1'000'000'000u};
+        return static_cast<::std::uint_least64_t>(ts.seconds) * 1'000'000'000u + static_cast<::std::uint_least64_t>(ts.subseconds) / subseconds_per_ns;
+    }
+
     struct timer
     {
         ::uwvm2::utils::container::u8string_view s{};
         ::fast_io::unix_timestamp t0{};
-#ifdef UWVM_CPP_EXCEPTIONS
-        // `t0_success`: Only useful when exceptions are on, off exceptions directly crash the program.
-        bool t0_success{true};
-#endif
+        timer_accumulator* accumulator{};
+        ::std::uint_least64_t bytes{};
+        bool print{};
+        // `active`: false when nothing is measured, or (exceptions on) when t0 could not be read. Off exceptions directly crash the program.
+        bool active{};
 
         // posix_clock_gettime may throw
         // Please use string literals initially to prevent dangling.
 
-        UWVM_GNU_COLD inline explicit constexpr timer(::uwvm2::utils::container::u8string_view strvw) noexcept : s{strvw}
+        UWVM_GNU_COLD inline explicit constexpr timer(::uwvm2::utils::container::u8string_view strvw) noexcept : s{strvw}, print{true} { start(); }
+
+        /// @brief      Accumulating form: the elapsed time is added to `acc`, and is printed as well in `UWVM_TIMER` builds.
+        /// @details    With a null `acc` in other builds no clock is read, so a hook whose report is disabled costs one branch.
+        inline constexpr timer(::uwvm2::utils::container::u8string_view strvw, timer_accumulator* acc) noexcept :
+            s{strvw},
+            accumulator{acc},
+#ifdef UWVM_TIMER
+            print{true}
+#else
+            print{false}
+#endif
         {
+            if(print || accumulator != nullptr) [[unlikely]] { start(); }
+        }
+
+        /// @brief Attach the size of the processed input (e.g. file bytes) to the accumulated sample.
+        inline constexpr void set_bytes(::std::size_t sz) noexcept { bytes = static_cast<::std::uint_least64_t>(sz); }
+
+        UWVM_GNU_COLD inline constexpr void start() noexcept
+        {
+            active = true;
+
 #ifdef UWVM_CPP_EXCEPTIONS
             try
 #endif
@@ -95,7 +137,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
 # endif
 
                 // Mark t0 as a failure and do not check t1 subsequently
-                t0_success = false;
+                active = false;
             }
 #endif
         }
@@ -105,15 +147,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
         inline constexpr timer(timer&&) = delete;
         inline constexpr timer& operator= (timer&&) = delete;
 
-        UWVM_GNU_COLD inline constexpr ~timer()
+        inline constexpr ~timer()
         {
-#ifdef UWVM_CPP_EXCEPTIONS
-            if(!t0_success) [[unlikely]]
-            {
-                // If the t0 fetch fails, processing is not continued to prevent outputting the wrong time.
-                return;
-            }
-#endif
+            // Nothing is measured, or the t0 fetch failed: processing is not continued to prevent outputting the wrong time.
+            if(!active) [[likely]] { return; }
 
             // `t1` no initialization is required, even if subsequent exceptions are not used, there is no ub.
             ::fast_io::unix_timestamp t1;
@@ -163,6 +200,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
             }
 #endif
 
+            auto const elapsed{t1 - t0};
+
+            if(accumulator != nullptr)
+            {
+                accumulator->total_ns.fetch_add(timestamp_to_ns(elapsed), ::std::memory_order_relaxed);
+                accumulator->count.fetch_add(1u, ::std::memory_order_relaxed);
+                if(bytes != 0u) { accumulator->bytes.fetch_add(bytes, ::std::memory_order_relaxed); }
+            }
+
+            if(!print) { return; }
+
             ::fast_io::iso8601_timestamp local_realtime{};
 
 #ifdef UWVM_CPP_EXCEPTIONS
@@ -191,7 +239,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
                                 s,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
                                 u8"\": ",
-                                t1 - t0,
+                                elapsed,
                                 u8"s ",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
                                 u8"[",
@@ -199,7 +247,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::debug
                                 u8"]\n",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
 #else
-            ::fast_io::io::perr(::fast_io::u8err(), u8"uwvm: [debug] timer \"", s, u8"\": ", t1 - t0, u8"s [", local_realtime, u8"]\n");
+            ::fast_io::io::perr(::fast_io::u8err(), u8"uwvm: [debug] timer \"", s, u8"\": ", elapsed, u8"s [", local_realtime, u8"]\n");
 #endif
         }
     };
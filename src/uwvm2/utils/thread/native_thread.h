@@ -68,6 +68,47 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::thread
         return requested_extra_worker_count < max_useful_extra_worker_count ? requested_extra_worker_count : max_useful_extra_worker_count;
     }
 
+#ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+    /// @brief  Extra worker threads currently held by an `extra_worker_lease`.
+    inline ::std::atomic_size_t extra_workers_in_use{};  // [global] No global variable dependencies from other translation units
+
+    /// @brief      A share of the process-wide budget of `hardware_concurrency() - 1` extra worker threads.
+    /// @details    Nested parallel phases draw from the same budget: modules parsed on one pool may each parse a large code section on
+    ///             another pool, and together they never start more than `hardware_concurrency() - 1` extra threads. A lease may be
+    ///             granted fewer workers than requested, including none, in which case the caller runs serially.
+    struct extra_worker_lease
+    {
+        ::std::size_t count{};
+
+        inline explicit extra_worker_lease(::std::size_t requested_extra_worker_count) noexcept
+        {
+            if(requested_extra_worker_count == 0uz) { return; }
+
+            auto const budget{hardware_concurrency() - 1uz};
+            auto in_use{extra_workers_in_use.load(::std::memory_order_relaxed)};
+            for(;;)
+            {
+                auto const available{budget > in_use ? budget - in_use : 0uz};
+                auto const granted{requested_extra_worker_count < available ? requested_extra_worker_count : available};
+                if(granted == 0uz) { return; }
+                if(extra_workers_in_use.compare_exchange_weak(in_use, in_use + granted, ::std::memory_order_acq_rel, ::std::memory_order_relaxed))
+                {
+                    this->count = granted;
+                    return;
+                }
+            }
+        }
+
+        inline extra_worker_lease(extra_worker_lease const&) noexcept = delete;
+        inline extra_worker_lease& operator= (extra_worker_lease const&) noexcept = delete;
+
+        inline ~extra_worker_lease()
+        {
+            if(this->count != 0uz) { extra_workers_in_use.fetch_sub(this->count, ::std::memory_order_acq_rel); }
+        }
+    };
+#endif
+
     template <typename T>
     struct native_global_typed_allocator_buffer
     {
@@ -51,6 +51,9 @@ export import :runtime_custom_compiler;
 export import :runtime_compiler_log;
 export import :runtime_compile_threads;
 export import :runtime_scheduling_policy;
+export import :runtime_profile_sample;
+export import :runtime_guest_stack;
+export import :runtime_uwvm_int_opfunc_profile;
 export import :runtime_llvm_jit_policy;
 export import :runtime_llvm_jit_lazy_policy;
 export import :runtime_llvm_jit_full_policy;
@@ -63,10 +66,13 @@ export import :runtime_aot;
 export import :runtime_tiered;
 export import :runtime_uwvm_int_set_opcode_conbination_level;
 export import :runtime_uwvm_int_loop_unwind_max_size;
+export import :runtime_uwvm_int_hot_tier_threshold;
 
 // wasi
 export import :wasi_disable_utf8_check;
 export import :wasip1_global_trace;
+export import :wasip1_binary_trace;
+export import :wasip1_decode_binary_trace;
 export import :wasip1_global_expose_host_api;
 export import :wasip1_global_disable;
 export import :wasip1_global_set_fd_limit;
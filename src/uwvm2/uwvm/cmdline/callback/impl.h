@@ -51,6 +51,9 @@
 # include "runtime_compiler_log.h"
 # include "runtime_compile_threads.h"
 # include "runtime_scheduling_policy.h"
+# include "runtime_profile_sample.h"
+# include "runtime_guest_stack.h"
+# include "runtime_uwvm_int_opfunc_profile.h"
 # include "runtime_llvm_jit_policy.h"
 # include "runtime_llvm_jit_lazy_policy.h"
 # include "runtime_llvm_jit_full_policy.h"
@@ -63,10 +66,13 @@
 # include "runtime_tiered.h"
 # include "runtime_uwvm_int_set_opcode_conbination_level.h"
 # include "runtime_uwvm_int_loop_unwind_max_size.h"
+# include "runtime_uwvm_int_hot_tier_threshold.h"
 
 // wasi
 # include "wasi_disable_utf8_check.h"
 # include "wasip1_global_trace.h"
+# include "wasip1_binary_trace.h"
+# include "wasip1_decode_binary_trace.h"
 # include "wasip1_global_expose_host_api.h"
 # include "wasip1_global_disable.h"
 # include "wasip1_global_set_fd_limit.h"
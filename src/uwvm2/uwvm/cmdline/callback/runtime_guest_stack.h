@@ -0,0 +1,142 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <memory>
+# include <limits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+# include <uwvm2/uwvm/runtime/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/ansies/impl.h>
+# include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/cmdline/impl.h>
+# include <uwvm2/uwvm/cmdline/params/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
+{
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+# if defined(UWVM_MODULE)
+    extern "C++" UWVM_GNU_COLD
+# else
+    UWVM_GNU_COLD inline constexpr
+# endif
+        ::uwvm2::utils::cmdline::parameter_return_type runtime_guest_stack_callback([[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results *
+                                                                                        para_begin,
+                                                                                    ::uwvm2::utils::cmdline::parameter_parsing_results * para_curr,
+                                                                                    ::uwvm2::utils::cmdline::parameter_parsing_results * para_end) noexcept
+    {
+        constexpr auto print_usage_error{
+            []() constexpr noexcept
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Usage: ",
+                                    ::uwvm2::utils::cmdline::print_usage(::uwvm2::uwvm::cmdline::params::runtime_guest_stack),
+                                    u8"\n\n");
+            }};
+
+        auto currp1{para_curr + 1u};
+        if(currp1 == para_end || currp1->type != ::uwvm2::utils::cmdline::parameter_parsing_results_type::arg) [[unlikely]]
+        {
+            print_usage_error();
+            return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
+        }
+
+        currp1->type = ::uwvm2::utils::cmdline::parameter_parsing_results_type::occupied_arg;
+
+        auto const currp1_str{currp1->str};
+
+        // Below 1 MiB the guest stack would be smaller than a default host thread stack; above 64 GiB the reservation itself
+        // starts to fail on common overcommit settings.
+        constexpr ::std::size_t min_stack_mib{1uz};
+        constexpr ::std::size_t max_stack_mib{65536uz};
+
+        ::std::size_t stack_mib{};
+        auto const [next, err]{::fast_io::parse_by_scan(currp1_str.cbegin(), currp1_str.cend(), stack_mib)};
+        if(err != ::fast_io::parse_code::ok || next != currp1_str.cend() || stack_mib < min_stack_mib || stack_mib > max_stack_mib ||
+           stack_mib > ::std::numeric_limits<::std::size_t>::max() / (1024uz * 1024uz)) [[unlikely]]
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Invalid runtime guest stack size: \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                currp1_str,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\". Expected an integer in ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                u8"[",
+                                min_stack_mib,
+                                u8", ",
+                                max_stack_mib,
+                                u8"]",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" MiB. Usage: ",
+                                ::uwvm2::utils::cmdline::print_usage(::uwvm2::uwvm::cmdline::params::runtime_guest_stack),
+                                u8"\n\n");
+            return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
+        }
+
+        bool backtrace{};
+        if(auto currp2{para_curr + 2u};
+           currp2 != para_end && currp2->type == ::uwvm2::utils::cmdline::parameter_parsing_results_type::arg && currp2->str == u8"backtrace")
+        {
+            currp2->type = ::uwvm2::utils::cmdline::parameter_parsing_results_type::occupied_arg;
+            backtrace = true;
+        }
+
+        ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_size = stack_mib * 1024uz * 1024uz;
+        ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_guest_stack_backtrace = backtrace;
+
+        return ::uwvm2::utils::cmdline::parameter_return_type::def;
+    }
+#endif
+}  // namespace uwvm2::uwvm::cmdline::params::details
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
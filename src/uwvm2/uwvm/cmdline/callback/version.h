@@ -1374,6 +1374,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
 # else
             ::fast_io::io::perr(u8log_output_ul, u8"    - Loop Unwind: Off\n");
 # endif
+
+            ::fast_io::io::perr(u8log_output_ul,
+                                u8"    - Lazy Hot Tier: On (default threshold ",
+                                ::uwvm2::uwvm::runtime::runtime_mode::default_runtime_uwvm_int_hot_tier_call_threshold,
+                                u8" calls)\n");
         }
 #endif
 #undef UWVM_VERSION_TARGET_POWERPC_FAMILY
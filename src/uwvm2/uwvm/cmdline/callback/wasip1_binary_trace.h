@@ -0,0 +1,144 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-04-26
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_push_macro.h>  // wasip1
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/ansies/impl.h>
+# include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/cmdline/impl.h>
+# include <uwvm2/uwvm/cmdline/params/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
+{
+#ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+# if defined(UWVM_IMPORT_WASI_WASIP1)
+    namespace wasip1_binary_trace_details
+    {
+        using parameter_return_type = ::uwvm2::utils::cmdline::parameter_return_type;
+
+        [[nodiscard]] inline constexpr parameter_return_type print_usage_error(::uwvm2::utils::container::u8string_view msg) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                msg,
+                                u8" Usage: ",
+                                ::uwvm2::utils::cmdline::print_usage(::uwvm2::uwvm::cmdline::params::wasip1_binary_trace),
+                                u8"\n\n");
+            return parameter_return_type::return_m1_imme;
+        }
+
+        [[nodiscard]] inline constexpr parameter_return_type print_open_error(::uwvm2::utils::container::u8string_view path) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Unable to open WASI binary trace file \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                path,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\".\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            return parameter_return_type::return_m1_imme;
+        }
+    }  // namespace wasip1_binary_trace_details
+
+#  if defined(UWVM_MODULE)
+    extern "C++" UWVM_GNU_COLD
+#  else
+    UWVM_GNU_COLD inline constexpr
+#  endif
+        ::uwvm2::utils::cmdline::parameter_return_type wasip1_binary_trace_callback([[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results *
+                                                                                        para_begin,
+                                                                                    ::uwvm2::utils::cmdline::parameter_parsing_results * para_curr,
+                                                                                    ::uwvm2::utils::cmdline::parameter_parsing_results * para_end) noexcept
+    {
+        auto file_arg{para_curr + 1u};
+        if(file_arg == para_end || file_arg->type != ::uwvm2::utils::cmdline::parameter_parsing_results_type::arg) [[unlikely]]
+        {
+            return wasip1_binary_trace_details::print_usage_error(u8"Missing binary trace file path.");
+        }
+
+        file_arg->type = ::uwvm2::utils::cmdline::parameter_parsing_results_type::occupied_arg;
+        auto const file_path{::uwvm2::utils::container::u8string_view{file_arg->str}};
+        if(file_path.empty()) [[unlikely]] { return wasip1_binary_trace_details::print_usage_error(u8"Missing binary trace file path."); }
+
+#  if !defined(__AVR__) && !((defined(_WIN32) && !defined(__WINE__)) && defined(_WIN32_WINDOWS)) && !(defined(__MSDOS__) || defined(__DJGPP__)) &&             \
+      !(defined(__NEWLIB__) && !defined(__CYGWIN__)) && !defined(_PICOLIBC__) && !defined(__wasm__)
+        ::fast_io::u8native_file output{};
+        if(!::uwvm2::uwvm::imported::wasi::wasip1::storage::reopen_wasip1_trace_output_file(output, file_path)) [[unlikely]]
+        {
+            return wasip1_binary_trace_details::print_open_error(file_path);
+        }
+
+        // The header is written and the flusher started here, before any module is loaded, so the hot path only checks one flag.
+        if(!::uwvm2::uwvm::imported::wasi::wasip1::storage::wasip1_binary_trace_writer.start(::std::move(output))) [[unlikely]]
+        {
+            return wasip1_binary_trace_details::print_open_error(file_path);
+        }
+
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::wasip1_binary_trace_enabled = true;
+        return ::uwvm2::utils::cmdline::parameter_return_type::def;
+#  else
+        return wasip1_binary_trace_details::print_usage_error(u8"Binary trace files are not supported on this platform.");
+#  endif
+    }
+
+# endif
+#endif
+}  // namespace uwvm2::uwvm::cmdline::params::details
+
+#ifndef UWVM_MODULE
+// macro
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_pop_macro.h>  // wasip1
+# endif
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,267 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-04-26
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_push_macro.h>  // wasip1
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/ansies/impl.h>
+# include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/cmdline/impl.h>
+# include <uwvm2/uwvm/cmdline/params/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/local_imported/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
+{
+#ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+# if defined(UWVM_IMPORT_WASI_WASIP1)
+    namespace wasip1_decode_binary_trace_details
+    {
+        using parameter_return_type = ::uwvm2::utils::cmdline::parameter_return_type;
+
+        [[nodiscard]] inline constexpr parameter_return_type print_error(::uwvm2::utils::container::u8string_view msg,
+                                                                         ::uwvm2::utils::container::u8string_view path) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                msg,
+                                u8" \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                path,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\".\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            return parameter_return_type::return_m1_imme;
+        }
+
+        /// @brief Map a record id back to the import name. Ids are derived from the names, so the table is the local_imported tuple itself.
+        [[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string_view function_name_of(::std::uint_least32_t function_id) noexcept
+        {
+            using func_tuple_type = typename ::uwvm2::uwvm::imported::wasi::wasip1::local_imported::wasip1_local_imported_module_t::local_function_tuple;
+
+            ::uwvm2::utils::container::u8string_view name{};
+            [&]<typename... Ts>(::std::type_identity<::uwvm2::utils::container::tuple<Ts...>>) constexpr noexcept
+            {
+                static_cast<void>(((Ts::binary_trace_function_id == function_id ? (name = Ts::function_name, true) : false) || ...));
+            }(::std::type_identity<func_tuple_type>{});
+            return name;
+        }
+    }  // namespace wasip1_decode_binary_trace_details
+
+#  if defined(UWVM_MODULE)
+    extern "C++" UWVM_GNU_COLD
+#  else
+    UWVM_GNU_COLD inline constexpr
+#  endif
+        ::uwvm2::utils::cmdline::parameter_return_type
+        wasip1_decode_binary_trace_callback([[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results * para_begin,
+                                            ::uwvm2::utils::cmdline::parameter_parsing_results * para_curr,
+                                            ::uwvm2::utils::cmdline::parameter_parsing_results * para_end) noexcept
+    {
+        namespace storage = ::uwvm2::uwvm::imported::wasi::wasip1::storage;
+        using wasip1_decode_binary_trace_details::print_error;
+
+        auto file_arg{para_curr + 1u};
+        if(file_arg == para_end || file_arg->type != ::uwvm2::utils::cmdline::parameter_parsing_results_type::arg) [[unlikely]]
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Missing binary trace file path. Usage: ",
+                                ::uwvm2::utils::cmdline::print_usage(::uwvm2::uwvm::cmdline::params::wasip1_decode_binary_trace),
+                                u8"\n\n");
+            return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
+        }
+
+        file_arg->type = ::uwvm2::utils::cmdline::parameter_parsing_results_type::occupied_arg;
+        auto const file_path{::uwvm2::utils::container::u8string_view{file_arg->str}};
+
+        ::fast_io::native_file_loader trace_file{};
+#  ifdef UWVM_CPP_EXCEPTIONS
+        try
+#  endif
+        {
+            trace_file = ::fast_io::native_file_loader{::fast_io::u8cstring_view{::fast_io::containers::null_terminated, file_path},
+                                                       ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+        }
+#  ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            return print_error(u8"Unable to open WASI binary trace file", file_path);
+        }
+#  endif
+
+        auto curr{reinterpret_cast<::std::byte const*>(trace_file.data())};
+        auto const end{curr + trace_file.size()};
+
+        storage::wasip1_binary_trace_file_header_t header;
+        if(static_cast<::std::size_t>(end - curr) < sizeof(header)) [[unlikely]] { return print_error(u8"Truncated WASI binary trace header in", file_path); }
+        ::std::memcpy(::std::addressof(header), curr, sizeof(header));
+        curr += sizeof(header);
+
+        constexpr storage::wasip1_binary_trace_file_header_t expected_header{};
+        if(::std::memcmp(header.magic, expected_header.magic, sizeof(header.magic)) != 0) [[unlikely]]
+        {
+            return print_error(u8"Not a WASI binary trace file:", file_path);
+        }
+        // Traces are decoded on the machine (or at least the byte order and build) that wrote them.
+        if(header.endian_tag != expected_header.endian_tag || header.version != storage::wasip1_binary_trace_version ||
+           header.record_size != sizeof(storage::wasip1_binary_trace_record_t)) [[unlikely]]
+        {
+            return print_error(u8"Unsupported WASI binary trace version, record size or byte order in", file_path);
+        }
+
+        ::uwvm2::utils::container::u8string_view const tick_unit{
+            header.tick_kind == storage::wasip1_binary_trace_tick_kind_t::cycle_counter ? ::uwvm2::utils::container::u8string_view{u8" cycles"}
+                                                                                        : ::uwvm2::utils::container::u8string_view{u8" ns"}};
+
+        // No copies will be made here.
+        auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+        // Add raii locks while unlocking operations
+        ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+            ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+        // No copies will be made here.
+        auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
+
+        ::std::size_t record_count{};
+        ::std::uint_least64_t dropped_count{};
+        ::std::uint_least64_t first_tick{};
+        bool has_first_tick{};
+
+        constexpr ::std::size_t record_size{sizeof(storage::wasip1_binary_trace_record_t)};
+        for(; static_cast<::std::size_t>(end - curr) >= record_size; curr += record_size)
+        {
+            storage::wasip1_binary_trace_record_t record;
+            ::std::memcpy(::std::addressof(record), curr, sizeof(record));
+
+            if(record.function_id == storage::wasip1_binary_trace_dropped_function_id) [[unlikely]]
+            {
+                dropped_count += record.args[0];
+                ::fast_io::io::perrln(u8log_output_ul, u8"[thread ", record.thread_index, u8"] <dropped ", record.args[0], u8" records>");
+                continue;
+            }
+
+            if(!has_first_tick)
+            {
+                first_tick = record.begin_tick;
+                has_first_tick = true;
+            }
+
+            ++record_count;
+
+            // Ticks are printed relative to the first record so traces of different runs line up.
+            ::fast_io::io::perr(u8log_output_ul, u8"[thread ", record.thread_index, u8"] +", record.begin_tick - first_tick, tick_unit, u8" ");
+
+            if(auto const name{wasip1_decode_binary_trace_details::function_name_of(record.function_id)}; !name.empty())
+            {
+                ::fast_io::io::perr(u8log_output_ul, name);
+            }
+            else
+            {
+                ::fast_io::io::perr(u8log_output_ul, u8"<unknown ", ::fast_io::mnp::hex0x(record.function_id), u8">");
+            }
+
+            ::fast_io::io::perr(u8log_output_ul, u8"(");
+            auto const stored_arg_count{record.arg_count < storage::wasip1_binary_trace_max_args ? static_cast<::std::size_t>(record.arg_count)
+                                                                                                   : storage::wasip1_binary_trace_max_args};
+            for(::std::size_t i{}; i != stored_arg_count; ++i)
+            {
+                if(i != 0uz) { ::fast_io::io::perr(u8log_output_ul, u8", "); }
+                ::fast_io::io::perr(u8log_output_ul, record.args[i]);
+            }
+            if(record.arg_count > stored_arg_count) { ::fast_io::io::perr(u8log_output_ul, u8", ..."); }
+
+            ::fast_io::io::perrln(u8log_output_ul, u8") -> ", record.result, u8" [", record.duration_ticks, tick_unit, u8"]");
+        }
+
+        ::fast_io::io::perr(u8log_output_ul,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                            u8"[info]  ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"Decoded ",
+                            record_count,
+                            u8" WASI calls, ",
+                            dropped_count,
+                            u8" dropped.\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+
+        if(curr != end) [[unlikely]]
+        {
+            // A partial tail is expected when the writer was killed mid-flush.
+            ::fast_io::io::perr(u8log_output_ul,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Ignored ",
+                                static_cast<::std::size_t>(end - curr),
+                                u8" trailing bytes of a truncated record.\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        return ::uwvm2::utils::cmdline::parameter_return_type::return_imme;
+    }
+
+# endif
+#endif
+}  // namespace uwvm2::uwvm::cmdline::params::details
+
+#ifndef UWVM_MODULE
+// macro
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_pop_macro.h>  // wasip1
+# endif
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
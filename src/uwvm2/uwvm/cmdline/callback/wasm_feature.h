@@ -257,6 +257,29 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
         auto& para{wasm_feature_details::wasm1p1_parameter()};
         return enable_single_wasm_feature(para_curr, u8"--wasm-feature-enable-simd", para.explicit_enable_simd, para.enable_simd, false, false);
     }
+
+#if defined(UWVM_MODULE)
+    extern "C++" UWVM_GNU_COLD
+#else
+    UWVM_GNU_COLD inline constexpr
+#endif
+        /// @brief Handle --wasm-feature-enable-tail-call.
+        /// @details Tail calls are a standalone proposal outside the wasm1.1 collection, so only a repeated switch conflicts.
+        ::uwvm2::utils::cmdline::parameter_return_type wasm_feature_enable_tail_call_callback(
+            [[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results * para_begin,
+            ::uwvm2::utils::cmdline::parameter_parsing_results * para_curr,
+            [[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results * para_end) noexcept
+    {
+        auto& para{wasm_feature_details::wasm1p1_parameter()};
+        if(para.explicit_enable_tail_call) [[unlikely]]
+        {
+            return wasm_feature_details::print_conflict(para_curr->str, u8"--wasm-feature-enable-tail-call");
+        }
+
+        para.explicit_enable_tail_call = true;
+        para.enable_tail_call = true;
+        return wasm_feature_details::parameter_return_type::def;
+    }
 }
 
 #ifndef UWVM_MODULE
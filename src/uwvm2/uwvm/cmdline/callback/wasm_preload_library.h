@@ -122,22 +122,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
             rename_module_name = ::uwvm2::utils::container::u8string_view{currp2_str};
         }
 
-        auto& new_preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm.emplace_back()};
-
-        auto const load_wasm_file_rtl{
-            ::uwvm2::uwvm::wasm::loader::load_wasm_file(new_preloaded_wasm, file_name, rename_module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter)};
-
-        switch(load_wasm_file_rtl)
-        {
-            [[likely]] case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok:
-            {
-                break;
-            }
-            [[unlikely]] default:
-            {
-                return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
-            }
-        }
+        // Only record the request: all wasm modules are loaded and parsed together (concurrently) before the dependency graph is built.
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm_requests.push_back({.file_name = file_name, .rename_module_name = rename_module_name});
 
         return ::uwvm2::utils::cmdline::parameter_return_type::def;
     }
@@ -77,6 +77,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_feature_enable_sign_extension),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_feature_enable_nontrapping_float_to_int),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_feature_enable_simd),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_feature_enable_tail_call),
 #if defined(UWVM_SUPPORT_WEAK_SYMBOL)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_list_weak_symbol_module),
 #endif
@@ -98,6 +99,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_disable_delay_local),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_enable_instruction_reorder),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_loop_unwind_max_size),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_hot_tier_threshold),
+#  if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_opfunc_profile),
+#  endif
 # endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_jit),
@@ -111,12 +116,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compiler_log),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compile_threads),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_scheduling_policy),
+# if defined(UWVM_RUNTIME_HAS_BACKEND)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_profile_sample),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_guest_stack),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_disable_cross_module_direct_call),
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT) || defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_policy),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_lazy_policy),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_full_policy),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_call_stack),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_disable_ir_verifaction),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_disable_wasip1_direct_call),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_no_sign),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_no_verify),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_path),
@@ -135,6 +146,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
 #ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
 # if defined(UWVM_IMPORT_WASI_WASIP1)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_trace),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_binary_trace),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_decode_binary_trace),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_expose_host_api),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_disable),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_set_fd_limit),
@@ -204,6 +217,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::log_disable_warning),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::log_convert_warn_to_fatal),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::log_verbose),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::log_timing_report),
 #if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
             ::std::addressof(::uwvm2::uwvm::cmdline::params::log_win32_use_ansi),
 #endif
@@ -53,11 +53,15 @@ export import :runtime_custom_compiler;
 export import :runtime_compiler_log;
 export import :runtime_compile_threads;
 export import :runtime_scheduling_policy;
+export import :runtime_profile_sample;
+export import :runtime_guest_stack;
+export import :runtime_disable_cross_module_direct_call;
 export import :runtime_llvm_jit_policy;
 export import :runtime_llvm_jit_lazy_policy;
 export import :runtime_llvm_jit_full_policy;
 export import :runtime_llvm_jit_call_stack;
 export import :runtime_llvm_jit_disable_ir_verifaction;
+export import :runtime_llvm_jit_disable_wasip1_direct_call;
 export import :runtime_llvm_jit_cache_no_sign;
 export import :runtime_llvm_jit_cache_no_verify;
 export import :runtime_llvm_jit_cache_path;
@@ -71,12 +75,16 @@ export import :runtime_uwvm_int_set_opcode_conbination_level;
 export import :runtime_uwvm_int_disable_delay_local;
 export import :runtime_uwvm_int_enable_instruction_reorder;
 export import :runtime_uwvm_int_loop_unwind_max_size;
+export import :runtime_uwvm_int_hot_tier_threshold;
+export import :runtime_uwvm_int_opfunc_profile;
 export import :runtime_tiered_disable_uwvm_int_lazy_interpreter;
 export import :runtime_tiered_disable_llvm_full_jit;
 
 // wasi
 export import :wasi_disable_utf8_check;
 export import :wasip1_global_trace;
+export import :wasip1_binary_trace;
+export import :wasip1_decode_binary_trace;
 export import :wasip1_global_expose_host_api;
 export import :wasip1_global_disable;
 export import :wasip1_global_set_fd_limit;
@@ -141,6 +149,7 @@ export import :log_enable_warning;
 export import :log_disable_warning;
 export import :log_convert_warn_to_fatal;
 export import :log_verbose;
+export import :log_timing_report;
 export import :log_win32_use_ansi;
 
 #ifndef UWVM_MODULE
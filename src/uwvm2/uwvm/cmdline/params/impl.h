@@ -53,11 +53,15 @@
 # include "runtime_compiler_log.h"
 # include "runtime_compile_threads.h"
 # include "runtime_scheduling_policy.h"
+# include "runtime_profile_sample.h"
+# include "runtime_guest_stack.h"
+# include "runtime_disable_cross_module_direct_call.h"
 # include "runtime_llvm_jit_policy.h"
 # include "runtime_llvm_jit_lazy_policy.h"
 # include "runtime_llvm_jit_full_policy.h"
 # include "runtime_llvm_jit_call_stack.h"
 # include "runtime_llvm_jit_disable_ir_verifaction.h"
+# include "runtime_llvm_jit_disable_wasip1_direct_call.h"
 # include "runtime_llvm_jit_cache_no_sign.h"
 # include "runtime_llvm_jit_cache_no_verify.h"
 # include "runtime_llvm_jit_cache_path.h"
@@ -71,12 +75,16 @@
 # include "runtime_uwvm_int_disable_delay_local.h"
 # include "runtime_uwvm_int_enable_instruction_reorder.h"
 # include "runtime_uwvm_int_loop_unwind_max_size.h"
+# include "runtime_uwvm_int_hot_tier_threshold.h"
+# include "runtime_uwvm_int_opfunc_profile.h"
 # include "runtime_tiered_disable_uwvm_int_lazy_interpreter.h"
 # include "runtime_tiered_disable_llvm_full_jit.h"
 
 // wasi
 # include "wasi_disable_utf8_check.h"
 # include "wasip1_global_trace.h"
+# include "wasip1_binary_trace.h"
+# include "wasip1_decode_binary_trace.h"
 # include "wasip1_global_expose_host_api.h"
 # include "wasip1_global_disable.h"
 # include "wasip1_global_set_fd_limit.h"
@@ -141,6 +149,7 @@
 # include "log_disable_warning.h"
 # include "log_convert_warn_to_fatal.h"
 # include "log_verbose.h"
+# include "log_timing_report.h"
 # include "log_win32_use_ansi.h"
 
 #endif
@@ -36,6 +36,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params
         inline bool wasm_feature_enable_sign_extension_is_exist{};
         inline bool wasm_feature_enable_nontrapping_float_to_int_is_exist{};
         inline bool wasm_feature_enable_simd_is_exist{};
+        inline bool wasm_feature_enable_tail_call_is_exist{};
 
 #if defined(UWVM_MODULE)
         extern "C++"
@@ -104,6 +105,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params
             ::uwvm2::utils::cmdline::parameter_return_type wasm_feature_enable_simd_callback(::uwvm2::utils::cmdline::parameter_parsing_results*,
                                                                                              ::uwvm2::utils::cmdline::parameter_parsing_results*,
                                                                                              ::uwvm2::utils::cmdline::parameter_parsing_results*) noexcept;
+
+#if defined(UWVM_MODULE)
+        extern "C++"
+#else
+        inline constexpr
+#endif
+            ::uwvm2::utils::cmdline::parameter_return_type
+            wasm_feature_enable_tail_call_callback(::uwvm2::utils::cmdline::parameter_parsing_results*,
+                                                   ::uwvm2::utils::cmdline::parameter_parsing_results*,
+                                                   ::uwvm2::utils::cmdline::parameter_parsing_results*) noexcept;
     }  // namespace details
 
 #if defined(__clang__)
@@ -163,6 +174,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params
                                                                                  .handle{::std::addressof(details::wasm_feature_enable_simd_callback)},
                                                                                  .is_exist{::std::addressof(details::wasm_feature_enable_simd_is_exist)},
                                                                                  .cate{::uwvm2::utils::cmdline::categorization::wasm}};
+
+    /// @brief Command-line switch that enables the tail-call proposal (`return_call`/`return_call_indirect`).
+    inline constexpr ::uwvm2::utils::cmdline::parameter wasm_feature_enable_tail_call{
+        .name{u8"--wasm-feature-enable-tail-call"},
+        .describe{u8"Enable the WebAssembly tail-call proposal. It is not part of the 1.1 feature set and may be combined with \"--wasm-feature-1p1\"."},
+        .handle{::std::addressof(details::wasm_feature_enable_tail_call_callback)},
+        .is_exist{::std::addressof(details::wasm_feature_enable_tail_call_is_exist)},
+        .cate{::uwvm2::utils::cmdline::categorization::wasm}};
 #if defined(__clang__)
 # pragma clang diagnostic pop
 #endif
@@ -31,6 +31,7 @@ export module uwvm2.uwvm.crtmain.global:process_time;
 import fast_io;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
+import uwvm2.uwvm.utils.timing;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
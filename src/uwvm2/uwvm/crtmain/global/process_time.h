@@ -30,6 +30,7 @@
 # include <fast_io.h>
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -63,6 +64,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::global
     UWVM_GNU_COLD inline constexpr void record_total_wasm_time_start() noexcept
     {
         if(wasm_start_time_available) [[unlikely]] { return; }
+
+        // `_start` is about to run: everything measured so far is startup latency.
+        ::uwvm2::uwvm::utils::timing::print_startup_timing_report();
+
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
         {
             ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
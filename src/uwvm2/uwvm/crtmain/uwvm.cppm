@@ -39,6 +39,7 @@ import uwvm2.utils.ansies;
 import uwvm2.utils.debug;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
+import uwvm2.uwvm.utils.timing;
 import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.run;
 import uwvm2.uwvm.crtmain.global;
@@ -39,6 +39,7 @@
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 # include <uwvm2/uwvm/cmdline/impl.h>
 # include <uwvm2/uwvm/run/impl.h>
 # include <uwvm2/uwvm/crtmain/global/impl.h>
@@ -58,6 +59,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm
     /// @return     exit value
     inline constexpr int uwvm_uz_u8main(::std::size_t argc, char8_t const* const* argv) noexcept
     {
+        // Origin of `--log-timing-report`: preloaded modules are loaded while the command line is parsed.
+        ::uwvm2::uwvm::utils::timing::record_startup_origin();
+
         switch(::uwvm2::uwvm::cmdline::parsing(argc, argv))
         {
             case ::uwvm2::uwvm::cmdline::parsing_return_val::def:
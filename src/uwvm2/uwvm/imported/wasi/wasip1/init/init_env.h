@@ -132,6 +132,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
         // Join lazy compiler workers before proc_exit enters the host exit path and starts global destruction.
         ::uwvm2::runtime::lib::lazy_compile_stop_before_proc_exit_host_api();
 
+        // fast_exit skips static destructors, so the binary trace writer would lose everything still sitting in the rings.
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::stop_wasip1_binary_trace();
+
 #  if defined(__linux__)
         ::fast_io::fast_exit(static_cast<int>(code));
 #  elif defined(_WIN32)
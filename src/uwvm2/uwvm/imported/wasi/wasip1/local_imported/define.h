@@ -146,6 +146,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::local_imported
                           "WASI local_imported wrapper expects uwvm wasip1 env type");
 
             using value_type = wasm_value_type;
+            using ret_type = Ret;
+            inline static constexpr ::std::size_t parameter_count{sizeof...(Args)};
             using res_tuple = wasip1_result_tuple_t<Ret>;
             using para_tuple = ::uwvm2::uwvm::wasm::type::import_function_parameter_tuple_t<feature_list, map_to_wasm_value_type<Args>()...>;
             using local_imported_function_type = ::uwvm2::uwvm::wasm::type::local_imported_function_type_t<res_tuple, para_tuple>;
@@ -183,6 +185,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::local_imported
                           "WASI local_imported wrapper expects uwvm wasip1 env type");
 
             using value_type = wasm_value_type;
+            using ret_type = Ret;
+            inline static constexpr ::std::size_t parameter_count{sizeof...(Args)};
             using res_tuple = wasip1_result_tuple_t<Ret>;
             using para_tuple = ::uwvm2::uwvm::wasm::type::import_function_parameter_tuple_t<feature_list, map_to_wasm_value_type<Args>()...>;
             using local_imported_function_type = ::uwvm2::uwvm::wasm::type::local_imported_function_type_t<res_tuple, para_tuple>;
@@ -216,7 +220,49 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::local_imported
         template <auto Fn, auto& Name>
         struct wasip1_local_imported_function final : wasip1_local_imported_function_base<Fn>
         {
+            using base_type = wasip1_local_imported_function_base<Fn>;
+            using local_imported_function_type = typename base_type::local_imported_function_type;
+
             inline static constexpr ::uwvm2::utils::container::u8string_view function_name{Name};
+
+            inline static constexpr ::std::uint_least32_t binary_trace_function_id{
+                ::uwvm2::uwvm::imported::wasi::wasip1::storage::wasip1_binary_trace_function_id(function_name)};
+
+            /// @note Shadows `base_type::call`. With the binary trace off this is one well-predicted load of a global flag in front of
+            ///       the zero-overhead wrapper; the record is filled only from the raw Wasm parameters, so the text trace inside `Fn` and
+            ///       the binary trace stay independent.
+            inline static constexpr void call(local_imported_function_type& func_type) noexcept
+            {
+                namespace storage = ::uwvm2::uwvm::imported::wasi::wasip1::storage;
+
+                if(!storage::wasip1_binary_trace_enabled) [[likely]]
+                {
+                    base_type::call(func_type);
+                    return;
+                }
+
+                constexpr ::std::size_t arg_count{base_type::parameter_count};
+                constexpr ::std::size_t stored_arg_count{arg_count < storage::wasip1_binary_trace_max_args ? arg_count
+                                                                                                            : storage::wasip1_binary_trace_max_args};
+
+                storage::wasip1_binary_trace_record_t record{.function_id = binary_trace_function_id,
+                                                             .arg_count = static_cast<::std::uint_least32_t>(arg_count)};
+                [&]<::std::size_t... I>(::std::index_sequence<I...>) constexpr noexcept
+                {
+                    ((record.args[I] = storage::wasip1_binary_trace_arg(::uwvm2::utils::container::get<I>(func_type.params))), ...);
+                }(::std::make_index_sequence<stored_arg_count>{});
+
+                record.begin_tick = storage::wasip1_binary_trace_tick();
+                base_type::call(func_type);
+                record.duration_ticks = storage::wasip1_binary_trace_tick() - record.begin_tick;
+
+                if constexpr(!::std::is_void_v<typename base_type::ret_type>)
+                {
+                    record.result = static_cast<::std::uint_least32_t>(::uwvm2::utils::container::get<0>(func_type.res));
+                }
+
+                storage::wasip1_binary_trace_push(record);
+            }
         };
 
         // wasi: WASI-Preview1
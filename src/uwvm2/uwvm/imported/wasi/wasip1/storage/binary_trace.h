@@ -0,0 +1,549 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-03-27
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+# include <memory>
+# include <type_traits>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>  // wasi
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_push_macro.h>  // wasip1
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include "env.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
+{
+#ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+# if defined(UWVM_IMPORT_WASI_WASIP1)
+    // Binary WASI trace
+    //
+    // The text trace (`--wasip1-global-trace`) formats a line while the guest waits for the host call to return, which dominates the
+    // cost of syscall-heavy workloads. The binary trace only copies a fixed-size record into a per-thread single-producer ring; a
+    // background flusher drains every ring into the output file. Producers never block: when a ring is full the record is dropped and
+    // counted, and the flusher writes one marker record carrying the drop count so the decoder can report the gap.
+    //
+    // File layout: one `wasip1_binary_trace_file_header_t`, then `wasip1_binary_trace_record_t` records in native byte order.
+    // Records of one thread are in call order; records of different threads are interleaved in flush order and can be re-ordered by
+    // `begin_tick`.
+
+    inline constexpr ::std::size_t wasip1_binary_trace_max_args{8uz};
+
+    /// @brief Records per thread ring. Must be a power of two.
+    inline constexpr ::std::size_t wasip1_binary_trace_ring_capacity{4096uz};
+    static_assert((wasip1_binary_trace_ring_capacity & (wasip1_binary_trace_ring_capacity - 1uz)) == 0uz);
+
+    /// @brief Upper bound of concurrently traced threads. Threads beyond this bound are counted but not recorded. Rings of exited threads
+    ///        are handed to new threads, so the bound limits live threads, not threads created over the whole run.
+    inline constexpr ::std::size_t wasip1_binary_trace_max_rings{256uz};
+
+    inline constexpr ::std::uint_least32_t wasip1_binary_trace_version{1u};
+
+    /// @brief `function_id` of the marker record emitted after records were dropped; `args[0]` holds the drop count.
+    inline constexpr ::std::uint_least32_t wasip1_binary_trace_dropped_function_id{0u};
+
+    enum class wasip1_binary_trace_tick_kind_t : ::std::uint_least32_t
+    {
+        cycle_counter = 0u,
+        monotonic_ns = 1u
+    };
+
+    struct wasip1_binary_trace_file_header_t
+    {
+        char8_t magic[8]{u8'U', u8'W', u8'V', u8'M', u8'W', u8'T', u8'R', u8'C'};
+        ::std::uint_least32_t version{wasip1_binary_trace_version};
+        ::std::uint_least32_t record_size{};
+        wasip1_binary_trace_tick_kind_t tick_kind{};
+        // Written as 0x01020304 by the producer; a decoder on a host of the other byte order sees 0x04030201.
+        ::std::uint_least32_t endian_tag{0x01020304u};
+    };
+
+    struct wasip1_binary_trace_record_t
+    {
+        /// @brief FNV-1a hash of the import name, see `wasip1_binary_trace_function_id`.
+        ::std::uint_least32_t function_id{};
+        /// @brief WASI errno returned by the call (0 for calls without a result).
+        ::std::uint_least32_t result{};
+        ::std::uint_least32_t thread_index{};
+        /// @brief Number of parameters of the import. Only the first `wasip1_binary_trace_max_args` are stored.
+        ::std::uint_least32_t arg_count{};
+        /// @brief Raw Wasm parameters, zero-extended. `args[0]` is the fd for the `fd_*` family.
+        ::std::uint_least64_t args[wasip1_binary_trace_max_args]{};
+        ::std::uint_least64_t begin_tick{};
+        ::std::uint_least64_t duration_ticks{};
+    };
+
+    static_assert(::std::is_trivially_copyable_v<wasip1_binary_trace_record_t>);
+    static_assert(::std::is_trivially_copyable_v<wasip1_binary_trace_file_header_t>);
+
+    /// @brief Stable id of a WASI import for the binary trace. Ids never collide with the dropped-records marker.
+    [[nodiscard]] inline constexpr ::std::uint_least32_t wasip1_binary_trace_function_id(::uwvm2::utils::container::u8string_view name) noexcept
+    {
+        ::std::uint_least32_t hash{2166136261u};
+        for(auto const c: name)
+        {
+            hash ^= static_cast<::std::uint_least32_t>(static_cast<::std::uint_least8_t>(c));
+            hash = static_cast<::std::uint_least32_t>(hash * 16777619u);
+        }
+        return hash == wasip1_binary_trace_dropped_function_id ? 1u : hash;
+    }
+
+    template <typename T>
+    [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr ::std::uint_least64_t wasip1_binary_trace_arg(T v) noexcept
+    {
+        // Zero-extend so an i32 argument keeps its bit pattern in the 64-bit slot.
+        using unsigned_type = ::std::make_unsigned_t<T>;
+        return static_cast<::std::uint_least64_t>(static_cast<unsigned_type>(v));
+    }
+
+#  if (defined(__x86_64__) || defined(__i386__)) && UWVM_HAS_BUILTIN(__builtin_ia32_rdtsc)
+    inline constexpr wasip1_binary_trace_tick_kind_t wasip1_binary_trace_tick_kind{wasip1_binary_trace_tick_kind_t::cycle_counter};
+#  else
+    inline constexpr wasip1_binary_trace_tick_kind_t wasip1_binary_trace_tick_kind{wasip1_binary_trace_tick_kind_t::monotonic_ns};
+#  endif
+
+    /// @brief Timestamp for trace records. Uses the TSC on x86; other targets do not expose a user-mode cycle counter that is safe to
+    ///        read everywhere, so they fall back to the monotonic clock.
+    [[nodiscard]] UWVM_ALWAYS_INLINE inline ::std::uint_least64_t wasip1_binary_trace_tick() noexcept
+    {
+#  if (defined(__x86_64__) || defined(__i386__)) && UWVM_HAS_BUILTIN(__builtin_ia32_rdtsc)
+        return static_cast<::std::uint_least64_t>(__builtin_ia32_rdtsc());
+#  else
+        ::fast_io::unix_timestamp ts{};
+#   ifdef UWVM_CPP_EXCEPTIONS
+        try
+#   endif
+        {
+            ts = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic);
+        }
+#   ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            return 0u;
+        }
+#   endif
+
+        constexpr ::std::uint_least64_t mul_factor{::fast_io::uint_least64_subseconds_per_second / 1'000'000'000u};
+        return static_cast<::std::uint_least64_t>(ts.seconds) * 1'000'000'000u + static_cast<::std::uint_least64_t>(ts.subseconds) / mul_factor;
+#  endif
+    }
+
+    inline constexpr ::std::size_t wasip1_binary_trace_cache_line_size{64uz};
+
+    /// @brief Single-producer single-consumer ring owned by one guest thread and drained by the flusher.
+    struct wasip1_binary_trace_ring_t
+    {
+        // Producer and consumer indices are free-running; `head - tail` is the fill level.
+        alignas(wasip1_binary_trace_cache_line_size)::std::atomic_size_t head{};
+        alignas(wasip1_binary_trace_cache_line_size)::std::atomic_size_t tail{};
+        alignas(wasip1_binary_trace_cache_line_size)::std::atomic_size_t dropped{};
+
+        // Set by the owning thread's TLS destructor. A new thread claims the ring by clearing it; records the old owner left behind
+        // are still drained, and `head` simply continues.
+        ::std::atomic_bool released{};
+
+#  if !defined(UWVM_USE_THREAD_LOCAL)
+        // Owner lookup for builds without C++ thread_local.
+        os_thread_id_t owner{};
+#  endif
+        // Written by the owner when it claims the ring; one value per traced thread, including threads that reuse a ring.
+        ::std::uint_least32_t thread_index{};
+
+        wasip1_binary_trace_record_t records[wasip1_binary_trace_ring_capacity];
+    };
+
+    struct wasip1_binary_trace_writer_t
+    {
+        ::fast_io::u8native_file file{};
+
+        ::std::atomic<wasip1_binary_trace_ring_t*> rings[wasip1_binary_trace_max_rings]{};
+        ::std::atomic_size_t ring_count{};
+        // Source of `thread_index`: counts threads, while `ring_count` counts rings.
+        ::std::atomic_uint_least32_t thread_count{};
+        // Calls from threads that could not get a ring because `wasip1_binary_trace_max_rings` was reached.
+        ::std::atomic_size_t unregistered_dropped{};
+
+        // Serializes file writes between the flusher, the synchronous fallback and `stop`.
+        ::std::atomic_flag drain_lock{};
+        ::std::atomic_bool stop_requested{};
+        ::std::atomic_bool flusher_running{};
+        bool started{};
+
+#  ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+        ::fast_io::native_thread flusher{};
+#  endif
+
+        inline constexpr wasip1_binary_trace_writer_t() noexcept = default;
+        inline constexpr wasip1_binary_trace_writer_t(wasip1_binary_trace_writer_t const&) noexcept = delete;
+        inline constexpr wasip1_binary_trace_writer_t& operator= (wasip1_binary_trace_writer_t const&) noexcept = delete;
+
+        inline constexpr ~wasip1_binary_trace_writer_t()
+        {
+            this->stop();
+
+            using allocator_t = ::fast_io::native_typed_global_allocator<wasip1_binary_trace_ring_t>;
+            auto const count{this->registered_ring_count()};
+            for(::std::size_t i{}; i != count; ++i)
+            {
+                auto const ring{this->rings[i].exchange(nullptr, ::std::memory_order_acq_rel)};
+                if(ring == nullptr) { continue; }
+                ::std::destroy_at(ring);
+                allocator_t::deallocate_n(ring, 1uz);
+            }
+        }
+
+        [[nodiscard]] inline constexpr ::std::size_t registered_ring_count() const noexcept
+        {
+            auto const count{this->ring_count.load(::std::memory_order_acquire)};
+            return count < wasip1_binary_trace_max_rings ? count : wasip1_binary_trace_max_rings;
+        }
+
+        /// @return false when the file could not be written; the caller disables the trace.
+        [[nodiscard]] inline constexpr bool write_records(wasip1_binary_trace_record_t const* begin, wasip1_binary_trace_record_t const* end) noexcept
+        {
+            if(begin == end) { return true; }
+
+#  ifdef UWVM_CPP_EXCEPTIONS
+            try
+#  endif
+            {
+                ::fast_io::operations::write_all_bytes(this->file, reinterpret_cast<::std::byte const*>(begin), reinterpret_cast<::std::byte const*>(end));
+            }
+#  ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                return false;
+            }
+#  endif
+            return true;
+        }
+
+        /// @brief Drain every registered ring once.
+        /// @return Number of records written.
+        inline constexpr ::std::size_t drain() noexcept
+        {
+            // A producer without a flusher drains its own full ring, so several threads can meet here while another holds the
+            // lock for a file write; back off the same way the runtime's spin locks do instead of hammering the flag.
+            for(unsigned spin_count{}; this->drain_lock.test_and_set(::std::memory_order_acquire);)
+            {
+                if(++spin_count > 1000u) { ::fast_io::this_thread::yield(); }
+                else
+                {
+                    ::uwvm2::utils::mutex::rwlock_pause();
+                }
+            }
+
+            ::std::size_t written{};
+            bool ok{true};
+
+            auto const count{this->registered_ring_count()};
+            for(::std::size_t i{}; i != count && ok; ++i)
+            {
+                auto const ring{this->rings[i].load(::std::memory_order_acquire)};
+                // The slot is reserved before the ring is published.
+                if(ring == nullptr) { continue; }
+
+                auto const tail{ring->tail.load(::std::memory_order_relaxed)};
+                auto const head{ring->head.load(::std::memory_order_acquire)};
+
+                if(head != tail)
+                {
+                    constexpr ::std::size_t mask{wasip1_binary_trace_ring_capacity - 1uz};
+                    auto const first{tail & mask};
+                    auto const fill{head - tail};
+                    auto const first_run{fill < wasip1_binary_trace_ring_capacity - first ? fill : wasip1_binary_trace_ring_capacity - first};
+
+                    // At most two contiguous runs: [first, capacity) and the wrapped prefix.
+                    ok = this->write_records(ring->records + first, ring->records + first + first_run) &&
+                         this->write_records(ring->records, ring->records + (fill - first_run));
+
+                    ring->tail.store(head, ::std::memory_order_release);
+                    written += fill;
+                }
+
+                if(auto const dropped{ring->dropped.exchange(0uz, ::std::memory_order_relaxed)}; dropped != 0uz && ok) [[unlikely]]
+                {
+                    wasip1_binary_trace_record_t const marker{.function_id = wasip1_binary_trace_dropped_function_id,
+                                                              .thread_index = ring->thread_index,
+                                                              .arg_count = 1u,
+                                                              .args = {static_cast<::std::uint_least64_t>(dropped)}};
+                    ok = this->write_records(::std::addressof(marker), ::std::addressof(marker) + 1u);
+                }
+            }
+
+            if(auto const dropped{this->unregistered_dropped.exchange(0uz, ::std::memory_order_relaxed)}; dropped != 0uz && ok) [[unlikely]]
+            {
+                wasip1_binary_trace_record_t const marker{.function_id = wasip1_binary_trace_dropped_function_id,
+                                                          .thread_index = ::std::numeric_limits<::std::uint_least32_t>::max(),
+                                                          .arg_count = 1u,
+                                                          .args = {static_cast<::std::uint_least64_t>(dropped)}};
+                ok = this->write_records(::std::addressof(marker), ::std::addressof(marker) + 1u);
+            }
+
+            // A write error (disk full, closed pipe) stops the flusher; producers keep filling and dropping into their rings.
+            if(!ok) [[unlikely]] { this->stop_requested.store(true, ::std::memory_order_release); }
+
+            this->drain_lock.clear(::std::memory_order_release);
+            return written;
+        }
+
+        inline constexpr void run_flusher() noexcept
+        {
+            while(!this->stop_requested.load(::std::memory_order_acquire))
+            {
+                if(this->drain() != 0uz) { continue; }
+
+                // Idle: poll again after 1ms. Producers never signal, so the hot path stays a plain store.
+                ::fast_io::unix_timestamp sleep_duration{};
+                sleep_duration.subseconds = static_cast<decltype(sleep_duration.subseconds)>(::fast_io::uint_least64_subseconds_per_second / 1000u);
+                ::fast_io::this_thread::sleep_for(sleep_duration);
+            }
+        }
+
+        /// @brief Write the header and start the flusher. Called once from command-line parsing, before any guest code runs.
+        [[nodiscard]] inline constexpr bool start(::fast_io::u8native_file&& output) noexcept
+        {
+            this->file = ::std::move(output);
+
+            wasip1_binary_trace_file_header_t const header{.record_size = static_cast<::std::uint_least32_t>(sizeof(wasip1_binary_trace_record_t)),
+                                                           .tick_kind = wasip1_binary_trace_tick_kind};
+#  ifdef UWVM_CPP_EXCEPTIONS
+            try
+#  endif
+            {
+                ::fast_io::operations::write_all_bytes(this->file,
+                                                       reinterpret_cast<::std::byte const*>(::std::addressof(header)),
+                                                       reinterpret_cast<::std::byte const*>(::std::addressof(header) + 1u));
+            }
+#  ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                return false;
+            }
+#  endif
+
+            this->started = true;
+
+#  ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+#   ifdef UWVM_CPP_EXCEPTIONS
+            try
+#   endif
+            {
+                this->flusher = ::fast_io::native_thread{[this]() constexpr noexcept { this->run_flusher(); }};
+                this->flusher_running.store(true, ::std::memory_order_release);
+            }
+#   ifdef UWVM_CPP_EXCEPTIONS
+            catch(...)
+            {
+                // Without a flusher, full rings are drained synchronously by their producer (see `wasip1_binary_trace_push`).
+            }
+#   endif
+#  endif
+
+            return true;
+        }
+
+        /// @brief Stop the flusher and write out everything still buffered. Safe to call more than once.
+        inline constexpr void stop() noexcept
+        {
+            if(!this->started) { return; }
+
+            this->stop_requested.store(true, ::std::memory_order_release);
+
+#  ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+            if(this->flusher.joinable()) { this->flusher.join(); }
+            this->flusher_running.store(false, ::std::memory_order_release);
+#  endif
+
+            // Final drain. Guest threads may still be running after proc_exit begins; their late records are best-effort.
+            this->drain();
+            this->started = false;
+        }
+
+        [[nodiscard]] inline constexpr bool has_flusher() const noexcept { return this->flusher_running.load(::std::memory_order_acquire); }
+    };
+
+    /// @brief Set once by `--wasip1-binary-trace` before execution; read on every WASI call.
+    inline bool wasip1_binary_trace_enabled{};  // [global]
+
+    inline wasip1_binary_trace_writer_t wasip1_binary_trace_writer{};  // [global]
+
+#  if defined(UWVM_USE_THREAD_LOCAL)
+#   if UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__tls_model__)
+#    ifdef UWVM
+    [[__gnu__::__tls_model__("local-exec")]]
+#    else
+    [[__gnu__::__tls_model__("local-dynamic")]]
+#    endif
+#   endif
+    inline thread_local wasip1_binary_trace_ring_t* current_wasip1_binary_trace_ring{};  // [global] [thread_local]
+
+    /// @brief Hands the calling thread's ring back when the thread exits. Kept apart from `current_wasip1_binary_trace_ring` so the hot
+    ///        lookup stays a trivially destructible TLS load; this object is only touched when a ring is registered.
+    struct wasip1_binary_trace_ring_releaser_t
+    {
+        wasip1_binary_trace_ring_t* ring{};
+
+        inline constexpr ~wasip1_binary_trace_ring_releaser_t()
+        {
+            if(this->ring != nullptr) { this->ring->released.store(true, ::std::memory_order_release); }
+        }
+    };
+
+    inline thread_local wasip1_binary_trace_ring_releaser_t wasip1_binary_trace_ring_releaser{};  // [global] [thread_local]
+#  endif
+
+    inline constexpr void claim_wasip1_binary_trace_ring(wasip1_binary_trace_ring_t& ring) noexcept
+    {
+        ring.thread_index = wasip1_binary_trace_writer.thread_count.fetch_add(1u, ::std::memory_order_relaxed);
+#  if !defined(UWVM_USE_THREAD_LOCAL)
+        ring.owner = current_thread_id();
+#  endif
+    }
+
+    [[nodiscard]] inline constexpr wasip1_binary_trace_ring_t* register_wasip1_binary_trace_ring() noexcept
+    {
+        auto& writer{wasip1_binary_trace_writer};
+
+        // Reuse the ring of an exited thread first. Claiming with acquire pairs with the releaser's store, so this thread continues
+        // from the old owner's last `head`; the flusher keeps draining the ring in between and never sees two producers.
+        auto const count{writer.registered_ring_count()};
+        for(::std::size_t i{}; i != count; ++i)
+        {
+            auto const ring{writer.rings[i].load(::std::memory_order_acquire)};
+            if(ring == nullptr || !ring->released.load(::std::memory_order_relaxed)) { continue; }
+
+            bool expected{true};
+            if(ring->released.compare_exchange_strong(expected, false, ::std::memory_order_acquire, ::std::memory_order_relaxed))
+            {
+                claim_wasip1_binary_trace_ring(*ring);
+                return ring;
+            }
+        }
+
+        // Cheap pre-check so threads past the bound do not allocate a ring on every call.
+        if(writer.ring_count.load(::std::memory_order_relaxed) >= wasip1_binary_trace_max_rings) [[unlikely]] { return nullptr; }
+
+        auto const index{writer.ring_count.fetch_add(1uz, ::std::memory_order_acq_rel)};
+        if(index >= wasip1_binary_trace_max_rings) [[unlikely]] { return nullptr; }
+
+        using allocator_t = ::fast_io::native_typed_global_allocator<wasip1_binary_trace_ring_t>;
+        auto const ring{::std::construct_at(allocator_t::allocate(1uz))};
+        claim_wasip1_binary_trace_ring(*ring);
+
+        writer.rings[index].store(ring, ::std::memory_order_release);
+        return ring;
+    }
+
+    [[nodiscard]] inline constexpr wasip1_binary_trace_ring_t* current_wasip1_binary_trace_ring_lookup() noexcept
+    {
+#  if defined(UWVM_USE_THREAD_LOCAL)
+        auto ring{current_wasip1_binary_trace_ring};
+        if(ring == nullptr) [[unlikely]]
+        {
+            ring = register_wasip1_binary_trace_ring();
+            current_wasip1_binary_trace_ring = ring;
+            wasip1_binary_trace_ring_releaser.ring = ring;
+        }
+        return ring;
+#  else
+        // Without thread_local there is no exit hook, so rings are never released; a thread whose id the OS recycles picks up the
+        // ring of the exited thread through this lookup.
+        auto const id{current_thread_id()};
+        auto& writer{wasip1_binary_trace_writer};
+        auto const count{writer.registered_ring_count()};
+        for(::std::size_t i{}; i != count; ++i)
+        {
+            auto const ring{writer.rings[i].load(::std::memory_order_acquire)};
+            if(ring != nullptr && ring->owner == id) { return ring; }
+        }
+        return register_wasip1_binary_trace_ring();
+#  endif
+    }
+
+    /// @brief Append one record to the calling thread's ring. Never blocks on I/O while a flusher thread is running.
+    inline constexpr void wasip1_binary_trace_push(wasip1_binary_trace_record_t const& record) noexcept
+    {
+        auto& writer{wasip1_binary_trace_writer};
+
+        auto const ring{current_wasip1_binary_trace_ring_lookup()};
+        if(ring == nullptr) [[unlikely]]
+        {
+            writer.unregistered_dropped.fetch_add(1uz, ::std::memory_order_relaxed);
+            return;
+        }
+
+        auto const head{ring->head.load(::std::memory_order_relaxed)};
+        if(head - ring->tail.load(::std::memory_order_acquire) == wasip1_binary_trace_ring_capacity) [[unlikely]]
+        {
+            // No flusher thread on this platform: drain on the producer instead of losing records.
+            if(!writer.has_flusher() && !writer.stop_requested.load(::std::memory_order_relaxed)) { writer.drain(); }
+
+            if(head - ring->tail.load(::std::memory_order_acquire) == wasip1_binary_trace_ring_capacity)
+            {
+                ring->dropped.fetch_add(1uz, ::std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        auto& slot{ring->records[head & (wasip1_binary_trace_ring_capacity - 1uz)]};
+        slot = record;
+        slot.thread_index = ring->thread_index;
+        ring->head.store(head + 1uz, ::std::memory_order_release);
+    }
+
+    /// @brief Flush the binary trace before the process leaves through a path that skips static destructors (e.g. `proc_exit`).
+    inline constexpr void stop_wasip1_binary_trace() noexcept
+    {
+        if(!wasip1_binary_trace_enabled) { return; }
+        wasip1_binary_trace_writer.stop();
+    }
+
+# endif
+#endif
+}  // namespace uwvm2::uwvm::imported::wasi::wasip1::storage
+
+#ifndef UWVM_MODULE
+// macro
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_pop_macro.h>  // wasip1
+# endif
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>  // wasi
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -24,6 +24,7 @@ module;
 
 export module uwvm2.uwvm.imported.wasi.wasip1.storage;
 export import :env;
+export import :binary_trace;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -24,4 +24,5 @@
 
 #ifndef UWVM_MODULE
 # include "env.h"
+# include "binary_trace.h"
 #endif
@@ -27,6 +27,7 @@ module;
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <memory>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
 #include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -37,6 +38,7 @@ import fast_io;
 import uwvm2.utils.ansies;
 import uwvm2.utils.debug;
 import uwvm2.utils.madvise;
+import uwvm2.utils.thread;
 import uwvm2.parser.wasm.base;
 import uwvm2.parser.wasm.concepts;
 import uwvm2.parser.wasm.standard;
@@ -44,6 +46,7 @@ import uwvm2.parser.wasm.binfmt.base;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.utils.memory;
+import uwvm2.uwvm.utils.timing;
 import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.wasm;
 import uwvm2.uwvm.imported.wasi.wasip1;
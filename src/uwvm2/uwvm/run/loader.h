@@ -28,6 +28,7 @@
 # include <cstdint>
 # include <type_traits>
 # include <utility>
+# include <memory>
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 # include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -39,6 +40,7 @@
 # include <uwvm2/utils/ansies/impl.h>
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/utils/madvise/impl.h>
+# include <uwvm2/utils/thread/impl.h>
 # include <uwvm2/parser/wasm/base/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
 # include <uwvm2/parser/wasm/standard/impl.h>
@@ -46,6 +48,7 @@
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/utils/memory/impl.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 # include <uwvm2/uwvm/cmdline/impl.h>
 # include <uwvm2/uwvm/wasm/impl.h>
 # include <uwvm2/uwvm/imported/wasi/wasip1/impl.h>
@@ -140,9 +143,63 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 # endif
 #endif
 
-    inline constexpr int load_exec_wasm_module() noexcept
+    namespace details
+    {
+        struct wasm_module_load_job_t
+        {
+            ::uwvm2::uwvm::wasm::type::wasm_file_t* wf{};
+            ::uwvm2::utils::container::u8cstring_view file_name{};
+            ::uwvm2::utils::container::u8string_view rename_module_name{};
+            ::uwvm2::uwvm::wasm::loader::wasm_file_preparse_t preparsed{};
+            int error_retval{};
+        };
+
+#ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+        inline ::uwvm2::utils::thread::scheduled_task make_preparse_wasm_module_task(wasm_module_load_job_t & job)
+        {
+            // `preparse_wasm_file` is noexcept and records parse failures in `job.preparsed`, so no failure state is shared between tasks.
+            ::uwvm2::uwvm::wasm::loader::preparse_wasm_file(*job.wf, job.preparsed);
+            co_return;
+        }
+#endif
+
+        inline constexpr void preparse_wasm_modules(::uwvm2::utils::container::vector<wasm_module_load_job_t> & jobs) noexcept
+        {
+#ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+            // Held until the pool is joined; code sections parsed by these tasks can only borrow what is left of the budget.
+            ::uwvm2::utils::thread::extra_worker_lease const lease{
+                ::uwvm2::utils::thread::clamp_extra_worker_count(jobs.size(), ::uwvm2::utils::thread::hardware_concurrency() - 1uz)};
+
+            if(lease.count != 0uz)
+            {
+                ::uwvm2::utils::thread::scheduled_task_batch task_batch{jobs.size()};
+                for(auto& job: jobs)
+                {
+                    auto task{make_preparse_wasm_module_task(job)};
+                    ::std::construct_at(task_batch.handles.buffer + task_batch.handle_count, task.release());
+                    ++task_batch.handle_count;
+                }
+
+                // Joins all workers before returning: every module is parsed before the dependency graph is built.
+                ::uwvm2::utils::thread::native_thread_pool thread_pool{};
+                thread_pool.run(task_batch, lease.count);
+                return;
+            }
+#endif
+
+            for(auto& job: jobs) { ::uwvm2::uwvm::wasm::loader::preparse_wasm_file(*job.wf, job.preparsed); }
+        }
+    }  // namespace details
+
+    /// @brief      Load the preloaded wasm modules (`--wasm-preload-library`, command-line order) and then the main module.
+    /// @details    Modules are loaded in three stages:
+    ///             1. map every file and detect its binary format, in module order;
+    ///             2. parse all modules concurrently on a `native_thread_pool`, joined before returning;
+    ///             3. finish every module in module order (custom sections, module names, warnings), replaying parse failures.
+    ///             All diagnostics are printed by stages 1 and 3, so the output does not depend on thread scheduling: open failures are
+    ///             reported first, then the first parse failure in module order.
+    inline constexpr int load_wasm_modules() noexcept
     {
-        // The wasm preload has been fully parsed
         // The dl preload has been fully registered
 
         if(!::uwvm2::uwvm::cmdline::wasm_file_ppos) [[unlikely]]
@@ -171,18 +228,64 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
             return static_cast<int>(::uwvm2::uwvm::run::retval::load_main_module_error);
         }
 
-        // get main module path
-        auto const module_file_name{::uwvm2::uwvm::cmdline::wasm_file_ppos->str};
+        auto const& preload_requests{::uwvm2::uwvm::wasm::storage::preloaded_wasm_requests};
+
+        // `preloaded_wasm` must not reallocate once jobs point into it.
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm.reserve(::uwvm2::uwvm::wasm::storage::preloaded_wasm.size() + preload_requests.size());
 
-        // load main module
-        auto const load_wasm_file_rtl{::uwvm2::uwvm::wasm::loader::load_wasm_file(::uwvm2::uwvm::wasm::storage::execute_wasm,
-                                                                                  module_file_name,
-                                                                                  ::uwvm2::uwvm::wasm::storage::execute_wasm.module_name,
-                                                                                  ::uwvm2::uwvm::wasm::storage::wasm_parameter)};
+        ::uwvm2::utils::container::vector<details::wasm_module_load_job_t> jobs{};
+        jobs.reserve(preload_requests.size() + 1uz);
 
-        if(load_wasm_file_rtl != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+        for(auto const& request: preload_requests)
         {
-            return static_cast<int>(::uwvm2::uwvm::run::retval::load_main_module_error);
+            auto& new_preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm.emplace_back()};
+            jobs.push_back_unchecked({.wf = ::std::addressof(new_preloaded_wasm),
+                                      .file_name = request.file_name,
+                                      .rename_module_name = request.rename_module_name,
+                                      .error_retval = static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error)});
+        }
+
+        jobs.push_back_unchecked({.wf = ::std::addressof(::uwvm2::uwvm::wasm::storage::execute_wasm),
+                                  .file_name = ::uwvm2::uwvm::cmdline::wasm_file_ppos->str,
+                                  .rename_module_name = ::uwvm2::uwvm::wasm::storage::execute_wasm.module_name,
+                                  .error_retval = static_cast<int>(::uwvm2::uwvm::run::retval::load_main_module_error)});
+
+        if(jobs.size() == 1uz)
+        {
+            // Nothing to overlap with: take the plain serial path.
+            auto& job{jobs.front_unchecked()};
+            if(::uwvm2::uwvm::wasm::loader::load_wasm_file(*job.wf, job.file_name, job.rename_module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter) !=
+               ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+            {
+                return job.error_retval;
+            }
+            return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
+        }
+
+        // stage 1
+        for(auto& job: jobs)
+        {
+            if(::uwvm2::uwvm::wasm::loader::prepare_wasm_file(*job.wf, job.file_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter, job.preparsed) !=
+               ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+            {
+                return job.error_retval;
+            }
+        }
+
+        // stage 2
+        details::preparse_wasm_modules(jobs);
+
+        // stage 3
+        for(auto& job: jobs)
+        {
+            if(::uwvm2::uwvm::wasm::loader::load_wasm_file(*job.wf,
+                                                           job.file_name,
+                                                           job.rename_module_name,
+                                                           ::uwvm2::uwvm::wasm::storage::wasm_parameter,
+                                                           ::std::addressof(job.preparsed)) != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+            {
+                return job.error_retval;
+            }
         }
 
         return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
@@ -269,6 +372,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
             }
 
+            ::uwvm2::utils::debug::timer wasi_setup_timer{
+                u8"wasi setup",
+                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::wasi_setup)};
+
             if(!details::validate_loaded_wasip1_group_bindings()) [[unlikely]]
             {
                 return static_cast<int>(::uwvm2::uwvm::run::retval::load_local_modules_error);
@@ -54,6 +54,7 @@ import uwvm2.parser.wasm.binfmt.base;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.utils.memory;
+import uwvm2.uwvm.utils.timing;
 import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.wasm;
 import uwvm2.uwvm.runtime;
@@ -71,6 +71,7 @@
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/utils/memory/impl.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 # include <uwvm2/uwvm/cmdline/impl.h>
 # include <uwvm2/uwvm/wasm/impl.h>
 # include <uwvm2/uwvm/runtime/impl.h>
@@ -1624,11 +1625,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
      */
     inline constexpr int run() noexcept
     {
-        // Preloaded wasm modules and dynamic-link bindings are prepared before this function is entered.  This driver
+        // Preloaded wasm module requests and dynamic-link bindings are prepared before this function is entered.  This driver
         // consumes the resulting global command-line/storage state and performs the final ordered load/execute sequence.
 
-        // Load the executable wasm module first.  Later local/weak modules may satisfy imports used by the executable.
-        if(auto const ret{::uwvm2::uwvm::run::load_exec_wasm_module()}; ret != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { return ret; }
+        // Load the preloaded wasm modules and the executable wasm module first; their parses run concurrently.  Later local/weak
+        // modules may satisfy imports used by the executable.
+        if(auto const ret{::uwvm2::uwvm::run::load_wasm_modules()}; ret != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { return ret; }
 
         // Load explicitly-provided local modules.  These participate in normal import resolution and duplicate checks.
         if(auto const ret{::uwvm2::uwvm::run::load_local_modules()}; ret != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { return ret; }
@@ -1673,6 +1675,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 
                 ::uwvm2::uwvm::wasm::section_detail::print_section_details();
 
+                ::uwvm2::uwvm::utils::timing::print_startup_timing_report();
+
                 // Return directly: section-detail mode is complete and must not fall through into runtime checks.
                 return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
             }
@@ -1681,11 +1685,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                 // Validate all wasm code with the parser/runtime validator entry point, but do not initialize executable
                 // runtime state.  This path is for validity checks, not compilation, partitioning, or backend execution.
                 // `validate_all_wasm_code` already emits its own verbose progress diagnostics.
-                if(!::uwvm2::uwvm::runtime::validator::validate_all_wasm_code()) [[unlikely]]
                 {
-                    return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+                    ::uwvm2::utils::debug::timer validation_timer{
+                        u8"validate all wasm code",
+                        ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::validation)};
+                    if(!::uwvm2::uwvm::runtime::validator::validate_all_wasm_code()) [[unlikely]]
+                    {
+                        return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+                    }
                 }
 
+                ::uwvm2::uwvm::utils::timing::print_startup_timing_report();
+
                 // Return directly: validation mode is complete and must not require executable backends.
                 return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
             }
@@ -1710,14 +1721,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 #else
         // Executable mode begins here.  Import existence and import-cycle validation must precede runtime initialization
         // because runtime storage assumes all module links are resolvable and acyclic.
-        if(auto const ret{::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles()};
-           ret != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok) [[unlikely]]
         {
-            return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+            ::uwvm2::utils::debug::timer dependency_check_timer{
+                u8"check import exist and detect cycles",
+                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::dependency_check)};
+            if(auto const ret{::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles()};
+               ret != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok) [[unlikely]]
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+            }
         }
 
         // Initialize runtime storage, link metadata, and backend-visible module data after import resolution succeeds.
-        ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+        {
+            ::uwvm2::utils::debug::timer initialize_runtime_timer{
+                u8"initialize runtime",
+                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::initialize_runtime)};
+            ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+        }
 
 # if defined(UWVM_RUNTIME_DEBUG_INTERPRETER)
         // The debug interpreter backend is modeled as a full-compile backend.  If the command line selected a lazy mode,
@@ -1927,9 +1948,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 
                         // Validate before entering lazy execution, then tell the runtime it can skip duplicate whole-code
                         // validation work.  Per-function compilation may still occur lazily.
-                        if(!::uwvm2::uwvm::runtime::validator::validate_all_wasm_code()) [[unlikely]]
                         {
-                            return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+                            ::uwvm2::utils::debug::timer validation_timer{
+                                u8"validate all wasm code",
+                                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::validation)};
+                            if(!::uwvm2::uwvm::runtime::validator::validate_all_wasm_code()) [[unlikely]]
+                            {
+                                return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
+                            }
                         }
 
                         ::uwvm2::runtime::lib::lazy_compile_run_config cfg{};
@@ -4468,6 +4468,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                             ::fast_io::fast_terminate();
                         }
 
+                        // Rebuild the whole slot so a previously flattened call_indirect entry cannot outlive its payload.
+                        slot = {};
                         if(func_idx < imported_func_count)
                         {
                             slot.storage.imported_ptr = ::std::addressof(curr_rt.imported_function_vec_storage.index_unchecked(func_idx));
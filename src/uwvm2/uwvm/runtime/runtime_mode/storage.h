@@ -173,6 +173,31 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
     /// @details Interpreted either as `functions per task` or `cumulative wasm code-body bytes per task` depending on the selected policy.
     inline ::std::size_t global_runtime_scheduling_size{default_runtime_scheduling_size};  // [global]
 
+    /// @brief Whether the runtime guest sampling profiler was explicitly configured.
+    inline bool runtime_profile_sample_existed{};  // [global]
+
+    /// @brief Runtime guest sampling profiler frequency in Hz.
+    /// @details `0` disables sampling. A non-zero value arms a process-wide `SIGPROF` interval timer while guest code runs.
+    inline ::std::size_t global_runtime_profile_sample_hz{};  // [global]
+
+    /// @brief Output path of the folded-stack profile written when guest execution stops.
+    inline ::uwvm2::utils::container::u8string global_runtime_profile_sample_path{};  // [global]
+
+    /// @brief Whether a dedicated guest stack was explicitly configured.
+    inline bool runtime_guest_stack_existed{};  // [global]
+
+    /// @brief Size in bytes of the dedicated, guard-paged native stack guest execution runs on.
+    /// @details `0` keeps running on the host thread's own stack. A non-zero size turns native stack exhaustion into a wasm
+    ///          call-stack-exhausted trap instead of a crash.
+    inline ::std::size_t global_runtime_guest_stack_size{};  // [global]
+
+    /// @brief Keep per-call logical wasm frames (trap backtraces) while running on the guest stack.
+    /// @details Without it only the innermost frame and the call depth are tracked, unless the sampling profiler needs full stacks.
+    inline bool global_runtime_guest_stack_backtrace{};  // [global]
+
+    /// @brief Whether calls into functions defined by another wasm module go through the generic import bridge instead of a direct link.
+    inline bool runtime_disable_cross_module_direct_call{};  // [global]
+
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
     enum class runtime_uwvm_int_opcode_conbination_level_t : unsigned
     {
@@ -184,6 +209,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 
     inline constexpr ::std::size_t default_runtime_uwvm_int_loop_unwind_max_size{4096uz};
 
+    inline constexpr ::std::uint_least32_t default_runtime_uwvm_int_hot_tier_call_threshold{256u};
+
     inline constexpr runtime_uwvm_int_opcode_conbination_level_t default_runtime_uwvm_int_opcode_conbination_level{
 # if defined(UWVM_ENABLE_UWVM_INT_EXTRA_HEAVY_COMBINE_OPS)
         runtime_uwvm_int_opcode_conbination_level_t::extra
@@ -218,6 +245,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 
     /// @brief Maximum Wasm body bytes considered for one loop-unwind decision.
     inline ::std::size_t global_runtime_uwvm_int_loop_unwind_max_size{default_runtime_uwvm_int_loop_unwind_max_size};  // [global]
+
+    /// @brief Whether the uwvm-int lazy hot-tier call threshold was explicitly configured.
+    inline bool runtime_uwvm_int_hot_tier_threshold_existed{};  // [global]
+
+    /// @brief Calls after which a lazily baseline-translated uwvm-int function is re-translated with full opcode conbination.
+    /// @details `0` disables the baseline tier, so lazy mode translates every function once with the full pipeline.
+    inline ::std::uint_least32_t global_runtime_uwvm_int_hot_tier_call_threshold{default_runtime_uwvm_int_hot_tier_call_threshold};  // [global]
+
+# if defined(UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE)
+    /// @brief Whether the uwvm-int opfunc n-gram profiler was explicitly configured.
+    inline bool runtime_uwvm_int_opfunc_profile_existed{};  // [global]
+
+    /// @brief Output path of the opfunc n-gram report. Non-empty makes the translator emit profiling probes.
+    inline ::uwvm2::utils::container::u8string global_runtime_uwvm_int_opfunc_profile_path{};  // [global]
+# endif
 #endif
 
 #if defined(UWVM_RUNTIME_LLVM_JIT) || defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -248,6 +290,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
     /// @brief Whether runtime LLVM JIT IR verification is disabled by command line.
     inline bool runtime_llvm_jit_disable_ir_verifaction{};  // [global]
 
+    /// @brief Whether LLVM JIT code calls WASI Preview1 imports through the raw host bridge instead of typed direct thunks.
+    inline bool runtime_llvm_jit_disable_wasip1_direct_call{};  // [global]
+
     /// @brief Whether runtime LLVM JIT cache signature generation is disabled by command line.
     inline bool runtime_llvm_jit_cache_no_sign{};  // [global]
 
@@ -228,6 +228,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::storage
         imported_function_storage_u storage{};
 
         local_defined_table_elem_storage_type_t type{};
+
+        // Flattened call_indirect entry, owned by the interpreter runtime: a process-wide canonical signature id plus the resolved
+        // direct-call record (opaque here). `call_sig_id == 0` means "no flat entry". Writers fill it together with the payload (the
+        // interpreter's table ops go through `table_elem_flatten_func`), table.copy moves it along, and readers never write it.
+        ::std::uint_least32_t call_sig_id{};
+        void const* call_target{};
     };
 }
 
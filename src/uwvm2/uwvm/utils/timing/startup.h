@@ -0,0 +1,204 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::utils::timing
+{
+    /// @brief      Startup phases recorded by `--log-timing-report`.
+    /// @details    The phases cover everything between process start and the first instruction of `_start`.
+    ///             Phases can be entered more than once (e.g. one `parse` per module), the report aggregates them.
+    enum class startup_phase : unsigned
+    {
+        file_load,
+        parse,
+        dependency_check,
+        validation,
+        initialize_runtime,
+        translate,
+        wasi_setup,
+        phase_end
+    };
+
+    inline constexpr ::std::size_t startup_phase_count{static_cast<::std::size_t>(startup_phase::phase_end)};
+
+    inline constexpr ::uwvm2::utils::container::u8string_view get_startup_phase_name(startup_phase phase) noexcept
+    {
+        switch(phase)
+        {
+            case startup_phase::file_load: return u8"file_load";
+            case startup_phase::parse: return u8"parse";
+            case startup_phase::dependency_check: return u8"dependency_check";
+            case startup_phase::validation: return u8"validation";
+            case startup_phase::initialize_runtime: return u8"initialize_runtime";
+            case startup_phase::translate: return u8"translate";
+            case startup_phase::wasi_setup: return u8"wasi_setup";
+            [[unlikely]] default: return u8"unknown";
+        }
+    }
+
+    /// @brief Enabled by `--log-timing-report`.
+    inline bool show_timing_report{};  // [global]
+
+    /// @brief One row per phase, filled by the `::uwvm2::utils::debug::timer` hooks of the phase.
+    inline ::uwvm2::utils::debug::timer_accumulator startup_phase_accumulators[startup_phase_count]{};  // [global]
+
+    /// @brief Number of wasm modules (exec + preloaded wasm) that reached the parse phase. Weak symbol (native) modules are not parsed.
+    inline ::std::atomic<::std::uint_least64_t> startup_module_count{};  // [global]
+
+    /// @brief Guard so that the report is printed exactly once, whichever path reaches the end of startup first.
+    inline ::std::atomic_flag startup_timing_report_printed{};  // [global]
+
+    /// @brief Process-relative origin so that `startup_ns` measures the whole startup, not only the recorded phases.
+    inline ::fast_io::unix_timestamp startup_origin{};  // [global]
+    inline bool startup_origin_available{};             // [global]
+
+    /// @note Called before the command line is parsed, so it cannot depend on `show_timing_report`.
+    inline void record_startup_origin() noexcept
+    {
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+            startup_origin = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            startup_origin_available = true;
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            startup_origin_available = false;
+        }
+#endif
+    }
+
+    /// @brief      Accumulator for the debug timer hook of `phase`.
+    /// @return     Null when `--log-timing-report` is off, in which case the hook reads no clock (outside `UWVM_TIMER` builds).
+    inline ::uwvm2::utils::debug::timer_accumulator* get_startup_phase_accumulator(startup_phase phase) noexcept
+    {
+        if(!show_timing_report) [[likely]] { return nullptr; }
+        return startup_phase_accumulators + static_cast<::std::size_t>(phase);
+    }
+
+    /// @brief Counts one module for the `timing summary modules=` field.
+    inline void record_startup_module() noexcept
+    {
+        if(show_timing_report) [[unlikely]] { startup_module_count.fetch_add(1u, ::std::memory_order_relaxed); }
+    }
+
+    /// @brief      Print the startup phase breakdown.
+    /// @details    Output is one `key=value` record per line so that benchmarks can parse it:
+    ///             `uwvm: [info]  timing phase=parse total_ns=... count=... bytes=...`
+    ///             followed by a `timing summary ...` line. Only the first call prints.
+    UWVM_GNU_COLD inline void print_startup_timing_report() noexcept
+    {
+        if(!show_timing_report) { return; }
+        if(startup_timing_report_printed.test_and_set(::std::memory_order_acq_rel)) { return; }
+
+        ::std::uint_least64_t startup_total_ns{};
+        if(startup_origin_available)
+        {
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
+#endif
+            {
+                startup_total_ns =
+                    ::uwvm2::utils::debug::timestamp_to_ns(::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw) - startup_origin);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                startup_total_ns = 0u;
+            }
+#endif
+        }
+
+        ::std::uint_least64_t phases_total_ns{};
+
+        for(::std::size_t i{}; i != startup_phase_count; ++i)
+        {
+            auto const& rec{startup_phase_accumulators[i]};
+            auto const total_ns{rec.total_ns.load(::std::memory_order_relaxed)};
+            phases_total_ns += total_ns;
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"timing phase=",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                get_startup_phase_name(static_cast<startup_phase>(i)),
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" total_ns=",
+                                total_ns,
+                                u8" count=",
+                                rec.count.load(::std::memory_order_relaxed),
+                                u8" bytes=",
+                                rec.bytes.load(::std::memory_order_relaxed),
+                                u8"\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        // Phases may overlap when modules are parsed concurrently, so `phases_ns` can exceed `startup_ns`.
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                            u8"[info]  ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"timing summary modules=",
+                            startup_module_count.load(::std::memory_order_relaxed),
+                            u8" phases_ns=",
+                            phases_total_ns,
+                            u8" startup_ns=",
+                            startup_total_ns,
+                            u8"\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+    }
+}  // namespace uwvm2::uwvm::utils::timing
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
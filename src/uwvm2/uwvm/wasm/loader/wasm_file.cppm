@@ -26,6 +26,7 @@ module;
 #include <cstdint>
 #include <climits>
 #include <type_traits>
+#include <atomic>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
 #include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -45,6 +46,7 @@ import uwvm2.parser.wasm.binfmt.base;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.utils.memory;
+import uwvm2.uwvm.utils.timing;
 import uwvm2.uwvm.wasm.base;
 import uwvm2.uwvm.wasm.type;
 import uwvm2.uwvm.wasm.storage;
@@ -27,6 +27,7 @@
 # include <cstdint>
 # include <climits>
 # include <type_traits>
+# include <atomic>
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 # include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -44,6 +45,7 @@
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/utils/memory/impl.h>
+# include <uwvm2/uwvm/utils/timing/impl.h>
 # include <uwvm2/uwvm/wasm/base/impl.h>
 # include <uwvm2/uwvm/wasm/type/impl.h>
 # include <uwvm2/uwvm/wasm/storage/impl.h>
@@ -65,17 +67,25 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
         wasm_parser_error
     };
 
-    inline constexpr load_wasm_file_rtl load_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf,
-                                                       ::uwvm2::utils::container::u8cstring_view load_file_name,
-                                                       ::uwvm2::utils::container::u8string_view rename_module_name,
-                                                       ::uwvm2::uwvm::wasm::type::wasm_parameter_t para) noexcept
+    /// @brief      Outcome of a module parse that ran ahead of `load_wasm_file`.
+    /// @details    `prepare_wasm_file` maps the file and detects the binary format in module order, `preparse_wasm_file` parses it
+    ///             (thread-safe, prints nothing), and `load_wasm_file` finishes loading in module order. A recorded parse failure is
+    ///             replayed by `load_wasm_file`, so diagnostics keep the same order and form as a serial load.
+    struct wasm_file_preparse_t
     {
-        wf.file_name = load_file_name;
-
-        wf.wasm_parameter = para;
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        // Parse duration, only measured with `--log-verbose` and reported when the module is replayed.
+        ::fast_io::unix_timestamp parse_time{};
+        bool file_loaded{};
+        bool parsed{};
+        bool failed{};
+    };
 
-        // verbose
-        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+    namespace details
+    {
+        /// @brief Verbose "Parse wasm file ... done" line, shared by the serial parse and the replay of a module parsed ahead of time.
+        inline constexpr void print_parse_wasm_file_done(::uwvm2::utils::container::u8cstring_view load_file_name,
+                                                         ::fast_io::unix_timestamp parse_time) noexcept
         {
             ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
@@ -83,128 +93,155 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
                                 u8"[info]  ",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                u8"Loading WASM File \"",
+                                u8"Parse wasm file \"",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
                                 load_file_name,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                u8"\". ",
+                                u8"\" done. (time=",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
-                                u8"[",
-                                ::uwvm2::uwvm::io::get_local_realtime(),
-                                u8"] ",
+                                parse_time,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"s). ",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
                                 u8"(verbose)\n",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
         }
 
-        ::fast_io::unix_timestamp start_time{};
-        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        /// @brief Open and map the wasm file, detect its binary format version and prefetch it.
+        inline constexpr load_wasm_file_rtl open_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf,
+                                                           ::uwvm2::utils::container::u8cstring_view load_file_name) noexcept
         {
-#ifdef UWVM_CPP_EXCEPTIONS
-            try
-#endif
-            {
-                start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
-            }
-#ifdef UWVM_CPP_EXCEPTIONS
-            catch(::fast_io::error)
-            {
-                // do nothing
-            }
-#endif
-        }
-
 #if defined(_WIN32) && !defined(_WIN32_WINDOWS)
-        if(load_file_name.starts_with(u8"::NT::"))
-        {
-            // nt path
-            ::fast_io::u8cstring_view const load_file_name_nt_subview{::fast_io::containers::null_terminated, load_file_name.subview(6uz)};
-
-            if(::uwvm2::uwvm::io::show_nt_path_warning)
+            if(load_file_name.starts_with(u8"::NT::"))
             {
-                // Output the main information and memory indication
-                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                    // 1
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                    u8"uwvm: ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                    u8"[warn]  ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"Resolve to NT path: \"",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                    load_file_name_nt_subview,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"\".",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                    u8" (nt-path)\n",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                // nt path
+                ::fast_io::u8cstring_view const load_file_name_nt_subview{::fast_io::containers::null_terminated, load_file_name.subview(6uz)};
 
-                if(::uwvm2::uwvm::io::nt_path_warning_fatal) [[unlikely]]
+                if(::uwvm2::uwvm::io::show_nt_path_warning)
                 {
+                    // Output the main information and memory indication
                     ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        // 1
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                         u8"uwvm: ",
-                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                        u8"[fatal] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        u8"[warn]  ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Resolve to NT path: \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        load_file_name_nt_subview,
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                        u8"Convert warnings to fatal errors. ",
+                                        u8"\".",
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                        u8"(nt-path)\n\n",
+                                        u8" (nt-path)\n",
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                    ::fast_io::fast_terminate();
+
+                    if(::uwvm2::uwvm::io::nt_path_warning_fatal) [[unlikely]]
+                    {
+                        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                            u8"uwvm: ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                            u8"[fatal] ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"Convert warnings to fatal errors. ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                            u8"(nt-path)\n\n",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                        ::fast_io::fast_terminate();
+                    }
                 }
-            }
 
 # ifdef UWVM_CPP_EXCEPTIONS
-            try
-# endif
-            {
-# ifdef UWVM_TIMER
-                ::uwvm2::utils::debug::timer parsing_timer{u8"file loader"};
+                try
 # endif
+                {
+                    ::uwvm2::utils::debug::timer parsing_timer{
+                        u8"file loader",
+                        ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::file_load)};
+
+                    // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
+                    // allow symlink
+                    wf.wasm_file =
+                        ::fast_io::native_file_loader{::fast_io::io_kernel, load_file_name_nt_subview, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+                    parsing_timer.set_bytes(wf.wasm_file.size());
+                }
+# ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error e)
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                        u8"[error] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Unable to open WASM file \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        load_file_name_nt_subview,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\": ",
+                                        e,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                        u8"\n");
 
-                // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
-                // allow symlink
-                wf.wasm_file =
-                    ::fast_io::native_file_loader{::fast_io::io_kernel, load_file_name_nt_subview, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+                    return load_wasm_file_rtl::load_error;
+                }
+# endif
             }
-# ifdef UWVM_CPP_EXCEPTIONS
-            catch(::fast_io::error e)
+            else
             {
-                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                    u8"uwvm: ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
-                                    u8"[error] ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"Unable to open WASM file \"",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
-                                    load_file_name_nt_subview,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"\": ",
-                                    e,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                    u8"\n");
+                // win32 path
 
-                return load_wasm_file_rtl::load_error;
-            }
+# ifdef UWVM_CPP_EXCEPTIONS
+                try
 # endif
-        }
-        else
-        {
-            // win32 path
+                {
+                    ::uwvm2::utils::debug::timer parsing_timer{
+                        u8"file loader",
+                        ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::file_load)};
+
+                    // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
+                    // allow symlink
+                    wf.wasm_file = ::fast_io::native_file_loader{load_file_name, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+                    parsing_timer.set_bytes(wf.wasm_file.size());
+                }
+# ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error e)
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                        u8"[error] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Unable to open WASM file \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        load_file_name,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\": ",
+                                        e,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                        u8"\n");
+
+                    return load_wasm_file_rtl::load_error;
+                }
+# endif
+            }
+#else
+            // win9x and posix
 
 # ifdef UWVM_CPP_EXCEPTIONS
             try
 # endif
             {
-# ifdef UWVM_TIMER
-                ::uwvm2::utils::debug::timer parsing_timer{u8"file loader"};
-# endif
+                ::uwvm2::utils::debug::timer parsing_timer{
+                    u8"file loader",
+                    ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::file_load)};
 
                 // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
                 // allow symlink
                 wf.wasm_file = ::fast_io::native_file_loader{load_file_name, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+                parsing_timer.set_bytes(wf.wasm_file.size());
             }
 # ifdef UWVM_CPP_EXCEPTIONS
             catch(::fast_io::error e)
@@ -222,57 +259,90 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                                     u8"\": ",
                                     e,
                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                    u8"\n");
+                                    u8"\n"
+#  ifndef _WIN32  // Win32 automatically adds a newline (winnt and win9x)
+                                    u8"\n"
+#  endif
+                );
 
                 return load_wasm_file_rtl::load_error;
             }
 # endif
-        }
-#else
-        // win9x and posix
+#endif
 
-# ifdef UWVM_CPP_EXCEPTIONS
-        try
-# endif
-        {
-# ifdef UWVM_TIMER
-            ::uwvm2::utils::debug::timer parsing_timer{u8"file loader"};
-# endif
+            // binfmt_ver has to be modified by the change_binfmt_ver function.
+            wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                           reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
+
+            // After detect
+            // Instructs to read the file all the way into memory
+            ::uwvm2::utils::madvise::my_madvise(wf.wasm_file.cbegin(), wf.wasm_file.size(), ::uwvm2::utils::madvise::madvise_flag::willneed);
 
-            // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
-            // allow symlink
-            wf.wasm_file = ::fast_io::native_file_loader{load_file_name, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+#if CHAR_BIT > 8
+            // Since files are either private page mapped or memory allocated and read, they can be modified directly.
+            // Prevents invalid content in non-low eight bits of char_bit not equal to 8 from causing an unknown error in the parser.
+            auto const wf_wasm_file_end{wf.wasm_file.end()};
+            for(auto wf_wasm_file_curr{wf.wasm_file.begin()}; wf_wasm_file_curr != wf_wasm_file_end; ++wf_wasm_file_curr) { *wf_wasm_file_curr &= 0xFFu; }
+#endif
+
+            return load_wasm_file_rtl::ok;
         }
-# ifdef UWVM_CPP_EXCEPTIONS
-        catch(::fast_io::error e)
+    }  // namespace details
+
+    inline constexpr load_wasm_file_rtl load_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf,
+                                                       ::uwvm2::utils::container::u8cstring_view load_file_name,
+                                                       ::uwvm2::utils::container::u8string_view rename_module_name,
+                                                       ::uwvm2::uwvm::wasm::type::wasm_parameter_t para,
+                                                       wasm_file_preparse_t const* preparsed = nullptr) noexcept
+    {
+        wf.file_name = load_file_name;
+
+        wf.wasm_parameter = para;
+
+        // verbose
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
         {
             ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                 u8"uwvm: ",
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
-                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                u8"Unable to open WASM file \"",
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                u8"Loading WASM File \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
                                 load_file_name,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                u8"\": ",
-                                e,
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                u8"\n"
-#  ifndef _WIN32  // Win32 automatically adds a newline (winnt and win9x)
-                                u8"\n"
-#  endif
-            );
-
-            return load_wasm_file_rtl::load_error;
+                                u8"\". ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
+                                u8"[",
+                                ::uwvm2::uwvm::io::get_local_realtime(),
+                                u8"] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8"(verbose)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
         }
-# endif
+
+        ::fast_io::unix_timestamp start_time{};
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
 #endif
+            {
+                start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // do nothing
+            }
+#endif
+        }
 
-        // binfmt_ver has to be modified by the change_binfmt_ver function.
-        wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                                       reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
+        if(preparsed == nullptr || !preparsed->file_loaded) [[likely]]
+        {
+            if(auto const open_rtl{details::open_wasm_file(wf, load_file_name)}; open_rtl != load_wasm_file_rtl::ok) [[unlikely]] { return open_rtl; }
+        }
 
         // verbose
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
@@ -301,16 +371,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
         }
 
-        // After detect
-        // Instructs to read the file all the way into memory
-        ::uwvm2::utils::madvise::my_madvise(wf.wasm_file.cbegin(), wf.wasm_file.size(), ::uwvm2::utils::madvise::madvise_flag::willneed);
-
-#if CHAR_BIT > 8
-        // Since files are either private page mapped or memory allocated and read, they can be modified directly.
-        // Prevents invalid content in non-low eight bits of char_bit not equal to 8 from causing an unknown error in the parser.
-        auto const wf_wasm_file_end{wf.wasm_file.end()};
-        for(auto wf_wasm_file_curr{wf.wasm_file.begin()}; wf_wasm_file_curr != wf_wasm_file_end; ++wf_wasm_file_curr) { *wf_wasm_file_curr &= 0xFFu; }
-#endif
 
         switch(wf.binfmt_ver)
         {
@@ -380,69 +440,69 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                     try
 #endif
                     {
-                        // parser
-#ifdef UWVM_TIMER
-                        ::uwvm2::utils::debug::timer parsing_timer{u8"parse binfmt ver1"};
-#endif
+                        if(preparsed != nullptr && preparsed->parsed)
+                        {
+                            // Parsed ahead of time by `preparse_wasm_file`. Replay a recorded failure here so that it is reported in
+                            // module order through the same diagnostics as a serial parse.
+                            if(preparsed->failed) [[unlikely]]
+                            {
+                                execute_wasm_binfmt_ver1_storage_wasm_err = preparsed->err;
+                                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                            }
 
-                        ::fast_io::unix_timestamp parser_start_time{};
-                        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::print_parse_wasm_file_done(load_file_name, preparsed->parse_time); }
+                        }
+                        else
                         {
+                            // parser
+                            ::uwvm2::utils::debug::timer parsing_timer{
+                                u8"parse binfmt ver1",
+                                ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::parse)};
+                            parsing_timer.set_bytes(wf.wasm_file.size());
+                            ::uwvm2::uwvm::utils::timing::record_startup_module();
+
+                            ::fast_io::unix_timestamp parser_start_time{};
+                            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                            {
 #ifdef UWVM_CPP_EXCEPTIONS
-                            try
+                                try
 #endif
-                            {
-                                parser_start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
-                            }
+                                {
+                                    parser_start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+                                }
 #ifdef UWVM_CPP_EXCEPTIONS
-                            catch(::fast_io::error)
-                            {
-                                // do nothing
-                            }
+                                catch(::fast_io::error)
+                                {
+                                    // do nothing
+                                }
 #endif
-                        }
+                            }
 
-                        wf.wasm_module_storage.wasm_binfmt_ver1_storage =
-                            ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                              reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
-                                                                              execute_wasm_binfmt_ver1_storage_wasm_err,
-                                                                              wf.wasm_parameter.binfmt1_para);
+                            wf.wasm_module_storage.wasm_binfmt_ver1_storage =
+                                ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
+                                                                                  execute_wasm_binfmt_ver1_storage_wasm_err,
+                                                                                  wf.wasm_parameter.binfmt1_para);
 
-                        ::fast_io::unix_timestamp parser_end_time{};
-                        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
-                        {
+                            ::fast_io::unix_timestamp parser_end_time{};
+                            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                            {
 #ifdef UWVM_CPP_EXCEPTIONS
-                            try
+                                try
 #endif
-                            {
-                                parser_end_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
-                            }
+                                {
+                                    parser_end_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+                                }
 #ifdef UWVM_CPP_EXCEPTIONS
-                            catch(::fast_io::error)
-                            {
-                                // do nothing
-                            }
+                                catch(::fast_io::error)
+                                {
+                                    // do nothing
+                                }
 #endif
 
-                            // verbose
-                            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                                u8"uwvm: ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
-                                                u8"[info]  ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                u8"Parse wasm file \"",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                                load_file_name,
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                u8"\" done. (time=",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
-                                                parser_end_time - parser_start_time,
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                u8"s). ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                u8"(verbose)\n",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                                // verbose
+                                details::print_parse_wasm_file_done(load_file_name, parser_end_time - parser_start_time);
+                            }
                         }
                     }
 #if defined(UWVM_CPP_EXCEPTIONS) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
@@ -991,6 +1051,91 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
         return load_wasm_file_rtl::ok;
     }
 
+    /// @brief      First stage of a staged load: map the file and detect its binary format.
+    /// @details    Must run on the main thread in module order, open failures are reported here exactly as in `load_wasm_file`.
+    inline constexpr load_wasm_file_rtl prepare_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf,
+                                                          ::uwvm2::utils::container::u8cstring_view load_file_name,
+                                                          ::uwvm2::uwvm::wasm::type::wasm_parameter_t para,
+                                                          wasm_file_preparse_t & preparsed) noexcept
+    {
+        wf.file_name = load_file_name;
+        wf.wasm_parameter = para;
+
+        if(auto const open_rtl{details::open_wasm_file(wf, load_file_name)}; open_rtl != load_wasm_file_rtl::ok) [[unlikely]] { return open_rtl; }
+
+        preparsed.file_loaded = true;
+        return load_wasm_file_rtl::ok;
+    }
+
+    /// @brief      Second stage of a staged load: parse the binary format.
+    /// @details    Touches only `wf` and `preparsed` and prints nothing (outside `UWVM_TIMER` debug builds), so distinct modules can be
+    ///             parsed concurrently. Unknown binary format versions are left unparsed and reported by `load_wasm_file`.
+    inline constexpr void preparse_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf, wasm_file_preparse_t & preparsed) noexcept
+    {
+        if(!preparsed.file_loaded || wf.binfmt_ver != static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(1u)) [[unlikely]] { return; }
+
+        ::uwvm2::utils::debug::timer parsing_timer{
+            u8"parse binfmt ver1",
+            ::uwvm2::uwvm::utils::timing::get_startup_phase_accumulator(::uwvm2::uwvm::utils::timing::startup_phase::parse)};
+        parsing_timer.set_bytes(wf.wasm_file.size());
+        ::uwvm2::uwvm::utils::timing::record_startup_module();
+
+        // Only the duration is kept here; the "Parse wasm file ... done" line is printed by `load_wasm_file` in module order.
+        ::fast_io::unix_timestamp parser_start_time{};
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
+#endif
+            {
+                parser_start_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // do nothing
+            }
+#endif
+        }
+
+#if defined(UWVM_CPP_EXCEPTIONS) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        try
+#endif
+        {
+            wf.wasm_module_storage.wasm_binfmt_ver1_storage =
+                ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
+                                                                  preparsed.err,
+                                                                  wf.wasm_parameter.binfmt1_para);
+        }
+#if defined(UWVM_CPP_EXCEPTIONS) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        catch(::fast_io::error)
+        {
+            preparsed.failed = true;
+        }
+#endif
+
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+            ::fast_io::unix_timestamp parser_end_time{};
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
+#endif
+            {
+                parser_end_time = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // do nothing
+            }
+#endif
+            preparsed.parse_time = parser_end_time - parser_start_time;
+        }
+
+        preparsed.parsed = true;
+    }
+
 }  // namespace uwvm2::uwvm::wasm::loader
 
 #ifndef UWVM_MODULE
@@ -43,4 +43,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
     /// @note  Must remain unchanged before initialization (to prevent iterator invalidation).
     inline ::uwvm2::utils::container::vector<::uwvm2::uwvm::wasm::type::wasm_file_t>
         preloaded_wasm{};  // [global] No global variable dependencies from other translation units
+
+    /// @brief  A `--wasm-preload-library` request recorded during command-line parsing.
+    /// @note   Both views point into `argv`, which outlives the whole run.
+    struct preloaded_wasm_request_t
+    {
+        ::uwvm2::utils::container::u8cstring_view file_name{};
+        ::uwvm2::utils::container::u8string_view rename_module_name{};
+    };
+
+    /// @brief  Preloaded wasm modules in command-line order. They are loaded together with the main module (see `run::load_wasm_modules`),
+    ///         which lets all modules be parsed concurrently.
+    inline ::uwvm2::utils::container::vector<preloaded_wasm_request_t>
+        preloaded_wasm_requests{};  // [global] No global variable dependencies from other translation units
 }  // namespace uwvm2::uwvm::wasm::storage
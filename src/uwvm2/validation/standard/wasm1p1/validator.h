@@ -1171,6 +1171,73 @@ UWVM_MODULE_EXPORT namespace uwvm2::validation::standard::wasm1p1
                 pop_available_concrete_operands(count);
             }};
 
+        // Tail-call stack effect: the callee results must equal the current function results, the arguments are consumed and the
+        // rest of the frame becomes polymorphic exactly as after `return`.
+        auto const validate_tail_call_operands{
+            [&](::std::byte const* op_begin, ::uwvm2::utils::container::u8string_view op_name, auto const& callee_type) constexpr UWVM_THROWS
+            {
+                auto const& func_frame{control_flow_stack.index_unchecked(0u)};
+                auto const expected_result_count{static_cast<::std::size_t>(func_frame.result.end - func_frame.result.begin)};
+                auto const callee_result_count{static_cast<::std::size_t>(callee_type.result.end - callee_type.result.begin)};
+
+                for(::std::size_t i{}; i != expected_result_count && i != callee_result_count; ++i)
+                {
+                    if(func_frame.result.begin[i] != callee_type.result.begin[i]) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+                        err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(func_frame.result.begin[i]);
+                        err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(callee_type.result.begin[i]);
+                        err.err_code = code_validation_error_code::br_value_type_mismatch;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+                }
+
+                if(expected_result_count != callee_result_count) [[unlikely]]
+                {
+                    err.err_curr = op_begin;
+                    err.err_selectable.end_result_mismatch.block_kind = op_name;
+                    err.err_selectable.end_result_mismatch.expected_count = expected_result_count;
+                    err.err_selectable.end_result_mismatch.actual_count = callee_result_count;
+                    err.err_selectable.end_result_mismatch.expected_type =
+                        expected_result_count == 1uz ? to_wasm1_value_type(func_frame.result.begin[0]) : wasm_value_type{};
+                    err.err_selectable.end_result_mismatch.actual_type =
+                        callee_result_count == 1uz ? to_wasm1_value_type(callee_type.result.begin[0]) : wasm_value_type{};
+                    err.err_code = code_validation_error_code::end_result_mismatch;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                auto const param_count{static_cast<::std::size_t>(callee_type.parameter.end - callee_type.parameter.begin)};
+                if(!is_polymorphic && concrete_operand_count() < param_count) [[unlikely]]
+                {
+                    report_operand_stack_underflow(op_begin, op_name, param_count);
+                }
+
+                auto const stack_size{operand_stack.size()};
+                auto const available_param_count{concrete_operand_count()};
+                auto const concrete_to_check{available_param_count < param_count ? available_param_count : param_count};
+                for(::std::size_t i{}; i != concrete_to_check; ++i)
+                {
+                    auto const expected_type{callee_type.parameter.begin[param_count - 1uz - i]};
+                    auto const actual_operand{operand_stack.index_unchecked(stack_size - 1uz - i)};
+                    if(!stack_entry_type_matches(actual_operand, expected_type)) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.br_value_type_mismatch.op_code_name = op_name;
+                        err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(expected_type);
+                        err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(actual_operand.type);
+                        err.err_code = code_validation_error_code::br_value_type_mismatch;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+                }
+
+                pop_available_concrete_operands(param_count);
+
+                auto const curr_frame_base{control_flow_stack.back_unchecked().operand_stack_base};
+                while(operand_stack.size() > curr_frame_base) { operand_stack.pop_back_unchecked(); }
+                is_polymorphic = true;
+            }};
+
         auto const validate_numeric_unary_stack_effect{[&](::std::byte const* op_begin,
                                                            ::uwvm2::utils::container::u8string_view op_name,
                                                            curr_operand_stack_value_type expected_operand_type,
@@ -2440,6 +2507,186 @@ UWVM_MODULE_EXPORT namespace uwvm2::validation::standard::wasm1p1
 
                     break;
                 }
+                case opcode_byte(wasm1p1_code::return_call):
+                {
+                    // return_call func_index ...
+                    // [ safe    ] unsafe (could be the section_end)
+                    // ^^ code_curr
+
+                    auto const op_begin{code_curr};
+
+                    ++code_curr;
+
+                    // return_call func_index ...
+                    // [ safe    ] unsafe (could be the section_end)
+                    //             ^^ code_curr
+
+                    if(!wasm1p1_para.enable_tail_call) [[unlikely]]
+                    {
+                        details::fail_feature_required(op_begin,
+                                                       err,
+                                                       opcode_u32(wasm1p1_code::return_call),
+                                                       ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call,
+                                                       ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+                    }
+
+                    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 func_index;  // No initialization necessary
+
+                    using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+                    auto const [func_next, func_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(code_curr),
+                                                                              reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                              ::fast_io::mnp::leb128_get(func_index))};
+                    if(func_err != ::fast_io::parse_code::ok) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::invalid_function_index_encoding;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(func_err);
+                    }
+
+                    code_curr = reinterpret_cast<::std::byte const*>(func_next);
+
+                    // return_call func_index ...
+                    // [      safe          ] unsafe (could be the section_end)
+                    //                        ^^ code_curr
+
+                    auto const all_function_size{import_func_count + local_func_count};
+                    if(static_cast<::std::size_t>(func_index) >= all_function_size) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.invalid_function_index.function_index = static_cast<::std::size_t>(func_index);
+                        err.err_selectable.invalid_function_index.all_function_size = all_function_size;
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::invalid_function_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    ::uwvm2::parser::wasm::standard::wasm1::features::final_function_type<Fs...> const* callee_type_ptr{};
+                    if(static_cast<::std::size_t>(func_index) < import_func_count)
+                    {
+                        auto const& imported_funcs{importsec.importdesc.index_unchecked(0u)};
+                        auto const imported_func_ptr{imported_funcs.index_unchecked(static_cast<::std::size_t>(func_index))};
+
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                        if(imported_func_ptr == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#endif
+                        callee_type_ptr = imported_func_ptr->imports.storage.function;
+                    }
+                    else
+                    {
+                        auto const local_idx{static_cast<::std::size_t>(func_index) - import_func_count};
+                        callee_type_ptr = typesec.types.cbegin() + funcsec.funcs.index_unchecked(local_idx);
+                    }
+
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                    if(callee_type_ptr == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
+#endif
+
+                    validate_tail_call_operands(op_begin, u8"return_call", *callee_type_ptr);
+
+                    break;
+                }
+                case opcode_byte(wasm1p1_code::return_call_indirect):
+                {
+                    // return_call_indirect type_index table_index ...
+                    // [ safe             ] unsafe (could be the section_end)
+                    // ^^ code_curr
+
+                    auto const op_begin{code_curr};
+
+                    ++code_curr;
+
+                    // return_call_indirect type_index table_index ...
+                    // [ safe             ] unsafe (could be the section_end)
+                    //                      ^^ code_curr
+
+                    if(!wasm1p1_para.enable_tail_call) [[unlikely]]
+                    {
+                        details::fail_feature_required(op_begin,
+                                                       err,
+                                                       opcode_u32(wasm1p1_code::return_call_indirect),
+                                                       ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::tail_call,
+                                                       ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+                    }
+
+                    using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+                    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 type_index;  // No initialization necessary
+                    auto const [type_next, type_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(code_curr),
+                                                                              reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                              ::fast_io::mnp::leb128_get(type_index))};
+                    if(type_err != ::fast_io::parse_code::ok) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::invalid_type_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(type_err);
+                    }
+
+                    code_curr = reinterpret_cast<::std::byte const*>(type_next);
+
+                    auto const all_type_count_uz{typesec.types.size()};
+                    if(static_cast<::std::size_t>(type_index) >= all_type_count_uz) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.illegal_type_index.type_index = type_index;
+                        err.err_selectable.illegal_type_index.all_type_count =
+                            static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(all_type_count_uz);
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::illegal_type_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 table_index;  // No initialization necessary
+                    auto const [table_next, table_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(code_curr),
+                                                                                reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                ::fast_io::mnp::leb128_get(table_index))};
+                    if(table_err != ::fast_io::parse_code::ok) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::invalid_table_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(table_err);
+                    }
+
+                    code_curr = reinterpret_cast<::std::byte const*>(table_next);
+
+                    // return_call_indirect type_index table_index ...
+                    // [                   safe                  ] unsafe (could be the section_end)
+                    //                                             ^^ code_curr
+
+                    check_table_index(op_begin, table_index);
+
+                    if(get_table_value_type(table_index) !=
+                       static_cast<curr_operand_stack_value_type>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::funcref)) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.br_value_type_mismatch.op_code_name = u8"return_call_indirect";
+                        err.err_selectable.br_value_type_mismatch.expected_type = to_wasm1_value_type(
+                            static_cast<curr_operand_stack_value_type>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::funcref));
+                        err.err_selectable.br_value_type_mismatch.actual_type = to_wasm1_value_type(get_table_value_type(table_index));
+                        err.err_code = code_validation_error_code::br_value_type_mismatch;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    // Stack effect: (args..., i32 func_index) -> polymorphic
+                    if(!is_polymorphic && concrete_operand_count() == 0uz) [[unlikely]]
+                    {
+                        report_operand_stack_underflow(op_begin, u8"return_call_indirect", 1uz);
+                    }
+
+                    auto const idx{try_pop_concrete_operand()};
+                    if(!operand_type_matches(idx, curr_operand_stack_value_type::i32)) [[unlikely]]
+                    {
+                        err.err_curr = op_begin;
+                        err.err_selectable.br_cond_type_not_i32.op_code_name = u8"return_call_indirect";
+                        err.err_selectable.br_cond_type_not_i32.cond_type = to_wasm1_value_type(idx.type);
+                        err.err_code = ::uwvm2::validation::error::code_validation_error_code::br_cond_type_not_i32;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    validate_tail_call_operands(op_begin,
+                                                u8"return_call_indirect",
+                                                typesec.types.index_unchecked(static_cast<::std::size_t>(type_index)));
+
+                    break;
+                }
                 case opcode_byte(wasm1p1_code::table_get):
                 {
                     // table.get tableidx ...
@@ -0,0 +1,203 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef UWVM_MODULE
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/thread/native_thread.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/binfmt.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    using Feature = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+    using byte_vec = ::std::vector<::std::byte>;
+
+    // 2600 bodies of 4 KiB: a 10 MiB code section, above `code_section_parallel_parse_threshold`.
+    inline constexpr ::std::size_t func_count{2600uz};
+    inline constexpr ::std::size_t body_size{4096uz};
+
+    inline void push_byte(byte_vec& buf, ::std::uint8_t v) { buf.push_back(static_cast<::std::byte>(v)); }
+
+    inline void push_leb_u32(byte_vec& buf, ::std::uint32_t v)
+    {
+        do {
+            auto b{static_cast<::std::uint8_t>(v & 0x7Fu)};
+            v >>= 7u;
+            if(v != 0u) { b |= 0x80u; }
+            push_byte(buf, b);
+        }
+        while(v != 0u);
+    }
+
+    inline void push_section(byte_vec& out, ::std::uint8_t id, byte_vec const& payload)
+    {
+        push_byte(out, id);
+        push_leb_u32(out, static_cast<::std::uint32_t>(payload.size()));
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    struct test_module
+    {
+        byte_vec bytes{};
+        // Offset of every body's local type byte (`(local i32 i32)`) in `bytes`.
+        ::std::vector<::std::size_t> local_type_offsets{};
+    };
+
+    // Every body is `(local i32 i32) nop ... nop end`.
+    [[nodiscard]] test_module make_module()
+    {
+        test_module m{};
+        auto& out{m.bytes};
+        for(auto const c: {0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u}) { push_byte(out, static_cast<::std::uint8_t>(c)); }
+
+        push_section(out, 0x01u, byte_vec{::std::byte{0x01u}, ::std::byte{0x60u}, ::std::byte{0x00u}, ::std::byte{0x00u}});
+
+        byte_vec funcsec{};
+        push_leb_u32(funcsec, static_cast<::std::uint32_t>(func_count));
+        funcsec.insert(funcsec.end(), func_count, ::std::byte{0x00u});
+        push_section(out, 0x03u, funcsec);
+
+        byte_vec codesec{};
+        push_leb_u32(codesec, static_cast<::std::uint32_t>(func_count));
+        ::std::vector<::std::size_t> local_type_offsets_in_section{};
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            push_leb_u32(codesec, static_cast<::std::uint32_t>(body_size));
+            push_byte(codesec, 0x01u);
+            push_byte(codesec, 0x02u);
+            local_type_offsets_in_section.push_back(codesec.size());
+            push_byte(codesec, 0x7Fu);
+            codesec.insert(codesec.end(), body_size - 4uz, ::std::byte{0x01u});
+            push_byte(codesec, 0x0Bu);
+        }
+
+        push_byte(out, 0x0Au);
+        push_leb_u32(out, static_cast<::std::uint32_t>(codesec.size()));
+        auto const codesec_offset{out.size()};
+        out.insert(out.end(), codesec.begin(), codesec.end());
+
+        for(auto const offset: local_type_offsets_in_section) { m.local_type_offsets.push_back(codesec_offset + offset); }
+        return m;
+    }
+
+    [[nodiscard]] int fail(int line, char const* what)
+    {
+        ::fast_io::io::perrln(::fast_io::u8err(), u8"code_section_parallel: line ", line, u8": ", ::fast_io::mnp::os_c_str(what));
+        return 1;
+    }
+
+    struct parse_result
+    {
+        bool ok{};
+        ::std::byte const* err_curr{};
+        ::uwvm2::parser::wasm::base::wasm_parse_error_code err_code{};
+    };
+
+    [[nodiscard]] int check_module(byte_vec const& bytes)
+    {
+        auto const* const begin{bytes.data()};
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        auto const storage{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<Feature>(begin, begin + bytes.size(), err, {})};
+
+        auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+            ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<Feature>>(storage.sections)};
+        if(codesec.codes.size() != func_count) { return fail(__LINE__, "code count"); }
+
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            auto const& code{codesec.codes.index_unchecked(i)};
+            auto const code_begin{reinterpret_cast<::std::byte const*>(code.body.code_begin)};
+            auto const expr_begin{reinterpret_cast<::std::byte const*>(code.body.expr_begin)};
+            auto const code_end{reinterpret_cast<::std::byte const*>(code.body.code_end)};
+            if(code_end - code_begin != static_cast<::std::ptrdiff_t>(body_size)) { return fail(__LINE__, "body size"); }
+            if(expr_begin - code_begin != 3) { return fail(__LINE__, "expr_begin"); }
+            if(code.locals.size() != 1uz || code.locals.index_unchecked(0uz).count != 2u || code.all_local_count != 2u)
+            {
+                return fail(__LINE__, "locals");
+            }
+        }
+        return 0;
+    }
+
+    [[nodiscard]] parse_result parse_broken(byte_vec const& bytes)
+    {
+        auto const* const begin{bytes.data()};
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        try
+        {
+            (void)::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<Feature>(begin, begin + bytes.size(), err, {});
+        }
+        catch(::fast_io::error const&)
+        {
+            return {.ok = false, .err_curr = err.err_curr, .err_code = err.err_code};
+        }
+        return {.ok = true};
+    }
+}  // namespace
+
+int main()
+{
+    auto const m{make_module()};
+
+    // Parallel path (when the machine has more than one hardware thread).
+    if(auto const r{check_module(m.bytes)}; r != 0) { return r; }
+
+    {
+        // With the whole shared worker budget held elsewhere, the same section parses serially to the same result.
+        ::uwvm2::utils::thread::extra_worker_lease const held{::uwvm2::utils::thread::hardware_concurrency()};
+        if(auto const r{check_module(m.bytes)}; r != 0) { return r; }
+    }
+
+    // Two bodies with an illegal local type, in different chunks: the reported error is always the first one in body order, whichever
+    // chunk fails first, and it matches the serial parse.
+    auto broken{m.bytes};
+    constexpr ::std::size_t first_bad_body{700uz};
+    constexpr ::std::size_t second_bad_body{2000uz};
+    broken[m.local_type_offsets[first_bad_body]] = ::std::byte{0x00u};
+    broken[m.local_type_offsets[second_bad_body]] = ::std::byte{0x00u};
+    auto const expected_curr{broken.data() + m.local_type_offsets[first_bad_body]};
+
+    parse_result serial{};
+    {
+        ::uwvm2::utils::thread::extra_worker_lease const held{::uwvm2::utils::thread::hardware_concurrency()};
+        serial = parse_broken(broken);
+    }
+    if(serial.ok) { return fail(__LINE__, "serial parse accepted an illegal local type"); }
+    if(serial.err_curr != expected_curr) { return fail(__LINE__, "serial error position"); }
+    if(serial.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type) { return fail(__LINE__, "serial error code"); }
+
+    for(unsigned round{}; round != 16u; ++round)
+    {
+        auto const parallel{parse_broken(broken)};
+        if(parallel.ok) { return fail(__LINE__, "parallel parse accepted an illegal local type"); }
+        if(parallel.err_curr != serial.err_curr || parallel.err_code != serial.err_code) { return fail(__LINE__, "parallel error differs from serial"); }
+    }
+
+    return 0;
+}
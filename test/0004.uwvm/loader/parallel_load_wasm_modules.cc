@@ -0,0 +1,204 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/uwvm/run/loader.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    using byte_vec = ::std::vector<unsigned char>;
+
+    void append_uleb(byte_vec& out, ::std::uint_least64_t value)
+    {
+        do {
+            auto byte{static_cast<unsigned char>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    void append_section(byte_vec& out, unsigned char id, byte_vec const& payload)
+    {
+        out.push_back(id);
+        append_uleb(out, payload.size());
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    // `func_count` functions `() -> i32` returning their index, so every module gives the parser real work to share out.
+    [[nodiscard]] byte_vec make_good_module(::std::uint_least32_t func_count)
+    {
+        byte_vec wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+        append_section(wasm, 0x01u, {0x01u, 0x60u, 0x00u, 0x01u, 0x7fu});
+
+        byte_vec functions{};
+        append_uleb(functions, func_count);
+        functions.insert(functions.end(), func_count, 0x00u);
+        append_section(wasm, 0x03u, functions);
+
+        byte_vec code{};
+        append_uleb(code, func_count);
+        for(::std::uint_least32_t i{}; i != func_count; ++i)
+        {
+            byte_vec body{0x00u, 0x41u};
+            append_uleb(body, i & 0x3fu);
+            body.push_back(0x0bu);
+            append_uleb(code, body.size());
+            code.insert(code.end(), body.begin(), body.end());
+        }
+        append_section(wasm, 0x0au, code);
+        return wasm;
+    }
+
+    // The type section announces a function type with five params and then ends: a parse error, not an open error.
+    [[nodiscard]] byte_vec make_bad_module()
+    {
+        byte_vec wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+        append_section(wasm, 0x01u, {0x01u, 0x60u, 0x05u});
+        return wasm;
+    }
+
+    [[nodiscard]] bool write_file(::std::filesystem::path const& path, byte_vec const& bytes)
+    {
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        output.write(reinterpret_cast<char const*>(bytes.data()), static_cast<::std::streamsize>(bytes.size()));
+        return static_cast<bool>(output);
+    }
+
+    struct module_file_t
+    {
+        ::std::u8string file_name{};
+        ::std::u8string module_name{};
+    };
+
+    [[nodiscard]] ::uwvm2::utils::container::u8cstring_view as_cstring_view(::std::u8string const& s) noexcept
+    { return ::uwvm2::utils::container::u8cstring_view{::fast_io::containers::null_terminated, s.c_str(), s.size()}; }
+
+    [[nodiscard]] ::uwvm2::utils::container::u8string_view as_string_view(::std::u8string const& s) noexcept
+    { return ::uwvm2::utils::container::u8string_view{s.data(), s.size()}; }
+
+    // Runs `load_wasm_modules` as the command line would: `preloads` in order, then `main_file` as the main module.
+    [[nodiscard]] int load_modules(::std::vector<module_file_t> const& preloads, module_file_t const& main_file)
+    {
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm.clear();
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm_requests.clear();
+        for(auto const& preload: preloads)
+        {
+            ::uwvm2::uwvm::wasm::storage::preloaded_wasm_requests.push_back(
+                {.file_name = as_cstring_view(preload.file_name), .rename_module_name = as_string_view(preload.module_name)});
+        }
+
+        static ::uwvm2::utils::cmdline::parameter_parsing_results main_para{};
+        main_para.str = as_cstring_view(main_file.file_name);
+        ::uwvm2::uwvm::cmdline::wasm_file_ppos = ::std::addressof(main_para);
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.module_name = as_string_view(main_file.module_name);
+
+        return ::uwvm2::uwvm::run::load_wasm_modules();
+    }
+
+    [[nodiscard]] int fail(int line, char const* what)
+    {
+        ::fast_io::io::perrln(::fast_io::u8err(), u8"parallel_load_wasm_modules: line ", line, u8": ", ::fast_io::mnp::os_c_str(what));
+        return 1;
+    }
+}  // namespace
+
+int main()
+{
+    constexpr ::std::size_t preload_count{12uz};
+    constexpr ::std::size_t first_bad_index{5uz};
+    constexpr ::std::size_t second_bad_index{9uz};
+    constexpr ::std::size_t repeats{8uz};
+
+    auto const dir{::std::filesystem::temp_directory_path() / "uwvm2test_parallel_load_wasm_modules"};
+    ::std::filesystem::remove_all(dir);
+    ::std::filesystem::create_directories(dir);
+
+    ::std::vector<module_file_t> good{};
+    for(::std::size_t i{}; i != preload_count; ++i)
+    {
+        auto const path{dir / ("good_" + ::std::to_string(i) + ".wasm")};
+        if(!write_file(path, make_good_module(static_cast<::std::uint_least32_t>(256u + i * 64u)))) { return fail(__LINE__, "write good module"); }
+        good.push_back({.file_name = path.u8string(), .module_name = u8"good_" + ::std::u8string{path.stem().u8string().substr(5)}});
+    }
+
+    auto const main_path{dir / "main.wasm"};
+    if(!write_file(main_path, make_good_module(64u))) { return fail(__LINE__, "write main module"); }
+    module_file_t const main_file{.file_name = main_path.u8string(), .module_name = u8"main"};
+
+    auto const bad_path{dir / "bad.wasm"};
+    if(!write_file(bad_path, make_bad_module())) { return fail(__LINE__, "write bad module"); }
+
+    // Every module parses on the pool and is finished in command-line order under the requested name.
+    for(::std::size_t repeat{}; repeat != repeats; ++repeat)
+    {
+        if(load_modules(good, main_file) != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) { return fail(__LINE__, "good modules failed to load"); }
+
+        auto const& loaded{::uwvm2::uwvm::wasm::storage::preloaded_wasm};
+        if(loaded.size() != preload_count) { return fail(__LINE__, "preloaded module count"); }
+        for(::std::size_t i{}; i != preload_count; ++i)
+        {
+            if(loaded.index_unchecked(i).module_name != as_string_view(good[i].module_name)) { return fail(__LINE__, "preloaded module name"); }
+            if(loaded.index_unchecked(i).binfmt_ver != 1u) { return fail(__LINE__, "preloaded module binfmt"); }
+        }
+        if(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name != u8"main") { return fail(__LINE__, "main module name"); }
+    }
+
+#if defined(UWVM_CPP_EXCEPTIONS) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // Two broken modules: whichever worker finishes first, the failure reported is always the first one in command-line order, and
+    // no module after it is finished.
+    auto with_bad{good};
+    with_bad[first_bad_index] = {.file_name = bad_path.u8string(), .module_name = u8"bad_first"};
+    with_bad[second_bad_index] = {.file_name = bad_path.u8string(), .module_name = u8"bad_second"};
+
+    for(::std::size_t repeat{}; repeat != repeats; ++repeat)
+    {
+        if(load_modules(with_bad, main_file) != static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error))
+        {
+            return fail(__LINE__, "a broken preloaded module must fail with the preload error code");
+        }
+
+        auto const& loaded{::uwvm2::uwvm::wasm::storage::preloaded_wasm};
+        for(::std::size_t i{}; i != preload_count; ++i)
+        {
+            bool const finished{!loaded.index_unchecked(i).module_name.empty()};
+            if(finished != (i < first_bad_index)) { return fail(__LINE__, "modules must be finished exactly up to the first parse failure"); }
+        }
+    }
+#endif
+
+    ::std::filesystem::remove_all(dir);
+    return 0;
+}
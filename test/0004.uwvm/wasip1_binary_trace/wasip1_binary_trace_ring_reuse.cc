@@ -0,0 +1,166 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+// Threads that exit hand their binary trace ring to the next thread that traces, so creating far more threads over a run than
+// `wasip1_binary_trace_max_rings` loses no records, and every thread still gets its own `thread_index` in the file.
+namespace
+{
+#if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && !(defined(__NEWLIB__) && !defined(__CYGWIN__)) && !defined(__freestanding__) &&                  \
+    defined(UWVM_USE_THREAD_LOCAL)
+    namespace storage = ::uwvm2::uwvm::imported::wasi::wasip1::storage;
+
+    // More than twice the ring bound, one thread at a time, then a batch of threads that trace concurrently.
+    inline constexpr ::std::size_t sequential_threads{storage::wasip1_binary_trace_max_rings * 2uz + 88uz};
+    inline constexpr ::std::size_t concurrent_threads{16uz};
+    inline constexpr ::std::size_t records_per_thread{3uz};
+
+    inline constexpr ::std::uint_least32_t traced_function_id{storage::wasip1_binary_trace_function_id(u8"args_sizes_get")};
+
+    void trace_calls(::std::size_t thread_ordinal) noexcept
+    {
+        for(::std::size_t i{}; i != records_per_thread; ++i)
+        {
+            storage::wasip1_binary_trace_record_t record{.function_id = traced_function_id, .arg_count = 2u};
+            record.args[0] = thread_ordinal;
+            record.args[1] = i;
+            record.begin_tick = storage::wasip1_binary_trace_tick();
+            storage::wasip1_binary_trace_push(record);
+        }
+    }
+
+    [[nodiscard]] int fail(char const* what)
+    {
+        ::fast_io::io::perrln("binary_trace_ring_reuse: ", ::fast_io::mnp::os_c_str(what));
+        return 1;
+    }
+#endif
+}  // namespace
+
+int main()
+{
+#if defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) || (defined(__NEWLIB__) && !defined(__CYGWIN__)) || defined(__freestanding__) ||                   \
+    !defined(UWVM_USE_THREAD_LOCAL)
+    // Rings are only handed back from a TLS destructor; without C++ thread_local they follow recycled OS thread ids instead.
+    return 0;
+#else
+    auto const trace_path{::std::filesystem::temp_directory_path() / "uwvm2test_binary_trace_ring_reuse.uwtrace"};
+    auto const trace_path_string{trace_path.string()};
+
+    auto& writer{storage::wasip1_binary_trace_writer};
+    if(!writer.start(::fast_io::u8native_file{::fast_io::mnp::os_c_str(trace_path_string.c_str()),
+                                              ::fast_io::open_mode::out | ::fast_io::open_mode::trunc}))
+    {
+        return fail("failed to start the writer");
+    }
+    storage::wasip1_binary_trace_enabled = true;
+
+    for(::std::size_t t{}; t != sequential_threads; ++t)
+    {
+        ::std::thread thread{trace_calls, t};
+        thread.join();
+    }
+
+    // `join` returns after the thread's TLS destructors ran, so every thread found the previous thread's ring released.
+    if(writer.registered_ring_count() != 1uz) { return fail("sequential threads did not reuse one ring"); }
+
+    {
+        ::std::vector<::std::thread> threads{};
+        threads.reserve(concurrent_threads);
+        for(::std::size_t t{}; t != concurrent_threads; ++t) { threads.emplace_back(trace_calls, sequential_threads + t); }
+        for(auto& thread: threads) { thread.join(); }
+    }
+
+    constexpr ::std::size_t total_threads{sequential_threads + concurrent_threads};
+    if(writer.registered_ring_count() > concurrent_threads) { return fail("concurrent threads did not reuse released rings"); }
+    if(writer.unregistered_dropped.load(::std::memory_order_relaxed) != 0uz) { return fail("a thread found no ring"); }
+    if(writer.thread_count.load(::std::memory_order_relaxed) != total_threads) { return fail("thread_count does not count threads"); }
+
+    storage::wasip1_binary_trace_enabled = false;
+    writer.stop();
+
+    ::std::ifstream input(trace_path, ::std::ios::binary);
+    ::std::vector<char> const bytes{::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{}};
+    input.close();
+    ::std::error_code ec{};
+    ::std::filesystem::remove(trace_path, ec);
+
+    storage::wasip1_binary_trace_file_header_t header;
+    if(bytes.size() < sizeof(header)) { return fail("truncated header"); }
+    ::std::memcpy(::std::addressof(header), bytes.data(), sizeof(header));
+    constexpr storage::wasip1_binary_trace_file_header_t expected_header{};
+    if(::std::memcmp(header.magic, expected_header.magic, sizeof(header.magic)) != 0 ||
+       header.record_size != sizeof(storage::wasip1_binary_trace_record_t))
+    {
+        return fail("bad header");
+    }
+
+    constexpr ::std::size_t record_size{sizeof(storage::wasip1_binary_trace_record_t)};
+    if((bytes.size() - sizeof(header)) != total_threads * records_per_thread * record_size) { return fail("record count mismatch"); }
+
+    // Per thread: which ordinal owns each thread_index, and how many of its calls were seen, in call order.
+    ::std::vector<::std::size_t> ordinal_of_index(total_threads, total_threads);
+    ::std::vector<::std::size_t> seen_of_ordinal(total_threads, 0uz);
+    for(auto curr{bytes.data() + sizeof(header)}; curr != bytes.data() + bytes.size(); curr += record_size)
+    {
+        storage::wasip1_binary_trace_record_t record;
+        ::std::memcpy(::std::addressof(record), curr, sizeof(record));
+
+        if(record.function_id != traced_function_id) { return fail("unexpected or dropped-marker record"); }
+        if(record.thread_index >= total_threads || record.args[0] >= total_threads) { return fail("thread index out of range"); }
+
+        auto& ordinal{ordinal_of_index[record.thread_index]};
+        if(ordinal == total_threads) { ordinal = static_cast<::std::size_t>(record.args[0]); }
+        // A reused ring must not carry the previous owner's thread_index into the new thread's records.
+        if(ordinal != record.args[0]) { return fail("two threads share a thread_index"); }
+
+        auto& seen{seen_of_ordinal[ordinal]};
+        if(record.args[1] != seen) { return fail("records of one thread are out of call order"); }
+        ++seen;
+    }
+
+    for(auto const seen: seen_of_ordinal)
+    {
+        if(seen != records_per_thread) { return fail("a thread lost records"); }
+    }
+
+    return 0;
+#endif
+}
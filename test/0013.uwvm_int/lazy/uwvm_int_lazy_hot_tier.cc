@@ -0,0 +1,221 @@
+#include "uwvm_int_lazy_common.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using namespace ::uwvm2test::uwvm_int_lazy;
+    namespace mode = ::uwvm2::uwvm::runtime::runtime_mode;
+
+    // Many distinct loop-free workers, and enough iterations that every worker crosses the hot-tier threshold and most calls run the
+    // promoted body. Timing lives in `benchmark/0003.uwvm/0008.uwvm_int_hot_tier`.
+    inline constexpr ::std::uint32_t worker_count{48u};
+    inline constexpr ::std::uint32_t worker_rounds{24u};
+    inline constexpr ::std::uint32_t startup_iterations{1u};
+    inline constexpr ::std::uint32_t steady_iterations{20000u};
+
+    [[nodiscard]] constexpr ::std::int32_t worker_add(::std::uint32_t worker, ::std::uint32_t round) noexcept
+    { return static_cast<::std::int32_t>(worker * 131u + round * 7u + 3u); }
+
+    [[nodiscard]] constexpr ::std::int32_t worker_mul(::std::uint32_t worker, ::std::uint32_t round) noexcept
+    { return static_cast<::std::int32_t>(((worker * 17u + round) * 2u) | 1u); }
+
+    [[nodiscard]] constexpr ::std::uint32_t run_worker(::std::uint32_t worker, ::std::uint32_t x) noexcept
+    {
+        auto v{x};
+        for(::std::uint32_t round{}; round != worker_rounds; ++round)
+        {
+            v = ((v + static_cast<::std::uint32_t>(worker_add(worker, round))) * static_cast<::std::uint32_t>(worker_mul(worker, round))) ^ x;
+        }
+        return v;
+    }
+
+    [[nodiscard]] constexpr ::std::uint32_t expected_accumulator(::std::uint32_t iterations) noexcept
+    {
+        ::std::uint32_t acc{};
+        for(::std::uint32_t i{}; i != iterations; ++i)
+        {
+            // Only the first worker sees the loop counter; the rest take the previous worker's result as is.
+            for(::std::uint32_t worker{}; worker != worker_count; ++worker) { acc = run_worker(worker, worker == 0u ? acc ^ i : acc); }
+        }
+        return acc;
+    }
+
+    struct hot_tier_module
+    {
+        byte_vec wasm{};
+        ::std::uint32_t entry_index{};
+    };
+
+    // `entry` loops `iterations` times, threading an accumulator through every worker, and traps unless the result matches the host
+    // model. Baseline and promoted bodies must therefore compute identical values.
+    [[nodiscard]] hot_tier_module build_hot_tier_module(::std::uint32_t iterations)
+    {
+        module_builder mb{};
+
+        auto op = [](byte_vec& c, wasm_op o) { strict::append_u8(c, u8(o)); };
+        auto u32 = [](byte_vec& c, ::std::uint32_t v) { strict::append_u32_leb(c, v); };
+        auto i32 = [](byte_vec& c, ::std::int32_t v) { strict::append_i32_leb(c, v); };
+
+        ::std::vector<::std::uint32_t> worker_indices{};
+        for(::std::uint32_t worker{}; worker != worker_count; ++worker)
+        {
+            func_body fb{};
+            op(fb.code, wasm_op::local_get);
+            u32(fb.code, 0u);
+            for(::std::uint32_t round{}; round != worker_rounds; ++round)
+            {
+                op(fb.code, wasm_op::i32_const);
+                i32(fb.code, worker_add(worker, round));
+                op(fb.code, wasm_op::i32_add);
+                op(fb.code, wasm_op::i32_const);
+                i32(fb.code, worker_mul(worker, round));
+                op(fb.code, wasm_op::i32_mul);
+                op(fb.code, wasm_op::local_get);
+                u32(fb.code, 0u);
+                op(fb.code, wasm_op::i32_xor);
+            }
+            op(fb.code, wasm_op::end);
+            worker_indices.push_back(mb.add_func(func_type{{k_val_i32}, {k_val_i32}}, ::std::move(fb)));
+        }
+
+        // locals: 0 = i, 1 = acc
+        func_body entry{};
+        entry.locals.push_back({2u, k_val_i32});
+        op(entry.code, wasm_op::loop);
+        strict::append_u8(entry.code, k_block_empty);
+        for(auto const worker_index: worker_indices)
+        {
+            op(entry.code, wasm_op::local_get);
+            u32(entry.code, 1u);
+            if(worker_index == worker_indices.front())
+            {
+                op(entry.code, wasm_op::local_get);
+                u32(entry.code, 0u);
+                op(entry.code, wasm_op::i32_xor);
+            }
+            op(entry.code, wasm_op::call);
+            u32(entry.code, worker_index);
+            op(entry.code, wasm_op::local_set);
+            u32(entry.code, 1u);
+        }
+        op(entry.code, wasm_op::local_get);
+        u32(entry.code, 0u);
+        op(entry.code, wasm_op::i32_const);
+        i32(entry.code, 1);
+        op(entry.code, wasm_op::i32_add);
+        op(entry.code, wasm_op::local_tee);
+        u32(entry.code, 0u);
+        op(entry.code, wasm_op::i32_const);
+        i32(entry.code, static_cast<::std::int32_t>(iterations));
+        op(entry.code, wasm_op::i32_lt_u);
+        op(entry.code, wasm_op::br_if);
+        u32(entry.code, 0u);
+        op(entry.code, wasm_op::end);
+        op(entry.code, wasm_op::local_get);
+        u32(entry.code, 1u);
+        op(entry.code, wasm_op::i32_const);
+        i32(entry.code, static_cast<::std::int32_t>(expected_accumulator(iterations)));
+        op(entry.code, wasm_op::i32_ne);
+        op(entry.code, wasm_op::if_);
+        strict::append_u8(entry.code, k_block_empty);
+        op(entry.code, wasm_op::unreachable);
+        op(entry.code, wasm_op::end);
+        op(entry.code, wasm_op::end);
+        auto const entry_index{mb.add_func(func_type{{}, {}}, ::std::move(entry))};
+
+        return hot_tier_module{.wasm = mb.build(), .entry_index = entry_index};
+    }
+
+    [[nodiscard]] int run_hot_tier_scenario(::std::uint32_t iterations, ::std::uint32_t hot_tier_threshold)
+    {
+        auto hm{build_hot_tier_module(iterations)};
+        auto prep{prepare_runtime_from_wasm(hm.wasm, u8"uwvm2test_lazy_hot_tier")};
+        UWVM2TEST_REQUIRE(prep.mod != nullptr);
+
+        configure_lazy_runtime(0uz, 4096uz);
+        mode::global_runtime_uwvm_int_hot_tier_call_threshold = hot_tier_threshold;
+        mode::global_runtime_mode = mode::runtime_mode_t::lazy_compile;
+        ::uwvm2::runtime::lib::lazy_compile_and_run_main_module(u8"uwvm2test_lazy_hot_tier",
+                                                                ::uwvm2::runtime::lib::lazy_compile_run_config{.entry_function_index = hm.entry_index});
+        return 0;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    // Returns the value of `key=<n>` from the lazy runtime summary in `log`, or zero when the key is absent.
+    [[nodiscard]] ::std::size_t read_log_counter(::std::string const& log, ::std::string_view key)
+    {
+        auto const pos{log.rfind(key)};
+        if(pos == ::std::string::npos) { return 0uz; }
+        return static_cast<::std::size_t>(::std::strtoull(log.c_str() + pos + key.size(), nullptr, 10));
+    }
+
+    // One lazy run in a child process, so every run starts from an untranslated module. The child writes the runtime log to a file
+    // and the parent reads the number of hot-tier promotions from its summary line. A mismatching accumulator traps the child.
+    [[nodiscard]] int run_hot_tier_child(::std::uint32_t iterations, ::std::uint32_t hot_tier_threshold, ::std::size_t& promotions)
+    {
+        pid_t const pid = ::fork();
+        if(pid == 0)
+        {
+            ::uwvm2::uwvm::io::u8runtime_log_output.reopen(u8"uwvm2test_lazy_hot_tier.log", ::fast_io::open_mode::out);
+            ::uwvm2::uwvm::io::enable_runtime_log = true;
+            auto const result{run_hot_tier_scenario(iterations, hot_tier_threshold)};
+            // Reopening closes and flushes the log before `_exit` skips the destructors.
+            ::uwvm2::uwvm::io::u8runtime_log_output.reopen(u8"/dev/null", ::fast_io::open_mode::out);
+            _exit(result == 0 ? 0 : 1);
+        }
+        if(pid < 0) { return strict::fail(__LINE__, "fork"); }
+
+        int status{};
+        if(::waitpid(pid, &status, 0) < 0) { return strict::fail(__LINE__, "waitpid"); }
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) { return strict::fail(__LINE__, "hot-tier scenario failed"); }
+
+        ::std::ifstream log_file("uwvm2test_lazy_hot_tier.log");
+        ::std::string const log{::std::istreambuf_iterator<char>{log_file}, ::std::istreambuf_iterator<char>{}};
+        if(log.find("hot_tier_promotions=") == ::std::string::npos) { return strict::fail(__LINE__, "lazy runtime summary missing"); }
+        promotions = read_log_counter(log, "hot_tier_promotions=");
+
+        ::std::cout << "[uwvm_int_lazy_hot_tier] iterations=" << iterations << " hot_tier_threshold=" << hot_tier_threshold
+                    << " hot_tier_promotions=" << promotions << '\n';
+        return 0;
+    }
+#endif
+
+    [[nodiscard]] int test_lazy_hot_tier()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        for(auto const threshold: {0u, 1u, mode::default_runtime_uwvm_int_hot_tier_call_threshold})
+        {
+            // A single pass leaves the default threshold unreached; the long run crosses every threshold.
+            for(auto const iterations: {startup_iterations, steady_iterations})
+            {
+                ::std::size_t promotions{};
+                UWVM2TEST_REQUIRE(run_hot_tier_child(iterations, threshold, promotions) == 0);
+# if defined(UWVM2TEST_RUNNER_USE_LLVM_JIT)
+                // The LLVM backend has no uwvm-int baseline tier.
+                UWVM2TEST_REQUIRE(promotions == 0uz);
+# else
+                bool const crossed{threshold != 0u && iterations >= threshold};
+                UWVM2TEST_REQUIRE(crossed ? promotions > 0uz : promotions == 0uz);
+# endif
+            }
+        }
+#else
+        for(auto const threshold: {0u, 1u, mode::default_runtime_uwvm_int_hot_tier_call_threshold})
+        {
+            UWVM2TEST_REQUIRE(run_hot_tier_scenario(steady_iterations, threshold) == 0);
+        }
+#endif
+        return 0;
+    }
+}  // namespace
+
+int main()
+{
+    return test_lazy_hot_tier();
+}
@@ -0,0 +1,245 @@
+#include "../uwvm_int_translate_strict_common.h"
+
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+// A straight-line group of `local.get base; <load>` shares one hoisted bounds guard (tail-call translation only). When the guard
+// fails, the trap must still name the first load of the group that is out of bounds, with its own static offset and size, also
+// after `memory.grow` moved the end of memory.
+namespace
+{
+    using namespace ::uwvm2test::uwvm_int_strict;
+
+#if !defined(UWVM2TEST_RUNNER_USE_LLVM_JIT) && (defined(__unix__) || defined(__APPLE__))
+
+    using native_memory_t = ::uwvm2::object::memory::linear::native_memory_t;
+
+    // 64 KiB of memory in every backend; the mmap backend uses 1-byte pages so loads pay for a length compare and hoisting applies.
+    inline constexpr ::std::size_t k_memory_bytes{65536uz};
+
+    // The group's third load (`i32.load offset=16`) is the first to fault when the base is 16 bytes below the end of memory.
+    inline constexpr ::std::uint_least64_t k_faulting_static_offset{16u};
+    inline constexpr ::std::size_t k_faulting_bytes{4uz};
+
+    inline ::std::uint_least64_t expected_effective_offset{};
+
+    [[noreturn]] void exit_with(int code) noexcept { _exit(code); }
+
+    void UWVM2TEST_WASM_ABI check_memory_oob(::uwvm2::object::memory::error::memory_error_t const& memerr) noexcept
+    {
+        bool const matches{memerr.memory_idx == 0uz && memerr.memory_static_offset == k_faulting_static_offset &&
+                           memerr.memory_type_size == k_faulting_bytes && !memerr.memory_offset.offset_65_bit &&
+                           memerr.memory_offset.offset == expected_effective_offset};
+        exit_with(matches ? 10 : 11);
+    }
+
+    [[nodiscard]] byte_vec build_bounds_hoist_module()
+    {
+        module_builder mb{};
+        mb.has_memory = true;
+        mb.memory_min = 1u;
+
+        auto op = [&](byte_vec& c, wasm_op o) { append_u8(c, u8(o)); };
+        auto u32 = [&](byte_vec& c, ::std::uint32_t v) { append_u32_leb(c, v); };
+
+        // f0: (base) -> i32.load[0] + wrap(i64.load[8]) + i32.load[16] + wrap(i64.load[64])
+        {
+            func_type ty{{k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 0u);
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i64_load);
+            u32(c, 3u);
+            u32(c, 8u);
+            op(c, wasm_op::i32_wrap_i64);
+            op(c, wasm_op::i32_add);
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 16u);
+            op(c, wasm_op::i32_add);
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i64_load);
+            u32(c, 3u);
+            u32(c, 64u);
+            op(c, wasm_op::i32_wrap_i64);
+            op(c, wasm_op::i32_add);
+
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        // f1: (delta) -> memory.grow delta
+        {
+            func_type ty{{k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::memory_grow);
+            u32(c, 0u);
+
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        return mb.build();
+    }
+
+    template <typename Fn>
+    [[nodiscard]] int run_in_child_expect_exit(int expected_code, Fn&& fn)
+    {
+        pid_t const pid = ::fork();
+        if(pid == 0)
+        {
+            fn();
+            exit_with(98);
+        }
+        if(pid < 0) { return fail(__LINE__, "fork"); }
+
+        int status{};
+        if(::waitpid(pid, &status, 0) < 0) { return fail(__LINE__, "waitpid"); }
+        if(!WIFEXITED(status)) { return fail(__LINE__, "child did not exit normally"); }
+        if(WEXITSTATUS(status) != expected_code) { return fail(__LINE__, "unexpected child exit code"); }
+        return 0;
+    }
+
+    template <optable::uwvm_interpreter_translate_option_t Opt>
+    [[nodiscard]] int run_bounds_hoist_suite(runtime_module_t const& rt, native_memory_t& mem)
+    {
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+        optable::compile_option cop{};
+        auto cm = compiler::compile_all_from_uwvm_single_func<Opt>(rt, cop, err);
+        UWVM2TEST_REQUIRE(err.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+
+# if defined(UWVM_ENABLE_UWVM_INT_COMBINE_OPS)
+        {
+            constexpr auto curr{make_initial_stacktop_currpos<Opt>()};
+            constexpr auto tuple =
+                compiler::details::make_interpreter_tuple<Opt>(::std::make_index_sequence<compiler::details::interpreter_tuple_size<Opt>()>{});
+            auto const exp_guard = optable::translate::get_uwvmint_memory_bounds_guard_localget_fptr_from_tuple<Opt>(curr, tuple);
+            UWVM2TEST_REQUIRE(bytecode_contains_fptr(cm.local_funcs.index_unchecked(0).op.operands, exp_guard));
+            UWVM2TEST_REQUIRE(!bytecode_contains_fptr(cm.local_funcs.index_unchecked(1).op.operands, exp_guard));
+        }
+# endif
+
+        using Runner = interpreter_runner<Opt>;
+        auto const run_group = [&](::std::int32_t base)
+        {
+            return load_i32(Runner::run(cm.local_funcs.index_unchecked(0),
+                                        rt.local_defined_function_vec_storage.index_unchecked(0),
+                                        pack_i32(base),
+                                        nullptr,
+                                        nullptr)
+                                .results);
+        };
+
+        // In bounds: every load of the group reads its own slot.
+        UWVM2TEST_REQUIRE(run_group(0) == 1 + 2 + 4 + 8);
+
+        auto const last_base{static_cast<::std::int32_t>(k_memory_bytes - 16uz)};
+
+        // The loads at offsets 0 and 8 fit; the trap names `i32.load offset=16`, not the guard's union range or the last load.
+        if(int const ec = run_in_child_expect_exit(10,
+                                                   [&]
+                                                   {
+                                                       expected_effective_offset = k_memory_bytes;
+                                                       (void)run_group(last_base);
+                                                   });
+           ec != 0)
+        {
+            return ec;
+        }
+
+        // After growing by 64 KiB the same base is in bounds and reads the new bytes; the group faults again at the new end.
+        if(int const ec = run_in_child_expect_exit(10,
+                                                   [&]
+                                                   {
+                                                       auto const delta{static_cast<::std::int32_t>(k_memory_bytes >> mem.custom_page_size_log2)};
+                                                       auto const old_pages{load_i32(Runner::run(cm.local_funcs.index_unchecked(1),
+                                                                                                 rt.local_defined_function_vec_storage.index_unchecked(1),
+                                                                                                 pack_i32(delta),
+                                                                                                 nullptr,
+                                                                                                 nullptr)
+                                                                                         .results)};
+                                                       if(old_pages != delta) { exit_with(13); }
+
+                                                       ::std::int32_t const grown_value{7};
+                                                       ::std::memcpy(mem.memory_begin + k_memory_bytes, ::std::addressof(grown_value), sizeof(grown_value));
+                                                       if(run_group(last_base) != grown_value) { exit_with(12); }
+
+                                                       expected_effective_offset = 2uz * k_memory_bytes;
+                                                       (void)run_group(static_cast<::std::int32_t>(2uz * k_memory_bytes - 16uz));
+                                                   });
+           ec != 0)
+        {
+            return ec;
+        }
+
+        return 0;
+    }
+
+#endif
+}  // namespace
+
+int main()
+{
+#if defined(UWVM2TEST_RUNNER_USE_LLVM_JIT) || (!defined(__unix__) && !defined(__APPLE__))
+    return 0;  // bounds-check hoisting is a u2 tail-call translation; the trap replay needs fork
+#else
+    install_unexpected_traps();
+    optable::call_func = strict_terminate_call;
+    optable::call_indirect_func = strict_terminate_call_indirect;
+    optable::trap_memory_out_of_bounds_func = check_memory_oob;
+
+    auto const wasm = build_bounds_hoist_module();
+    auto prep = prepare_runtime_from_wasm(wasm, u8"uwvm2test_memory_bounds_hoist_localget");
+    UWVM2TEST_REQUIRE(prep.mod != nullptr);
+    runtime_module_t const& rt = *prep.mod;
+    UWVM2TEST_REQUIRE(!rt.local_defined_memory_vec_storage.empty());
+
+    // The runtime owns memory0; the test replaces its backing before translation so the translator sees the memory it will run on.
+    auto& mem = const_cast<native_memory_t&>(rt.local_defined_memory_vec_storage.index_unchecked(0).memory);
+# if defined(UWVM_SUPPORT_MMAP)
+    mem = native_memory_t{1uz, ::uwvm2::object::memory::linear::mmap_memory_status_t::wasm32};
+    mem.init_by_page_count(k_memory_bytes);
+    UWVM2TEST_REQUIRE(optable::translate::details::memory_bounds_check_hoistable(mem));
+# endif
+
+    auto const store_i32 = [&](::std::size_t at, ::std::int32_t v) { ::std::memcpy(mem.memory_begin + at, ::std::addressof(v), sizeof(v)); };
+    auto const store_i64 = [&](::std::size_t at, ::std::int64_t v) { ::std::memcpy(mem.memory_begin + at, ::std::addressof(v), sizeof(v)); };
+    store_i32(0uz, 1);
+    store_i64(8uz, 2);
+    store_i32(16uz, 4);
+    store_i64(64uz, 8);
+
+    if(abi_mode_enabled("tail-min"))
+    {
+        if(int const ec = run_bounds_hoist_suite<k_test_tail_min_opt>(rt, mem); ec != 0) { return ec; }
+    }
+
+    if(abi_mode_enabled("tail-sysv"))
+    {
+        if(int const ec = run_bounds_hoist_suite<k_test_tail_sysv_opt>(rt, mem); ec != 0) { return ec; }
+    }
+
+    return 0;
+#endif
+}
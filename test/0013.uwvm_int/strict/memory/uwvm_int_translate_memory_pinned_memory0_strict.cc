@@ -0,0 +1,287 @@
+#include "../uwvm_int_translate_strict_common.h"
+
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+// Pinned memory0 (`memory0_begin_pos`/`memory0_end_pos`): plain loads and stores on a dynamic-length mmap memory check against
+// the `[begin, end)` carried in argument slots. The pins start out null, may lag behind `memory.grow`, and a miss must re-read the
+// live length before it traps. Each suite also runs unpinned so both layouts agree on results and on the reported trap.
+namespace
+{
+    using namespace ::uwvm2test::uwvm_int_strict;
+
+#if defined(UWVM_SUPPORT_MMAP) && !defined(UWVM2TEST_RUNNER_USE_LLVM_JIT) && (defined(__unix__) || defined(__APPLE__))
+
+    using native_memory_t = ::uwvm2::object::memory::linear::native_memory_t;
+
+    // The runtime's pinned layout on 8-integer-argument ABIs: pins in slots 3-4, the i32/i64 ring after them.
+    inline constexpr optable::uwvm_interpreter_translate_option_t k_test_tail_pinned_memory0_opt{
+        .is_tail_call = true,
+        .i32_stack_top_begin_pos = 5uz,
+        .i32_stack_top_end_pos = 7uz,
+        .i64_stack_top_begin_pos = 5uz,
+        .i64_stack_top_end_pos = 7uz,
+        .f32_stack_top_begin_pos = 7uz,
+        .f32_stack_top_end_pos = 9uz,
+        .f64_stack_top_begin_pos = 7uz,
+        .f64_stack_top_end_pos = 9uz,
+        .v128_stack_top_begin_pos = SIZE_MAX,
+        .v128_stack_top_end_pos = SIZE_MAX,
+        .memory0_begin_pos = 3uz,
+        .memory0_end_pos = 4uz,
+    };
+
+    static_assert(compiler::details::interpreter_tuple_has_no_holes<k_test_tail_pinned_memory0_opt>());
+    static_assert(optable::details::memory0_pinned_for<k_test_tail_pinned_memory0_opt, optable::details::bounds_check_mmap_judge>());
+
+    // 64 KiB in 1-byte pages: smaller than a platform page, so loads and stores take the dynamic-length (pinnable) path.
+    inline constexpr ::std::size_t k_memory_bytes{65536uz};
+
+    struct expected_oob_t
+    {
+        ::std::uint_least64_t effective_offset{};
+        ::std::uint_least64_t static_offset{};
+        ::std::uint_least64_t memory_length{};
+        ::std::size_t bytes{};
+    };
+
+    inline expected_oob_t expected_oob{};
+
+    [[noreturn]] void exit_with(int code) noexcept { _exit(code); }
+
+    void UWVM2TEST_WASM_ABI check_memory_oob(::uwvm2::object::memory::error::memory_error_t const& memerr) noexcept
+    {
+        bool const matches{memerr.memory_idx == 0uz && !memerr.memory_offset.offset_65_bit && memerr.memory_offset.offset == expected_oob.effective_offset &&
+                           memerr.memory_static_offset == expected_oob.static_offset && memerr.memory_length == expected_oob.memory_length &&
+                           memerr.memory_type_size == expected_oob.bytes};
+        exit_with(matches ? 10 : 11);
+    }
+
+    [[nodiscard]] byte_vec build_pinned_memory0_module()
+    {
+        module_builder mb{};
+        mb.has_memory = true;
+        mb.memory_min = 1u;
+
+        auto op = [&](byte_vec& c, wasm_op o) { append_u8(c, u8(o)); };
+        auto u32 = [&](byte_vec& c, ::std::uint32_t v) { append_u32_leb(c, v); };
+        auto i32 = [&](byte_vec& c, ::std::int32_t v) { append_i32_leb(c, v); };
+
+        // The address is always the sum of two locals, which no `local.get` load fusion matches, so the plain (pinnable) ops are used.
+        auto addr = [&](byte_vec& c, ::std::uint32_t a, ::std::uint32_t b)
+        {
+            op(c, wasm_op::local_get);
+            u32(c, a);
+            op(c, wasm_op::local_get);
+            u32(c, b);
+            op(c, wasm_op::i32_add);
+        };
+
+        // f0: (a, b) -> i32.load (a + b)
+        {
+            func_type ty{{k_val_i32, k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+
+            addr(c, 0u, 1u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 0u);
+
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        // f1: (a, b, delta, probe) -> grow while pinned, then read past the stale pin and at `probe`
+        //   i32.load (a + b) offset=65532 ; drop           ;; pins [0, 64 KiB)
+        //   memory.grow delta ; drop
+        //   i32.store (a + b) offset=65536 <- 7             ;; past the stale pin: must re-pin, not trap
+        //   i32.load (a + b) offset=65536 + i32.load (probe + b)
+        {
+            func_type ty{{k_val_i32, k_val_i32, k_val_i32, k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+
+            addr(c, 0u, 1u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 65532u);
+            op(c, wasm_op::drop);
+
+            op(c, wasm_op::local_get);
+            u32(c, 2u);
+            op(c, wasm_op::memory_grow);
+            u32(c, 0u);
+            op(c, wasm_op::drop);
+
+            addr(c, 0u, 1u);
+            op(c, wasm_op::i32_const);
+            i32(c, 7);
+            op(c, wasm_op::i32_store);
+            u32(c, 2u);
+            u32(c, 65536u);
+
+            addr(c, 0u, 1u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 65536u);
+
+            addr(c, 3u, 1u);
+            op(c, wasm_op::i32_load);
+            u32(c, 2u);
+            u32(c, 0u);
+            op(c, wasm_op::i32_add);
+
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        return mb.build();
+    }
+
+    [[nodiscard]] byte_vec pack_i32x4(::std::int32_t a, ::std::int32_t b, ::std::int32_t c, ::std::int32_t d)
+    {
+        byte_vec out(16);
+        ::std::memcpy(out.data(), ::std::addressof(a), 4);
+        ::std::memcpy(out.data() + 4, ::std::addressof(b), 4);
+        ::std::memcpy(out.data() + 8, ::std::addressof(c), 4);
+        ::std::memcpy(out.data() + 12, ::std::addressof(d), 4);
+        return out;
+    }
+
+    [[nodiscard]] byte_vec pack_i32x2(::std::int32_t a, ::std::int32_t b)
+    {
+        byte_vec out(8);
+        ::std::memcpy(out.data(), ::std::addressof(a), 4);
+        ::std::memcpy(out.data() + 4, ::std::addressof(b), 4);
+        return out;
+    }
+
+    template <typename Fn>
+    [[nodiscard]] int run_in_child_expect_exit(int expected_code, Fn&& fn)
+    {
+        pid_t const pid = ::fork();
+        if(pid == 0)
+        {
+            fn();
+            exit_with(98);
+        }
+        if(pid < 0) { return fail(__LINE__, "fork"); }
+
+        int status{};
+        if(::waitpid(pid, &status, 0) < 0) { return fail(__LINE__, "waitpid"); }
+        if(!WIFEXITED(status)) { return fail(__LINE__, "child did not exit normally"); }
+        if(WEXITSTATUS(status) != expected_code) { return fail(__LINE__, "unexpected child exit code"); }
+        return 0;
+    }
+
+    template <optable::uwvm_interpreter_translate_option_t Opt>
+    [[nodiscard]] int run_pinned_memory0_suite(runtime_module_t const& rt)
+    {
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+        optable::compile_option cop{};
+        auto cm = compiler::compile_all_from_uwvm_single_func<Opt>(rt, cop, err);
+        UWVM2TEST_REQUIRE(err.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+
+        using Runner = interpreter_runner<Opt>;
+        auto const run = [&](::std::size_t func_index, byte_vec const& params)
+        {
+            return load_i32(Runner::run(cm.local_funcs.index_unchecked(func_index),
+                                        rt.local_defined_function_vec_storage.index_unchecked(func_index),
+                                        params,
+                                        nullptr,
+                                        nullptr)
+                                .results);
+        };
+
+        // The first access pins from null; the last in-bounds word reads normally.
+        UWVM2TEST_REQUIRE(run(0uz, pack_i32x2(0, 0)) == 1);
+        UWVM2TEST_REQUIRE(run(0uz, pack_i32x2(static_cast<::std::int32_t>(k_memory_bytes - 8uz), 4)) == 2);
+
+        // A straddling load traps with the live length, not a null or stale pin.
+        if(int const ec = run_in_child_expect_exit(10,
+                                                   [&]
+                                                   {
+                                                       expected_oob = {.effective_offset = k_memory_bytes - 2uz,
+                                                                       .static_offset = 0u,
+                                                                       .memory_length = k_memory_bytes,
+                                                                       .bytes = 4uz};
+                                                       (void)run(0uz, pack_i32x2(static_cast<::std::int32_t>(k_memory_bytes - 2uz), 0));
+                                                   });
+           ec != 0)
+        {
+            return ec;
+        }
+
+        auto const delta{static_cast<::std::int32_t>(k_memory_bytes)};
+
+        // memory.grow while pinned: the store and load past the stale end re-pin instead of trapping, and see each other.
+        if(int const ec = run_in_child_expect_exit(20,
+                                                   [&] { exit_with(run(1uz, pack_i32x4(0, 0, delta, 0)) == 7 + 1 ? 20 : 21); });
+           ec != 0)
+        {
+            return ec;
+        }
+
+        // After the re-pin, an access past the grown end still traps, reporting the grown length.
+        if(int const ec = run_in_child_expect_exit(10,
+                                                   [&]
+                                                   {
+                                                       expected_oob = {.effective_offset = 2uz * k_memory_bytes - 2uz,
+                                                                       .static_offset = 0u,
+                                                                       .memory_length = 2uz * k_memory_bytes,
+                                                                       .bytes = 4uz};
+                                                       (void)run(1uz, pack_i32x4(0, 0, delta, static_cast<::std::int32_t>(2uz * k_memory_bytes - 2uz)));
+                                                   });
+           ec != 0)
+        {
+            return ec;
+        }
+
+        return 0;
+    }
+
+#endif
+}  // namespace
+
+int main()
+{
+#if !defined(UWVM_SUPPORT_MMAP) || defined(UWVM2TEST_RUNNER_USE_LLVM_JIT) || (!defined(__unix__) && !defined(__APPLE__))
+    return 0;  // pinning only applies to u2 on mmap memories; the trap checks need fork
+#else
+    install_unexpected_traps();
+    optable::call_func = strict_terminate_call;
+    optable::call_indirect_func = strict_terminate_call_indirect;
+    optable::trap_memory_out_of_bounds_func = check_memory_oob;
+
+    auto const wasm = build_pinned_memory0_module();
+    auto prep = prepare_runtime_from_wasm(wasm, u8"uwvm2test_memory_pinned_memory0");
+    UWVM2TEST_REQUIRE(prep.mod != nullptr);
+    runtime_module_t const& rt = *prep.mod;
+    UWVM2TEST_REQUIRE(!rt.local_defined_memory_vec_storage.empty());
+
+    // Replace memory0's backing with a 1-byte-page memory before translation, so the translator selects the dynamic-length ops.
+    auto& mem = const_cast<native_memory_t&>(rt.local_defined_memory_vec_storage.index_unchecked(0).memory);
+    mem = native_memory_t{1uz, ::uwvm2::object::memory::linear::mmap_memory_status_t::wasm32};
+    mem.init_by_page_count(k_memory_bytes);
+    UWVM2TEST_REQUIRE(optable::translate::details::select_mmap_variant(mem) == optable::translate::details::mmap_variant::judge);
+
+    ::std::int32_t const first_word{1};
+    ::std::int32_t const last_word{2};
+    ::std::memcpy(mem.memory_begin, ::std::addressof(first_word), sizeof(first_word));
+    ::std::memcpy(mem.memory_begin + (k_memory_bytes - 4uz), ::std::addressof(last_word), sizeof(last_word));
+
+    if(int const ec = run_pinned_memory0_suite<k_test_tail_pinned_memory0_opt>(rt); ec != 0) { return ec; }
+
+    if(abi_mode_enabled("tail-min"))
+    {
+        if(int const ec = run_pinned_memory0_suite<k_test_tail_min_opt>(rt); ec != 0) { return ec; }
+    }
+
+    return 0;
+#endif
+}
@@ -0,0 +1,357 @@
+// The profiler is a build option; this test always builds it in so that probes and reports are exercised in every configuration.
+#ifndef UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE
+# define UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE
+#endif
+
+#include "strict/uwvm_int_translate_strict_common.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace
+{
+    using namespace ::uwvm2test::uwvm_int_strict;
+
+    namespace opfunc_profile = ::uwvm2::runtime::compiler::uwvm_int::optable::opfunc_profile;
+
+    constexpr ::std::size_t k_calls = 64uz;
+    constexpr char8_t const* k_report_path{u8"uwvm2test_opfunc_profile.txt"};
+
+    [[nodiscard]] constexpr ::std::int32_t kernel_model(::std::int32_t a, ::std::int32_t b) noexcept
+    {
+        auto const ua{static_cast<::std::uint32_t>(a)};
+        auto const ub{static_cast<::std::uint32_t>(b)};
+        auto const x{(ua * 3u + ub) ^ 0x5a5au};
+        return static_cast<::std::int32_t>(::std::rotl(x, 7) - ua);
+    }
+
+    [[nodiscard]] byte_vec build_kernel_module()
+    {
+        module_builder mb{};
+
+        auto op = [&](byte_vec& c, wasm_op o) { append_u8(c, u8(o)); };
+        auto u32 = [&](byte_vec& c, ::std::uint32_t v) { append_u32_leb(c, v); };
+        auto i32 = [&](byte_vec& c, ::std::int32_t v) { append_i32_leb(c, v); };
+
+        // f0: (i32 a, i32 b) -> i32 = rotl((a * 3 + b) ^ 0x5a5a, 7) - a, straight-line so every dispatch extends the chain.
+        {
+            func_type ty{{k_val_i32, k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_const);
+            i32(c, 3);
+            op(c, wasm_op::i32_mul);
+            op(c, wasm_op::local_get);
+            u32(c, 1u);
+            op(c, wasm_op::i32_add);
+            op(c, wasm_op::i32_const);
+            i32(c, 0x5a5a);
+            op(c, wasm_op::i32_xor);
+            op(c, wasm_op::i32_const);
+            i32(c, 7);
+            op(c, wasm_op::i32_rotl);
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_sub);
+            op(c, wasm_op::end);
+
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        return mb.build();
+    }
+
+    [[nodiscard]] byte_vec pack_i32x2(::std::int32_t a, ::std::int32_t b)
+    {
+        byte_vec out(8);
+        ::std::memcpy(out.data(), ::std::addressof(a), 4);
+        ::std::memcpy(out.data() + 4, ::std::addressof(b), 4);
+        return out;
+    }
+
+    [[nodiscard]] ::std::int32_t call_arg_a(::std::size_t i) noexcept { return static_cast<::std::int32_t>(static_cast<::std::uint32_t>(i) * 2654435761u); }
+
+    [[nodiscard]] ::std::int32_t call_arg_b(::std::size_t i) noexcept { return static_cast<::std::int32_t>(~static_cast<::std::uint32_t>(i * 40503uz)); }
+
+    void set_profile_path(char8_t const* path)
+    {
+        auto& profile_path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_opfunc_profile_path};
+        profile_path.clear();
+        ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(profile_path)};
+        ::fast_io::io::print(ref, ::fast_io::mnp::os_c_str(path));
+    }
+
+    // Each translation option runs against fresh counters, so its report covers only its own dispatches.
+    void reset_profile_counters() noexcept
+    {
+        ::uwvm2::utils::mutex::mutex_guard_t registry_guard{opfunc_profile::registry.mutex};
+        for(auto const table: opfunc_profile::registry.tables)
+        {
+            table->slots.clear();
+            table->used = 0uz;
+            table->last_probe_ip = nullptr;
+            table->chain = 0uz;
+        }
+    }
+
+    struct probe_site
+    {
+        ::std::size_t pos{};
+        opfunc_profile::probe_back_offset_t back_offset{};
+        opfunc_profile::opfunc_bits_t op{};
+    };
+
+    struct report_row
+    {
+        ::std::size_t n{};
+        ::std::uint64_t count{};
+        ::std::uint64_t saved{};
+        ::std::string sequence{};
+
+        [[nodiscard]] friend bool operator== (report_row const&, report_row const&) = default;
+    };
+
+    [[nodiscard]] ::std::string display_name(opfunc_profile::opfunc_bits_t bits)
+    {
+        auto const name{opfunc_profile::opfunc_display_name(bits)};
+        return ::std::string(reinterpret_cast<char const*>(name.data()), name.size());
+    }
+
+    // The report ranks fusion candidates (n >= 2) by saved dispatches, then lists single opfuncs by count; ties sort by name.
+    [[nodiscard]] ::std::vector<report_row> expected_report(::std::vector<probe_site> const& sites)
+    {
+        ::std::map<::std::pair<::std::size_t, ::std::string>, ::std::uint64_t> counts{};
+        for(::std::size_t i{}; i != sites.size(); ++i)
+        {
+            ::std::string sequence{display_name(sites[i].op)};
+            counts[{1uz, sequence}] += k_calls;
+            for(::std::size_t n{2uz}; n <= opfunc_profile::max_ngram_length && n <= i + 1uz; ++n)
+            {
+                sequence = display_name(sites[i + 1uz - n].op) + " " + sequence;
+                counts[{n, sequence}] += k_calls;
+            }
+        }
+
+        ::std::vector<report_row> rows{};
+        for(auto const& [key, count]: counts) { rows.push_back(report_row{key.first, count, count * (key.first - 1uz), key.second}); }
+        ::std::sort(rows.begin(),
+                    rows.end(),
+                    [](report_row const& a, report_row const& b)
+                    {
+                        bool const a_candidate{a.n != 1uz};
+                        bool const b_candidate{b.n != 1uz};
+                        if(a_candidate != b_candidate) { return a_candidate; }
+                        auto const a_key{a_candidate ? a.saved : a.count};
+                        auto const b_key{b_candidate ? b.saved : b.count};
+                        if(a_key != b_key) { return a_key > b_key; }
+                        return a.sequence < b.sequence;
+                    });
+        return rows;
+    }
+
+    [[nodiscard]] bool read_report(::std::uint64_t& dispatches, ::std::vector<report_row>& rows)
+    {
+        {
+            ::fast_io::u8obuf_file file{::fast_io::mnp::os_c_str(k_report_path),
+                                        ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+            opfunc_profile::write_opfunc_profile(file);
+        }
+
+        ::std::ifstream in(reinterpret_cast<char const*>(k_report_path));
+        if(!in) { return false; }
+        ::std::string line{};
+        while(::std::getline(in, line))
+        {
+            if(line.starts_with("# dispatches\t"))
+            {
+                dispatches = ::std::stoull(line.substr(13uz));
+                continue;
+            }
+            if(line.empty() || line.front() == '#') { continue; }
+
+            // n \t count \t saved_dispatches \t saved_percent \t sequence
+            ::std::istringstream fields(line);
+            report_row row{};
+            ::std::string percent{};
+            if(!(fields >> row.n >> row.count >> row.saved >> percent)) { return false; }
+            fields.get();
+            ::std::getline(fields, row.sequence);
+            rows.push_back(::std::move(row));
+        }
+        return true;
+    }
+
+    template <optable::uwvm_interpreter_translate_option_t Opt>
+    [[nodiscard]] int run_kernel(runtime_module_t const& rt, compiled_module_t const& cm, ::std::vector<::std::int32_t>& results)
+    {
+        UWVM2TEST_REQUIRE(!cm.local_funcs.empty());
+
+        results.clear();
+        for(::std::size_t i{}; i != k_calls; ++i)
+        {
+            auto const rr{interpreter_runner<Opt>::run(cm.local_funcs.index_unchecked(0),
+                                                       rt.local_defined_function_vec_storage.index_unchecked(0),
+                                                       pack_i32x2(call_arg_a(i), call_arg_b(i)),
+                                                       nullptr,
+                                                       nullptr)};
+            UWVM2TEST_REQUIRE(rr.results.size() == 4uz);
+            results.push_back(load_i32(rr.results));
+        }
+        return 0;
+    }
+
+    template <optable::uwvm_interpreter_translate_option_t Opt>
+    [[nodiscard]] int check_profiled_kernel(runtime_module_t const& rt)
+    {
+        constexpr auto interpreter_tuple{
+            compiler::details::make_interpreter_tuple<Opt>(::std::make_index_sequence<compiler::details::interpreter_tuple_size<Opt>()>{})};
+        auto const probe_fptr{optable::translate::get_uwvmint_opfunc_profile_probe_fptr_from_tuple<Opt>(interpreter_tuple)};
+        constexpr ::std::size_t probe_size{sizeof(probe_fptr) + sizeof(opfunc_profile::probe_back_offset_t)};
+
+        // Unprofiled: the production stream, without a single probe.
+        set_profile_path(u8"");
+        ::uwvm2::validation::error::code_validation_error_impl plain_err{};
+        optable::compile_option plain_cop{};
+        auto plain_cm = compiler::compile_all_from_uwvm_single_func<Opt>(rt, plain_cop, plain_err);
+        UWVM2TEST_REQUIRE(plain_err.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+        ::std::vector<::std::int32_t> plain_results{};
+        UWVM2TEST_REQUIRE((run_kernel<Opt>(rt, plain_cm, plain_results)) == 0);
+        UWVM2TEST_REQUIRE(!bytecode_contains_fptr(plain_cm.local_funcs.index_unchecked(0).op.operands, probe_fptr));
+        for(::std::size_t i{}; i != k_calls; ++i) { UWVM2TEST_REQUIRE(plain_results[i] == kernel_model(call_arg_a(i), call_arg_b(i))); }
+
+        // Profiled: same results, one probe in front of every opfunc.
+        set_profile_path(k_report_path);
+        reset_profile_counters();
+        ::uwvm2::validation::error::code_validation_error_impl profiled_err{};
+        optable::compile_option profiled_cop{};
+        auto profiled_cm = compiler::compile_all_from_uwvm_single_func<Opt>(rt, profiled_cop, profiled_err);
+        UWVM2TEST_REQUIRE(profiled_err.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+        ::std::vector<::std::int32_t> profiled_results{};
+        UWVM2TEST_REQUIRE((run_kernel<Opt>(rt, profiled_cm, profiled_results)) == 0);
+        set_profile_path(u8"");
+        UWVM2TEST_REQUIRE(profiled_results == plain_results);
+
+        auto const& bc{profiled_cm.local_funcs.index_unchecked(0).op.operands};
+        UWVM2TEST_REQUIRE(bc.size() > plain_cm.local_funcs.index_unchecked(0).op.operands.size());
+
+        ::std::vector<probe_site> sites{};
+        for(::std::size_t i{}; i + probe_size + sizeof(probe_fptr) <= bc.size();)
+        {
+            if(::std::memcmp(bc.data() + i, ::std::addressof(probe_fptr), sizeof(probe_fptr)) != 0)
+            {
+                ++i;
+                continue;
+            }
+            probe_site site{.pos = i};
+            ::std::memcpy(::std::addressof(site.back_offset), bc.data() + i + sizeof(probe_fptr), sizeof(site.back_offset));
+            ::std::memcpy(::std::addressof(site.op), bc.data() + i + probe_size, sizeof(probe_fptr));
+            sites.push_back(site);
+            i += probe_size;
+        }
+        UWVM2TEST_REQUIRE(sites.size() >= 3uz);
+
+        // Straight-line code: the first probe starts the chain, every later one links to its layout predecessor, and no probe is
+        // ever followed by another probe.
+        opfunc_profile::opfunc_bits_t probe_bits{};
+        ::std::memcpy(::std::addressof(probe_bits), ::std::addressof(probe_fptr), sizeof(probe_fptr));
+        UWVM2TEST_REQUIRE(sites.front().back_offset == 0u);
+        for(::std::size_t i{}; i != sites.size(); ++i)
+        {
+            UWVM2TEST_REQUIRE(sites[i].op != probe_bits);
+            if(i != 0uz) { UWVM2TEST_REQUIRE(sites[i].back_offset == sites[i].pos - sites[i - 1uz].pos); }
+        }
+
+        ::std::uint64_t dispatches{};
+        ::std::vector<report_row> rows{};
+        UWVM2TEST_REQUIRE(read_report(dispatches, rows));
+        UWVM2TEST_REQUIRE(dispatches == k_calls * sites.size());
+
+        auto const expected{expected_report(sites)};
+        UWVM2TEST_REQUIRE(rows.size() == expected.size());
+        for(::std::size_t i{}; i != rows.size(); ++i)
+        {
+            if(rows[i] != expected[i])
+            {
+                ::std::fprintf(stderr,
+                               "uwvm2test: report row %zu: got (%zu, %llu, %llu, %s), expected (%zu, %llu, %llu, %s)\n",
+                               i,
+                               rows[i].n,
+                               static_cast<unsigned long long>(rows[i].count),
+                               static_cast<unsigned long long>(rows[i].saved),
+                               rows[i].sequence.c_str(),
+                               expected[i].n,
+                               static_cast<unsigned long long>(expected[i].count),
+                               static_cast<unsigned long long>(expected[i].saved),
+                               expected[i].sequence.c_str());
+                return fail(__LINE__, "opfunc profile report differs from the dispatched sequence");
+            }
+        }
+
+        // The kernel is longer than three opfuncs, so the ranking opens with a triple.
+        UWVM2TEST_REQUIRE(rows.front().n == opfunc_profile::max_ngram_length);
+        return 0;
+    }
+
+    [[nodiscard]] int test_opfunc_profile()
+    {
+        ::uwvm2test::uwvm_int_strict::install_unexpected_traps();
+        optable::call_func = ::uwvm2test::uwvm_int_strict::strict_terminate_call;
+        optable::call_indirect_func = ::uwvm2test::uwvm_int_strict::strict_terminate_call_indirect;
+
+        auto wasm = build_kernel_module();
+        auto prep = prepare_runtime_from_wasm(wasm, u8"uwvm2test_opfunc_profile");
+        UWVM2TEST_REQUIRE(prep.mod != nullptr);
+        runtime_module_t const& rt = *prep.mod;
+        UWVM2TEST_REQUIRE(!rt.local_defined_function_vec_storage.empty());
+
+        // byref
+        {
+            constexpr optable::uwvm_interpreter_translate_option_t opt{.is_tail_call = false};
+            UWVM2TEST_REQUIRE((check_profiled_kernel<opt>(rt)) == 0);
+        }
+
+        // tailcall
+        {
+            constexpr optable::uwvm_interpreter_translate_option_t opt{.is_tail_call = true};
+            UWVM2TEST_REQUIRE((check_profiled_kernel<opt>(rt)) == 0);
+        }
+
+        // tailcall + stacktop caching (scalar4 merged, minimal size => spill/fill opfuncs are probed too)
+        {
+            constexpr optable::uwvm_interpreter_translate_option_t opt{
+                .is_tail_call = true,
+                .i32_stack_top_begin_pos = 3uz,
+                .i32_stack_top_end_pos = 4uz,
+                .i64_stack_top_begin_pos = 3uz,
+                .i64_stack_top_end_pos = 4uz,
+                .f32_stack_top_begin_pos = 3uz,
+                .f32_stack_top_end_pos = 4uz,
+                .f64_stack_top_begin_pos = 3uz,
+                .f64_stack_top_end_pos = 4uz,
+                .v128_stack_top_begin_pos = SIZE_MAX,
+                .v128_stack_top_end_pos = SIZE_MAX,
+            };
+            static_assert(compiler::details::interpreter_tuple_has_no_holes<opt>());
+            UWVM2TEST_REQUIRE((check_profiled_kernel<opt>(rt)) == 0);
+        }
+
+        return 0;
+    }
+}  // namespace
+
+int main()
+{
+    try
+    {
+        return test_opfunc_profile();
+    }
+    catch(...)
+    {
+        return ::uwvm2test::uwvm_int_strict::fail(__LINE__, "uncaught exception");
+    }
+}
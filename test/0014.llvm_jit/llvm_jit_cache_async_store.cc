@@ -0,0 +1,194 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <initializer_list>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <system_error>
+
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/runtime/macro/push_macros.h>
+#include <uwvm2/runtime/llvm_jit_cache/store.h>
+
+namespace
+{
+    namespace cache = ::uwvm2::runtime::llvm_jit_cache;
+    namespace details = ::uwvm2::runtime::llvm_jit_cache::details;
+
+    // Large enough that the bytes live on the heap, so a moved string keeps its buffer.
+    inline constexpr ::std::size_t object_size{4096uz};
+
+    bool check(bool condition, char const* what)
+    {
+        if(!condition) { ::std::cerr << "[cache_async_store] " << what << '\n'; }
+        return condition;
+    }
+
+    [[nodiscard]] ::uwvm2::utils::container::u8string to_u8string(::std::string const& s)
+    { return ::uwvm2::utils::container::u8string{::uwvm2::utils::container::u8string_view{reinterpret_cast<char8_t const*>(s.data()), s.size()}}; }
+
+    [[nodiscard]] cache::cache_context make_context(::std::string const& dir, ::std::string const& key)
+    {
+        cache::cache_context ctx{};
+        ctx.cache_dir = to_u8string(dir);
+        ctx.cache_key = to_u8string(key);
+        ctx.target_triple = u8"uwvm2test-unknown-unknown";
+        ctx.cpu_name = u8"generic";
+        ctx.llvm_version = u8"0";
+        ctx.uwvm_abi = u8"uwvm2test";
+        ctx.codegen_policy = u8"O0";
+        ctx.cache_key_is_complete = true;
+        return ctx;
+    }
+
+    [[nodiscard]] cache::cache_policy make_policy(::std::size_t max_async_store_bytes) noexcept
+    {
+        cache::cache_policy policy{};
+        policy.generate_signature = false;
+        policy.verify_signature = false;
+        policy.max_async_store_bytes = max_async_store_bytes;
+        return policy;
+    }
+
+    [[nodiscard]] ::uwvm2::utils::container::u8string make_object(::std::size_t size, char8_t fill)
+    {
+        ::uwvm2::utils::container::u8string object{};
+        object.reserve(size);
+        for(::std::size_t i{}; i != size; ++i) { object.push_back(static_cast<char8_t>(fill + static_cast<char8_t>(i % 7uz))); }
+        return object;
+    }
+
+    [[nodiscard]] details::cache_store_request make_request(::std::string const& dir,
+                                                            ::std::string const& key,
+                                                            ::std::size_t size,
+                                                            ::std::size_t object_index,
+                                                            cache::cache_policy const& policy)
+    {
+        return details::make_cache_store_request(make_context(dir, key), make_object(size, u8'a'), policy, {}, false, object_index, 0uz);
+    }
+
+    [[nodiscard]] bool admit(details::async_cache_store_worker& worker, details::cache_store_request& request)
+    {
+        ::std::lock_guard lock{worker.mutex};
+        return worker.admit_locked(request);
+    }
+
+    [[nodiscard]] bool pending_indices_are(details::async_cache_store_worker& worker, ::std::initializer_list<::std::size_t> expected)
+    {
+        ::std::lock_guard lock{worker.mutex};
+        if(worker.requests.size() != expected.size()) { return false; }
+        auto it{worker.requests.cbegin()};
+        for(auto const index: expected)
+        {
+            if(it->object_index != index) { return false; }
+            ++it;
+        }
+        return true;
+    }
+
+    // The worker thread is never started here, so the queue holds exactly what admission left in it.
+    bool test_drop_oldest(::std::string const& dir)
+    {
+        details::async_cache_store_worker worker{};
+        auto const policy{make_policy(3uz * object_size)};
+        bool ok{true};
+
+        for(::std::size_t i{}; i != 5uz; ++i)
+        {
+            auto request{make_request(dir, "drop-" + ::std::to_string(i), object_size, i, policy)};
+            ok = check(admit(worker, request), "an object within the bound was not queued") && ok;
+        }
+        // Five objects into room for three: the two oldest go, in arrival order.
+        ok = check(pending_indices_are(worker, {2uz, 3uz, 4uz}), "queue does not hold the three newest stores") && ok;
+        ok = check(worker.dropped_requests == 2u && worker.queued_bytes == 3uz * object_size, "dropped= count or queued bytes wrong after overflow") &&
+             ok;
+
+        // A double-size store evicts the two oldest survivors, not the newest one.
+        auto wide{make_request(dir, "drop-wide", 2uz * object_size, 5uz, policy)};
+        ok = check(admit(worker, wide), "a double-size object within the bound was not queued") && ok;
+        ok = check(pending_indices_are(worker, {4uz, 5uz}), "double-size store did not evict the oldest stores first") && ok;
+        ok = check(worker.dropped_requests == 4u && worker.queued_bytes == 3uz * object_size, "dropped= count wrong after double-size store") && ok;
+
+        // An object larger than the whole bound is refused for the queue and left intact for a synchronous write; nothing
+        // pending is dropped for it.
+        auto oversized{make_request(dir, "drop-oversized", 4uz * object_size, 6uz, policy)};
+        ok = check(!admit(worker, oversized), "an object larger than the bound was queued") && ok;
+        ok = check(oversized.object.size() == 4uz * object_size, "refused object was consumed") && ok;
+        ok = check(pending_indices_are(worker, {4uz, 5uz}) && worker.dropped_requests == 4u, "oversized object dropped pending stores") && ok;
+
+        // An oversized store still supersedes a pending store of the same cache file.
+        auto oversized_same{make_request(dir, "drop-4", 4uz * object_size, 7uz, policy)};
+        ok = check(!admit(worker, oversized_same), "an oversized same-identity object was queued") && ok;
+        ok = check(pending_indices_are(worker, {5uz}) && worker.coalesced_requests == 1u && worker.queued_bytes == 2uz * object_size,
+                   "oversized store left the superseded pending store queued") &&
+             ok;
+        return ok;
+    }
+
+    bool test_coalesce_and_move(::std::string const& dir)
+    {
+        details::async_cache_store_worker worker{};
+        auto const policy{make_policy(8uz * object_size)};
+        bool ok{true};
+
+        auto first{make_request(dir, "same", object_size, 0uz, policy)};
+        ok = check(admit(worker, first), "first store was not queued") && ok;
+
+        // The caller's buffer must reach the queue as is: moved into the request, then into the deque.
+        auto newer_object{make_object(2uz * object_size, u8'N')};
+        auto const expected_object{newer_object};
+        auto const* const buffer{newer_object.data()};
+        auto second{details::make_cache_store_request(make_context(dir, "same"), ::std::move(newer_object), policy, {}, false, 1uz, 0uz)};
+        ok = check(newer_object.empty() && second.object.data() == buffer, "request copied the moved object") && ok;
+        ok = check(admit(worker, second), "second store was not queued") && ok;
+
+        {
+            ::std::lock_guard lock{worker.mutex};
+            ok = check(worker.requests.size() == 1uz && worker.coalesced_requests == 1u && worker.dropped_requests == 0u,
+                       "same-identity stores were not coalesced into one pending write") &&
+                 ok;
+            ok = check(worker.requests.front().object_index == 1uz && worker.requests.front().object.data() == buffer,
+                       "coalesced store does not own the newest object buffer") &&
+                 ok;
+            ok = check(worker.queued_bytes == 2uz * object_size, "queued bytes still count the superseded store") && ok;
+            ok = check(worker.start_locked(), "store worker did not start") && ok;
+        }
+        worker.condition.notify_one();
+        worker.flush();
+
+        // One pending request means one file write, and it published the newer object.
+        auto const loaded{cache::load_object(make_context(dir, "same"), policy)};
+        ok = check(loaded.status == cache::cache_status::ok, "coalesced store was not published") && ok;
+        ok = check(loaded.object.size() == expected_object.size() &&
+                       ::std::memcmp(loaded.object.data(), expected_object.data(), expected_object.size()) == 0,
+                   "published object is not the newest store") &&
+             ok;
+
+        ::std::size_t files{};
+        ::std::error_code ec{};
+        for(auto const& entry: ::std::filesystem::recursive_directory_iterator{dir, ec})
+        {
+            if(entry.is_regular_file()) { ++files; }
+        }
+        ok = check(!ec && files == 1uz, "coalesced stores did not leave exactly one cache file") && ok;
+        return ok;
+    }
+}  // namespace
+
+int main()
+{
+    auto const root{::std::filesystem::temp_directory_path() / "uwvm2test_llvm_jit_cache_async_store"};
+    ::std::error_code ec{};
+    ::std::filesystem::remove_all(root, ec);
+
+    bool ok{test_drop_oldest((root / "drop").string())};
+    ok = test_coalesce_and_move((root / "coalesce").string()) && ok;
+
+    ::std::filesystem::remove_all(root, ec);
+    return ok ? 0 : 1;
+}
+
+#include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,66 @@
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    inline constexpr ::std::array all_modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"int_lazy", "-Rint"             },
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+        wat::mode_t{"jit_lazy", "-Rjit"             },
+        wat::mode_t{"tiered",   "-Rtiered"          },
+    };
+
+    // Table writes only exist in the interpreter; they refill the slot's flattened call_indirect entry.
+    inline constexpr ::std::array table_write_modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"int_lazy", "-Rint"             },
+    };
+
+    inline constexpr char const* reference_types_args{" --wasm-feature-enable-reference-types"};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "call_indirect", "call_indirect", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const match_wasm{wat::compile_wat(env, "signature_match")};
+    auto const mismatch_wasm{wat::compile_wat(env, "signature_mismatch")};
+    auto const table_write_wasm{wat::compile_wat(env, "table_write")};
+    if(match_wasm.empty() || mismatch_wasm.empty() || table_write_wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    for(auto const& mode: all_modes)
+    {
+        // Structurally equal types match across type indices, and a thousand calls through the same slots return the right values.
+        auto const match_stem{::std::string{"signature_match."} + mode.name};
+        ok = wat::expect_success(env, match_stem, wat::run_uwvm(env, match_stem, mode.args, match_wasm)) && ok;
+
+        // A slot whose function has another signature traps before the callee runs, also after the slot was hit with the right type.
+        auto const mismatch_stem{::std::string{"signature_mismatch."} + mode.name};
+        auto const result{wat::run_uwvm(env, mismatch_stem, mode.args, mismatch_wasm)};
+        ok = wat::expect_trap(env, mismatch_stem, result, "call_indirect: signature mismatch") && ok;
+    }
+
+    // table.set/table.fill/table.grow retarget slots, and retyping a slot makes the next call mismatch rather than call the old target.
+    for(auto const& mode: table_write_modes)
+    {
+        auto const stem{::std::string{"table_write."} + mode.name};
+        auto const result{wat::run_uwvm(env, stem, ::std::string{mode.args} + reference_types_args, table_write_wasm)};
+        ok = wat::expect_trap(env, stem, result, "call_indirect: signature mismatch") && ok;
+    }
+
+    return ok ? 0 : 1;
+}
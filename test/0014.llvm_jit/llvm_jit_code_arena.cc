@@ -0,0 +1,206 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/runtime/macro/push_macros.h>
+#include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/translate/section_memory_manager.h>
+
+#if defined(UWVM_RUNTIME_LLVM_JIT) && !defined(_WIN32) && __has_include(<sys/mman.h>) && UINTPTR_MAX > 0xffffffffu
+# define UWVM2TEST_HAS_CODE_ARENA 1
+#else
+# define UWVM2TEST_HAS_CODE_ARENA 0
+#endif
+
+#if UWVM2TEST_HAS_CODE_ARENA
+namespace
+{
+    namespace details = ::uwvm2::runtime::compiler::llvm_jit::details;
+
+    inline constexpr ::std::size_t page{4096uz};
+
+    bool check(bool condition, char const* what)
+    {
+        if(!condition) { ::std::cerr << "[code_arena] " << what << '\n'; }
+        return condition;
+    }
+
+    // Pure bookkeeping over a fake address range: nothing is mapped.
+    bool test_region_first_fit()
+    {
+        constexpr ::std::uintptr_t base{0x10000000u};
+        details::runtime_llvm_jit_code_arena_region region{.begin = base, .end = base + 16uz * page, .frontier = base};
+
+        auto const a{region.allocate(page)};
+        auto const b{region.allocate(page)};
+        auto const c{region.allocate(page)};
+        auto const d{region.allocate(page)};
+        bool ok{check(a == base && b == base + page && c == base + 2uz * page && d == base + 3uz * page, "bump allocation is not contiguous")};
+
+        // Adjacent releases coalesce into one extent.
+        region.release(b, page);
+        region.release(c, page);
+        ok = check(region.free_extents.size() == 1uz && region.free_extents.front().size == 2uz * page, "b and c did not coalesce") && ok;
+        ok = check(region.live_bytes == 2uz * page, "live bytes after release") && ok;
+
+        // The lowest released extent that fits is reused before the frontier moves.
+        ok = check(region.allocate(page) == b, "first fit did not reuse b") && ok;
+        auto const frontier_before{region.frontier};
+        ok = check(region.allocate(2uz * page) == frontier_before, "request larger than the hole did not bump the frontier") && ok;
+        ok = check(region.allocate(page) == c, "first fit did not reuse c") && ok;
+        ok = check(region.free_extents.empty(), "free list not empty after the hole was consumed") && ok;
+
+        // Releasing the block below the frontier folds it back into the frontier instead of the free list.
+        region.release(frontier_before, 2uz * page);
+        ok = check(region.frontier == frontier_before && region.free_extents.empty(), "tail release did not retreat the frontier") && ok;
+
+        // Exhaustion reports 0 so the mapper can fall back.
+        ok = check(region.allocate(region.end - region.frontier + page) == 0u, "oversized request did not fail") && ok;
+        ok = check(region.live_bytes == 4uz * page, "live bytes after the run") && ok;
+        return ok;
+    }
+
+    bool test_mapper()
+    {
+        using purpose_t = ::llvm::SectionMemoryManager::AllocationPurpose;
+        constexpr unsigned rw{::llvm::sys::Memory::MF_READ | ::llvm::sys::Memory::MF_WRITE};
+
+        auto const page_bytes{static_cast<::std::size_t>(::llvm::sys::Process::getPageSizeEstimate())};
+
+        // A private mapper so the counters start from zero; like the process-wide one it is never unmapped.
+        auto& mapper{*::new details::runtime_llvm_jit_code_arena_mapper{}};
+
+        ::std::error_code ec{};
+        auto first{mapper.allocateMappedMemory(purpose_t::Code, 100uz, nullptr, rw, ec)};
+        if(ec || first.base() == nullptr) { return check(false, "small code allocation failed"); }
+        if(mapper.stats().reserved_bytes == 0uz)
+        {
+            ::std::cout << "[code_arena] skip mapper checks, the arena reservation was refused\n";
+            return mapper.releaseMappedMemory(first) ? check(false, "release of a fallback block failed") : true;
+        }
+
+        auto second{mapper.allocateMappedMemory(purpose_t::Code, 100uz, nullptr, rw, ec)};
+        bool ok{check(!ec && second.base() != nullptr && first.allocatedSize() % page_bytes == 0uz, "second code allocation failed")};
+        ::std::memset(first.base(), 0xcc, first.allocatedSize());
+        auto const first_address{first.base()};
+
+        // A released block goes back to PROT_NONE and is handed out again before the frontier moves.
+        ok = check(!mapper.releaseMappedMemory(first), "release into the arena failed") && ok;
+        auto reused{mapper.allocateMappedMemory(purpose_t::Code, 100uz, nullptr, rw, ec)};
+        ok = check(!ec && reused.base() == first_address, "released code block was not reused first") && ok;
+        if(!ec && reused.base() != nullptr) { ::std::memset(reused.base(), 0, reused.allocatedSize()); }
+
+        auto const arena_stats{mapper.stats()};
+        ok = check(arena_stats.fallback_allocations == 0uz && arena_stats.code_bytes == 2uz * page_bytes, "arena accounting after reuse") && ok;
+
+        // A block larger than the whole data region cannot come from the arena and falls back to sys::Memory.
+        auto const oversized_bytes{details::runtime_llvm_jit_code_arena_data_region_bytes + page_bytes};
+        auto fallback{mapper.allocateMappedMemory(purpose_t::RWData, oversized_bytes, nullptr, rw, ec)};
+        if(ec || fallback.base() == nullptr)
+        {
+            // The host may refuse a mapping this large without overcommit; that is not the arena's failure.
+            ::std::cout << "[code_arena] skip fallback check, sys::Memory refused " << oversized_bytes << " bytes\n";
+        }
+        else
+        {
+            auto const fallback_address{reinterpret_cast<::std::uintptr_t>(fallback.base())};
+            auto const first_arena_address{reinterpret_cast<::std::uintptr_t>(first_address)};
+            bool const outside{fallback_address + fallback.allocatedSize() <= first_arena_address ||
+                               fallback_address >= first_arena_address + arena_stats.reserved_bytes};
+            static_cast<unsigned char*>(fallback.base())[0] = 1u;
+            auto const fallback_stats{mapper.stats()};
+            ok = check(outside && fallback_stats.fallback_allocations == 1uz && fallback_stats.data_bytes == arena_stats.data_bytes,
+                       "oversized block did not fall back to sys::Memory") &&
+                 ok;
+            ok = check(!mapper.releaseMappedMemory(fallback), "release of the fallback block failed") && ok;
+            ok = check(mapper.stats().data_bytes == arena_stats.data_bytes, "fallback release touched the arena") && ok;
+        }
+
+        ok = check(!mapper.releaseMappedMemory(second) && !mapper.releaseMappedMemory(reused), "final release failed") && ok;
+        ok = check(mapper.stats().code_bytes == 0uz, "code bytes still live after every release") && ok;
+        return ok;
+    }
+
+# if defined(__linux__)
+    // Resident pages of this process, from /proc/self/statm; 0 when it cannot be read.
+    [[nodiscard]] ::std::size_t resident_pages()
+    {
+        ::std::ifstream statm{"/proc/self/statm"};
+        ::std::size_t size_pages{};
+        ::std::size_t resident{};
+        if(!(statm >> size_pages >> resident)) { return 0uz; }
+        return resident;
+    }
+
+    // A released block must give its pages back to the kernel, not just lose its permissions.
+    bool test_release_drops_rss()
+    {
+        using purpose_t = ::llvm::SectionMemoryManager::AllocationPurpose;
+        constexpr unsigned rw{::llvm::sys::Memory::MF_READ | ::llvm::sys::Memory::MF_WRITE};
+        constexpr ::std::size_t block_bytes{32uz * 1024uz * 1024uz};
+
+        auto const page_bytes{static_cast<::std::size_t>(::llvm::sys::Process::getPageSizeEstimate())};
+        auto& mapper{*::new details::runtime_llvm_jit_code_arena_mapper{}};
+
+        ::std::error_code ec{};
+        auto block{mapper.allocateMappedMemory(purpose_t::RWData, block_bytes, nullptr, rw, ec)};
+        if(ec || block.base() == nullptr) { return check(false, "large data allocation failed"); }
+        if(mapper.stats().fallback_allocations != 0uz)
+        {
+            ::std::cout << "[code_arena] skip RSS check, the arena reservation was refused\n";
+            return !mapper.releaseMappedMemory(block) || check(false, "release of a fallback block failed");
+        }
+
+        auto const block_address{block.base()};
+        ::std::memset(block.base(), 0x5a, block.allocatedSize());
+        auto const touched{resident_pages()};
+        if(touched == 0uz)
+        {
+            ::std::cout << "[code_arena] skip RSS check, /proc/self/statm is unreadable\n";
+            return !mapper.releaseMappedMemory(block) || check(false, "release into the arena failed");
+        }
+
+        bool ok{check(!mapper.releaseMappedMemory(block), "release into the arena failed")};
+        auto const released{resident_pages()};
+        // Allow a quarter of the block for unrelated allocations between the two samples.
+        auto const block_pages{block_bytes / page_bytes};
+        ok = check(released + block_pages * 3uz / 4uz <= touched, "RSS did not drop after releasing an arena block") && ok;
+
+        // The extent is handed out again; the dropped pages come back zero-filled instead of with the old contents.
+        auto reused{mapper.allocateMappedMemory(purpose_t::RWData, block_bytes, nullptr, rw, ec)};
+        ok = check(!ec && reused.base() == block_address, "released data block was not reused first") && ok;
+        if(!ec && reused.base() != nullptr)
+        {
+            auto const bytes{static_cast<unsigned char const*>(reused.base())};
+            ok = check(bytes[0] == 0u && bytes[reused.allocatedSize() - 1uz] == 0u, "reused block still holds released pages") && ok;
+            ok = check(!mapper.releaseMappedMemory(reused), "release of the reused block failed") && ok;
+        }
+        return ok;
+    }
+# endif
+}  // namespace
+#endif
+
+int main()
+{
+#if UWVM2TEST_HAS_CODE_ARENA
+    bool ok{test_region_first_fit()};
+    ok = test_mapper() && ok;
+# if defined(__linux__)
+    ok = test_release_drops_rss() && ok;
+# endif
+    return ok ? 0 : 1;
+#else
+    // Windows and 32-bit targets keep SectionMemoryManager's own mappings.
+    ::std::cout << "[code_arena] skip, no code arena on this platform\n";
+    return 0;
+#endif
+}
+
+#undef UWVM2TEST_HAS_CODE_ARENA
+
+#include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+#include <uwvm2/utils/macro/pop_macros.h>
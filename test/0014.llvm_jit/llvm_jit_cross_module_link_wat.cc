@@ -0,0 +1,79 @@
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // uwvm-int full mode links wasm-to-wasm imports through direct call-info records; LLVM full mode through typed-entry slots
+    // published after every module is materialized. Lazy LLVM and `-Rno-xmod-direct` keep the bridge and serve as the reference.
+    inline constexpr ::std::array modes{
+        wat::mode_t{"int_full",        "-Rcm full -Rcc int"                 },
+        wat::mode_t{"int_full_bridge", "-Rcm full -Rcc int -Rno-xmod-direct"},
+        wat::mode_t{"jit_full",        "-Rcm full -Rcc jit"                 },
+        wat::mode_t{"jit_full_bridge", "-Rcm full -Rcc jit -Rno-xmod-direct"},
+        wat::mode_t{"jit_lazy",        "-Rjit"                              },
+    };
+
+    struct trap_fixture_t
+    {
+        char const* stem;
+        char const* trap_kind;
+    };
+
+    // Traps raised inside `lib` must reach the caller with the same kind as a same-module trap.
+    inline constexpr ::std::array trap_fixtures{
+        trap_fixture_t{"main_div_zero",    "integer divide by zero"},
+        trap_fixture_t{"main_unreachable", "unreachable"           },
+    };
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "cross_module_link", "cross_module", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const lib_wasm{wat::compile_wat(env, "lib")};
+    auto const main_wasm{wat::compile_wat(env, "main")};
+    if(lib_wasm.empty() || main_wasm.empty()) { return 1; }
+
+    auto const preload_args{"--wasm-preload-library " + wat::quote_argument(lib_wasm) + " lib"};
+
+    bool ok{true};
+
+    for(auto const& mode: modes)
+    {
+        // `main` traps through `unreachable` when any cross-module result, callee state or the raw-bridge fallback is wrong.
+        auto const stem{::std::string{"main."} + mode.name};
+        auto const result{wat::run_uwvm(env, stem, mode.args, preload_args + " --run " + wat::quote_argument(main_wasm))};
+        ok = wat::expect_success(env, stem, result) && ok;
+    }
+
+    for(auto const& fixture: trap_fixtures)
+    {
+        auto const wasm{wat::compile_wat(env, fixture.stem)};
+        if(wasm.empty())
+        {
+            ok = false;
+            continue;
+        }
+
+        for(auto const& mode: modes)
+        {
+            auto const stem{::std::string{fixture.stem} + "." + mode.name};
+            auto const result{wat::run_uwvm(env, stem, mode.args, preload_args + " --run " + wat::quote_argument(wasm))};
+            ok = wat::expect_trap(env, stem, result, fixture.trap_kind) && ok;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
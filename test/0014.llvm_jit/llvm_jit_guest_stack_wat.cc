@@ -0,0 +1,74 @@
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    inline constexpr ::std::array all_modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"int_lazy", "-Rint"             },
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+        wat::mode_t{"jit_lazy", "-Rjit"             },
+        wat::mode_t{"tiered",   "-Rtiered"          },
+    };
+
+    // Lean frames (the default) and the full frame vector (`backtrace`) bound recursion by the same guard.
+    inline constexpr ::std::array stack_args{
+        wat::mode_t{"lean",      " --runtime-guest-stack 1"          },
+        wat::mode_t{"backtrace", " --runtime-guest-stack 1 backtrace"},
+    };
+
+    [[nodiscard]] bool guest_stack_unavailable(wat::run_result_t const& result)
+    {
+        return result.output.find("--runtime-guest-stack is ignored") != ::std::string::npos ||
+               result.output.find("running on the host stack") != ::std::string::npos;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "guest_stack", "guest_stack", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const bounded_wasm{wat::compile_wat(env, "bounded_recursion")};
+    auto const unbounded_wasm{wat::compile_wat(env, "unbounded_recursion")};
+    if(bounded_wasm.empty() || unbounded_wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    for(auto const& mode: all_modes)
+    {
+        for(auto const& stack: stack_args)
+        {
+            auto const args{::std::string{mode.args} + stack.args};
+
+            // Recursion that fits returns its result on the guest stack.
+            auto const bounded_stem{::std::string{"bounded_recursion."} + mode.name + "." + stack.name};
+            auto const bounded{wat::run_uwvm(env, bounded_stem, args, bounded_wasm)};
+            ok = wat::expect_success(env, bounded_stem, bounded) && ok;
+
+            // Without stack switching the unbounded fixture would overflow the host stack, so there is nothing to check.
+            if(guest_stack_unavailable(bounded))
+            {
+                ::std::cout << "[guest_stack] " << bounded_stem << ": skip overflow, guest stack unavailable\n";
+                continue;
+            }
+
+            // Recursion without a base case reaches the guard page and traps instead of crashing the host.
+            auto const unbounded_stem{::std::string{"unbounded_recursion."} + mode.name + "." + stack.name};
+            auto const unbounded{wat::run_uwvm(env, unbounded_stem, args, unbounded_wasm)};
+            ok = wat::expect_trap(env, unbounded_stem, unbounded, "call stack exhausted") && ok;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
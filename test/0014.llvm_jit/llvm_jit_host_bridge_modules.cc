@@ -0,0 +1,253 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Enough preloaded modules that their storage addresses spread over several buckets of the module-identity table.
+    inline constexpr ::std::size_t library_count{48uz};
+
+    void append_uleb(::std::vector<unsigned char>& out, ::std::uint_least64_t value)
+    {
+        do {
+            auto byte{static_cast<unsigned char>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    void append_name(::std::vector<unsigned char>& out, ::std::string_view name)
+    {
+        append_uleb(out, name.size());
+        out.insert(out.end(), name.begin(), name.end());
+    }
+
+    void append_section(::std::vector<unsigned char>& out, unsigned char id, ::std::vector<unsigned char> const& payload)
+    {
+        out.push_back(id);
+        append_uleb(out, payload.size());
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    void append_args_sizes_get_import(::std::vector<unsigned char>& imports)
+    {
+        append_name(imports, "wasi_snapshot_preview1");
+        append_name(imports, "args_sizes_get");
+        imports.insert(imports.end(), {0x00u, 0x00u});
+    }
+
+    // Each library exports `probe`: it poisons its own `mem[0]`, lets WASI `args_sizes_get` write argc there and returns the
+    // word.  WASI writes into the memory of the module the host call resolves to, so a library whose call is attributed to
+    // another module returns the poison value instead of argc.
+    [[nodiscard]] ::std::vector<unsigned char> make_library_module()
+    {
+        ::std::vector<unsigned char> wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(wasm, 0x01u, {0x02u, 0x60u, 0x02u, 0x7fu, 0x7fu, 0x01u, 0x7fu, 0x60u, 0x00u, 0x01u, 0x7fu});
+
+        ::std::vector<unsigned char> imports{0x01u};
+        append_args_sizes_get_import(imports);
+        append_section(wasm, 0x02u, imports);
+
+        append_section(wasm, 0x03u, {0x01u, 0x01u});
+        append_section(wasm, 0x05u, {0x01u, 0x00u, 0x01u});
+
+        ::std::vector<unsigned char> exports{0x02u};
+        append_name(exports, "probe");
+        exports.insert(exports.end(), {0x00u, 0x01u});
+        append_name(exports, "memory");
+        exports.insert(exports.end(), {0x02u, 0x00u});
+        append_section(wasm, 0x07u, exports);
+
+        ::std::vector<unsigned char> const body{0x00u, 0x41u, 0x00u, 0x41u, 0x7fu, 0x36u, 0x02u, 0x00u, 0x41u, 0x00u, 0x41u, 0x04u,
+                                                0x10u, 0x00u, 0x1au, 0x41u, 0x00u, 0x28u, 0x02u, 0x00u, 0x0bu};
+        ::std::vector<unsigned char> code{0x01u};
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+        append_section(wasm, 0x0au, code);
+
+        return wasm;
+    }
+
+    // `_start` reads argc into its own memory the same way, then traps unless every library's `probe` returns that value.
+    [[nodiscard]] ::std::vector<unsigned char> make_main_module()
+    {
+        ::std::vector<unsigned char> wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(wasm, 0x01u, {0x03u, 0x60u, 0x02u, 0x7fu, 0x7fu, 0x01u, 0x7fu, 0x60u, 0x00u, 0x00u, 0x60u, 0x00u, 0x01u, 0x7fu});
+
+        ::std::vector<unsigned char> imports{};
+        append_uleb(imports, library_count + 1uz);
+        append_args_sizes_get_import(imports);
+        for(::std::size_t i{}; i != library_count; ++i)
+        {
+            append_name(imports, "lib" + ::std::to_string(i));
+            append_name(imports, "probe");
+            imports.insert(imports.end(), {0x00u, 0x02u});
+        }
+        append_section(wasm, 0x02u, imports);
+
+        append_section(wasm, 0x03u, {0x01u, 0x01u});
+        append_section(wasm, 0x05u, {0x01u, 0x00u, 0x01u});
+
+        ::std::vector<unsigned char> exports{0x02u};
+        append_name(exports, "_start");
+        exports.push_back(0x00u);
+        append_uleb(exports, library_count + 1uz);
+        append_name(exports, "memory");
+        exports.insert(exports.end(), {0x02u, 0x00u});
+        append_section(wasm, 0x07u, exports);
+
+        // mem[0] = -1; args_sizes_get(0, 4); if(mem[0] == -1) unreachable
+        ::std::vector<unsigned char> body{0x00u, 0x41u, 0x00u, 0x41u, 0x7fu, 0x36u, 0x02u, 0x00u, 0x41u, 0x00u, 0x41u, 0x04u, 0x10u, 0x00u, 0x1au,
+                                          0x41u, 0x00u, 0x28u, 0x02u, 0x00u, 0x41u, 0x7fu, 0x46u, 0x04u, 0x40u, 0x00u, 0x0bu};
+        // if(lib<i>.probe() != mem[0]) unreachable
+        for(::std::size_t i{}; i != library_count; ++i)
+        {
+            body.push_back(0x10u);
+            append_uleb(body, i + 1uz);
+            body.insert(body.end(), {0x41u, 0x00u, 0x28u, 0x02u, 0x00u, 0x47u, 0x04u, 0x40u, 0x00u, 0x0bu});
+        }
+        body.push_back(0x0bu);
+
+        ::std::vector<unsigned char> code{0x01u};
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+        append_section(wasm, 0x0au, code);
+
+        return wasm;
+    }
+
+    [[nodiscard]] bool write_file(::std::filesystem::path const& path, ::std::vector<unsigned char> const& bytes)
+    {
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        output.write(reinterpret_cast<char const*>(bytes.data()), static_cast<::std::streamsize>(bytes.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write fixture: " << path << '\n';
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        auto text{path.string()};
+#ifdef _WIN32
+        auto trailing_backslashes{0uz};
+        for(auto it{text.rbegin()}; it != text.rend() && *it == '\\'; ++it) { ++trailing_backslashes; }
+        text.append(trailing_backslashes, '\\');
+#endif
+        return ::std::string{"\""} + text + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::string read_text_file(::std::filesystem::path const& path)
+    {
+        ::std::ifstream input(path);
+        return ::std::string{::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{}};
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit_host_bridge_modules"};
+    ::std::filesystem::remove_all(artifact_dir);
+    ::std::filesystem::create_directories(artifact_dir);
+
+    if(!write_file(artifact_dir / "main.wasm", make_main_module())) { return 1; }
+    auto const library{make_library_module()};
+    for(::std::size_t i{}; i != library_count; ++i)
+    {
+        if(!write_file(artifact_dir / ("lib" + ::std::to_string(i) + ".wasm"), library)) { return 1; }
+    }
+
+    struct mode_t
+    {
+        ::std::string_view name;
+        ::std::string_view args;
+    };
+
+    constexpr mode_t modes[]{
+        {"jit_lazy", "-Rjit"              },
+        {"jit_full", "-Rcm full -Rcc jit"},
+    };
+
+    bool ok{true};
+    for(auto const& mode: modes)
+    {
+        auto const output_path{artifact_dir / (::std::string{mode.name} + ".out")};
+
+        // Preloaded modules are passed by relative name so the command line stays short.
+#ifdef _WIN32
+        ::std::string command{"cd /d " + quote_argument(artifact_dir) + " && "};
+#else
+        ::std::string command{"cd " + quote_argument(artifact_dir) + " && "};
+#endif
+        command += quote_argument(uwvm_path) + " " + ::std::string{mode.args} + " --runtime-llvm-jit-cache-path disable";
+        for(::std::size_t i{}; i != library_count; ++i)
+        {
+            auto const name{"lib" + ::std::to_string(i)};
+            command += " --wasm-preload-library " + name + ".wasm " + name;
+        }
+        command += " --run main.wasm > " + quote_argument(output_path) + " 2>&1";
+
+        // A non-zero status is a trap in `_start` (a WASI call attributed to the wrong module) or the bridge terminating on a
+        // module it could not identify.
+        if(auto const status{run_system_command(command)}; status != 0)
+        {
+            ::std::cerr << "[llvm_jit_host_bridge_modules] " << mode.name << ": uwvm returned " << status << '\n' << read_text_file(output_path) << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    inline constexpr ::std::size_t local_function_count{6uz};
+    inline constexpr ::std::size_t no_cluster{static_cast<::std::size_t>(-1)};
+
+    // Compile threads are off so only `_start`'s cluster is demanded and every run writes the same objects.
+    inline constexpr ::std::string_view lazy_args{"-Rjit --runtime-compile-threads 0"};
+
+    // Cluster index of every local function from the `cluster-member` lines of the lazy compiler log.
+    [[nodiscard]] ::std::array<::std::size_t, local_function_count> read_clusters(::std::string_view log)
+    {
+        ::std::array<::std::size_t, local_function_count> clusters{};
+        clusters.fill(no_cluster);
+
+        constexpr ::std::string_view tag{"[llvm-jit-lazy] cluster-member "};
+        constexpr ::std::string_view fn_key{" local_fn="};
+        constexpr ::std::string_view cluster_key{" cluster="};
+        for(auto pos{log.find(tag)}; pos != ::std::string_view::npos; pos = log.find(tag, pos + tag.size()))
+        {
+            auto const eol{log.find('\n', pos)};
+            auto const line{log.substr(pos, eol == ::std::string_view::npos ? ::std::string_view::npos : eol - pos)};
+            auto const fn_pos{line.find(fn_key)};
+            auto const cluster_pos{line.find(cluster_key)};
+            if(fn_pos == ::std::string_view::npos || cluster_pos == ::std::string_view::npos) { continue; }
+
+            ::std::string const text{line};
+            auto const local_fn{static_cast<::std::size_t>(::std::strtoull(text.c_str() + fn_pos + fn_key.size(), nullptr, 10))};
+            if(local_fn < local_function_count)
+            {
+                clusters[local_fn] = static_cast<::std::size_t>(::std::strtoull(text.c_str() + cluster_pos + cluster_key.size(), nullptr, 10));
+            }
+        }
+        return clusters;
+    }
+
+    // Relative paths of the files in a cache directory; cache files are named after their keys.
+    [[nodiscard]] ::std::set<::std::string> snapshot_cache(::std::filesystem::path const& cache_dir)
+    {
+        ::std::set<::std::string> files{};
+        ::std::error_code ec{};
+        for(auto it{::std::filesystem::recursive_directory_iterator{cache_dir, ec}}; !ec && it != ::std::filesystem::recursive_directory_iterator{};
+            it.increment(ec))
+        {
+            if(it->is_regular_file(ec)) { files.insert(::std::filesystem::relative(it->path(), cache_dir, ec).generic_string()); }
+        }
+        return files;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "lazy_clusters", "lazy_clusters", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const wasm{wat::compile_wat(env, "call_graph")};
+    if(wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    // Membership: `_start` -> `$outer` -> `$inner` share a cluster, the never-called orphan pair gets its own, and `$lonely`
+    // stays alone, because clusters only follow direct call edges.
+    auto const cold_a_dir{env.artifact_dir / "cache_a"};
+    auto const cold_a{wat::run_uwvm_cached(env, "call_graph.cold_a", lazy_args, cold_a_dir, wasm)};
+    if(!wat::expect_success(env, "call_graph.cold_a", cold_a)) { return 1; }
+
+    auto const clusters{read_clusters(cold_a.log)};
+    bool const membership_ok{clusters[0] != no_cluster && clusters[0] == clusters[1] && clusters[1] == clusters[2] && clusters[3] != no_cluster &&
+                             clusters[3] == clusters[4] && clusters[3] != clusters[0] && clusters[5] != no_cluster && clusters[5] != clusters[0] &&
+                             clusters[5] != clusters[3]};
+    if(!membership_ok)
+    {
+        ::std::cerr << "[lazy_clusters] unexpected cluster membership:";
+        for(auto const cluster: clusters) { ::std::cerr << ' ' << static_cast<long long>(cluster); }
+        ::std::cerr << '\n' << cold_a.log << '\n';
+        ok = false;
+    }
+
+    // Key stability: a second cold cache written by a separate process holds exactly the same objects.
+    auto const files_a{snapshot_cache(cold_a_dir)};
+    auto const cold_b_dir{env.artifact_dir / "cache_b"};
+    auto const cold_b{wat::run_uwvm_cached(env, "call_graph.cold_b", lazy_args, cold_b_dir, wasm)};
+    ok = wat::expect_success(env, "call_graph.cold_b", cold_b) && ok;
+    auto const files_b{snapshot_cache(cold_b_dir)};
+    if(files_a.empty() || files_a != files_b)
+    {
+        ::std::cerr << "[lazy_clusters] cold caches differ: " << files_a.size() << " vs " << files_b.size() << " files\n";
+        ok = false;
+    }
+
+    // A warm run loads the cluster object instead of compiling it and writes nothing new.
+    auto const warm{wat::run_uwvm_cached(env, "call_graph.warm", lazy_args, cold_a_dir, wasm)};
+    ok = wat::expect_success(env, "call_graph.warm", warm) && ok;
+    bool const warm_ok{warm.log.find("object-cache-hit") != ::std::string::npos &&
+                       warm.log.find("object-cache-store-enqueue") == ::std::string::npos && snapshot_cache(cold_a_dir) == files_a};
+    if(!warm_ok)
+    {
+        ::std::cerr << "[lazy_clusters] warm run did not hit the cold objects\n" << warm.log << '\n';
+        ok = false;
+    }
+
+    return ok ? 0 : 1;
+}
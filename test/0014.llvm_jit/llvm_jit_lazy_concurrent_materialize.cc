@@ -0,0 +1,270 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // Enough distinct functions that background workers and demand compilation from `_start` overlap for most of the run.
+    inline constexpr ::std::size_t worker_function_count{512uz};
+    inline constexpr ::std::size_t worker_body_rounds{24uz};
+    inline constexpr ::std::size_t race_repeats{3uz};
+
+    // Compile-thread counts: zero runs every materialization on demand, the others race workers against `_start`.
+    inline constexpr unsigned compile_thread_counts[]{0u, 1u, 4u, 8u};
+
+    void append_uleb(::std::vector<unsigned char>& out, ::std::uint_least64_t value)
+    {
+        do {
+            auto byte{static_cast<unsigned char>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    void append_sleb(::std::vector<unsigned char>& out, ::std::int_least64_t value)
+    {
+        for(;;)
+        {
+            auto const byte{static_cast<unsigned char>(value & 0x7f)};
+            value >>= 7;
+            bool const done{(value == 0 && (byte & 0x40u) == 0u) || (value == -1 && (byte & 0x40u) != 0u)};
+            out.push_back(done ? byte : static_cast<unsigned char>(byte | 0x80u));
+            if(done) { return; }
+        }
+    }
+
+    void append_section(::std::vector<unsigned char>& out, unsigned char id, ::std::vector<unsigned char> const& payload)
+    {
+        out.push_back(id);
+        append_uleb(out, payload.size());
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    [[nodiscard]] ::std::int_least64_t worker_add(::std::size_t function, ::std::size_t round) noexcept
+    { return static_cast<::std::int_least64_t>(function * worker_body_rounds + round) * 7 + 3; }
+
+    [[nodiscard]] ::std::int_least64_t worker_mul(::std::size_t function, ::std::size_t round) noexcept
+    { return (static_cast<::std::int_least64_t>(function * worker_body_rounds + round) * 13) | 1; }
+
+    // Host-side evaluation of worker `function` with wasm i32 wrap-around.
+    [[nodiscard]] ::std::uint_least32_t expected_worker_result(::std::size_t function, ::std::uint_least32_t param) noexcept
+    {
+        auto value{param};
+        for(::std::size_t round{}; round != worker_body_rounds; ++round)
+        {
+            value = static_cast<::std::uint_least32_t>(value + static_cast<::std::uint_least32_t>(worker_add(function, round)));
+            value = static_cast<::std::uint_least32_t>(value * static_cast<::std::uint_least32_t>(worker_mul(function, round)));
+            value ^= param;
+        }
+        return value;
+    }
+
+    // `_start` calls every `(i32) -> i32` worker once and traps through `unreachable` unless it returns the host-computed value,
+    // so a worker that runs before its code is published, or runs another worker's code, fails the run.
+    [[nodiscard]] ::std::vector<unsigned char> make_race_module()
+    {
+        ::std::vector<unsigned char> wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(wasm, 0x01u, {0x02u, 0x60u, 0x00u, 0x00u, 0x60u, 0x01u, 0x7fu, 0x01u, 0x7fu});
+
+        ::std::vector<unsigned char> functions{};
+        append_uleb(functions, worker_function_count + 1uz);
+        functions.push_back(0x00u);
+        functions.insert(functions.end(), worker_function_count, 0x01u);
+        append_section(wasm, 0x03u, functions);
+
+        append_section(wasm, 0x07u, {0x01u, 0x06u, '_', 's', 't', 'a', 'r', 't', 0x00u, 0x00u});
+
+        ::std::vector<unsigned char> code{};
+        append_uleb(code, worker_function_count + 1uz);
+
+        ::std::vector<unsigned char> body{0x00u};
+        for(::std::size_t i{}; i != worker_function_count; ++i)
+        {
+            auto const param{static_cast<::std::uint_least32_t>(i * 2654435761u)};
+            body.push_back(0x41u);
+            append_sleb(body, static_cast<::std::int_least32_t>(param));
+            body.push_back(0x10u);
+            append_uleb(body, i + 1uz);
+            body.push_back(0x41u);
+            append_sleb(body, static_cast<::std::int_least32_t>(expected_worker_result(i, param)));
+            // i32.ne; if; unreachable; end
+            body.insert(body.end(), {0x47u, 0x04u, 0x40u, 0x00u, 0x0bu});
+        }
+        body.push_back(0x0bu);
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+
+        for(::std::size_t i{}; i != worker_function_count; ++i)
+        {
+            body.assign({0x00u, 0x20u, 0x00u});
+            for(::std::size_t round{}; round != worker_body_rounds; ++round)
+            {
+                body.push_back(0x41u);
+                append_sleb(body, worker_add(i, round));
+                body.push_back(0x6au);
+                body.push_back(0x41u);
+                append_sleb(body, worker_mul(i, round));
+                body.push_back(0x6cu);
+                body.insert(body.end(), {0x20u, 0x00u, 0x73u});
+            }
+            body.push_back(0x0bu);
+            append_uleb(code, body.size());
+            code.insert(code.end(), body.begin(), body.end());
+        }
+        append_section(wasm, 0x0au, code);
+
+        return wasm;
+    }
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        auto text{path.string()};
+#ifdef _WIN32
+        auto trailing_backslashes{0uz};
+        for(auto it{text.rbegin()}; it != text.rend() && *it == '\\'; ++it) { ++trailing_backslashes; }
+        text.append(trailing_backslashes, '\\');
+#endif
+        return ::std::string{"\""} + text + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::string read_text_file(::std::filesystem::path const& path)
+    {
+        ::std::ifstream input(path, ::std::ios::binary);
+        return ::std::string{::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{}};
+    }
+
+    // Checks the lazy compiler log: a function is claimed either by a worker (`compile-start`) or by demand compilation
+    // (`compile-cu-end`), never both and never twice, and no materialization fails.
+    [[nodiscard]] bool check_claims(::std::string_view log, ::std::string const& label)
+    {
+        ::std::vector<unsigned> claims(worker_function_count + 1uz);
+        bool ok{true};
+
+        while(!log.empty())
+        {
+            auto const eol{log.find('\n')};
+            auto const line{log.substr(0uz, eol)};
+            log = eol == ::std::string_view::npos ? ::std::string_view{} : log.substr(eol + 1uz);
+
+            if(line.find("[llvm-jit-lazy] ") == ::std::string_view::npos) { continue; }
+            if(line.find("state=failed") != ::std::string_view::npos)
+            {
+                ::std::cerr << "[llvm_jit_lazy_concurrent] " << label << ": failed materialization: " << line << '\n';
+                ok = false;
+            }
+
+            bool const claimed{line.find("] compile-start ") != ::std::string_view::npos || line.find("] compile-cu-end ") != ::std::string_view::npos};
+            if(!claimed) { continue; }
+
+            constexpr ::std::string_view key{" local_fn="};
+            auto const pos{line.find(key)};
+            if(pos == ::std::string_view::npos) { continue; }
+            auto const local_fn{static_cast<::std::size_t>(::std::strtoull(line.data() + pos + key.size(), nullptr, 10))};
+            if(local_fn >= claims.size() || ++claims[local_fn] > 1u)
+            {
+                ::std::cerr << "[llvm_jit_lazy_concurrent] " << label << ": local_fn=" << local_fn << " materialized more than once\n";
+                ok = false;
+            }
+        }
+
+        return ok;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit_lazy_concurrent"};
+    ::std::filesystem::remove_all(artifact_dir);
+    ::std::filesystem::create_directories(artifact_dir);
+
+    auto const wasm_path{artifact_dir / "race.wasm"};
+    {
+        auto const wasm{make_race_module()};
+        ::std::ofstream output(wasm_path, ::std::ios::binary | ::std::ios::trunc);
+        output.write(reinterpret_cast<char const*>(wasm.data()), static_cast<::std::streamsize>(wasm.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write race fixture: " << wasm_path << '\n';
+            return 1;
+        }
+    }
+
+    bool ok{true};
+
+    // Timing and thread scaling are measured by benchmark/0003.uwvm/0003.lazy_jit_compile_scaling; this test only checks that
+    // concurrent materialization publishes every function once and correctly.
+    for(auto const compile_threads: compile_thread_counts)
+    {
+        for(::std::size_t repeat{}; repeat != race_repeats; ++repeat)
+        {
+            auto const label{"threads_" + ::std::to_string(compile_threads) + "." + ::std::to_string(repeat)};
+            auto const output_path{artifact_dir / (label + ".out")};
+            auto const log_path{artifact_dir / (label + ".log")};
+            auto const command{quote_argument(uwvm_path) + " -Rjit --runtime-llvm-jit-cache-path disable --runtime-compile-threads " +
+                               ::std::to_string(compile_threads) + " -Rclog file " + quote_argument(log_path) + " --run " + quote_argument(wasm_path) +
+                               " > " + quote_argument(output_path) + " 2>&1"};
+            ::std::cout << "[llvm_jit_lazy_concurrent] " << command << '\n';
+
+            if(auto const status{run_system_command(command)}; status != 0)
+            {
+                ::std::cerr << "[llvm_jit_lazy_concurrent] " << label << ": uwvm returned " << status << '\n' << read_text_file(output_path) << '\n';
+                ok = false;
+                continue;
+            }
+
+            ok = check_claims(read_text_file(log_path), label) && ok;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
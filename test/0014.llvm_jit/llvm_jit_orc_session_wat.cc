@@ -0,0 +1,100 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if __has_include(<unistd.h>)
+# include <unistd.h>
+#endif
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // Compile threads are off so every leaf outside `_start`'s cluster is linked on demand as an object of its own.
+    inline constexpr ::std::string_view lazy_args{"-Rjit --runtime-compile-threads 0"};
+
+    [[nodiscard]] ::std::size_t page_bytes() noexcept
+    {
+#if __has_include(<unistd.h>)
+        if(auto const size{::sysconf(_SC_PAGESIZE)}; size > 0) { return static_cast<::std::size_t>(size); }
+#endif
+        return 4096uz;
+    }
+
+    struct session_stats_t
+    {
+        ::std::size_t objects_linked{};
+        ::std::size_t exec_bytes{};
+        ::std::size_t private_data_bytes{};
+        ::std::size_t shared_data_chunk_bytes{};
+        ::std::size_t event_listeners{};
+    };
+
+    [[nodiscard]] session_stats_t read_session_stats(::std::string const& log)
+    {
+        return session_stats_t{.objects_linked = wat::read_log_counter(log, "orc-session objects_linked="),
+                               .exec_bytes = wat::read_log_counter(log, " exec_bytes="),
+                               .private_data_bytes = wat::read_log_counter(log, " private_data_bytes="),
+                               .shared_data_chunk_bytes = wat::read_log_counter(log, " shared_data_chunk_bytes="),
+                               .event_listeners = wat::read_log_counter(log, " event_listeners=")};
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "orc_session", "orc_session", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const wasm{wat::compile_wat(env, "many_small_functions")};
+    if(wasm.empty()) { return 1; }
+
+    auto const plain{wat::run_uwvm(env, "many_small_functions.plain", lazy_args, wasm)};
+    if(!wat::expect_success(env, "many_small_functions.plain", plain)) { return 1; }
+
+    auto const stats{read_session_stats(plain.log)};
+    if(stats.objects_linked == 0uz)
+    {
+        // Windows and 32-bit hosts link each object through its own SectionMemoryManager and report no session footprint.
+        ::std::cout << "[orc_session] skip, no shared section memory on this platform\n";
+        return 0;
+    }
+
+    bool ok{true};
+
+    // Every object keeps its code and read-only data in one page, and writable data packs into shared chunks instead of
+    // costing each object pages of its own.
+    auto const page{page_bytes()};
+    bool const footprint_ok{stats.objects_linked >= 2uz && stats.exec_bytes + stats.private_data_bytes <= stats.objects_linked * page &&
+                            stats.shared_data_chunk_bytes < stats.objects_linked * page};
+    if(!footprint_ok)
+    {
+        ::std::cerr << "[orc_session] unexpected footprint: objects_linked=" << stats.objects_linked << " exec_bytes=" << stats.exec_bytes
+                    << " private_data_bytes=" << stats.private_data_bytes << " shared_data_chunk_bytes=" << stats.shared_data_chunk_bytes
+                    << " page=" << page << '\n'
+                    << plain.log << '\n';
+        ok = false;
+    }
+
+    // Unwind call stacks add the runtime's debug listener next to the built-in ones instead of replacing them.
+    auto const unwind_args{::std::string{lazy_args} + " -Rllvm-call-stack unwind"};
+    auto const unwind{wat::run_uwvm(env, "many_small_functions.unwind", unwind_args, wasm)};
+    ok = wat::expect_success(env, "many_small_functions.unwind", unwind) && ok;
+    auto const unwind_stats{read_session_stats(unwind.log)};
+    if(unwind_stats.event_listeners < stats.event_listeners + 1uz || unwind_stats.objects_linked != stats.objects_linked)
+    {
+        ::std::cerr << "[orc_session] unwind run: event_listeners=" << unwind_stats.event_listeners << " (plain " << stats.event_listeners
+                    << "), objects_linked=" << unwind_stats.objects_linked << " (plain " << stats.objects_linked << ")\n"
+                    << unwind.log << '\n';
+        ok = false;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    struct profile_mode_t
+    {
+        wat::mode_t mode;
+        // Interpreter frames carry their name; LLVM code is recognized by its PC and tagged `_[j]`.
+        char const* expected_frame;
+    };
+
+    inline constexpr ::std::array modes{
+        profile_mode_t{wat::mode_t{"int_full", "-Rcm full -Rcc int"}, "hot"  },
+        profile_mode_t{wat::mode_t{"jit_full", "-Rcm full -Rcc jit"}, "_[j] "},
+    };
+
+    // `samples=<n>` from the profiler's summary line, or zero when the line is missing.
+    [[nodiscard]] ::std::size_t read_sample_count(::std::string const& output)
+    {
+        constexpr ::std::string_view key{"Guest profile: samples="};
+        auto const pos{output.find(key)};
+        if(pos == ::std::string::npos) { return 0uz; }
+        return static_cast<::std::size_t>(::std::strtoull(output.c_str() + pos + key.size(), nullptr, 10));
+    }
+
+    // Every folded line is `frame;frame;... <count>` with a positive count.
+    [[nodiscard]] bool folded_lines_well_formed(::std::string_view text)
+    {
+        while(!text.empty())
+        {
+            auto const eol{text.find('\n')};
+            auto const line{text.substr(0uz, eol)};
+            text = eol == ::std::string_view::npos ? ::std::string_view{} : text.substr(eol + 1uz);
+            if(line.empty()) { continue; }
+
+            auto const space{line.rfind(' ')};
+            if(space == ::std::string_view::npos || space == 0uz || space + 1uz == line.size()) { return false; }
+            auto const count{line.substr(space + 1uz)};
+            if(count.find_first_not_of("0123456789") != ::std::string_view::npos || count == "0") { return false; }
+        }
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "profile_sample", "profile_sample", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    // The name section gives the folded frames their function names.
+    auto const wasm{wat::compile_wat(env, "hot_loop_and_sleep", "--debug-names")};
+    if(wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    for(auto const& [mode, expected_frame]: modes)
+    {
+        auto const stem{::std::string{"hot_loop_and_sleep."} + mode.name};
+        auto const profile_path{env.artifact_dir / (stem + ".folded")};
+
+        // The fixture traps if the 300ms `poll_oneoff` sleep returns early or with an error while SIGPROF ticks are armed.
+        auto const args{::std::string{mode.args} + " --runtime-profile-sample 1000 " + wat::quote_argument(profile_path)};
+        auto const result{wat::run_uwvm(env, stem, args, wasm)};
+        if(!wat::expect_success(env, stem, result))
+        {
+            ok = false;
+            continue;
+        }
+
+        if(result.output.find("Guest sampling profiler is unavailable") != ::std::string::npos)
+        {
+            ::std::cout << "[profile_sample] " << stem << ": skip, no sampler on this platform\n";
+            continue;
+        }
+
+        auto const folded{wat::read_text_file(profile_path)};
+        bool const profile_ok{read_sample_count(result.output) != 0uz && folded.find(expected_frame) != ::std::string::npos &&
+                              folded_lines_well_formed(folded)};
+        if(!profile_ok)
+        {
+            ::std::cerr << "[profile_sample] " << stem << ": expected samples with a \"" << expected_frame << "\" frame\n"
+                        << result.output << '\n'
+                        << folded << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
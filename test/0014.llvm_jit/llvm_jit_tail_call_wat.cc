@@ -0,0 +1,74 @@
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // Modes whose tail calls run in constant host stack: interpreter frame reuse, and LLVM `musttail` in full and lazy JIT.
+    inline constexpr ::std::array constant_stack_modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"int_lazy", "-Rint"             },
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+        wat::mode_t{"jit_lazy", "-Rjit"             },
+    };
+
+    // Tiered Tier 1/Tier 2 code calls through the tier-aware bridge and its LLVM core has a hidden-argument prototype, so
+    // tiered mode only promises tail-call results, not constant stack; it runs the shallow fixture only.
+    inline constexpr ::std::array all_modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"int_lazy", "-Rint"             },
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+        wat::mode_t{"jit_lazy", "-Rjit"             },
+        wat::mode_t{"tiered",   "-Rtiered"          },
+    };
+
+    inline constexpr char const* feature_args{" --wasm-feature-enable-tail-call"};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "tail_call", "tail_call", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const recursion_wasm{wat::compile_wat(env, "mutual_recursion", "--enable-tail-call")};
+    auto const mismatch_wasm{wat::compile_wat(env, "indirect_signature_mismatch", "--enable-tail-call")};
+    if(recursion_wasm.empty() || mismatch_wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    // A million `return_call`/`return_call_indirect` hops must finish with the right results.
+    for(auto const& mode: constant_stack_modes)
+    {
+        auto const stem{::std::string{"mutual_recursion."} + mode.name};
+        ok = wat::expect_success(env, stem, wat::run_uwvm(env, stem, ::std::string{mode.args} + feature_args, recursion_wasm)) && ok;
+    }
+
+    // The matching slot returns its result; the mismatching slot traps before the callee runs.
+    for(auto const& mode: all_modes)
+    {
+        auto const stem{::std::string{"indirect_signature_mismatch."} + mode.name};
+        auto const result{wat::run_uwvm(env, stem, ::std::string{mode.args} + feature_args, mismatch_wasm)};
+        ok = wat::expect_trap(env, stem, result, "call_indirect: signature mismatch") && ok;
+    }
+
+    // Without the feature switch the module is rejected instead of running.
+    {
+        auto const result{wat::run_uwvm(env, "mutual_recursion.disabled", "-Rcm full -Rcc jit", recursion_wasm)};
+        if(result.status == 0 || !wat::parse_trap_kind(result.output).empty())
+        {
+            ::std::cerr << "[tail_call] tail calls ran without --wasm-feature-enable-tail-call\n" << result.output << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
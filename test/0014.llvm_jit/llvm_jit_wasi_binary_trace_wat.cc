@@ -0,0 +1,73 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // Interpreter and LLVM calls reach WASI through the same traced wrapper; both must write the same records.
+    inline constexpr ::std::array modes{
+        wat::mode_t{"int_full", "-Rcm full -Rcc int"},
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+    };
+
+    [[nodiscard]] ::std::size_t count_occurrences(::std::string_view text, ::std::string_view needle)
+    {
+        ::std::size_t count{};
+        for(auto pos{text.find(needle)}; pos != ::std::string_view::npos; pos = text.find(needle, pos + needle.size())) { ++count; }
+        return count;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "wasi_binary_trace", "wasi_binary_trace", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const wasm{wat::compile_wat(env, "wasi_calls")};
+    if(wasm.empty()) { return 1; }
+
+    bool ok{true};
+
+    for(auto const& mode: modes)
+    {
+        auto const stem{::std::string{"wasi_calls."} + mode.name};
+        auto const trace_path{env.artifact_dir / (stem + ".uwtrace")};
+
+        auto const run_args{::std::string{mode.args} + " --wasip1-binary-trace " + wat::quote_argument(trace_path)};
+        if(!wat::expect_success(env, stem, wat::run_uwvm(env, stem, run_args, wasm)))
+        {
+            ok = false;
+            continue;
+        }
+
+        // The trace written by the run above decodes to the four calls in order, with their arguments and errno, and no gaps.
+        auto const decode_stem{stem + ".decode"};
+        auto const decoded{wat::run_uwvm(env, decode_stem, "", "--decode-wasi-trace " + wat::quote_argument(trace_path))};
+        auto const& text{decoded.output};
+
+        auto const first_args{text.find("args_sizes_get(0, 4) -> 0 [")};
+        auto const fd_write{text.find("fd_write(1, 16, 1, 24) -> 0 [")};
+        bool const decoded_ok{decoded.status == 0 && count_occurrences(text, "args_sizes_get(0, 4) -> 0 [") == 3uz &&
+                              count_occurrences(text, "fd_write(1, 16, 1, 24) -> 0 [") == 1uz && first_args != ::std::string::npos &&
+                              fd_write != ::std::string::npos && first_args < fd_write && text.find("<dropped") == ::std::string::npos &&
+                              text.find("Decoded 4 WASI calls, 0 dropped.") != ::std::string::npos};
+        if(!decoded_ok)
+        {
+            ::std::cerr << "[wasi_binary_trace] " << decode_stem << ": unexpected decode (status " << decoded.status << ")\n" << text << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // Full-module and lazy LLVM both bind WASI imports to typed direct thunks unless the switch keeps them on the raw bridge.
+    inline constexpr ::std::array modes{
+        wat::mode_t{"jit_full", "-Rcm full -Rcc jit"},
+        wat::mode_t{"jit_lazy", "-Rjit"             },
+    };
+
+    inline constexpr ::std::string_view raw_bridge_args{"--runtime-llvm-jit-disable-wasip1-direct-call"};
+
+    inline constexpr ::std::string_view results_prefix{"wasip1-results "};
+    inline constexpr ::std::size_t results_bytes{56uz};
+
+    // Returns the hex record printed by `wasi_results.wat`, or an empty string when the line is missing or malformed.
+    [[nodiscard]] ::std::string find_results(::std::string const& output)
+    {
+        auto const begin{output.find(results_prefix)};
+        if(begin == ::std::string::npos) { return {}; }
+        auto const hex_begin{begin + results_prefix.size()};
+        auto const hex_end{output.find('\n', hex_begin)};
+        if(hex_end == ::std::string::npos || hex_end - hex_begin != 2uz * results_bytes) { return {}; }
+        return output.substr(hex_begin, hex_end - hex_begin);
+    }
+
+    [[nodiscard]] ::std::uint_least32_t hex_nibble(char ch) noexcept
+    { return ch <= '9' ? static_cast<::std::uint_least32_t>(ch - '0') : static_cast<::std::uint_least32_t>(ch - 'a' + 10); }
+
+    // Little-endian i32 at byte `offset` of the record.
+    [[nodiscard]] ::std::uint_least32_t read_word(::std::string const& hex, ::std::size_t offset) noexcept
+    {
+        ::std::uint_least32_t value{};
+        for(::std::size_t i{4uz}; i-- != 0uz;)
+        {
+            auto const pos{2uz * (offset + i)};
+            value = (value << 8u) | (hex_nibble(hex[pos]) << 4u) | hex_nibble(hex[pos + 1uz]);
+        }
+        return value;
+    }
+
+    // errno values the fixture expects regardless of the call path: `badf` for every call on the unopened fd 1000.
+    [[nodiscard]] bool check_errnos(::std::string const& hex)
+    {
+        constexpr ::std::uint_least32_t errno_success{0u};
+        constexpr ::std::uint_least32_t errno_badf{8u};
+        return read_word(hex, 0uz) == errno_success && read_word(hex, 4uz) == 3u && read_word(hex, 12uz) == errno_success &&
+               read_word(hex, 20uz) == errno_success && read_word(hex, 24uz) == errno_success && read_word(hex, 32uz) == errno_badf &&
+               read_word(hex, 36uz) == errno_success && read_word(hex, 48uz) == errno_badf && read_word(hex, 52uz) == errno_badf;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    wat::env_t env{};
+    switch(wat::setup(argc, argv, "wasip1_direct_call", "wasip1_direct_call", env))
+    {
+        case wat::setup_status::ready: break;
+        case wat::setup_status::skip: return 0;
+        case wat::setup_status::failed: return 1;
+    }
+
+    auto const wasm{wat::compile_wat(env, "wasi_results")};
+    if(wasm.empty()) { return 1; }
+
+    // Two guest arguments after the module name, so `args_get` has a non-trivial buffer to sum.
+    auto const run_args{"--run " + wat::quote_argument(wasm) + " alpha beta"};
+
+    bool ok{true};
+
+    for(auto const& mode: modes)
+    {
+        ::std::string results[2]{};
+        for(::std::size_t raw{}; raw != 2uz; ++raw)
+        {
+            auto const stem{::std::string{"wasi_results."} + mode.name + (raw != 0uz ? ".raw" : ".direct")};
+            auto args{::std::string{mode.args}};
+            if(raw != 0uz) { args += " " + ::std::string{raw_bridge_args}; }
+
+            auto const result{wat::run_uwvm(env, stem, args, run_args)};
+            if(!wat::expect_success(env, stem, result))
+            {
+                ok = false;
+                continue;
+            }
+
+            results[raw] = find_results(result.output);
+            if(results[raw].empty() || !check_errnos(results[raw]))
+            {
+                ::std::cerr << "[wasip1_direct_call] " << stem << ": unexpected WASI results\n" << result.output << '\n';
+                ok = false;
+            }
+        }
+
+        // Both paths must produce every errno and every result byte identically.
+        if(!results[0].empty() && !results[1].empty() && results[0] != results[1])
+        {
+            ::std::cerr << "[wasip1_direct_call] " << mode.name << ": direct and raw bridge results differ\n  direct " << results[0]
+                        << "\n  raw    " << results[1] << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+// Shared driver for the 0014 wat tests that run fixtures through the `uwvm` executable: it locates `uwvm` and `wat2wasm`,
+// compiles fixtures into the test artifact directory and runs them with a compiler log so tests can check results, trap
+// kinds and runtime counters.
+namespace uwvm2test::llvm_jit_wat
+{
+    struct mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    struct env_t
+    {
+        char const* test_name{};
+        ::std::filesystem::path uwvm_path{};
+        ::std::filesystem::path wat2wasm_path{};
+        ::std::filesystem::path wat_dir{};
+        ::std::filesystem::path artifact_dir{};
+    };
+
+    enum class setup_status
+    {
+        ready,
+        skip,
+        failed
+    };
+
+    struct run_result_t
+    {
+        int status{};
+        // Output with ANSI colors stripped.
+        ::std::string output{};
+        ::std::string log{};
+    };
+
+    [[nodiscard]] inline ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        auto text{path.string()};
+#ifdef _WIN32
+        auto trailing_backslashes{0uz};
+        for(auto it{text.rbegin()}; it != text.rend() && *it == '\\'; ++it) { ++trailing_backslashes; }
+        text.append(trailing_backslashes, '\\');
+#endif
+        return ::std::string{"\""} + text + "\"";
+    }
+
+    [[nodiscard]] inline int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] inline ::std::string read_text_file(::std::filesystem::path const& path)
+    {
+        ::std::ifstream input(path);
+        return ::std::string{::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{}};
+    }
+
+    [[nodiscard]] inline ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] inline ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] inline ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(run_system_command("wat2wasm --version > NUL 2>&1") == 0) { return "wat2wasm"; }
+#else
+        if(run_system_command("wat2wasm --version > /dev/null 2>&1") == 0) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    [[nodiscard]] inline ::std::string strip_ansi_codes(::std::string_view text)
+    {
+        ::std::string out{};
+        out.reserve(text.size());
+
+        for(::std::size_t i{}; i != text.size();)
+        {
+            if(text[i] == '\x1b' && i + 1uz < text.size() && text[i + 1uz] == '[')
+            {
+                i += 2uz;
+                while(i != text.size())
+                {
+                    auto const ch{text[i++]};
+                    if(ch >= '@' && ch <= '~') { break; }
+                }
+                continue;
+            }
+
+            out.push_back(text[i++]);
+        }
+
+        return out;
+    }
+
+    // The trap kind printed as `Runtime crash (<kind>)`, or empty when the run did not trap.
+    [[nodiscard]] inline ::std::string parse_trap_kind(::std::string_view plain_output)
+    {
+        constexpr ::std::string_view prefix{"Runtime crash ("};
+        auto const begin{plain_output.find(prefix)};
+        if(begin == ::std::string_view::npos) { return {}; }
+
+        auto const value_begin{begin + prefix.size()};
+        auto const value_end{plain_output.find(')', value_begin)};
+        if(value_end == ::std::string_view::npos) { return {}; }
+
+        return ::std::string{plain_output.substr(value_begin, value_end - value_begin)};
+    }
+
+    // Returns the value of `key=<n>` from the last runtime summary in `log`, or zero when the key is absent.
+    [[nodiscard]] inline ::std::size_t read_log_counter(::std::string const& log, ::std::string_view key)
+    {
+        auto const pos{log.rfind(key)};
+        if(pos == ::std::string::npos) { return 0uz; }
+        return static_cast<::std::size_t>(::std::strtoull(log.c_str() + pos + key.size(), nullptr, 10));
+    }
+
+    // Resolves `uwvm`, `wat2wasm` and `test/0014.llvm_jit/wat/<wat_subdir>`, and recreates the artifact directory.  A missing
+    // `wat2wasm` skips the test, like the other wat-driven 0014 tests.
+    [[nodiscard]] inline setup_status setup(int argc, char** argv, char const* test_name, char const* wat_subdir, env_t& env)
+    {
+        if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+        {
+            ::std::cerr << "missing argv[0]\n";
+            return setup_status::failed;
+        }
+
+        env.test_name = test_name;
+        auto const executable{::std::filesystem::absolute(argv[0])};
+        auto const executable_dir{executable.parent_path()};
+        auto const wat_rel{::std::filesystem::path{"test"} / "0014.llvm_jit" / "wat" / wat_subdir};
+        auto const project_root{find_parent_with(executable_dir, wat_rel)};
+        if(project_root.empty())
+        {
+            ::std::cerr << "failed to locate project root from " << executable << '\n';
+            return setup_status::failed;
+        }
+
+        env.uwvm_path = find_uwvm_binary(executable_dir);
+        if(env.uwvm_path.empty())
+        {
+            ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+            return setup_status::failed;
+        }
+
+        env.wat2wasm_path = find_wat2wasm(project_root);
+        if(env.wat2wasm_path.empty())
+        {
+            ::std::cout << "[" << test_name << "] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+            return setup_status::skip;
+        }
+
+        env.wat_dir = project_root / wat_rel;
+        env.artifact_dir = executable_dir / "test-artifacts" / "0014.llvm_jit" / wat_subdir;
+        ::std::error_code ec{};
+        ::std::filesystem::remove_all(env.artifact_dir, ec);
+        ::std::filesystem::create_directories(env.artifact_dir, ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create artifact directory: " << env.artifact_dir << '\n';
+            return setup_status::failed;
+        }
+
+        return setup_status::ready;
+    }
+
+    // Compiles `<wat_dir>/<stem>.wat` to `<artifact_dir>/<stem>.wasm`; returns an empty path on failure.
+    [[nodiscard]] inline ::std::filesystem::path compile_wat(env_t const& env, ::std::string_view stem, ::std::string_view wat2wasm_flags = {})
+    {
+        auto const wat_path{env.wat_dir / (::std::string{stem} + ".wat")};
+        auto const wasm_path{env.artifact_dir / (::std::string{stem} + ".wasm")};
+        auto command{quote_argument(env.wat2wasm_path)};
+        if(!wat2wasm_flags.empty()) { command += " " + ::std::string{wat2wasm_flags}; }
+        command += " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path);
+        ::std::cout << "[" << env.test_name << "] " << command << '\n';
+        if(run_system_command(command) == 0) { return wasm_path; }
+
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return {};
+    }
+
+    // Runs `uwvm <args> <cache_args> -Rclog file <log> <run_args>`.  `run_args` is the `--run ...` tail, which lets callers add
+    // `--wasm-preload-library` options in front of the main module.
+    [[nodiscard]] inline run_result_t run_uwvm_with_cache_args(env_t const& env,
+                                                               ::std::string_view stem,
+                                                               ::std::string_view args,
+                                                               ::std::string_view cache_args,
+                                                               ::std::string const& run_args)
+    {
+        auto const output_path{env.artifact_dir / (::std::string{stem} + ".out")};
+        auto const log_path{env.artifact_dir / (::std::string{stem} + ".log")};
+        auto const command{quote_argument(env.uwvm_path) + " " + ::std::string{args} + " " + ::std::string{cache_args} + " -Rclog file " +
+                           quote_argument(log_path) + " " + run_args + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[" << env.test_name << "] " << command << '\n';
+
+        run_result_t result{};
+        result.status = run_system_command(command);
+        result.output = strip_ansi_codes(read_text_file(output_path));
+        result.log = read_text_file(log_path);
+        return result;
+    }
+
+    // Runs with the LLVM cache disabled so every run compiles from scratch.
+    [[nodiscard]] inline run_result_t run_uwvm(env_t const& env, ::std::string_view stem, ::std::string_view args, ::std::string const& run_args)
+    { return run_uwvm_with_cache_args(env, stem, args, "--runtime-llvm-jit-cache-path disable", run_args); }
+
+    [[nodiscard]] inline run_result_t run_uwvm(env_t const& env, ::std::string_view stem, ::std::string_view args, ::std::filesystem::path const& wasm_path)
+    { return run_uwvm(env, stem, args, "--run " + quote_argument(wasm_path)); }
+
+    // Runs against the LLVM object cache in `cache_dir`; repeated runs with the same directory exercise cold and warm lookups.
+    [[nodiscard]] inline run_result_t run_uwvm_cached(env_t const& env,
+                                                      ::std::string_view stem,
+                                                      ::std::string_view args,
+                                                      ::std::filesystem::path const& cache_dir,
+                                                      ::std::filesystem::path const& wasm_path)
+    {
+        return run_uwvm_with_cache_args(env,
+                                        stem,
+                                        args,
+                                        "--runtime-llvm-jit-cache-path path " + quote_argument(cache_dir),
+                                        "--run " + quote_argument(wasm_path));
+    }
+
+    // Expects a clean exit; fixtures trap through `unreachable` when a result is wrong.
+    [[nodiscard]] inline bool expect_success(env_t const& env, ::std::string_view stem, run_result_t const& result)
+    {
+        if(result.status == 0) { return true; }
+        ::std::cerr << "[" << env.test_name << "] " << stem << ": uwvm returned " << result.status << '\n' << result.output << '\n';
+        return false;
+    }
+
+    // Expects the run to trap with exactly `trap_kind`.
+    [[nodiscard]] inline bool expect_trap(env_t const& env, ::std::string_view stem, run_result_t const& result, ::std::string_view trap_kind)
+    {
+        if(result.status != 0 && parse_trap_kind(result.output) == trap_kind) { return true; }
+        ::std::cerr << "[" << env.test_name << "] " << stem << ": expected trap \"" << trap_kind << "\", got status " << result.status << " trap \""
+                    << parse_trap_kind(result.output) << "\"\n"
+                    << result.output << '\n';
+        return false;
+    }
+}  // namespace uwvm2test::llvm_jit_wat
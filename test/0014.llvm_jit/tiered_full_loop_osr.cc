@@ -0,0 +1,225 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "llvm_jit_wat_runner.h"
+
+namespace
+{
+    namespace wat = ::uwvm2test::llvm_jit_wat;
+
+    // One `_start` invocation runs the whole workload. The workers are hot enough to push the module to Tier 2 while `_start` is
+    // still inside its loop, which is the case loop OSR into Tier 2 exists for.
+    inline constexpr ::std::uint_least32_t worker_count{32u};
+    inline constexpr ::std::uint_least32_t worker_rounds{8u};
+    inline constexpr ::std::uint_least32_t kernel_iterations{400'000u};
+
+    void append_uleb(::std::vector<unsigned char>& out, ::std::uint_least64_t value)
+    {
+        do {
+            auto byte{static_cast<unsigned char>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    void append_sleb(::std::vector<unsigned char>& out, ::std::int_least64_t value)
+    {
+        for(;;)
+        {
+            auto const byte{static_cast<unsigned char>(value & 0x7f)};
+            value >>= 7;
+            bool const done{(value == 0 && (byte & 0x40u) == 0u) || (value == -1 && (byte & 0x40u) != 0u)};
+            out.push_back(done ? byte : static_cast<unsigned char>(byte | 0x80u));
+            if(done) { return; }
+        }
+    }
+
+    void append_name(::std::vector<unsigned char>& out, ::std::string_view name)
+    {
+        append_uleb(out, name.size());
+        out.insert(out.end(), name.begin(), name.end());
+    }
+
+    void append_section(::std::vector<unsigned char>& out, unsigned char id, ::std::vector<unsigned char> const& payload)
+    {
+        out.push_back(id);
+        append_uleb(out, payload.size());
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    [[nodiscard]] constexpr ::std::int_least32_t worker_add(::std::uint_least32_t worker, ::std::uint_least32_t round) noexcept
+    { return static_cast<::std::int_least32_t>(worker * 131u + round * 7u + 3u); }
+
+    [[nodiscard]] constexpr ::std::int_least32_t worker_mul(::std::uint_least32_t worker, ::std::uint_least32_t round) noexcept
+    { return static_cast<::std::int_least32_t>(((worker * 17u + round) * 2u) | 1u); }
+
+    [[nodiscard]] constexpr ::std::uint_least32_t expected_accumulator() noexcept
+    {
+        ::std::uint_least32_t acc{};
+        for(::std::uint_least32_t i{}; i != kernel_iterations; ++i)
+        {
+            for(::std::uint_least32_t worker{}; worker != worker_count; ++worker)
+            {
+                // Only the first worker sees the loop counter; the rest take the previous worker's result as is.
+                auto const x{worker == 0u ? static_cast<::std::uint_least32_t>(acc ^ i) : acc};
+                auto v{x};
+                for(::std::uint_least32_t round{}; round != worker_rounds; ++round)
+                {
+                    v = static_cast<::std::uint_least32_t>(((v + static_cast<::std::uint_least32_t>(worker_add(worker, round))) *
+                                                            static_cast<::std::uint_least32_t>(worker_mul(worker, round))) ^
+                                                           x);
+                }
+                acc = v;
+            }
+        }
+        return acc;
+    }
+
+    // `_start` threads an accumulator through every `(i32) -> i32` worker `kernel_iterations` times and traps unless the result
+    // matches the host model, so whichever tier finishes the loop must agree with the interpreter that started it.
+    [[nodiscard]] ::std::vector<unsigned char> make_kernel_module()
+    {
+        ::std::vector<unsigned char> wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(wasm, 0x01u, {0x02u, 0x60u, 0x00u, 0x00u, 0x60u, 0x01u, 0x7fu, 0x01u, 0x7fu});
+
+        ::std::vector<unsigned char> functions{};
+        append_uleb(functions, worker_count + 1u);
+        functions.push_back(0x00u);
+        functions.insert(functions.end(), worker_count, 0x01u);
+        append_section(wasm, 0x03u, functions);
+
+        ::std::vector<unsigned char> exports{0x01u};
+        append_name(exports, "_start");
+        exports.insert(exports.end(), {0x00u, 0x00u});
+        append_section(wasm, 0x07u, exports);
+
+        ::std::vector<unsigned char> code{};
+        append_uleb(code, worker_count + 1u);
+
+        // locals: 0 = i, 1 = acc
+        ::std::vector<unsigned char> body{0x01u, 0x02u, 0x7fu, 0x03u, 0x40u};
+        for(::std::uint_least32_t worker{}; worker != worker_count; ++worker)
+        {
+            body.insert(body.end(), {0x20u, 0x01u});
+            if(worker == 0u) { body.insert(body.end(), {0x20u, 0x00u, 0x73u}); }
+            body.push_back(0x10u);
+            append_uleb(body, worker + 1u);
+            body.insert(body.end(), {0x21u, 0x01u});
+        }
+        body.insert(body.end(), {0x20u, 0x00u, 0x41u, 0x01u, 0x6au, 0x22u, 0x00u, 0x41u});
+        append_sleb(body, static_cast<::std::int_least64_t>(kernel_iterations));
+        body.insert(body.end(), {0x49u, 0x0du, 0x00u, 0x0bu});
+        body.insert(body.end(), {0x20u, 0x01u, 0x41u});
+        append_sleb(body, static_cast<::std::int_least32_t>(expected_accumulator()));
+        body.insert(body.end(), {0x47u, 0x04u, 0x40u, 0x00u, 0x0bu, 0x0bu});
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+
+        for(::std::uint_least32_t worker{}; worker != worker_count; ++worker)
+        {
+            body.assign({0x00u, 0x20u, 0x00u});
+            for(::std::uint_least32_t round{}; round != worker_rounds; ++round)
+            {
+                body.push_back(0x41u);
+                append_sleb(body, worker_add(worker, round));
+                body.push_back(0x6au);
+                body.push_back(0x41u);
+                append_sleb(body, worker_mul(worker, round));
+                body.push_back(0x6cu);
+                body.insert(body.end(), {0x20u, 0x00u, 0x73u});
+            }
+            body.push_back(0x0bu);
+            append_uleb(code, body.size());
+            code.insert(code.end(), body.begin(), body.end());
+        }
+        append_section(wasm, 0x0au, code);
+
+        return wasm;
+    }
+
+    // The trap at the end of `_start` turns a wrong Tier 2 reentry into a failed run. `expect_t2_osr` says whether the running loop
+    // must have moved to Tier 2 through a loop reentry.
+    [[nodiscard]] bool check_run(wat::env_t const& env, ::std::string_view stem, wat::run_result_t const& result, bool expect_t2_osr)
+    {
+        if(!wat::expect_success(env, stem, result)) { return false; }
+
+        auto const osr_full_ready{wat::read_log_counter(result.log, "tiered_osr_full_ready=")};
+        ::std::cout << "[tiered_full_loop_osr] " << stem << " tiered_full_ready=" << wat::read_log_counter(result.log, "tiered_full_ready=")
+                    << " tiered_osr_full_ready=" << osr_full_ready << '\n';
+        if(expect_t2_osr && osr_full_ready == 0uz)
+        {
+            ::std::cerr << "[tiered_full_loop_osr] " << stem << ": the running loop never moved to Tier 2\n";
+            return false;
+        }
+        if(!expect_t2_osr && osr_full_ready != 0uz)
+        {
+            ::std::cerr << "[tiered_full_loop_osr] " << stem << ": loop OSR entered Tier 2 outside a tiered run with Tier 2\n";
+            return false;
+        }
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+
+    // The fixture is generated here, so only `uwvm` is needed, not `wat2wasm`.
+    wat::env_t env{};
+    env.test_name = "tiered_full_loop_osr";
+    env.uwvm_path = wat::find_uwvm_binary(executable_dir);
+    if(env.uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    env.artifact_dir = executable_dir / "test-artifacts" / "0014.tiered_full_loop_osr";
+    ::std::filesystem::remove_all(env.artifact_dir);
+    ::std::filesystem::create_directories(env.artifact_dir);
+
+    auto const wasm_path{env.artifact_dir / "kernel.wasm"};
+    {
+        auto const wasm{make_kernel_module()};
+        ::std::ofstream output(wasm_path, ::std::ios::binary | ::std::ios::trunc);
+        output.write(reinterpret_cast<char const*>(wasm.data()), static_cast<::std::streamsize>(wasm.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write kernel fixture: " << wasm_path << '\n';
+            return 1;
+        }
+    }
+
+    bool ok{true};
+
+    ok = check_run(env, "tiered", wat::run_uwvm(env, "tiered", "-Rtiered", wasm_path), true) && ok;
+    ok = check_run(env, "tiered_no_t2", wat::run_uwvm(env, "tiered_no_t2", "-Rtiered -Rtiered-disable-t2", wasm_path), false) && ok;
+
+    // One cache directory shared by every mode. Tiered code carries loop reentry wrappers that `-Rjit` and `-Rcm full` code does
+    // not, so an object stored by one mode and loaded by another would either lack the reentry points or carry unexpected ones.
+    // The last tiered run is warm and must still reach Tier 2 through a loop reentry.
+    auto const cache_dir{env.artifact_dir / "cache"};
+    ::std::filesystem::create_directories(cache_dir);
+    ok = check_run(env, "cached_tiered_cold", wat::run_uwvm_cached(env, "cached_tiered_cold", "-Rtiered", cache_dir, wasm_path), true) && ok;
+    ok = check_run(env, "cached_jit", wat::run_uwvm_cached(env, "cached_jit", "-Rjit", cache_dir, wasm_path), false) && ok;
+    ok = check_run(env, "cached_full", wat::run_uwvm_cached(env, "cached_full", "-Rcm full -Rcc jit", cache_dir, wasm_path), false) && ok;
+    ok = check_run(env, "cached_tiered_warm", wat::run_uwvm_cached(env, "cached_tiered_warm", "-Rtiered", cache_dir, wasm_path), true) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // `$rec` recurses `recursion_depth` frames deep and runs the hot loop at the bottom, so Tier 2 is published, and the code it
+    // supersedes is queued for reclamation, while every one of those frames and the loop itself still execute in Tier 0 or 1.
+    // More workers than one lazy cluster holds, so most Tier 1 objects hold no live frame and can actually be freed.
+    inline constexpr ::std::uint_least32_t worker_count{32u};
+    inline constexpr ::std::uint_least32_t worker_rounds{8u};
+    inline constexpr ::std::uint_least32_t kernel_iterations{400'000u};
+    inline constexpr ::std::uint_least32_t recursion_depth{48u};
+
+    void append_uleb(::std::vector<unsigned char>& out, ::std::uint_least64_t value)
+    {
+        do {
+            auto byte{static_cast<unsigned char>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    void append_sleb(::std::vector<unsigned char>& out, ::std::int_least64_t value)
+    {
+        for(;;)
+        {
+            auto const byte{static_cast<unsigned char>(value & 0x7f)};
+            value >>= 7;
+            bool const done{(value == 0 && (byte & 0x40u) == 0u) || (value == -1 && (byte & 0x40u) != 0u)};
+            out.push_back(done ? byte : static_cast<unsigned char>(byte | 0x80u));
+            if(done) { return; }
+        }
+    }
+
+    void append_name(::std::vector<unsigned char>& out, ::std::string_view name)
+    {
+        append_uleb(out, name.size());
+        out.insert(out.end(), name.begin(), name.end());
+    }
+
+    void append_section(::std::vector<unsigned char>& out, unsigned char id, ::std::vector<unsigned char> const& payload)
+    {
+        out.push_back(id);
+        append_uleb(out, payload.size());
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    [[nodiscard]] constexpr ::std::int_least32_t worker_add(::std::uint_least32_t worker, ::std::uint_least32_t round) noexcept
+    { return static_cast<::std::int_least32_t>(worker * 131u + round * 7u + 3u); }
+
+    [[nodiscard]] constexpr ::std::int_least32_t worker_mul(::std::uint_least32_t worker, ::std::uint_least32_t round) noexcept
+    { return static_cast<::std::int_least32_t>(((worker * 17u + round) * 2u) | 1u); }
+
+    [[nodiscard]] constexpr ::std::uint_least32_t run_worker(::std::uint_least32_t worker, ::std::uint_least32_t x) noexcept
+    {
+        auto v{x};
+        for(::std::uint_least32_t round{}; round != worker_rounds; ++round)
+        {
+            v = static_cast<::std::uint_least32_t>(
+                ((v + static_cast<::std::uint_least32_t>(worker_add(worker, round))) * static_cast<::std::uint_least32_t>(worker_mul(worker, round))) ^ x);
+        }
+        return v;
+    }
+
+    // Host model of `$rec(recursion_depth)`: the loop result plus every frame's depth on the way back up, with i32 wrap-around.
+    [[nodiscard]] constexpr ::std::uint_least32_t expected_result() noexcept
+    {
+        ::std::uint_least32_t acc{};
+        for(::std::uint_least32_t i{}; i != kernel_iterations; ++i)
+        {
+            for(::std::uint_least32_t worker{}; worker != worker_count; ++worker) { acc = run_worker(worker, worker == 0u ? acc ^ i : acc); }
+        }
+        for(::std::uint_least32_t depth{1u}; depth <= recursion_depth; ++depth) { acc = static_cast<::std::uint_least32_t>(acc + depth); }
+        return acc;
+    }
+
+    // Function 0 is `_start`, 1 is `$rec`, the rest are `(i32) -> i32` workers.  `_start` traps unless `$rec` returns the host
+    // model's value, so a frame that returned into freed or unpublished code fails the run.
+    [[nodiscard]] ::std::vector<unsigned char> make_module(::std::uint_least32_t expected)
+    {
+        ::std::vector<unsigned char> wasm{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(wasm, 0x01u, {0x02u, 0x60u, 0x00u, 0x00u, 0x60u, 0x01u, 0x7fu, 0x01u, 0x7fu});
+
+        ::std::vector<unsigned char> functions{};
+        append_uleb(functions, worker_count + 2u);
+        functions.insert(functions.end(), {0x00u, 0x01u});
+        functions.insert(functions.end(), worker_count, 0x01u);
+        append_section(wasm, 0x03u, functions);
+
+        ::std::vector<unsigned char> exports{0x01u};
+        append_name(exports, "_start");
+        exports.insert(exports.end(), {0x00u, 0x00u});
+        append_section(wasm, 0x07u, exports);
+
+        ::std::vector<unsigned char> code{};
+        append_uleb(code, worker_count + 2u);
+
+        // _start: if($rec(depth) != expected) unreachable
+        ::std::vector<unsigned char> body{0x00u, 0x41u};
+        append_sleb(body, recursion_depth);
+        body.insert(body.end(), {0x10u, 0x01u, 0x41u});
+        append_sleb(body, static_cast<::std::int_least32_t>(expected));
+        body.insert(body.end(), {0x47u, 0x04u, 0x40u, 0x00u, 0x0bu, 0x0bu});
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+
+        // $rec(n): n != 0 ? $rec(n - 1) + n : hot loop.  locals: 0 = n, 1 = i, 2 = acc
+        body.assign({0x01u, 0x02u, 0x7fu, 0x20u, 0x00u, 0x04u, 0x7fu});
+        body.insert(body.end(), {0x20u, 0x00u, 0x41u, 0x01u, 0x6bu, 0x10u, 0x01u, 0x20u, 0x00u, 0x6au});
+        body.insert(body.end(), {0x05u, 0x03u, 0x40u});
+        for(::std::uint_least32_t worker{}; worker != worker_count; ++worker)
+        {
+            body.insert(body.end(), {0x20u, 0x02u});
+            if(worker == 0u) { body.insert(body.end(), {0x20u, 0x01u, 0x73u}); }
+            body.push_back(0x10u);
+            append_uleb(body, worker + 2u);
+            body.insert(body.end(), {0x21u, 0x02u});
+        }
+        body.insert(body.end(), {0x20u, 0x01u, 0x41u, 0x01u, 0x6au, 0x22u, 0x01u, 0x41u});
+        append_sleb(body, static_cast<::std::int_least64_t>(kernel_iterations));
+        body.insert(body.end(), {0x49u, 0x0du, 0x00u, 0x0bu, 0x20u, 0x02u, 0x0bu, 0x0bu});
+        append_uleb(code, body.size());
+        code.insert(code.end(), body.begin(), body.end());
+
+        for(::std::uint_least32_t worker{}; worker != worker_count; ++worker)
+        {
+            body.assign({0x00u, 0x20u, 0x00u});
+            for(::std::uint_least32_t round{}; round != worker_rounds; ++round)
+            {
+                body.push_back(0x41u);
+                append_sleb(body, worker_add(worker, round));
+                body.push_back(0x6au);
+                body.push_back(0x41u);
+                append_sleb(body, worker_mul(worker, round));
+                body.push_back(0x6cu);
+                body.insert(body.end(), {0x20u, 0x00u, 0x73u});
+            }
+            body.push_back(0x0bu);
+            append_uleb(code, body.size());
+            code.insert(code.end(), body.begin(), body.end());
+        }
+        append_section(wasm, 0x0au, code);
+
+        return wasm;
+    }
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        auto text{path.string()};
+#ifdef _WIN32
+        auto trailing_backslashes{0uz};
+        for(auto it{text.rbegin()}; it != text.rend() && *it == '\\'; ++it) { ++trailing_backslashes; }
+        text.append(trailing_backslashes, '\\');
+#endif
+        return ::std::string{"\""} + text + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::string read_text_file(::std::filesystem::path const& path)
+    {
+        ::std::ifstream input(path);
+        return ::std::string{::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{}};
+    }
+
+    // Returns the value of `key=<n>` from the last runtime summary in `log`, or zero when the key is absent.
+    [[nodiscard]] ::std::size_t read_log_counter(::std::string const& log, ::std::string_view key)
+    {
+        auto const pos{log.rfind(key)};
+        if(pos == ::std::string::npos) { return 0uz; }
+        return static_cast<::std::size_t>(::std::strtoull(log.c_str() + pos + key.size(), nullptr, 10));
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.tiered_reclaim_live_frames"};
+    ::std::filesystem::remove_all(artifact_dir);
+    ::std::filesystem::create_directories(artifact_dir);
+
+    auto const wasm_path{artifact_dir / "live_frames.wasm"};
+    {
+        auto const wasm{make_module(expected_result())};
+        ::std::ofstream output(wasm_path, ::std::ios::binary | ::std::ios::trunc);
+        output.write(reinterpret_cast<char const*>(wasm.data()), static_cast<::std::streamsize>(wasm.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write live-frame fixture: " << wasm_path << '\n';
+            return 1;
+        }
+    }
+
+    struct mode_t
+    {
+        ::std::string_view name;
+        ::std::string_view args;
+        // Tier 2 supersedes interpreter bytecode when Tier 0 runs, and lazy LLVM objects when it does not.
+        ::std::string_view reclaimed_key;
+    };
+
+    constexpr mode_t modes[]{
+        {"tiered",       "-Rtiered",                     " tiered_reclaim_tier0_bytes="},
+        {"tiered_no_t0", "-Rtiered -Rtiered-disable-t0", " tiered_reclaim_tier1_bytes="},
+    };
+
+    bool ok{true};
+    for(auto const& mode: modes)
+    {
+        auto const output_path{artifact_dir / (::std::string{mode.name} + ".out")};
+        auto const log_path{artifact_dir / (::std::string{mode.name} + ".log")};
+        auto const command{quote_argument(uwvm_path) + " " + ::std::string{mode.args} + " --runtime-llvm-jit-cache-path disable -Rclog file " +
+                           quote_argument(log_path) + " --run " + quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[tiered_reclaim_live_frames] " << command << '\n';
+
+        // A non-zero status is the trap in `_start`: some frame resumed in code that reclamation had already taken away.
+        if(auto const status{run_system_command(command)}; status != 0)
+        {
+            ::std::cerr << "[tiered_reclaim_live_frames] " << mode.name << ": uwvm returned " << status << '\n' << read_text_file(output_path) << '\n';
+            ok = false;
+            continue;
+        }
+
+        auto const log{read_text_file(log_path)};
+        auto const publishes{read_log_counter(log, " tiered_full_publishes=")};
+        auto const reclaimed{read_log_counter(log, mode.reclaimed_key)};
+        ::std::cout << "[tiered_reclaim_live_frames] mode=" << mode.name << " tiered_full_publishes=" << publishes << mode.reclaimed_key << reclaimed
+                    << '\n';
+        if(publishes == 0uz || reclaimed == 0uz)
+        {
+            ::std::cerr << "[tiered_reclaim_live_frames] " << mode.name << ": expected Tier 2 to publish and superseded code to be reclaimed\n"
+                        << log << '\n';
+            ok = false;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,34 @@
+(module
+  ;; `$ii` and `$ii_dup` are distinct type indices with the same signature, so slots typed with either must match a
+  ;; `call_indirect (type $ii)`; the loop keeps hitting the same slots so the flattened entries are exercised repeatedly.
+  (type $ii (func (param i32) (result i32)))
+  (type $ii_dup (func (param i32) (result i32)))
+  (type $ll (func (param i64) (result i64)))
+  (table 3 funcref)
+  (elem (i32.const 0) $inc $dbl $wide)
+
+  (func $inc (type $ii) (param $x i32) (result i32)
+    (i32.add (local.get $x) (i32.const 1)))
+
+  (func $dbl (type $ii_dup) (param $x i32) (result i32)
+    (i32.mul (local.get $x) (i32.const 2)))
+
+  (func $wide (type $ll) (param $x i64) (result i64)
+    (i64.add (local.get $x) (i64.const 1)))
+
+  (func (export "_start")
+    (local $i i32)
+    (local $acc i32)
+    (local $wide_acc i64)
+    (loop $next
+      ;; acc += inc(i) + dbl(i)
+      (local.set $acc
+        (i32.add (local.get $acc)
+          (i32.add (call_indirect (type $ii) (local.get $i) (i32.const 0))
+                   (call_indirect (type $ii_dup) (local.get $i) (i32.const 1)))))
+      (local.set $wide_acc (call_indirect (type $ll) (local.get $wide_acc) (i32.const 2)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $next (i32.lt_u (local.get $i) (i32.const 1000))))
+    ;; sum(i + 1) + sum(2i) for i < 1000 = 500500 + 999000
+    (if (i32.ne (local.get $acc) (i32.const 1499500)) (then unreachable))
+    (if (i64.ne (local.get $wide_acc) (i64.const 1000)) (then unreachable))))
@@ -0,0 +1,23 @@
+(module
+  ;; Slot 1 holds `$wide` (i64 -> i64). After a run of matching calls through slot 0, calling slot 1 as (i32) -> i32
+  ;; must trap with a signature mismatch instead of entering `$wide`.
+  (type $ii (func (param i32) (result i32)))
+  (type $ll (func (param i64) (result i64)))
+  (table 2 funcref)
+  (elem (i32.const 0) $inc $wide)
+
+  (func $inc (type $ii) (param $x i32) (result i32)
+    (i32.add (local.get $x) (i32.const 1)))
+
+  (func $wide (type $ll) (param $x i64) (result i64)
+    (i64.add (local.get $x) (i64.const 1)))
+
+  (func $call (param $slot i32) (param $x i32) (result i32)
+    (call_indirect (type $ii) (local.get $x) (local.get $slot)))
+
+  (func (export "_start")
+    (local $i i32)
+    (loop $next
+      (local.set $i (call $call (i32.const 0) (local.get $i)))
+      (br_if $next (i32.lt_u (local.get $i) (i32.const 100))))
+    (drop (call $call (i32.const 1) (local.get $i)))))
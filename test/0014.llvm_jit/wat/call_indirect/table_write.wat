@@ -0,0 +1,39 @@
+(module
+  ;; table.set, table.fill and table.grow store new targets into slots that were already flattened at instantiation;
+  ;; call_indirect must see the new target right away, and a slot rewritten with another signature must mismatch.
+  (type $ii (func (param i32) (result i32)))
+  (type $ll (func (param i64) (result i64)))
+  (table $t 2 funcref)
+  (elem (i32.const 0) $inc $inc)
+  (elem declare func $dbl $neg $wide)
+
+  (func $inc (type $ii) (param $x i32) (result i32)
+    (i32.add (local.get $x) (i32.const 1)))
+
+  (func $dbl (type $ii) (param $x i32) (result i32)
+    (i32.mul (local.get $x) (i32.const 2)))
+
+  (func $neg (type $ii) (param $x i32) (result i32)
+    (i32.sub (i32.const 0) (local.get $x)))
+
+  (func $wide (type $ll) (param $x i64) (result i64)
+    (i64.add (local.get $x) (i64.const 1)))
+
+  (func $call (param $slot i32) (param $x i32) (result i32)
+    (call_indirect (type $ii) (local.get $x) (local.get $slot)))
+
+  (func (export "_start")
+    (if (i32.ne (call $call (i32.const 0) (i32.const 20)) (i32.const 21)) (then unreachable))
+
+    (table.set $t (i32.const 0) (ref.func $dbl))
+    (if (i32.ne (call $call (i32.const 0) (i32.const 20)) (i32.const 40)) (then unreachable))
+
+    (table.fill $t (i32.const 0) (ref.func $neg) (i32.const 2))
+    (if (i32.ne (call $call (i32.const 1) (i32.const 20)) (i32.const -20)) (then unreachable))
+
+    (if (i32.ne (table.grow $t (ref.func $dbl) (i32.const 1)) (i32.const 2)) (then unreachable))
+    (if (i32.ne (call $call (i32.const 2) (i32.const 21)) (i32.const 42)) (then unreachable))
+
+    ;; The last write changes the slot's signature.
+    (table.set $t (i32.const 0) (ref.func $wide))
+    (drop (call $call (i32.const 0) (i32.const 20)))))
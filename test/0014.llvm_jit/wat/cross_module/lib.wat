@@ -0,0 +1,32 @@
+(module
+  ;; Preloaded as `lib`. Every export but `close` is a defined function, so the importer links to it directly: a direct call-info
+  ;; record in uwvm-int, a published typed-entry slot in LLVM full mode. `close` re-exports a WASI import, which has no defined
+  ;; callee; its LLVM slot is never published and the call keeps the raw host bridge.
+  (import "wasi_snapshot_preview1" "fd_close" (func $fd_close (param i32) (result i32)))
+  (memory (export "memory") 1)
+  (data (i32.const 0) "\2a\00\00\00")
+  (global $calls (mut i32) (i32.const 0))
+
+  (func (export "mix") (param $a i32) (param $b i64) (param $c f32) (param $d f64) (result f64)
+    (f64.add (f64.add (f64.convert_i32_s (local.get $a)) (f64.convert_i64_s (local.get $b)))
+             (f64.add (f64.promote_f32 (local.get $c)) (local.get $d))))
+
+  (func (export "mul64") (param $a i64) (param $b i64) (result i64)
+    (i64.mul (local.get $a) (local.get $b)))
+
+  ;; State stays in this module: the counter is the callee's global, whatever module calls it.
+  (func (export "count") (result i32)
+    (global.set $calls (i32.add (global.get $calls) (i32.const 1)))
+    (global.get $calls))
+
+  ;; Reads this module's memory, which holds 42 at address 0; the caller's memory holds something else there.
+  (func (export "peek") (param $addr i32) (result i32)
+    (i32.load (local.get $addr)))
+
+  (func (export "div") (param $a i32) (param $b i32) (result i32)
+    (i32.div_s (local.get $a) (local.get $b)))
+
+  (func (export "fail")
+    (unreachable))
+
+  (export "close" (func $fd_close)))
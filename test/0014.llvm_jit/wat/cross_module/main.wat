@@ -0,0 +1,32 @@
+(module
+  ;; Calls every `lib` export across the module boundary and traps unless each result matches.
+  (import "lib" "mix" (func $mix (param i32 i64 f32 f64) (result f64)))
+  (import "lib" "mul64" (func $mul64 (param i64 i64) (result i64)))
+  (import "lib" "count" (func $count (result i32)))
+  (import "lib" "peek" (func $peek (param i32) (result i32)))
+  (import "lib" "close" (func $close (param i32) (result i32)))
+  (memory (export "memory") 1)
+  (data (i32.const 0) "\07\00\00\00")
+
+  (func $check (param $ok i32)
+    (if (i32.eqz (local.get $ok)) (then (unreachable))))
+
+  (func (export "_start")
+    (local $i i32)
+    ;; Mixed i32/i64/f32/f64 parameters and an f64 result.
+    (call $check (f64.eq (call $mix (i32.const 1) (i64.const 2) (f32.const 0.5) (f64.const 0.25)) (f64.const 3.75)))
+    (call $check (f64.eq (call $mix (i32.const -5) (i64.const 0x100000000) (f32.const -1.5) (f64.const 1e10)) (f64.const 14294967289.5)))
+    (call $check (i64.eq (call $mul64 (i64.const 0x123456789) (i64.const -3)) (i64.const -14660155035)))
+
+    ;; A thousand calls, each seeing the callee's global advance by one.
+    (loop $next
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (call $check (i32.eq (call $count) (local.get $i)))
+      (br_if $next (i32.lt_u (local.get $i) (i32.const 1000))))
+
+    ;; The callee reads its own memory, not the caller's.
+    (call $check (i32.eq (call $peek (i32.const 0)) (i32.const 42)))
+    (call $check (i32.eq (i32.load (i32.const 0)) (i32.const 7)))
+
+    ;; The re-exported WASI import takes the raw bridge and still returns `badf` for an unopened fd.
+    (call $check (i32.eq (call $close (i32.const 1000)) (i32.const 8)))))
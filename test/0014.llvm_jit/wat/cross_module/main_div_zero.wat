@@ -0,0 +1,7 @@
+(module
+  ;; The callee traps on integer division by zero; the trap must surface like a same-module trap.
+  (import "lib" "div" (func $div (param i32 i32) (result i32)))
+  (memory (export "memory") 1)
+
+  (func (export "_start")
+    (drop (call $div (i32.const 1) (i32.const 0)))))
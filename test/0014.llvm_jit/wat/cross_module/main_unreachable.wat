@@ -0,0 +1,7 @@
+(module
+  ;; The callee executes `unreachable`.
+  (import "lib" "fail" (func $fail))
+  (memory (export "memory") 1)
+
+  (func (export "_start")
+    (call $fail)))
@@ -0,0 +1,13 @@
+(module
+  ;; `$down` never reaches a base case. Its result is stored after the call returns, so no mode can turn the recursion into a
+  ;; loop; every mode grows the native stack until it reaches the guest stack guard and must trap with `call stack exhausted`.
+  (memory 1)
+
+  (func $down (param $n i32) (result i32)
+    (local $r i32)
+    (local.set $r (call $down (i32.add (local.get $n) (i32.const 1))))
+    (i32.store (i32.and (i32.shl (local.get $n) (i32.const 2)) (i32.const 0xfffc)) (local.get $r))
+    (local.get $r))
+
+  (func (export "_start")
+    (drop (call $down (i32.const 0)))))
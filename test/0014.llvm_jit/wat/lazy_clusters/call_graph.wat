@@ -0,0 +1,23 @@
+(module
+  ;; Local functions, in index order:
+  ;;   0 _start -> 1 $outer -> 2 $inner      reachable from _start: one cluster
+  ;;   3 $orphan_root -> 4 $orphan_leaf      never called, but a call graph of its own: a second cluster
+  ;;   5 $lonely                             calls nothing and is called by nothing: a cluster of one
+  ;; Clusters follow call edges only, so neither orphan group is packed into _start's cluster to fill its budget.
+  (func (export "_start")
+    (if (i32.ne (call $outer (i32.const 5)) (i32.const 16)) (then (unreachable))))
+
+  (func $outer (param $x i32) (result i32)
+    (i32.add (call $inner (local.get $x)) (i32.const 1)))
+
+  (func $inner (param $x i32) (result i32)
+    (i32.mul (local.get $x) (i32.const 3)))
+
+  (func $orphan_root (param $x i32) (result i32)
+    (i32.xor (call $orphan_leaf (local.get $x)) (i32.const 7)))
+
+  (func $orphan_leaf (param $x i32) (result i32)
+    (i32.sub (local.get $x) (i32.const 11)))
+
+  (func $lonely (param $x i32) (result i32)
+    (i32.rotl (local.get $x) (i32.const 9))))
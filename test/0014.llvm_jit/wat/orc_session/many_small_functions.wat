@@ -0,0 +1,327 @@
+(module
+  ;; 64 tiny leaves called once each from _start.  Lazy clusters stop at 16 functions, so the leaves past _start's cluster
+  ;; each materialize as an object of their own: dozens of small objects for one ORC session.
+  (global $acc (mut i32) (i32.const 0))
+
+  (func (export "_start")
+    (if (i32.ne (call $leaf0 (i32.const 0)) (i32.const 1)) (then (unreachable)))
+    (if (i32.ne (call $leaf1 (i32.const 1)) (i32.const 5)) (then (unreachable)))
+    (if (i32.ne (call $leaf2 (i32.const 2)) (i32.const 9)) (then (unreachable)))
+    (if (i32.ne (call $leaf3 (i32.const 3)) (i32.const 13)) (then (unreachable)))
+    (if (i32.ne (call $leaf4 (i32.const 4)) (i32.const 17)) (then (unreachable)))
+    (if (i32.ne (call $leaf5 (i32.const 5)) (i32.const 21)) (then (unreachable)))
+    (if (i32.ne (call $leaf6 (i32.const 6)) (i32.const 25)) (then (unreachable)))
+    (if (i32.ne (call $leaf7 (i32.const 7)) (i32.const 29)) (then (unreachable)))
+    (if (i32.ne (call $leaf8 (i32.const 8)) (i32.const 33)) (then (unreachable)))
+    (if (i32.ne (call $leaf9 (i32.const 9)) (i32.const 37)) (then (unreachable)))
+    (if (i32.ne (call $leaf10 (i32.const 10)) (i32.const 41)) (then (unreachable)))
+    (if (i32.ne (call $leaf11 (i32.const 11)) (i32.const 45)) (then (unreachable)))
+    (if (i32.ne (call $leaf12 (i32.const 12)) (i32.const 49)) (then (unreachable)))
+    (if (i32.ne (call $leaf13 (i32.const 13)) (i32.const 53)) (then (unreachable)))
+    (if (i32.ne (call $leaf14 (i32.const 14)) (i32.const 57)) (then (unreachable)))
+    (if (i32.ne (call $leaf15 (i32.const 15)) (i32.const 61)) (then (unreachable)))
+    (if (i32.ne (call $leaf16 (i32.const 16)) (i32.const 65)) (then (unreachable)))
+    (if (i32.ne (call $leaf17 (i32.const 17)) (i32.const 69)) (then (unreachable)))
+    (if (i32.ne (call $leaf18 (i32.const 18)) (i32.const 73)) (then (unreachable)))
+    (if (i32.ne (call $leaf19 (i32.const 19)) (i32.const 77)) (then (unreachable)))
+    (if (i32.ne (call $leaf20 (i32.const 20)) (i32.const 81)) (then (unreachable)))
+    (if (i32.ne (call $leaf21 (i32.const 21)) (i32.const 85)) (then (unreachable)))
+    (if (i32.ne (call $leaf22 (i32.const 22)) (i32.const 89)) (then (unreachable)))
+    (if (i32.ne (call $leaf23 (i32.const 23)) (i32.const 93)) (then (unreachable)))
+    (if (i32.ne (call $leaf24 (i32.const 24)) (i32.const 97)) (then (unreachable)))
+    (if (i32.ne (call $leaf25 (i32.const 25)) (i32.const 101)) (then (unreachable)))
+    (if (i32.ne (call $leaf26 (i32.const 26)) (i32.const 105)) (then (unreachable)))
+    (if (i32.ne (call $leaf27 (i32.const 27)) (i32.const 109)) (then (unreachable)))
+    (if (i32.ne (call $leaf28 (i32.const 28)) (i32.const 113)) (then (unreachable)))
+    (if (i32.ne (call $leaf29 (i32.const 29)) (i32.const 117)) (then (unreachable)))
+    (if (i32.ne (call $leaf30 (i32.const 30)) (i32.const 121)) (then (unreachable)))
+    (if (i32.ne (call $leaf31 (i32.const 31)) (i32.const 125)) (then (unreachable)))
+    (if (i32.ne (call $leaf32 (i32.const 32)) (i32.const 129)) (then (unreachable)))
+    (if (i32.ne (call $leaf33 (i32.const 33)) (i32.const 133)) (then (unreachable)))
+    (if (i32.ne (call $leaf34 (i32.const 34)) (i32.const 137)) (then (unreachable)))
+    (if (i32.ne (call $leaf35 (i32.const 35)) (i32.const 141)) (then (unreachable)))
+    (if (i32.ne (call $leaf36 (i32.const 36)) (i32.const 145)) (then (unreachable)))
+    (if (i32.ne (call $leaf37 (i32.const 37)) (i32.const 149)) (then (unreachable)))
+    (if (i32.ne (call $leaf38 (i32.const 38)) (i32.const 153)) (then (unreachable)))
+    (if (i32.ne (call $leaf39 (i32.const 39)) (i32.const 157)) (then (unreachable)))
+    (if (i32.ne (call $leaf40 (i32.const 40)) (i32.const 161)) (then (unreachable)))
+    (if (i32.ne (call $leaf41 (i32.const 41)) (i32.const 165)) (then (unreachable)))
+    (if (i32.ne (call $leaf42 (i32.const 42)) (i32.const 169)) (then (unreachable)))
+    (if (i32.ne (call $leaf43 (i32.const 43)) (i32.const 173)) (then (unreachable)))
+    (if (i32.ne (call $leaf44 (i32.const 44)) (i32.const 177)) (then (unreachable)))
+    (if (i32.ne (call $leaf45 (i32.const 45)) (i32.const 181)) (then (unreachable)))
+    (if (i32.ne (call $leaf46 (i32.const 46)) (i32.const 185)) (then (unreachable)))
+    (if (i32.ne (call $leaf47 (i32.const 47)) (i32.const 189)) (then (unreachable)))
+    (if (i32.ne (call $leaf48 (i32.const 48)) (i32.const 193)) (then (unreachable)))
+    (if (i32.ne (call $leaf49 (i32.const 49)) (i32.const 197)) (then (unreachable)))
+    (if (i32.ne (call $leaf50 (i32.const 50)) (i32.const 201)) (then (unreachable)))
+    (if (i32.ne (call $leaf51 (i32.const 51)) (i32.const 205)) (then (unreachable)))
+    (if (i32.ne (call $leaf52 (i32.const 52)) (i32.const 209)) (then (unreachable)))
+    (if (i32.ne (call $leaf53 (i32.const 53)) (i32.const 213)) (then (unreachable)))
+    (if (i32.ne (call $leaf54 (i32.const 54)) (i32.const 217)) (then (unreachable)))
+    (if (i32.ne (call $leaf55 (i32.const 55)) (i32.const 221)) (then (unreachable)))
+    (if (i32.ne (call $leaf56 (i32.const 56)) (i32.const 225)) (then (unreachable)))
+    (if (i32.ne (call $leaf57 (i32.const 57)) (i32.const 229)) (then (unreachable)))
+    (if (i32.ne (call $leaf58 (i32.const 58)) (i32.const 233)) (then (unreachable)))
+    (if (i32.ne (call $leaf59 (i32.const 59)) (i32.const 237)) (then (unreachable)))
+    (if (i32.ne (call $leaf60 (i32.const 60)) (i32.const 241)) (then (unreachable)))
+    (if (i32.ne (call $leaf61 (i32.const 61)) (i32.const 245)) (then (unreachable)))
+    (if (i32.ne (call $leaf62 (i32.const 62)) (i32.const 249)) (then (unreachable)))
+    (if (i32.ne (call $leaf63 (i32.const 63)) (i32.const 253)) (then (unreachable)))
+    (if (i32.ne (global.get $acc) (i32.const 2016)) (then (unreachable))))
+
+  (func $leaf0 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf1 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf2 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf3 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf4 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf5 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf6 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf7 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf8 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf9 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf10 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf11 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf12 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf13 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf14 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf15 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf16 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf17 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf18 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf19 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf20 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf21 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf22 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf23 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf24 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf25 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf26 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf27 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf28 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf29 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf30 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf31 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf32 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf33 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf34 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf35 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf36 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf37 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf38 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf39 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf40 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf41 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf42 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf43 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf44 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf45 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf46 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf47 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf48 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf49 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf50 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf51 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf52 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf53 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf54 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf55 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf56 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf57 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf58 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf59 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf60 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf61 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf62 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1)))
+
+  (func $leaf63 (param $x i32) (result i32)
+    (global.set $acc (i32.add (global.get $acc) (local.get $x)))
+    (i32.add (i32.mul (local.get $x) (i32.const 4)) (i32.const 1))))
@@ -0,0 +1,41 @@
+(module
+  ;; `$hot` burns CPU time so ITIMER_PROF ticks land in guest code; `$sleep` then blocks in `poll_oneoff` for 300ms while the
+  ;; sampler is armed. Profiling ticks must neither crash the guest nor cut the sleep short.
+  (import "wasi_snapshot_preview1" "poll_oneoff" (func $poll_oneoff (param i32 i32 i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "clock_time_get" (func $clock_time_get (param i32 i64 i32) (result i32)))
+  (memory (export "memory") 1)
+
+  (func $hot (param $n i32) (result i64)
+    (local $i i32)
+    (local $acc i64)
+    (loop $next
+      ;; An LCG step the optimizer cannot fold away.
+      (local.set $acc (i64.add (i64.mul (local.get $acc) (i64.const 6364136223846793005)) (i64.extend_i32_u (local.get $i))))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $next (i32.lt_u (local.get $i) (local.get $n))))
+    (local.get $acc))
+
+  (func $now (result i64)
+    (if (call $clock_time_get (i32.const 1) (i64.const 0) (i32.const 0x400)) (then (unreachable)))
+    (i64.load (i32.const 0x400)))
+
+  (func $sleep (param $ns i64)
+    ;; One relative clock subscription at 0x100: userdata, tag = clock, id = monotonic, timeout, precision, flags = 0.
+    (i64.store (i32.const 0x100) (i64.const 7))
+    (i32.store8 (i32.const 0x108) (i32.const 0))
+    (i32.store (i32.const 0x110) (i32.const 1))
+    (i64.store (i32.const 0x118) (local.get $ns))
+    (i64.store (i32.const 0x120) (i64.const 0))
+    (i32.store16 (i32.const 0x128) (i32.const 0))
+    (if (call $poll_oneoff (i32.const 0x100) (i32.const 0x200) (i32.const 1) (i32.const 0x300)) (then (unreachable)))
+    (if (i32.ne (i32.load (i32.const 0x300)) (i32.const 1)) (then (unreachable))))
+
+  (func (export "_start")
+    (local $begin i64)
+    (i64.store (i32.const 0x500) (call $hot (i32.const 100000000)))
+
+    (local.set $begin (call $now))
+    (call $sleep (i64.const 300000000))
+    (if (i64.lt_u (i64.sub (call $now) (local.get $begin)) (i64.const 300000000)) (then (unreachable)))
+
+    (i64.store (i32.const 0x508) (call $hot (i32.const 100000000)))))
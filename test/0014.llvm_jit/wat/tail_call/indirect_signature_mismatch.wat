@@ -0,0 +1,20 @@
+(module
+  ;; `$bounce` tail-calls slot 0 (matching signature) and then slot 1, whose function takes an extra parameter: the
+  ;; second `return_call_indirect` must trap with a signature mismatch, never call `$wrong`.
+  (type $t (func (param i32) (result i32)))
+  (type $u (func (param i32 i32) (result i32)))
+  (table 2 funcref)
+  (elem (i32.const 0) $right $wrong)
+
+  (func $right (type $t) (param $x i32) (result i32)
+    (i32.add (local.get $x) (i32.const 1)))
+
+  (func $wrong (type $u) (param $x i32) (param $y i32) (result i32)
+    (i32.add (local.get $x) (local.get $y)))
+
+  (func $bounce (param $slot i32) (param $x i32) (result i32)
+    (return_call_indirect (type $t) (local.get $x) (local.get $slot)))
+
+  (func (export "_start")
+    (if (i32.ne (call $bounce (i32.const 0) (i32.const 41)) (i32.const 42)) (then unreachable))
+    (drop (call $bounce (i32.const 1) (i32.const 41)))))
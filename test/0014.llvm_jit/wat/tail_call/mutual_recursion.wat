@@ -0,0 +1,44 @@
+(module
+  ;; `$even`/`$odd` bounce a million times through `return_call`; `$sum_a`/`$sum_b` do the same through
+  ;; `return_call_indirect`.  Without frame reuse (interpreter) or `musttail` (LLVM JIT) the host stack overflows.
+  (type $acc (func (param i64 i64) (result i64)))
+  (table 2 funcref)
+  (elem (i32.const 0) $sum_a $sum_b)
+
+  (func $even (param $n i64) (result i32)
+    (if (result i32) (i64.eqz (local.get $n))
+      (then (i32.const 1))
+      (else (return_call $odd (i64.sub (local.get $n) (i64.const 1))))))
+
+  (func $odd (param $n i64) (result i32)
+    (if (result i32) (i64.eqz (local.get $n))
+      (then (i32.const 0))
+      (else (return_call $even (i64.sub (local.get $n) (i64.const 1))))))
+
+  (func $sum_a (type $acc) (param $n i64) (param $acc i64) (result i64)
+    (if (result i64) (i64.eqz (local.get $n))
+      (then (local.get $acc))
+      (else
+        (return_call_indirect (type $acc)
+          (i64.sub (local.get $n) (i64.const 1))
+          (i64.add (local.get $acc) (local.get $n))
+          (i32.const 1)))))
+
+  (func $sum_b (type $acc) (param $n i64) (param $acc i64) (result i64)
+    (if (result i64) (i64.eqz (local.get $n))
+      (then (local.get $acc))
+      (else
+        (return_call_indirect (type $acc)
+          (i64.sub (local.get $n) (i64.const 1))
+          (i64.add (local.get $acc) (local.get $n))
+          (i32.const 0)))))
+
+  ;; Different prototype from the caller: no `musttail`, but the result must still be right.
+  (func $widen (param $x i32) (result i64)
+    (return_call $sum_a (i64.extend_i32_u (local.get $x)) (i64.const 0)))
+
+  (func (export "_start")
+    (if (i32.ne (call $even (i64.const 1000000)) (i32.const 1)) (then unreachable))
+    (if (i32.ne (call $even (i64.const 1000001)) (i32.const 0)) (then unreachable))
+    (if (i64.ne (call $sum_a (i64.const 1000000) (i64.const 0)) (i64.const 500000500000)) (then unreachable))
+    (if (i64.ne (call $widen (i32.const 100)) (i64.const 5050)) (then unreachable))))
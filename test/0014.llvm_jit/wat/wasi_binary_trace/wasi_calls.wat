@@ -0,0 +1,21 @@
+(module
+  ;; Three `args_sizes_get` calls and one `fd_write` of "ok\n" to stdout. Every call must return errno 0; the test decodes
+  ;; the binary trace of this run and expects exactly these four records with these arguments.
+  (import "wasi_snapshot_preview1" "args_sizes_get" (func $args_sizes_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_write" (func $fd_write (param i32 i32 i32 i32) (result i32)))
+  (memory (export "memory") 1)
+  (data (i32.const 32) "ok\n")
+
+  (func $check (param $errno i32)
+    (if (local.get $errno) (then (unreachable))))
+
+  (func (export "_start")
+    (call $check (call $args_sizes_get (i32.const 0) (i32.const 4)))
+    (call $check (call $args_sizes_get (i32.const 0) (i32.const 4)))
+    (call $check (call $args_sizes_get (i32.const 0) (i32.const 4)))
+
+    ;; iovec at 16: { buf = 32, len = 3 }; nwritten at 24.
+    (i32.store (i32.const 16) (i32.const 32))
+    (i32.store (i32.const 20) (i32.const 3))
+    (call $check (call $fd_write (i32.const 1) (i32.const 16) (i32.const 1) (i32.const 24)))
+    (if (i32.ne (i32.load (i32.const 24)) (i32.const 3)) (then (unreachable)))))
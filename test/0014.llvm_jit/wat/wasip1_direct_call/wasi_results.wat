@@ -0,0 +1,71 @@
+(module
+  ;; Calls a spread of WASI Preview1 functions (successful and failing, with i32 and i64 parameters) and prints every errno and
+  ;; result word as one hex line on stdout: `wasip1-results <hex>`.  The test runs this with typed direct thunks and with the raw
+  ;; host bridge and expects the same line from both.
+  (import "wasi_snapshot_preview1" "args_sizes_get" (func $args_sizes_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "args_get" (func $args_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "environ_sizes_get" (func $environ_sizes_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_fdstat_get" (func $fd_fdstat_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_close" (func $fd_close (param i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_seek" (func $fd_seek (param i32 i64 i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_prestat_get" (func $fd_prestat_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "clock_res_get" (func $clock_res_get (param i32 i32) (result i32)))
+  (import "wasi_snapshot_preview1" "fd_write" (func $fd_write (param i32 i32 i32 i32) (result i32)))
+  (memory (export "memory") 1)
+  (data (i32.const 4096) "wasip1-results ")
+
+  ;; Result record at 1024, 56 bytes:
+  ;;   +0 args_sizes_get errno  +4 argc  +8 argv_buf_size  +12 args_get errno  +16 byte sum of the argv buffer
+  ;;   +20 environ_sizes_get errno  +24 fd_fdstat_get(1) errno  +28 fd 1 filetype  +32 fd_close(1000) errno
+  ;;   +36 clock_res_get errno  +40 monotonic clock resolution (i64)  +48 fd_seek(1000) errno  +52 fd_prestat_get(1000) errno
+  (func $hex_digit (param $d i32) (result i32)
+    (i32.add (local.get $d) (select (i32.const 48) (i32.const 87) (i32.lt_u (local.get $d) (i32.const 10)))))
+
+  (func $hex (param $src i32) (param $len i32) (param $dst i32)
+    (local $i i32)
+    (local $byte i32)
+    (block $done
+      (loop $next
+        (br_if $done (i32.ge_u (local.get $i) (local.get $len)))
+        (local.set $byte (i32.load8_u (i32.add (local.get $src) (local.get $i))))
+        (i32.store8 (i32.add (local.get $dst) (i32.shl (local.get $i) (i32.const 1)))
+                    (call $hex_digit (i32.shr_u (local.get $byte) (i32.const 4))))
+        (i32.store8 (i32.add (local.get $dst) (i32.add (i32.shl (local.get $i) (i32.const 1)) (i32.const 1)))
+                    (call $hex_digit (i32.and (local.get $byte) (i32.const 15))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br $next))))
+
+  (func (export "_start")
+    (local $i i32)
+    (local $sum i32)
+    (i32.store (i32.const 1024) (call $args_sizes_get (i32.const 1028) (i32.const 1032)))
+
+    ;; argv pointers at 2048, argv strings at 2304.
+    (i32.store (i32.const 1036) (call $args_get (i32.const 2048) (i32.const 2304)))
+    (block $done
+      (loop $next
+        (br_if $done (i32.ge_u (local.get $i) (i32.load (i32.const 1032))))
+        (local.set $sum (i32.add (local.get $sum) (i32.load8_u (i32.add (i32.const 2304) (local.get $i)))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br $next)))
+    (i32.store (i32.const 1040) (local.get $sum))
+
+    ;; environ counts land in scratch at 2560; only the errno is recorded, the counts follow the host environment.
+    (i32.store (i32.const 1044) (call $environ_sizes_get (i32.const 2560) (i32.const 2564)))
+
+    ;; fdstat at 2576 (24 bytes, filetype in the first byte).
+    (i32.store (i32.const 1048) (call $fd_fdstat_get (i32.const 1) (i32.const 2576)))
+    (i32.store (i32.const 1052) (i32.load8_u (i32.const 2576)))
+
+    (i32.store (i32.const 1056) (call $fd_close (i32.const 1000)))
+    (i32.store (i32.const 1060) (call $clock_res_get (i32.const 1) (i32.const 1064)))
+    (i32.store (i32.const 1072) (call $fd_seek (i32.const 1000) (i64.const -4) (i32.const 1) (i32.const 2600)))
+    (i32.store (i32.const 1076) (call $fd_prestat_get (i32.const 1000) (i32.const 2608)))
+
+    ;; "wasip1-results " (15 bytes) + 112 hex digits + "\n" at 4096; iovec at 16, nwritten at 24.
+    (call $hex (i32.const 1024) (i32.const 56) (i32.const 4111))
+    (i32.store8 (i32.const 4223) (i32.const 10))
+    (i32.store (i32.const 16) (i32.const 4096))
+    (i32.store (i32.const 20) (i32.const 128))
+    (if (call $fd_write (i32.const 1) (i32.const 16) (i32.const 1) (i32.const 24)) (then (unreachable)))
+    (if (i32.ne (i32.load (i32.const 24)) (i32.const 128)) (then (unreachable)))))
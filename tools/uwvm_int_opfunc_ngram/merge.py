@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+from dataclasses import dataclass
+from typing import Dict, List, Sequence, Tuple
+
+
+class ReportParseError(RuntimeError):
+    pass
+
+
+@dataclass
+class Report:
+    path: str
+    dispatches: int
+    counts: Dict[Tuple[int, str], int]
+
+
+def read_report(path: str) -> Report:
+    dispatches = None
+    counts: Dict[Tuple[int, str], int] = {}
+    with open(path, "r", encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line:
+                continue
+            if line.startswith("#"):
+                fields = line[1:].strip().split("\t")
+                if len(fields) == 2 and fields[0] == "dispatches":
+                    dispatches = int(fields[1])
+                continue
+            fields = line.split("\t")
+            if len(fields) != 5:
+                raise ReportParseError(f"{path}:{lineno}: expected 5 tab-separated columns, got {len(fields)}")
+            key = (int(fields[0]), fields[4])
+            counts[key] = counts.get(key, 0) + int(fields[1])
+    if dispatches is None:
+        raise ReportParseError(f"{path}: missing '# dispatches' header")
+    return Report(path, dispatches, counts)
+
+
+def merge(reports: Sequence[Report], normalize: bool) -> Tuple[float, Dict[Tuple[int, str], float]]:
+    # With --normalize every workload contributes the same weight (its counts are scaled to 1e9 dispatches),
+    # so one long-running benchmark cannot drown out the others.
+    total = 0.0
+    merged: Dict[Tuple[int, str], float] = {}
+    for r in reports:
+        scale = (1e9 / r.dispatches) if (normalize and r.dispatches) else 1.0
+        total += r.dispatches * scale
+        for key, count in r.counts.items():
+            merged[key] = merged.get(key, 0.0) + count * scale
+    return total, merged
+
+
+def ranked(merged: Dict[Tuple[int, str], float], min_n: int) -> List[Tuple[int, str, float, float]]:
+    rows = [(n, seq, count, count * (n - 1)) for (n, seq), count in merged.items() if n >= min_n]
+    # Same order as the runtime report: fusion candidates by saved dispatches, then single opfuncs by count.
+    rows.sort(key=lambda r: (r[0] == 1, -(r[3] if r[0] != 1 else r[2]), r[1]))
+    return rows
+
+
+def main(argv: Sequence[str]) -> int:
+    ap = argparse.ArgumentParser(description="Merge uwvm-int opfunc n-gram profiles (--runtime-uwvm-int-opfunc-profile) into one ranking.")
+    ap.add_argument("reports", nargs="+", help="report files written by uwvm")
+    ap.add_argument("--normalize", action="store_true", help="weight every report equally instead of by dispatch count")
+    ap.add_argument("--min-n", type=int, default=1, help="drop sequences shorter than this (default: 1)")
+    ap.add_argument("--top", type=int, default=0, help="print only the first N rows (default: all)")
+    ap.add_argument("--json", action="store_true", help="output JSON")
+    args = ap.parse_args(argv)
+
+    try:
+        reports = [read_report(p) for p in args.reports]
+    except (OSError, ValueError, ReportParseError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+
+    total, merged = merge(reports, args.normalize)
+    rows = ranked(merged, args.min_n)
+    if args.top > 0:
+        rows = rows[: args.top]
+
+    if args.json:
+        out = {
+            "reports": [r.path for r in reports],
+            "dispatches": total,
+            "rows": [
+                {"n": n, "count": count, "saved_dispatches": saved, "saved_percent": (100.0 * saved / total) if total else 0.0, "sequence": seq.split(" ")}
+                for n, seq, count, saved in rows
+            ],
+        }
+        json.dump(out, sys.stdout, indent=2)
+        sys.stdout.write("\n")
+        return 0
+
+    print("# uwvm-int opfunc n-gram profile (merged)")
+    print(f"# reports\t{len(reports)}")
+    print(f"# dispatches\t{total:.0f}")
+    print("# n\tcount\tsaved_dispatches\tsaved_percent\tsequence")
+    for n, seq, count, saved in rows:
+        pct = (100.0 * saved / total) if total else 0.0
+        print(f"{n}\t{count:.0f}\t{saved:.0f}\t{pct:.2f}\t{seq}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -202,6 +202,16 @@ function def_build(opt)
 		add_defines("UWVM_ENABLE_UWVM_INT_LOOP_UNWIND")
 	end
 
+	local enable_uwvm_int_pin_memory0 = get_config("enable-uwvm-int-pin-memory0")
+	if enable_uwvm_int_pin_memory0 then
+		add_defines("UWVM_ENABLE_UWVM_INT_PIN_MEMORY0")
+	end
+
+	local enable_uwvm_int_opfunc_profile = get_config("enable-uwvm-int-opfunc-profile")
+	if enable_uwvm_int_opfunc_profile then
+		add_defines("UWVM_ENABLE_UWVM_INT_OPFUNC_PROFILE")
+	end
+
 	local use_thread_local = get_config("use-thread-local")
 	if use_thread_local then
 		add_defines("UWVM_USE_THREAD_LOCAL")
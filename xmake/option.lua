@@ -302,6 +302,28 @@ option("enable-uwvm-int-loop-unwind", function()
     set_default(true)
 end)
 
+option("enable-uwvm-int-pin-memory0", function()
+    set_description
+    (
+        "Pin memory0 begin/end in uwvm-int tail-call arguments on 8-integer-argument ABIs (aarch64, riscv64, loongarch64).",
+        "default = false",
+        "    false: keep every spare integer argument register for the i32/i64 stack-top ring.",
+        "    true: trade two ring registers for pinned memory0 slots; only dynamic-length mmap memories use them."
+    )
+    set_default(false)
+end)
+
+option("enable-uwvm-int-opfunc-profile", function()
+    set_description
+    (
+        "Build the uwvm-int opfunc n-gram profiler (--runtime-uwvm-int-opfunc-profile).",
+        "default = false",
+        "    false: no profiling code is compiled in.",
+        "    true: the translator can prefix every opfunc with a counting probe; link with -rdynamic to get symbol names in the report."
+    )
+    set_default(false)
+end)
+
 option("detailed-debug-check", function()
     set_description
     (
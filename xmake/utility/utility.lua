@@ -9,6 +9,7 @@ local llvm_jit_required_components = {
     "linker",
     "executionengine",
     "mcjit",
+    "orcjit",
     "runtimedyld",
     "passes",
     "scalaropts",
@@ -21,7 +22,11 @@ local llvm_jit_required_components = {
 }
 
 local llvm_jit_optional_components = {
-    "targetparser"
+    "targetparser",
+    -- Profiler JIT event listeners; only present when LLVM itself was configured with them.
+    "perfjitevents",
+    "inteljitevents",
+    "oprofilejit"
 }
 
 local llvm_jit_terminal_component_candidates = {
@@ -37,10 +42,14 @@ local llvm_component_link_names = {
     debuginfodwarf = { "LLVMDebugInfoDWARF" },
     executionengine = { "LLVMExecutionEngine" },
     instcombine = { "LLVMInstCombine" },
+    inteljitevents = { "LLVMIntelJITEvents" },
     linker = { "LLVMLinker" },
     mcjit = { "LLVMMCJIT" },
     object = { "LLVMObject" },
+    oprofilejit = { "LLVMOProfileJIT" },
+    orcjit = { "LLVMOrcJIT", "LLVMOrcShared", "LLVMOrcTargetProcess" },
     passes = { "LLVMPasses" },
+    perfjitevents = { "LLVMPerfJITEvents" },
     runtimedyld = { "LLVMRuntimeDyld" },
     scalaropts = { "LLVMScalarOpts" },
     support = { "LLVMSupport" },
@@ -910,9 +919,9 @@ function get_llvm_jit_options()
 
     -- Some LLVM builds omit explicit JIT driver libraries and/or the native
     -- target codegen family from component queries. Re-add them explicitly so
-    -- MCJIT-backed runtime linking remains stable across LLVM distributions.
+    -- MCJIT/ORC-backed runtime linking remains stable across LLVM distributions.
     local apple_process_target_codegen = _llvm_jit_uses_apple_process_target_codegen()
-    local explicit_jit_components = { "executionengine", "mcjit" }
+    local explicit_jit_components = { "executionengine", "mcjit", "orcjit" }
     if apple_process_target_codegen and host_target_components and #host_target_components ~= 0 then
         explicit_jit_components = table.join(explicit_jit_components, host_target_components)
     else
@@ -925,13 +934,14 @@ function get_llvm_jit_options()
         explicit_jit_args = _llvm_link_query_args(link_static, _llvm_library_query(link_static), {
             "executionengine",
             "mcjit",
+            "orcjit",
             "native"
         })
         explicit_jit_libs = link_static and _run_required_llvm_link_query(llvm_config, explicit_jit_args)
             or (_run_llvm_config(llvm_config, explicit_jit_args) or "")
     end
     if not link_static and explicit_jit_libs and explicit_jit_libs ~= "" and host_target_components and #host_target_components ~= 0 then
-        local explicit_direct_link_names = _llvm_direct_link_names({ "executionengine", "mcjit" }, host_target_components)
+        local explicit_direct_link_names = _llvm_direct_link_names({ "executionengine", "mcjit", "orcjit" }, host_target_components)
         local explicit_direct_jit_libs = _filter_llvm_dynamic_link_flags(explicit_jit_libs, explicit_direct_link_names)
         if explicit_direct_jit_libs ~= "" then
             explicit_jit_libs = explicit_direct_jit_libs